@@ -0,0 +1,624 @@
+/**
+ * @file scheduler_benchmark.cpp
+ * @brief 任务调度器执行层性能基准
+ *
+ * 对比工作窃取线程池与"每个任务创建一个分离线程"的执行方式：
+ * - 提交到开始执行的延迟（单任务往返，手动计时）
+ * - 外部线程批量提交小任务的吞吐量随工作线程数的变化
+ * - 任务内部递归派生子任务（分叉）时的吞吐量，考察本地队列与窃取
+ * - 分级无锁优先级队列在多线程竞争下的入队/出队吞吐量
+ * - 调度器submitTask（ScheduledTask + promise映射表）与免分配轻量任务的提交吞吐量
+ * - 长任务按分片让出时，关键任务从提交到开始执行的抢占延迟随分片长度的变化
+ * - 调度策略矩阵：fifo/priority/edf/公平共享 × 微任务/100微秒任务 × 1~64个生产者线程，
+ *   分别测量提交吞吐量、提交到开始执行的延迟与future兑现的端到端延迟（含p50/p99）
+ *
+ * 运行示例：
+ * @code
+ * ./radar_scheduler_bench --benchmark_format=json --benchmark_out=scheduler.json
+ * ./radar_scheduler_bench --benchmark_filter=Matrix --benchmark_out=scheduler.json
+ * @endcode
+ *
+ * 调度器改动前后各输出一份JSON，用Google Benchmark自带的tools/compare.py对比：
+ * @code
+ * compare.py benchmarks before.json after.json
+ * @endcode
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include <benchmark/benchmark.h>
+#include "modules/task_scheduler/task_scheduler_implementations.h"
+#include "modules/task_scheduler/work_stealing_pool.h"
+#include "common/logger.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace radar;
+using namespace radar::common;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// 吞吐量基准每批提交的任务数
+    constexpr int64_t BATCH_TASKS = 10000;
+
+    /// 分叉基准的递归深度（叶子任务数为2^depth）
+    constexpr int FAN_OUT_DEPTH = 12;
+
+    /// 抢占延迟基准中低优先级长任务的总时长
+    constexpr std::chrono::milliseconds PREEMPTION_LONG_TASK{20};
+
+    /// 策略矩阵中每个生产者每批提交的任务数
+    constexpr int64_t PRODUCER_BATCH = 64;
+
+    /// 策略矩阵的最大生产者线程数
+    constexpr int MAX_PRODUCERS = 64;
+
+    /// 策略矩阵的工作线程数（固定，便于跨策略、跨版本比较）
+    constexpr uint32_t MATRIX_WORKERS = 4;
+
+    /**
+     * @brief 策略矩阵中的一种调度策略
+     */
+    struct StrategyCase
+    {
+        const char *name;   ///< 结果标签
+        const char *policy; ///< 对应的schedulingPolicy
+        bool fairShare;     ///< 是否把生产者分给两个租户（权重1:3）并启用公平共享
+    };
+
+    /// 参与对比的调度策略，基准参数strategy为下标
+    constexpr StrategyCase STRATEGY_CASES[] = {
+        {"fifo", "fifo", false},
+        {"priority", "priority", false},
+        {"edf", "edf", false},
+        {"fair_share", "fifo", true},
+    };
+
+    /// 策略矩阵的生产者线程共享的调度器，由0号线程在计时循环前后创建和销毁
+    ThreadPoolScheduler *matrixScheduler = nullptr;
+
+    /**
+     * @brief 启动执行ScheduledTask的线程池
+     */
+    void startPool(WorkStealingPool &pool, uint32_t threads)
+    {
+        WorkStealingPoolConfig config;
+        config.threadCount = threads;
+        config.name = "bench-pool";
+        pool.start(config, [](ScheduledTaskPtr task)
+                   { task->execute(); });
+    }
+
+    /**
+     * @brief 启动FIFO策略的线程池调度器
+     */
+    void startScheduler(ThreadPoolScheduler &scheduler, uint32_t threads)
+    {
+        TaskSchedulerConfig config;
+        config.coreThreads = threads;
+        config.maxThreads = threads;
+        config.schedulingPolicy = "fifo";
+        scheduler.configure(config);
+        scheduler.initialize();
+        scheduler.start();
+    }
+
+    /**
+     * @brief 自旋等待计数达到目标
+     */
+    void waitFor(const std::atomic<int64_t> &counter, int64_t target)
+    {
+        while (counter.load(std::memory_order_acquire) < target)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief 忙等一段时间（模拟计算密集的分片）
+     */
+    void spinFor(Clock::duration duration)
+    {
+        const auto end = Clock::now() + duration;
+        while (Clock::now() < end)
+        {
+        }
+    }
+
+    /**
+     * @brief 计算样本的分位数（会重排样本）
+     */
+    double percentile(std::vector<double> &samples, double quantile)
+    {
+        if (samples.empty())
+        {
+            return 0.0;
+        }
+        const size_t rank = std::min(samples.size() - 1, static_cast<size_t>(quantile * samples.size()));
+        std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+        return samples[rank];
+    }
+
+    /**
+     * @brief 0号线程按参数strategy启动共享调度器，其余线程在计时循环入口的屏障处等待
+     */
+    void setUpMatrix(benchmark::State &state)
+    {
+        if (state.thread_index() != 0)
+        {
+            return;
+        }
+
+        const StrategyCase &strategy = STRATEGY_CASES[state.range(0)];
+        TaskSchedulerConfig config;
+        config.coreThreads = MATRIX_WORKERS;
+        config.maxThreads = MATRIX_WORKERS;
+        config.schedulingPolicy = strategy.policy;
+        // 所有生产者各积压一批也不触发准入拒绝，测的是调度开销而不是背压
+        config.queueCapacity = static_cast<uint32_t>(MAX_PRODUCERS * PRODUCER_BATCH * 2);
+        config.queueFullPolicy = "block";
+        if (strategy.fairShare)
+        {
+            config.tenants = {{1, "sensor-1", 1}, {2, "sensor-2", 3}};
+        }
+
+        matrixScheduler = new ThreadPoolScheduler(MATRIX_WORKERS);
+        matrixScheduler->configure(config);
+        matrixScheduler->initialize();
+        matrixScheduler->start();
+        state.SetLabel(std::string(strategy.name) + (state.range(1) > 0 ? "/busy" : "/tiny"));
+    }
+
+    /**
+     * @brief 0号线程在计时循环结束（所有线程都已退出循环）后销毁共享调度器
+     */
+    void tearDownMatrix(benchmark::State &state)
+    {
+        if (state.thread_index() != 0)
+        {
+            return;
+        }
+        matrixScheduler->stop();
+        delete matrixScheduler;
+        matrixScheduler = nullptr;
+    }
+
+    /**
+     * @brief 以生产者线程对应的优先级和租户提交一个任务
+     */
+    Future<void> submitMatrixTask(const benchmark::State &state, std::function<void()> task)
+    {
+        const int producer = state.thread_index();
+        const auto priority = static_cast<PacketPriority>(producer % TASK_PRIORITY_LEVELS);
+        const TenantId tenant = STRATEGY_CASES[state.range(0)].fairShare ? 1 + producer % 2 : DEFAULT_TENANT;
+        return matrixScheduler->submitTenantTask(tenant, std::move(task), priority);
+    }
+
+    /**
+     * @brief 提交单个任务并等待兑现，计时到任务开始执行或future兑现
+     */
+    void runMatrixLatency(benchmark::State &state, bool untilResolved)
+    {
+        setUpMatrix(state);
+        const auto work = std::chrono::microseconds(state.range(1));
+
+        std::vector<double> samplesUs;
+        for (auto _ : state)
+        {
+            Clock::time_point started;
+            const auto submitted = Clock::now();
+            submitMatrixTask(state, [&started, work]()
+                             {
+                started = Clock::now();
+                spinFor(work); })
+                .get();
+
+            const double seconds =
+                std::chrono::duration<double>((untilResolved ? Clock::now() : started) - submitted).count();
+            state.SetIterationTime(seconds);
+            samplesUs.push_back(seconds * 1e6);
+        }
+
+        // 多生产者时框架把计时总和按全部线程的迭代数平均，单次请求的延迟以这几个计数器为准
+        const double meanUs =
+            samplesUs.empty() ? 0.0 : std::accumulate(samplesUs.begin(), samplesUs.end(), 0.0) / samplesUs.size();
+        state.counters["mean_us"] = benchmark::Counter(meanUs, benchmark::Counter::kAvgThreads);
+        state.counters["p50_us"] = benchmark::Counter(percentile(samplesUs, 0.50), benchmark::Counter::kAvgThreads);
+        state.counters["p99_us"] = benchmark::Counter(percentile(samplesUs, 0.99), benchmark::Counter::kAvgThreads);
+        tearDownMatrix(state);
+    }
+
+    /**
+     * @brief 策略矩阵参数：strategy × work_us（0为微任务）× 1~64个生产者线程
+     */
+    void matrixArguments(benchmark::internal::Benchmark *bench)
+    {
+        bench->ArgNames({"strategy", "work_us"});
+        for (int64_t strategy = 0; strategy < static_cast<int64_t>(std::size(STRATEGY_CASES)); ++strategy)
+        {
+            for (int64_t workUs : {0, 100})
+            {
+                bench->Args({strategy, workUs});
+            }
+        }
+        bench->ThreadRange(1, MAX_PRODUCERS);
+    }
+
+    /**
+     * @brief 递归派生两个子任务，叶子节点计数
+     */
+    void fanOut(WorkStealingPool &pool, std::atomic<int64_t> &leaves, int depth)
+    {
+        if (depth == 0)
+        {
+            leaves.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        for (int i = 0; i < 2; ++i)
+        {
+            pool.submit(std::make_shared<ScheduledTask>([&pool, &leaves, depth]()
+                                                        { fanOut(pool, leaves, depth - 1); }));
+        }
+    }
+
+} // anonymous namespace
+
+/**
+ * @brief 工作窃取线程池：提交到开始执行的延迟
+ */
+static void BM_WorkStealingSubmitToStart(benchmark::State &state)
+{
+    WorkStealingPool pool;
+    startPool(pool, static_cast<uint32_t>(state.range(0)));
+
+    std::atomic<int64_t> started{0};
+    std::atomic<Clock::rep> startTime{0};
+    int64_t expected = 0;
+    for (auto _ : state)
+    {
+        auto task = std::make_shared<ScheduledTask>([&]()
+                                                    {
+            startTime.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+            started.fetch_add(1, std::memory_order_release); });
+
+        const auto submitTime = Clock::now();
+        pool.submit(std::move(task));
+        waitFor(started, ++expected);
+
+        const Clock::time_point begin{Clock::duration(startTime.load(std::memory_order_relaxed))};
+        state.SetIterationTime(std::chrono::duration<double>(begin - submitTime).count());
+    }
+
+    pool.stop();
+    state.counters["parks"] = static_cast<double>(pool.getStatistics().parks);
+}
+BENCHMARK(BM_WorkStealingSubmitToStart)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseManualTime();
+
+/**
+ * @brief 分离线程（原执行方式）：提交到开始执行的延迟
+ */
+static void BM_DetachedThreadSubmitToStart(benchmark::State &state)
+{
+    std::atomic<int64_t> started{0};
+    std::atomic<Clock::rep> startTime{0};
+    int64_t expected = 0;
+    for (auto _ : state)
+    {
+        const auto submitTime = Clock::now();
+        std::thread([&]()
+                    {
+            startTime.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+            started.fetch_add(1, std::memory_order_release); })
+            .detach();
+        waitFor(started, ++expected);
+
+        const Clock::time_point begin{Clock::duration(startTime.load(std::memory_order_relaxed))};
+        state.SetIterationTime(std::chrono::duration<double>(begin - submitTime).count());
+    }
+}
+BENCHMARK(BM_DetachedThreadSubmitToStart)->UseManualTime();
+
+/**
+ * @brief 工作窃取线程池：外部线程批量提交小任务的吞吐量
+ */
+static void BM_WorkStealingThroughput(benchmark::State &state)
+{
+    WorkStealingPool pool;
+    startPool(pool, static_cast<uint32_t>(state.range(0)));
+
+    std::atomic<int64_t> done{0};
+    int64_t expected = 0;
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < BATCH_TASKS; ++i)
+        {
+            pool.submit(std::make_shared<ScheduledTask>([&done]()
+                                                        { done.fetch_add(1, std::memory_order_release); }));
+        }
+        expected += BATCH_TASKS;
+        waitFor(done, expected);
+    }
+
+    pool.stop();
+    const auto stats = pool.getStatistics();
+    state.SetItemsProcessed(state.iterations() * BATCH_TASKS);
+    state.counters["steals"] = static_cast<double>(stats.successfulSteals);
+    state.counters["parks"] = static_cast<double>(stats.parks);
+}
+BENCHMARK(BM_WorkStealingThroughput)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+/**
+ * @brief 工作窃取线程池：任务内部递归派生子任务的吞吐量
+ */
+static void BM_WorkStealingFanOut(benchmark::State &state)
+{
+    WorkStealingPool pool;
+    startPool(pool, static_cast<uint32_t>(state.range(0)));
+
+    std::atomic<int64_t> leaves{0};
+    int64_t expected = 0;
+    for (auto _ : state)
+    {
+        pool.submit(std::make_shared<ScheduledTask>([&pool, &leaves]()
+                                                    { fanOut(pool, leaves, FAN_OUT_DEPTH); }));
+        expected += int64_t{1} << FAN_OUT_DEPTH;
+        waitFor(leaves, expected);
+    }
+
+    pool.stop();
+    const auto stats = pool.getStatistics();
+    // 每棵树共2^(depth+1)-1个任务
+    state.SetItemsProcessed(state.iterations() * ((int64_t{2} << FAN_OUT_DEPTH) - 1));
+    state.counters["stolen"] = static_cast<double>(stats.stolenTasks);
+}
+BENCHMARK(BM_WorkStealingFanOut)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+/**
+ * @brief 调度器常规路径：submitTask批量提交并等待全部future
+ */
+static void BM_SchedulerSubmitTask(benchmark::State &state)
+{
+    ThreadPoolScheduler scheduler(static_cast<uint32_t>(state.range(0)));
+    startScheduler(scheduler, static_cast<uint32_t>(state.range(0)));
+
+    std::atomic<int64_t> done{0};
+    std::vector<Future<void>> futures;
+    futures.reserve(BATCH_TASKS);
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < BATCH_TASKS; ++i)
+        {
+            futures.push_back(scheduler.submitTask([&done]()
+                                                   { done.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto &future : futures)
+        {
+            future.get();
+        }
+        futures.clear();
+    }
+
+    scheduler.stop();
+    state.SetItemsProcessed(state.iterations() * BATCH_TASKS);
+}
+BENCHMARK(BM_SchedulerSubmitTask)->Arg(1)->Arg(4)->UseRealTime();
+
+/**
+ * @brief 调度器轻量路径：submitLightTask批量提交并等待全部句柄
+ */
+static void BM_SchedulerSubmitLightTask(benchmark::State &state)
+{
+    ThreadPoolScheduler scheduler(static_cast<uint32_t>(state.range(0)));
+    startScheduler(scheduler, static_cast<uint32_t>(state.range(0)));
+
+    std::atomic<int64_t> done{0};
+    std::vector<LightTaskFuture> futures;
+    futures.reserve(BATCH_TASKS);
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < BATCH_TASKS; ++i)
+        {
+            futures.push_back(scheduler.submitLightTask([&done]()
+                                                        { done.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto &future : futures)
+        {
+            future.get();
+        }
+        futures.clear();
+    }
+
+    scheduler.stop();
+    state.SetItemsProcessed(state.iterations() * BATCH_TASKS);
+}
+BENCHMARK(BM_SchedulerSubmitLightTask)->Arg(1)->Arg(4)->UseRealTime();
+
+/**
+ * @brief 策略矩阵：每个生产者批量提交并等待兑现的吞吐量，submit_ns为单次提交调用的平均耗时
+ */
+static void BM_SchedulerMatrixThroughput(benchmark::State &state)
+{
+    setUpMatrix(state);
+    const auto work = std::chrono::microseconds(state.range(1));
+
+    std::vector<Future<void>> futures;
+    futures.reserve(PRODUCER_BATCH);
+    Clock::duration submitTime{};
+    for (auto _ : state)
+    {
+        const auto begin = Clock::now();
+        for (int64_t i = 0; i < PRODUCER_BATCH; ++i)
+        {
+            futures.push_back(submitMatrixTask(state, [work]()
+                                               { spinFor(work); }));
+        }
+        submitTime += Clock::now() - begin;
+
+        for (auto &future : futures)
+        {
+            future.get();
+        }
+        futures.clear();
+    }
+
+    const int64_t submitted = state.iterations() * PRODUCER_BATCH;
+    state.SetItemsProcessed(submitted);
+    state.counters["submit_ns"] = benchmark::Counter(
+        submitted > 0 ? std::chrono::duration<double, std::nano>(submitTime).count() / submitted : 0.0,
+        benchmark::Counter::kAvgThreads);
+    tearDownMatrix(state);
+}
+BENCHMARK(BM_SchedulerMatrixThroughput)->Apply(matrixArguments)->UseRealTime();
+
+/**
+ * @brief 策略矩阵：从提交到任务开始执行的延迟
+ */
+static void BM_SchedulerMatrixSubmitToStart(benchmark::State &state)
+{
+    runMatrixLatency(state, false);
+}
+BENCHMARK(BM_SchedulerMatrixSubmitToStart)
+    ->Apply(matrixArguments)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief 策略矩阵：从提交到future兑现、调用者被唤醒的端到端延迟
+ */
+static void BM_SchedulerMatrixFutureResolution(benchmark::State &state)
+{
+    runMatrixLatency(state, true);
+}
+BENCHMARK(BM_SchedulerMatrixFutureResolution)
+    ->Apply(matrixArguments)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief 检查点抢占延迟：单工作线程上20ms的低优先级长任务按参数（微秒）分片，
+ *        执行中提交关键任务，计时从提交到关键任务开始执行；参数20000相当于不分片
+ */
+static void BM_CheckpointPreemptionLatency(benchmark::State &state)
+{
+    const auto chunk = std::chrono::microseconds(state.range(0));
+
+    ThreadPoolScheduler scheduler(1);
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+    config.schedulingPolicy = "priority";
+    scheduler.configure(config);
+    scheduler.initialize();
+    scheduler.start();
+
+    for (auto _ : state)
+    {
+        std::atomic<bool> started{false};
+        auto bulk = scheduler.submitResumableTask(
+            [&started, chunk, end = Clock::time_point{}]() mutable
+            {
+                if (!started.load(std::memory_order_relaxed))
+                {
+                    end = Clock::now() + PREEMPTION_LONG_TASK;
+                    started.store(true, std::memory_order_release);
+                }
+                spinFor(std::min<Clock::duration>(chunk, end - Clock::now()));
+                return Clock::now() >= end;
+            },
+            PacketPriority::LOW);
+        while (!started.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+
+        Clock::time_point ran;
+        const auto submitted = Clock::now();
+        scheduler.submitTask([&ran]()
+                             { ran = Clock::now(); },
+                             PacketPriority::CRITICAL)
+            .get();
+        state.SetIterationTime(std::chrono::duration<double>(ran - submitted).count());
+        bulk.get();
+    }
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    scheduler.stop();
+    state.counters["preemptions"] = static_cast<double>(status.preemptions);
+    state.counters["max_latency_us"] = static_cast<double>(status.maxPreemptionLatencyUs);
+}
+BENCHMARK(BM_CheckpointPreemptionLatency)
+    ->Arg(50)
+    ->Arg(200)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Iterations(25) // 计时只含抢占延迟，每次迭代却要跑完20ms长任务，固定迭代次数
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief 分级无锁优先级队列：多线程并发入队+出队
+ */
+static void BM_PriorityTaskQueuePushPop(benchmark::State &state)
+{
+    static PriorityTaskQueue *queue = nullptr;
+    static std::vector<ScheduledTaskPtr> tasks;
+    if (state.thread_index() == 0)
+    {
+        queue = new PriorityTaskQueue(4096);
+        tasks.clear();
+        for (size_t i = 0; i < 64; ++i)
+        {
+            tasks.push_back(std::make_shared<ScheduledTask>([]() {},
+                                                            static_cast<PacketPriority>(i % TASK_PRIORITY_LEVELS)));
+        }
+    }
+
+    size_t next = static_cast<size_t>(state.thread_index());
+    ScheduledTaskPtr task;
+    for (auto _ : state)
+    {
+        queue->enqueue(tasks[next++ % tasks.size()]);
+        queue->dequeue(task, 0);
+        benchmark::DoNotOptimize(task.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+    if (state.thread_index() == 0)
+    {
+        delete queue;
+        queue = nullptr;
+    }
+}
+BENCHMARK(BM_PriorityTaskQueuePushPop)->ThreadRange(1, 8)->UseRealTime();
+
+int main(int argc, char **argv)
+{
+    // 任务与线程池会输出日志，需要先初始化日志系统
+    LoggerConfig logConfig;
+    logConfig.console.enabled = true;
+    logConfig.file.enabled = false;
+    logConfig.globalLevel = LogLevel::WARN;
+    LoggerManager::getInstance().initialize(logConfig);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    LoggerManager::getInstance().shutdown();
+    return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file backpressure.h
+ * @brief 基于信用的背压信号
+ *
+ * 下游（任务调度器）按等待队列容量发放信用，每个排队中的任务占用一个信用，
+ * 任务出队执行时归还。上游（数据接收器）在生成或入队数据前查询剩余信用，
+ * 据此放慢采集或在边缘丢弃，而不是把积压一路推进调度器：
+ * - 查询只读一个原子变量，可以在每个数据包上调用
+ * - 占用与归还是无锁的，只有阻塞等待信用的线程才进入内核
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see TaskScheduler::getBackpressureSignal
+ * @see IDataReceiver::setBackpressureSignal
+ */
+
+#pragma once
+
+#include "common/event_count.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace radar
+{
+
+    /**
+     * @brief 上游在下游无信用时的处理方式
+     */
+    enum class BackpressurePolicy
+    {
+        NONE,     ///< 忽略背压
+        THROTTLE, ///< 节流：等待信用（有上限），超时后照常交付
+        DROP      ///< 在边缘丢弃，不占用上游缓冲和下游队列
+    };
+
+    /**
+     * @brief 解析配置中的背压策略名称
+     * @param name 策略名称（none/throttle/drop）
+     * @return 策略，无法识别时为NONE
+     */
+    BackpressurePolicy parseBackpressurePolicy(const std::string &name);
+
+    /**
+     * @brief 信用池
+     *
+     * 容量为0表示不限：占用照常计数，但永远有信用。
+     *
+     * @note 所有公共方法都是线程安全的
+     */
+    class BackpressureSignal
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 信用总数（0表示不限）
+         */
+        explicit BackpressureSignal(uint32_t capacity);
+
+        BackpressureSignal(const BackpressureSignal &) = delete;
+        BackpressureSignal &operator=(const BackpressureSignal &) = delete;
+
+        /**
+         * @brief 获取信用总数
+         * @return 信用总数
+         */
+        uint32_t getCapacity() const { return capacity_; }
+
+        /**
+         * @brief 获取已占用的信用数
+         * @return 占用数
+         */
+        uint32_t getOccupancy() const { return occupancy_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief 获取剩余信用数
+         * @return 剩余信用数，不限容量时为UINT32_MAX
+         */
+        uint32_t getCredits() const;
+
+        /**
+         * @brief 检查是否还有信用
+         * @return 是否有信用
+         */
+        bool hasCredit() const { return getCredits() > 0; }
+
+        /**
+         * @brief 获取占用率
+         * @return 0~1，不限容量时为0
+         */
+        double getOccupancyRatio() const;
+
+        /**
+         * @brief 在占用数低于上限时占用一个信用
+         * @param limit 占用上限（不超过容量，用于按优先级分级准入）
+         * @return 是否占用成功
+         */
+        bool tryAcquire(uint32_t limit);
+
+        /**
+         * @brief 占用一个信用，不足时阻塞等待
+         * @param limit 占用上限
+         * @param timeout 最长等待时间
+         * @return 是否占用成功（超时返回false）
+         */
+        bool acquire(uint32_t limit, std::chrono::milliseconds timeout);
+
+        /**
+         * @brief 归还一个信用并唤醒等待者
+         */
+        void release();
+
+        /**
+         * @brief 归还全部信用并唤醒等待者
+         * @note 仅在占用信用的数据项已全部丢弃时调用（如调度器清理后），共享该信号的上游不受影响
+         */
+        void reset();
+
+        /**
+         * @brief 等待直到有信用（不占用），供上游节流
+         * @param timeout 最长等待时间
+         * @return 返回时是否有信用
+         */
+        bool waitForCredit(std::chrono::milliseconds timeout) const;
+
+        /**
+         * @brief 上游按策略决定是否交付一个数据项（不占用信用）
+         * @param policy 背压策略
+         * @param maxWait THROTTLE策略下的最长等待时间
+         * @return 应交付返回true，应在边缘丢弃返回false
+         */
+        bool admitUpstream(BackpressurePolicy policy, std::chrono::milliseconds maxWait) const;
+
+    private:
+        const uint32_t capacity_;             ///< 信用总数（0表示不限）
+        std::atomic<uint32_t> occupancy_{0};  ///< 已占用的信用数
+        mutable EventCount creditsAvailable_; ///< 归还信用时通知等待者
+    };
+
+} // namespace radar
@@ -0,0 +1,117 @@
+/**
+ * @file control_lane.h
+ * @brief 与数据流分离的低延迟控制通道
+ *
+ * 控制消息（切换CFAR虚警率、波束集合、处理参数等）不进入数据队列，也不争用数据路径的锁：
+ * - 投递是一次无锁入队，数据队列再满也不会阻塞或排在积压之后
+ * - 模块的工作线程在相邻两个数据包之间检查一次（一个原子读），有消息时就地执行
+ * - 同一时刻只有一个线程执行控制消息，消息按投递顺序生效
+ *
+ * 因此控制消息的延迟上限是"一个数据包的处理时间 + 唤醒时间"，与积压深度无关。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see DataProcessor::postControl
+ * @see modules::DataReceiver::postControl
+ * @see TaskScheduler::postControl
+ */
+
+#pragma once
+
+#include "common/mpmc_ring_queue.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace radar
+{
+
+    /**
+     * @brief 控制通道统计
+     */
+    struct ControlLaneStatistics
+    {
+        uint64_t posted = 0;        ///< 已投递的消息数
+        uint64_t applied = 0;       ///< 已执行的消息数
+        uint64_t rejected = 0;      ///< 通道已满被拒绝的消息数
+        uint64_t failed = 0;        ///< 执行时抛出异常的消息数
+        double meanLatencyUs = 0.0; ///< 投递到开始执行的平均延迟（微秒）
+        double maxLatencyUs = 0.0;  ///< 投递到开始执行的最大延迟（微秒）
+    };
+
+    /**
+     * @brief 控制通道
+     *
+     * @note post()与hasPending()可以在任何线程调用；drain()由模块的工作线程调用，
+     *       并发调用时只有一个线程执行，其余立即返回
+     */
+    class ControlLane
+    {
+    public:
+        using Action = std::function<void()>; ///< 控制消息（在工作线程上执行）
+
+        /**
+         * @brief 构造函数
+         * @param capacity 可积压的控制消息数（向上取整到2的幂）
+         */
+        explicit ControlLane(size_t capacity = 64);
+
+        ControlLane(const ControlLane &) = delete;
+        ControlLane &operator=(const ControlLane &) = delete;
+
+        /**
+         * @brief 投递控制消息
+         * @param action 控制消息
+         * @return 通道已满或消息为空时返回false
+         */
+        bool post(Action action);
+
+        /**
+         * @brief 检查是否有待执行的消息（供工作线程在数据包之间调用）
+         * @return 是否有待执行的消息
+         */
+        bool hasPending() const { return pending_.load(std::memory_order_acquire) > 0; }
+
+        /**
+         * @brief 按投递顺序执行所有待执行的消息
+         * @return 本次执行的消息数；其他线程正在执行时为0
+         * @note 消息抛出的异常被捕获并计入failed，不影响后续消息
+         */
+        size_t drain();
+
+        /**
+         * @brief 获取统计信息
+         * @return 统计快照
+         */
+        ControlLaneStatistics getStatistics() const;
+
+        /**
+         * @brief 重置统计信息
+         */
+        void resetStatistics();
+
+    private:
+        /// 排队中的控制消息
+        struct Message
+        {
+            Action action;                                  ///< 控制消息
+            std::chrono::steady_clock::time_point postedAt; ///< 投递时间
+        };
+
+        MpmcRingQueue<Message> queue_;            ///< 待执行的消息
+        std::atomic<uint32_t> pending_{0};        ///< 已投递未执行的消息数
+        std::atomic<bool> draining_{false};       ///< 是否有线程正在执行消息
+        std::atomic<uint64_t> posted_{0};         ///< 已投递的消息数
+        std::atomic<uint64_t> applied_{0};        ///< 已执行的消息数
+        std::atomic<uint64_t> rejected_{0};       ///< 被拒绝的消息数
+        std::atomic<uint64_t> failed_{0};         ///< 执行失败的消息数
+        std::atomic<uint64_t> totalLatencyNs_{0}; ///< 累计延迟（纳秒）
+        std::atomic<uint64_t> maxLatencyNs_{0};   ///< 最大延迟（纳秒）
+    };
+
+} // namespace radar
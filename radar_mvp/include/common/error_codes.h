@@ -61,6 +61,7 @@ namespace radar
         constexpr ErrorCode SHUTDOWN_FAILED = 0x0007;       ///< 关闭失败
         constexpr ErrorCode CONFIGURATION_ERROR = 0x0008;   ///< 配置错误
         constexpr ErrorCode PERMISSION_DENIED = 0x0009;     ///< 权限拒绝
+        constexpr ErrorCode OPERATION_CANCELLED = 0x000A;   ///< 操作已取消
     }
 
     /**
@@ -100,6 +101,8 @@ namespace radar
         constexpr ErrorCode BEAMFORMING_ERROR = 0x2008;    ///< 波束形成错误
         constexpr ErrorCode CALIBRATION_ERROR = 0x2009;    ///< 校准错误
         constexpr ErrorCode PERFORMANCE_DEGRADED = 0x200A; ///< 性能下降
+        constexpr ErrorCode DEADLINE_EXCEEDED = 0x200B;    ///< 数据包超过处理截止时间
+        constexpr ErrorCode PACKET_SHED = 0x200C;          ///< 过载保护丢弃数据包
     }
 
     /**
@@ -119,6 +122,9 @@ namespace radar
         constexpr ErrorCode SCHEDULING_ERROR = 0x3008;      ///< 调度错误
         constexpr ErrorCode TASK_TIMEOUT = 0x3009;          ///< 任务超时
         constexpr ErrorCode LOAD_BALANCING_ERROR = 0x300A;  ///< 负载均衡错误
+        constexpr ErrorCode DEADLINE_MISSED = 0x300B;       ///< 任务错过截止时间被丢弃
+        constexpr ErrorCode GRAPH_CYCLE = 0x300C;           ///< 任务依赖图中存在环
+        constexpr ErrorCode GRAPH_BUSY = 0x300D;            ///< 任务依赖图正在执行
     }
 
     /**
@@ -0,0 +1,220 @@
+/**
+ * @file event_count.h
+ * @brief 事件计数器（eventcount）等待/通知原语
+ *
+ * 为无锁数据结构提供"检查条件 → 休眠"之间不丢失唤醒的等待机制：
+ * 消费者先登记等待并取得当前纪元，再次检查条件后才真正休眠；
+ * 生产者发布数据后通知，没有等待者时通知不进入内核。
+ *
+ * - 先自旋：队列在低负载下往往几微秒内就有数据，自旋期间取到就不必休眠和唤醒
+ * - 再休眠：Linux上直接在纪元字上futex等待，唤醒只需一次系统调用，不经过互斥锁和条件变量；
+ *   其他平台退化为互斥锁 + 条件变量
+ * - 批量通知：一次发布多个数据项时用notifyMany()，一次系统调用唤醒多个等待者
+ *
+ * 典型用法：
+ * @code
+ * // 消费者
+ * if (!events.awaitFor([&]() { return tryPop(item); }, timeout))
+ * {
+ *     return TIMEOUT;
+ * }
+ *
+ * // 生产者
+ * push(item);
+ * events.notifyOne();
+ * @endcode
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace radar
+{
+
+    /**
+     * @brief 事件计数器
+     *
+     * 纪元在每次有效通知时加一，等待者在纪元变化后返回，返回后应重新检查条件。
+     * 等待者数单独计数，通知方据此判断是否需要唤醒。
+     *
+     * @note 所有公共方法都是线程安全的
+     */
+    class EventCount
+    {
+    public:
+        /// 等待凭据（登记时的纪元）
+        using Key = uint32_t;
+
+        static constexpr uint32_t DEFAULT_SPIN_ROUNDS = 128; ///< 休眠前默认的自旋检查次数
+
+        EventCount() = default;
+
+        EventCount(const EventCount &) = delete;
+        EventCount &operator=(const EventCount &) = delete;
+
+        /**
+         * @brief 登记等待
+         * @return 等待凭据，传给wait()
+         */
+        Key prepareWait();
+
+        /**
+         * @brief 取消登记（prepareWait()之后发现条件已满足）
+         */
+        void cancelWait();
+
+        /**
+         * @brief 休眠直到prepareWait()之后有通知到达
+         * @param key prepareWait()返回的凭据
+         */
+        void wait(Key key);
+
+        /**
+         * @brief 休眠直到有通知到达或超时
+         * @param key prepareWait()返回的凭据
+         * @param timeout 超时时间
+         * @return 收到通知返回true，超时返回false
+         */
+        bool waitFor(Key key, std::chrono::nanoseconds timeout);
+
+        /**
+         * @brief 先自旋再休眠，直到条件成立
+         * @param condition 条件检查（可能被调用多次，可以带副作用，如尝试出队）
+         * @param spinRounds 休眠前的自旋检查次数
+         */
+        template <typename Condition>
+        void await(Condition condition, uint32_t spinRounds = DEFAULT_SPIN_ROUNDS);
+
+        /**
+         * @brief 先自旋再休眠，直到条件成立或超时
+         * @param condition 条件检查（可能被调用多次，可以带副作用，如尝试出队）
+         * @param timeout 超时时间
+         * @param spinRounds 休眠前的自旋检查次数
+         * @return 条件是否成立
+         */
+        template <typename Condition>
+        bool awaitFor(Condition condition, std::chrono::nanoseconds timeout,
+                      uint32_t spinRounds = DEFAULT_SPIN_ROUNDS);
+
+        /**
+         * @brief 唤醒一个等待者，没有等待者时不进入内核
+         */
+        void notifyOne();
+
+        /**
+         * @brief 唤醒至多count个等待者（一次发布多个数据项），没有等待者时不进入内核
+         * @param count 唤醒数
+         */
+        void notifyMany(uint32_t count);
+
+        /**
+         * @brief 唤醒全部等待者，没有等待者时不进入内核
+         */
+        void notifyAll();
+
+        /**
+         * @brief 获取当前登记的等待者数
+         * @return 等待者数
+         */
+        uint32_t getWaiterCount() const;
+
+    private:
+        /**
+         * @brief 自旋等待中的一次让步（不让出CPU）
+         */
+        static void relax()
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        /**
+         * @brief 推进纪元并唤醒
+         * @param count 唤醒数
+         */
+        void notify(uint32_t count);
+
+        std::atomic<uint32_t> epoch_{0};   ///< 纪元（Linux上为futex字）
+        std::atomic<uint32_t> waiters_{0}; ///< 登记的等待者数
+#if !defined(__linux__)
+        std::mutex mutex_;           ///< 休眠互斥锁
+        std::condition_variable cv_; ///< 休眠条件变量
+#endif
+    };
+
+    template <typename Condition>
+    void EventCount::await(Condition condition, uint32_t spinRounds)
+    {
+        for (uint32_t i = 0; i < spinRounds; ++i)
+        {
+            if (condition())
+            {
+                return;
+            }
+            relax();
+        }
+
+        for (;;)
+        {
+            const Key key = prepareWait();
+            if (condition())
+            {
+                cancelWait();
+                return;
+            }
+            wait(key);
+        }
+    }
+
+    template <typename Condition>
+    bool EventCount::awaitFor(Condition condition, std::chrono::nanoseconds timeout, uint32_t spinRounds)
+    {
+        for (uint32_t i = 0; i < spinRounds; ++i)
+        {
+            if (condition())
+            {
+                return true;
+            }
+            relax();
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (;;)
+        {
+            const Key key = prepareWait();
+            if (condition())
+            {
+                cancelWait();
+                return true;
+            }
+
+            const auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining.count() <= 0)
+            {
+                cancelWait();
+                return false;
+            }
+            waitFor(key, remaining);
+        }
+    }
+
+} // namespace radar
@@ -0,0 +1,895 @@
+/**
+ * @file future.h
+ * @brief 支持续体的Future/Promise
+ *
+ * std::future只能阻塞等待：把"接收 → 处理 → 显示"串起来时总要有线程停在get()上。
+ * 这里的Future在结果就绪时直接触发续体：
+ * - then()：结果就绪后调用回调，返回回调结果的Future；回调返回Future时自动展开
+ * - then(executor, ...)：续体投递到执行器（如任务调度器）执行，不占用完成线程
+ * - whenAll()/whenAny()：组合多个Future
+ * - cancel()：以OPERATION_CANCELLED异常完成Future，并沿then()链向上游传播；
+ *   生产者通过Promise::isCancelled()或取消处理函数得知并跳过工作
+ *
+ * 典型用法：
+ * @code
+ * receiver->receivePacketAsync()
+ *     .then(*scheduler, [processor](RawDataPacketPtr packet)
+ *           { return processor->processPacketAsync(packet); })
+ *     .then([display](ProcessingResultPtr result)
+ *           { display->displayResult(result); });
+ * @endcode
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#pragma once
+
+#include "error_codes.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief 执行器接口：在某个执行上下文中运行工作项
+     */
+    class IExecutor
+    {
+    public:
+        /// 工作项
+        using Work = std::function<void()>;
+
+        virtual ~IExecutor() = default;
+
+        /**
+         * @brief 投递工作项
+         * @param work 工作项
+         * @throws 无法投递时抛出异常，由调用者把异常转交给对应的Future
+         */
+        virtual void execute(Work work) = 0;
+    };
+
+    template <typename T>
+    class Future;
+
+    template <typename T>
+    class Promise;
+
+    namespace detail
+    {
+        /// void结果的占位值
+        struct Unit
+        {
+        };
+
+        /// 共享状态中实际保存的值类型
+        template <typename T>
+        using StoredValue = std::conditional_t<std::is_void<T>::value, Unit, T>;
+
+        template <typename T>
+        struct UnwrapFuture
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        struct UnwrapFuture<Future<T>>
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        struct IsFuture : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct IsFuture<Future<T>> : std::true_type
+        {
+        };
+
+        /// 续体回调的返回值类型
+        template <typename T, typename F, bool = std::is_void<T>::value>
+        struct CallbackResult
+        {
+            using type = std::invoke_result_t<F, T>;
+        };
+
+        template <typename T, typename F>
+        struct CallbackResult<T, F, true>
+        {
+            using type = std::invoke_result_t<F>;
+        };
+
+        /**
+         * @brief Future与Promise的共享状态
+         *
+         * 结果只写一次：setValue/setException/cancel中先到者生效，其余返回false。
+         * 完成后依次执行已登记的回调（在完成线程上，锁外执行）。
+         */
+        template <typename T>
+        class FutureState
+        {
+        public:
+            using Value = StoredValue<T>;
+            using Callback = std::function<void()>;
+
+            bool isReady() const noexcept
+            {
+                return ready_.load(std::memory_order_acquire);
+            }
+
+            bool isCancelled() const noexcept
+            {
+                return cancelled_.load(std::memory_order_acquire);
+            }
+
+            template <typename... Args>
+            bool setValue(Args &&...args)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (ready_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+                value_.emplace(std::forward<Args>(args)...);
+                finish(lock);
+                return true;
+            }
+
+            bool setException(std::exception_ptr error)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (ready_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+                error_ = std::move(error);
+                finish(lock);
+                return true;
+            }
+
+            bool cancel()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (ready_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+                cancelled_.store(true, std::memory_order_release);
+                error_ = std::make_exception_ptr(
+                    ModuleException(SystemErrors::OPERATION_CANCELLED, "Operation cancelled"));
+                Callback hook = std::move(cancelHook_);
+                finish(lock);
+
+                if (hook)
+                {
+                    hook();
+                }
+                return true;
+            }
+
+            /**
+             * @brief 设置取消处理函数（替换之前的）
+             * @note 已被取消时立即在当前线程调用
+             */
+            void setCancelHook(Callback hook)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (!ready_.load(std::memory_order_relaxed))
+                {
+                    cancelHook_ = std::move(hook);
+                    return;
+                }
+                lock.unlock();
+                if (isCancelled() && hook)
+                {
+                    hook();
+                }
+            }
+
+            /**
+             * @brief 登记完成回调，已完成时立即在当前线程调用
+             */
+            void addCallback(Callback callback)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (!ready_.load(std::memory_order_relaxed))
+                {
+                    callbacks_.push_back(std::move(callback));
+                    return;
+                }
+                lock.unlock();
+                callback();
+            }
+
+            void wait() const
+            {
+                if (isReady())
+                {
+                    return;
+                }
+                std::unique_lock<std::mutex> lock(mutex_);
+                readyCondition_.wait(lock, [this]()
+                                     { return isReady(); });
+            }
+
+            template <typename Rep, typename Period>
+            bool waitFor(const std::chrono::duration<Rep, Period> &timeout) const
+            {
+                if (isReady())
+                {
+                    return true;
+                }
+                std::unique_lock<std::mutex> lock(mutex_);
+                return readyCondition_.wait_for(lock, timeout, [this]()
+                                                { return isReady(); });
+            }
+
+            /// 仅在完成后调用
+            const std::exception_ptr &error() const noexcept
+            {
+                return error_;
+            }
+
+            /// 仅在成功完成后调用
+            Value &value() noexcept
+            {
+                return *value_;
+            }
+
+        private:
+            /**
+             * @brief 标记完成、唤醒等待者并在锁外执行回调
+             */
+            void finish(std::unique_lock<std::mutex> &lock)
+            {
+                ready_.store(true, std::memory_order_release);
+                std::vector<Callback> callbacks = std::move(callbacks_);
+                callbacks_.clear();
+                if (!cancelled_.load(std::memory_order_relaxed))
+                {
+                    cancelHook_ = nullptr;
+                }
+                lock.unlock();
+
+                readyCondition_.notify_all();
+                for (auto &callback : callbacks)
+                {
+                    callback();
+                }
+            }
+
+            mutable std::mutex mutex_;                       ///< 状态互斥锁
+            mutable std::condition_variable readyCondition_; ///< 完成通知
+            std::atomic<bool> ready_{false};                 ///< 是否已完成
+            std::atomic<bool> cancelled_{false};             ///< 是否被取消
+            std::optional<Value> value_;                     ///< 结果值
+            std::exception_ptr error_;                       ///< 异常
+            std::vector<Callback> callbacks_;                ///< 完成回调
+            Callback cancelHook_;                            ///< 取消处理函数
+        };
+
+        /// 组合函数访问Future内部状态的入口
+        struct FutureAccess
+        {
+            template <typename T>
+            static std::shared_ptr<FutureState<T>> take(Future<T> &future)
+            {
+                future.checkValid();
+                return std::move(future.state_);
+            }
+        };
+
+        /**
+         * @brief 把只移动的可调用对象包装成可复制的std::function
+         */
+        template <typename F>
+        std::function<void()> shareCallable(F &&callable)
+        {
+            auto shared = std::make_shared<std::decay_t<F>>(std::forward<F>(callable));
+            return [shared]()
+            { (*shared)(); };
+        }
+
+        /**
+         * @brief 把一个已完成状态的结果转交给另一个状态
+         */
+        template <typename T>
+        void forwardResult(FutureState<T> &source, FutureState<T> &target)
+        {
+            if (source.error())
+            {
+                target.setException(source.error());
+            }
+            else
+            {
+                target.setValue(std::move(source.value()));
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief 支持续体的Future
+     * @tparam T 结果类型，可为void
+     *
+     * 只移动；get()和then()都会消费Future（之后valid()为false）。
+     * 取消、等待与查询可在任意线程调用，但同一个Future对象不应被多个线程同时修改。
+     */
+    template <typename T>
+    class Future
+    {
+    public:
+        using ValueType = T;
+
+        Future() noexcept = default;
+
+        explicit Future(std::shared_ptr<detail::FutureState<T>> state) noexcept
+            : state_(std::move(state)) {}
+
+        Future(Future &&) noexcept = default;
+        Future &operator=(Future &&) noexcept = default;
+        Future(const Future &) = delete;
+        Future &operator=(const Future &) = delete;
+
+        /**
+         * @brief 检查是否关联了共享状态
+         * @return 是否有效
+         */
+        bool valid() const noexcept { return state_ != nullptr; }
+
+        /**
+         * @brief 检查结果是否就绪（成功、失败或取消）
+         * @return 是否就绪，无效Future返回false
+         */
+        bool isReady() const noexcept { return state_ && state_->isReady(); }
+
+        /**
+         * @brief 检查是否被取消
+         * @return 是否被取消
+         */
+        bool isCancelled() const noexcept { return state_ && state_->isCancelled(); }
+
+        /**
+         * @brief 阻塞等待结果就绪
+         * @throws std::future_error Future无效
+         */
+        void wait() const
+        {
+            checkValid();
+            state_->wait();
+        }
+
+        /**
+         * @brief 限时等待结果就绪
+         * @param timeout 超时时间
+         * @return 是否已就绪
+         * @throws std::future_error Future无效
+         */
+        template <typename Rep, typename Period>
+        bool waitFor(const std::chrono::duration<Rep, Period> &timeout) const
+        {
+            checkValid();
+            return state_->waitFor(timeout);
+        }
+
+        /**
+         * @brief 等待并取出结果，失败时重新抛出异常
+         * @return 结果
+         * @throws std::future_error Future无效
+         * @throws ModuleException 被取消时错误码为SystemErrors::OPERATION_CANCELLED
+         */
+        T get()
+        {
+            auto state = detail::FutureAccess::take(*this);
+            state->wait();
+            if (state->error())
+            {
+                std::rethrow_exception(state->error());
+            }
+            if constexpr (!std::is_void<T>::value)
+            {
+                return std::move(state->value());
+            }
+        }
+
+        /**
+         * @brief 取消：尚未完成时以OPERATION_CANCELLED异常完成，并通知生产者与上游
+         * @return 是否由本次调用完成了Future
+         */
+        bool cancel()
+        {
+            return state_ && state_->cancel();
+        }
+
+        /**
+         * @brief 结果就绪后在完成线程上调用回调
+         * @param callback 以结果为参数的回调（T为void时无参数）
+         * @return 回调结果的Future；回调返回Future<U>时返回Future<U>
+         *
+         * 本Future失败或被取消时不调用回调，异常直接传给返回的Future；
+         * 回调抛出的异常同样传给返回的Future。取消返回的Future会向上游传播取消。
+         */
+        template <typename F>
+        auto then(F &&callback)
+        {
+            return thenOn(nullptr, std::forward<F>(callback));
+        }
+
+        /**
+         * @brief 结果就绪后把回调投递到执行器执行
+         * @param executor 执行器（如TaskScheduler），须比续体存活更久
+         * @param callback 回调，同then(F)
+         * @return 回调结果的Future
+         */
+        template <typename F>
+        auto then(IExecutor &executor, F &&callback)
+        {
+            return thenOn(&executor, std::forward<F>(callback));
+        }
+
+    private:
+        friend struct detail::FutureAccess;
+
+        void checkValid() const
+        {
+            if (!state_)
+            {
+                throw std::future_error(std::future_errc::no_state);
+            }
+        }
+
+        template <typename F>
+        auto thenOn(IExecutor *executor, F &&callback)
+        {
+            using Callback = std::decay_t<F>;
+            using Result = typename detail::CallbackResult<T, Callback>::type;
+            using Next = typename detail::UnwrapFuture<Result>::type;
+
+            auto parent = detail::FutureAccess::take(*this);
+            auto child = std::make_shared<detail::FutureState<Next>>();
+
+            std::weak_ptr<detail::FutureState<T>> weakParent = parent;
+            child->setCancelHook([weakParent]()
+                                 {
+                if (auto upstream = weakParent.lock())
+                {
+                    upstream->cancel();
+                } });
+
+            // 续体持有上游状态：投递到执行器后上游的Promise/Future可能都已释放
+            auto run = [parent, child, callback = std::forward<F>(callback)]() mutable
+            {
+                if (parent->error())
+                {
+                    child->setException(parent->error());
+                    return;
+                }
+                try
+                {
+                    invokeContinuation<Result>(callback, *parent, child);
+                }
+                catch (...)
+                {
+                    child->setException(std::current_exception());
+                }
+            };
+
+            detail::FutureState<T> *source = parent.get();
+            if (executor)
+            {
+                source->addCallback(detail::shareCallable(
+                    [executor, child, run = std::move(run)]() mutable
+                    {
+                        try
+                        {
+                            executor->execute(detail::shareCallable(std::move(run)));
+                        }
+                        catch (...)
+                        {
+                            child->setException(std::current_exception());
+                        }
+                    }));
+            }
+            else
+            {
+                source->addCallback(detail::shareCallable(std::move(run)));
+            }
+            return Future<Next>(std::move(child));
+        }
+
+        template <typename Result, typename Callback, typename Next>
+        static void invokeContinuation(Callback &callback, detail::FutureState<T> &parent,
+                                       const std::shared_ptr<detail::FutureState<Next>> &child)
+        {
+            auto invoke = [&]() -> Result
+            {
+                if constexpr (std::is_void<T>::value)
+                {
+                    return callback();
+                }
+                else
+                {
+                    return callback(std::move(parent.value()));
+                }
+            };
+
+            if constexpr (detail::IsFuture<Result>::value)
+            {
+                // 回调返回Future：内层完成时再完成外层，取消外层时取消内层
+                Result inner = invoke();
+                auto innerState = detail::FutureAccess::take(inner);
+                std::weak_ptr<detail::FutureState<Next>> weakInner = innerState;
+                child->setCancelHook([weakInner]()
+                                     {
+                    if (auto state = weakInner.lock())
+                    {
+                        state->cancel();
+                    } });
+                detail::FutureState<Next> *raw = innerState.get();
+                raw->addCallback([innerState, child]()
+                                 { detail::forwardResult(*innerState, *child); });
+            }
+            else if constexpr (std::is_void<Result>::value)
+            {
+                invoke();
+                child->setValue();
+            }
+            else
+            {
+                child->setValue(invoke());
+            }
+        }
+
+        std::shared_ptr<detail::FutureState<T>> state_; ///< 共享状态
+    };
+
+    /**
+     * @brief Future的生产者端
+     * @tparam T 结果类型，可为void
+     *
+     * 只移动；析构时若尚未设置结果，Future以std::future_error(broken_promise)完成。
+     */
+    template <typename T>
+    class Promise
+    {
+    public:
+        Promise() : state_(std::make_shared<detail::FutureState<T>>()) {}
+
+        Promise(Promise &&other) noexcept
+            : state_(std::move(other.state_)), retrieved_(other.retrieved_) {}
+
+        Promise &operator=(Promise &&other) noexcept
+        {
+            if (this != &other)
+            {
+                abandon();
+                state_ = std::move(other.state_);
+                retrieved_ = other.retrieved_;
+            }
+            return *this;
+        }
+
+        Promise(const Promise &) = delete;
+        Promise &operator=(const Promise &) = delete;
+
+        ~Promise()
+        {
+            abandon();
+        }
+
+        /**
+         * @brief 获取关联的Future（只能获取一次）
+         * @return Future
+         * @throws std::future_error 已获取过或Promise无效
+         */
+        Future<T> getFuture()
+        {
+            if (!state_)
+            {
+                throw std::future_error(std::future_errc::no_state);
+            }
+            if (retrieved_)
+            {
+                throw std::future_error(std::future_errc::future_already_retrieved);
+            }
+            retrieved_ = true;
+            return Future<T>(state_);
+        }
+
+        /**
+         * @brief 设置结果（T为void时无参数）
+         * @return 是否设置成功；已完成（包括已被取消）时返回false
+         */
+        template <typename... Args>
+        bool setValue(Args &&...args)
+        {
+            return state_ && state_->setValue(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief 设置异常
+         * @param error 异常
+         * @return 是否设置成功
+         */
+        bool setException(std::exception_ptr error)
+        {
+            return state_ && state_->setException(std::move(error));
+        }
+
+        /**
+         * @brief 检查消费者是否已取消
+         * @return 是否被取消
+         */
+        bool isCancelled() const noexcept
+        {
+            return state_ && state_->isCancelled();
+        }
+
+        /**
+         * @brief 检查结果是否已设置
+         * @return 是否已完成
+         */
+        bool isReady() const noexcept
+        {
+            return state_ && state_->isReady();
+        }
+
+        /**
+         * @brief 设置取消处理函数，消费者取消时调用（已被取消时立即调用）
+         * @param handler 处理函数，在取消者线程上执行
+         */
+        void setCancelHandler(std::function<void()> handler)
+        {
+            if (state_)
+            {
+                state_->setCancelHook(std::move(handler));
+            }
+        }
+
+        /**
+         * @brief 检查是否关联了共享状态
+         * @return 是否有效
+         */
+        bool valid() const noexcept { return state_ != nullptr; }
+
+    private:
+        void abandon() noexcept
+        {
+            if (state_ && !state_->isReady())
+            {
+                state_->setException(std::make_exception_ptr(
+                    std::future_error(std::future_errc::broken_promise)));
+            }
+        }
+
+        std::shared_ptr<detail::FutureState<T>> state_; ///< 共享状态
+        bool retrieved_ = false;                        ///< Future是否已被获取
+    };
+
+    /**
+     * @brief 创建已就绪的Future
+     * @param value 结果
+     * @return Future
+     */
+    template <typename T>
+    Future<std::decay_t<T>> makeReadyFuture(T &&value)
+    {
+        Promise<std::decay_t<T>> promise;
+        promise.setValue(std::forward<T>(value));
+        return promise.getFuture();
+    }
+
+    /**
+     * @brief 创建已就绪的Future<void>
+     * @return Future
+     */
+    inline Future<void> makeReadyFuture()
+    {
+        Promise<void> promise;
+        promise.setValue();
+        return promise.getFuture();
+    }
+
+    /**
+     * @brief 创建以异常完成的Future
+     * @param error 异常
+     * @return Future
+     */
+    template <typename T>
+    Future<T> makeFailedFuture(std::exception_ptr error)
+    {
+        Promise<T> promise;
+        promise.setException(std::move(error));
+        return promise.getFuture();
+    }
+
+    /// whenAll()的结果类型：T为void时为void，否则为按输入顺序排列的结果列表
+    template <typename T>
+    using WhenAllResult = std::conditional_t<std::is_void<T>::value, void, std::vector<T>>;
+
+    /// whenAny()的结果类型：T为void时为完成者下标，否则为（下标，结果）
+    template <typename T>
+    using WhenAnyResult = std::conditional_t<std::is_void<T>::value, size_t, std::pair<size_t, T>>;
+
+    /**
+     * @brief 所有输入都成功时完成
+     * @param futures 输入Future（被消费）
+     * @return 组合Future；任一输入失败时立即以该异常完成，取消组合Future会取消所有输入
+     */
+    template <typename T>
+    Future<WhenAllResult<T>> whenAll(std::vector<Future<T>> futures)
+    {
+        using State = detail::FutureState<T>;
+
+        struct Context
+        {
+            std::mutex mutex;                                          ///< 结果互斥锁
+            std::vector<std::optional<detail::StoredValue<T>>> values; ///< 按输入顺序的结果
+            size_t remaining = 0;                                      ///< 尚未完成的输入数
+            Promise<WhenAllResult<T>> promise;                         ///< 组合结果
+        };
+
+        auto context = std::make_shared<Context>();
+        Future<WhenAllResult<T>> result = context->promise.getFuture();
+        if (futures.empty())
+        {
+            if constexpr (std::is_void<T>::value)
+            {
+                context->promise.setValue();
+            }
+            else
+            {
+                context->promise.setValue(std::vector<T>());
+            }
+            return result;
+        }
+
+        std::vector<std::shared_ptr<State>> inputs;
+        inputs.reserve(futures.size());
+        for (auto &future : futures)
+        {
+            inputs.push_back(detail::FutureAccess::take(future));
+        }
+        context->values.resize(inputs.size());
+        context->remaining = inputs.size();
+
+        std::vector<std::weak_ptr<State>> weakInputs(inputs.begin(), inputs.end());
+        context->promise.setCancelHandler([weakInputs]()
+                                          {
+            for (const auto &weak : weakInputs)
+            {
+                if (auto input = weak.lock())
+                {
+                    input->cancel();
+                }
+            } });
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            State *input = inputs[i].get();
+            input->addCallback([context, input, i]()
+                               {
+                if (input->error())
+                {
+                    context->promise.setException(input->error());
+                    return;
+                }
+
+                bool last = false;
+                {
+                    std::lock_guard<std::mutex> lock(context->mutex);
+                    context->values[i].emplace(std::move(input->value()));
+                    last = --context->remaining == 0;
+                }
+                if (!last)
+                {
+                    return;
+                }
+
+                if constexpr (std::is_void<T>::value)
+                {
+                    context->promise.setValue();
+                }
+                else
+                {
+                    std::vector<T> values;
+                    values.reserve(context->values.size());
+                    for (auto &value : context->values)
+                    {
+                        values.push_back(std::move(*value));
+                    }
+                    context->promise.setValue(std::move(values));
+                } });
+        }
+        return result;
+    }
+
+    /**
+     * @brief 第一个成功的输入完成时完成
+     * @param futures 输入Future（被消费），不能为空
+     * @return 组合Future；全部失败时以最后一个异常完成，取消组合Future会取消所有输入。
+     *         其余输入继续运行，需要时由调用者自行取消
+     */
+    template <typename T>
+    Future<WhenAnyResult<T>> whenAny(std::vector<Future<T>> futures)
+    {
+        using State = detail::FutureState<T>;
+
+        if (futures.empty())
+        {
+            return makeFailedFuture<WhenAnyResult<T>>(std::make_exception_ptr(
+                ModuleException(SystemErrors::INVALID_PARAMETER, "whenAny requires at least one future")));
+        }
+
+        struct Context
+        {
+            std::atomic<size_t> failures{0};   ///< 失败的输入数
+            size_t total = 0;                  ///< 输入总数
+            Promise<WhenAnyResult<T>> promise; ///< 组合结果
+        };
+
+        auto context = std::make_shared<Context>();
+        context->total = futures.size();
+        Future<WhenAnyResult<T>> result = context->promise.getFuture();
+
+        std::vector<std::shared_ptr<State>> inputs;
+        inputs.reserve(futures.size());
+        for (auto &future : futures)
+        {
+            inputs.push_back(detail::FutureAccess::take(future));
+        }
+
+        std::vector<std::weak_ptr<State>> weakInputs(inputs.begin(), inputs.end());
+        context->promise.setCancelHandler([weakInputs]()
+                                          {
+            for (const auto &weak : weakInputs)
+            {
+                if (auto input = weak.lock())
+                {
+                    input->cancel();
+                }
+            } });
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            State *input = inputs[i].get();
+            input->addCallback([context, input, i]()
+                               {
+                if (input->error())
+                {
+                    if (context->failures.fetch_add(1) + 1 == context->total)
+                    {
+                        context->promise.setException(input->error());
+                    }
+                    return;
+                }
+
+                if constexpr (std::is_void<T>::value)
+                {
+                    context->promise.setValue(i);
+                }
+                else
+                {
+                    context->promise.setValue(std::make_pair(i, std::move(input->value())));
+                } });
+        }
+        return result;
+    }
+
+} // namespace radar
@@ -19,8 +19,9 @@
 
 #include "types.h"
 #include "error_codes.h"
+#include "future.h"
+#include "backpressure.h"
 #include <functional>
-#include <future>
 #include <memory>
 
 namespace radar
@@ -185,12 +186,29 @@ namespace radar
          */
         virtual ErrorCode receivePacket(RawDataPacketPtr &packet, uint32_t timeoutMs = 0) = 0;
 
+        /**
+         * @brief 批量接收数据包（同步方式）
+         * @param packets 输出数组，调用者提供，至少maxCount个元素
+         * @param maxCount 最多接收的数据包数
+         * @param receivedCount 输出参数，实际接收的数据包数
+         * @param timeoutMs 等待第一个数据包的超时时间（毫秒），0表示无限等待
+         * @return 操作结果错误码
+         * @retval SystemErrors::SUCCESS 至少接收到一个数据包
+         * @retval SystemErrors::INVALID_PARAMETER packets为空或maxCount为0
+         * @retval DataReceiverErrors::RECEIVER_NOT_READY 接收器未就绪
+         * @retval SystemErrors::OPERATION_TIMEOUT 接收超时
+         * @note 只为第一个数据包等待，之后在一次同步操作中取走已缓冲的数据包，
+         *       消费者可按16~64个一批拉取，分摊每个数据包的同步开销
+         */
+        virtual ErrorCode receivePackets(RawDataPacketPtr *packets, size_t maxCount, size_t &receivedCount,
+                                         uint32_t timeoutMs = 0) = 0;
+
         /**
          * @brief 异步接收数据包
-         * @return 数据包的future对象
-         * @note 调用者可以通过future获取结果或检查状态
+         * @return 数据包的Future，下一个到达的数据包直接交给它，不占用等待线程
+         * @note 可用then()串接后续处理；取消后不再占用数据包
          */
-        virtual std::future<RawDataPacketPtr> receivePacketAsync() = 0;
+        virtual Future<RawDataPacketPtr> receivePacketAsync() = 0;
 
         /**
          * @brief 设置数据包接收回调函数
@@ -212,6 +230,13 @@ namespace radar
          * @warning 此操作将丢弃所有缓冲的数据包
          */
         virtual ErrorCode flushBuffer() = 0;
+
+        /**
+         * @brief 设置下游背压信号
+         * @param signal 下游（通常是任务调度器）发放的信用池，nullptr表示不受下游约束
+         * @note 无信用时按配置的backpressurePolicy节流或在边缘丢弃数据包
+         */
+        virtual void setBackpressureSignal(std::shared_ptr<const BackpressureSignal> signal) = 0;
     };
 
     //==============================================================================
@@ -248,9 +273,9 @@ namespace radar
         /**
          * @brief 异步处理数据包
          * @param inputPacket 输入数据包
-         * @return 处理结果的future对象
+         * @return 处理结果的Future；执行前取消则跳过处理
          */
-        virtual std::future<ProcessingResultPtr> processPacketAsync(
+        virtual Future<ProcessingResultPtr> processPacketAsync(
             const RawDataPacketPtr &inputPacket) = 0;
 
         /**
@@ -289,6 +314,13 @@ namespace radar
          * @return 处理器能力描述结构
          */
         virtual ProcessorCapabilities getCapabilities() const = 0;
+
+        /**
+         * @brief 获取当前积压的数据包数
+         * @return 排队、批内等待与正在处理的数据包总数，不跟踪积压的实现返回0
+         * @note 负载均衡调度器据此估计实例的排队深度，包括不经该调度器提交的数据包
+         */
+        virtual size_t getQueueDepth() const { return 0; }
     };
 
     //==============================================================================
@@ -297,9 +329,10 @@ namespace radar
 
     /**
      * @brief 任务调度模块接口
-     * @details 负责管理系统中的异步任务执行和资源调度
+     * @details 负责管理系统中的异步任务执行和资源调度，
+     *          同时作为执行器运行Future::then()投递的续体
      */
-    class ITaskScheduler : public IModule
+    class ITaskScheduler : public IModule, public IExecutor
     {
     public:
         /// 任务函数类型定义
@@ -317,17 +350,17 @@ namespace radar
          * @brief 提交普通任务
          * @param task 任务函数
          * @param priority 任务优先级
-         * @return 任务的future对象
+         * @return 任务的Future；执行前取消则跳过任务
          */
-        virtual std::future<void> submitTask(Task task, PacketPriority priority = PacketPriority::NORMAL) = 0;
+        virtual Future<void> submitTask(Task task, PacketPriority priority = PacketPriority::NORMAL) = 0;
 
         /**
          * @brief 提交有返回值的任务
          * @param task 任务函数
          * @param priority 任务优先级
-         * @return 任务结果的future对象
+         * @return 任务结果的Future；执行前取消则跳过任务
          */
-        virtual std::future<ProcessingResultPtr> submitTaskWithResult(
+        virtual Future<ProcessingResultPtr> submitTaskWithResult(
             TaskWithResult task, PacketPriority priority = PacketPriority::NORMAL) = 0;
 
         /**
@@ -335,9 +368,9 @@ namespace radar
          * @param processor 数据处理器指针
          * @param packet 数据包指针
          * @param priority 任务优先级
-         * @return 处理结果的future对象
+         * @return 处理结果的Future；执行前取消则跳过处理
          */
-        virtual std::future<ProcessingResultPtr> submitProcessingTask(
+        virtual Future<ProcessingResultPtr> submitProcessingTask(
             std::shared_ptr<IDataProcessor> processor,
             RawDataPacketPtr packet,
             PacketPriority priority = PacketPriority::NORMAL) = 0;
@@ -360,6 +393,12 @@ namespace radar
          * @return 调度器状态统计
          */
         virtual SchedulerStatus getSchedulerStatus() const = 0;
+
+        /**
+         * @brief 获取背压信号
+         * @return 按等待队列容量发放的信用池，可交给上游接收器轮询
+         */
+        virtual std::shared_ptr<const BackpressureSignal> getBackpressureSignal() const = 0;
     };
 
     //==============================================================================
@@ -0,0 +1,179 @@
+/**
+ * @file mpmc_ring_queue.h
+ * @brief 有界无锁多生产者多消费者环形队列
+ *
+ * 每个槽位带一个序号：生产者与消费者各自用CAS认领下标，再通过槽位序号
+ * 交接数据，入队与出队都不加锁且各只需一次CAS（D. Vyukov的有界MPMC队列）。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see PriorityTaskQueue
+ * @see ControlLane
+ * @see OverflowRing
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace radar
+{
+
+    /**
+     * @brief 有界无锁MPMC环形队列
+     * @tparam T 元素类型（需可默认构造和移动）
+     *
+     * @note 所有公共方法都是线程安全的；size()在并发访问时为近似值
+     */
+    template <typename T>
+    class MpmcRingQueue
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 容量（向上取整到2的幂，至少为2）
+         */
+        explicit MpmcRingQueue(size_t capacity = 1024)
+        {
+            size_t rounded = 2;
+            while (rounded < capacity)
+            {
+                rounded <<= 1;
+            }
+            capacity_ = rounded;
+            mask_ = rounded - 1;
+            cells_.reset(new Cell[rounded]);
+            for (size_t i = 0; i < rounded; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcRingQueue(const MpmcRingQueue &) = delete;
+        MpmcRingQueue &operator=(const MpmcRingQueue &) = delete;
+
+        /**
+         * @brief 入队
+         * @param item 元素（成功时被移走）
+         * @return 队列已满时返回false
+         */
+        bool tryPush(T &item)
+        {
+            Cell *cell;
+            size_t position = enqueuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells_[position & mask_];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (diff == 0)
+                {
+                    if (enqueuePos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->data = std::move(item);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 出队
+         * @param item 输出参数，出队的元素
+         * @return 队列为空时返回false
+         */
+        bool tryPop(T &item)
+        {
+            Cell *cell;
+            size_t position = dequeuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells_[position & mask_];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+                if (diff == 0)
+                {
+                    if (dequeuePos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = dequeuePos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            item = std::move(cell->data);
+            cell->data = T();
+            cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 获取元素数量（近似值）
+         * @return 元素数量
+         */
+        size_t size() const
+        {
+            const size_t enqueued = enqueuePos_.load(std::memory_order_relaxed);
+            const size_t dequeued = dequeuePos_.load(std::memory_order_relaxed);
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+        /**
+         * @brief 检查是否为空（近似值）
+         * @return 是否为空
+         */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief 获取容量
+         * @return 容量
+         */
+        size_t capacity() const
+        {
+            return capacity_;
+        }
+
+    private:
+        /// 槽位
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0}; ///< 槽位序号
+            T data{};                        ///< 元素
+        };
+
+        std::unique_ptr<Cell[]> cells_;                 ///< 槽位数组
+        size_t capacity_ = 0;                           ///< 容量（2的幂）
+        size_t mask_ = 0;                               ///< 下标掩码
+        alignas(64) std::atomic<size_t> enqueuePos_{0}; ///< 下一个入队位置
+        alignas(64) std::atomic<size_t> dequeuePos_{0}; ///< 下一个出队位置
+    };
+
+} // namespace radar
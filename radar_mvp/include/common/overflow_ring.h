@@ -0,0 +1,484 @@
+/**
+ * @file overflow_ring.h
+ * @brief 带溢出策略的有界无锁环形缓冲区
+ *
+ * 接收器的数据包队列：生产者（接收线程）与消费者之间只经过一次无锁入队/出队，
+ * 队列满时的处理直接在环形缓冲区内完成：
+ * - drop_oldest：生产者取走最旧的元素再入队，保留最新数据
+ * - drop_newest：丢弃新元素，入队立即返回
+ * - block：生产者先自旋再休眠，直到有空位或缓冲区关闭
+ *
+ * 单生产者时底层为SPSC环形队列，入队没有CAS；多生产者时为MPMC环形队列。
+ * SPSC模式下消费者之间（以及drop_oldest时腾出空位的生产者）用一把互斥锁串行，
+ * 只有一个消费者时这把锁不会发生争用，生产者的正常入队路径不加锁。
+ * 批量出队在一次同步操作中取走多个元素，只为第一个元素等待。
+ * 丢弃数按原子计数累计（DropCounter），由调用者按时间间隔取出后限频记录日志。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see SpscRingQueue
+ * @see MpmcRingQueue
+ */
+
+#pragma once
+
+#include "common/event_count.h"
+#include "common/mpmc_ring_queue.h"
+#include "common/spsc_ring_queue.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace radar
+{
+
+    /**
+     * @brief 缓冲区满时的处理策略
+     */
+    enum class OverflowPolicy
+    {
+        DROP_OLDEST, ///< 丢弃最旧的元素
+        DROP_NEWEST, ///< 丢弃新元素
+        BLOCK        ///< 阻塞生产者直到有空位
+    };
+
+    /**
+     * @brief 解析配置中的溢出策略名称
+     * @param name 策略名称（drop_oldest/drop_newest/block）
+     * @return 策略，无法识别时为DROP_OLDEST
+     */
+    OverflowPolicy parseOverflowPolicy(const std::string &name);
+
+    /**
+     * @brief 获取溢出策略名称
+     * @param policy 策略
+     * @return 与配置相同的名称
+     */
+    const char *getOverflowPolicyName(OverflowPolicy policy);
+
+    /**
+     * @brief 限频报告的丢弃计数
+     *
+     * 丢弃路径上只是一次原子加；报告方按最短间隔取出上次报告以来新增的丢弃数，
+     * 每个间隔至多记录一条日志，而不是每丢一个数据项一条。
+     */
+    class DropCounter
+    {
+    public:
+        /**
+         * @brief 记录丢弃
+         * @param count 丢弃数
+         */
+        void add(uint64_t count = 1)
+        {
+            dropped_.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 获取累计丢弃数
+         * @return 丢弃数
+         */
+        uint64_t getTotal() const
+        {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 限频取出待报告的丢弃数
+         *
+         * 距上次报告不足interval时返回0；否则返回上次报告以来新增的丢弃数，
+         * 并发调用时只有一个调用者取到。
+         *
+         * @param interval 最短报告间隔
+         * @return 待报告的丢弃数
+         */
+        uint64_t takeToReport(std::chrono::nanoseconds interval)
+        {
+            const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count();
+            int64_t last = lastReportNs_.load(std::memory_order_relaxed);
+            if (last != 0 && now - last < interval.count())
+            {
+                return 0;
+            }
+            if (!lastReportNs_.compare_exchange_strong(last, now, std::memory_order_relaxed))
+            {
+                return 0;
+            }
+            const uint64_t total = dropped_.load(std::memory_order_relaxed);
+            return total - reportedDrops_.exchange(total, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> dropped_{0};       ///< 累计丢弃数
+        std::atomic<uint64_t> reportedDrops_{0}; ///< 已报告的丢弃数
+        std::atomic<int64_t> lastReportNs_{0};   ///< 上次报告时间（steady_clock纳秒）
+    };
+
+    /**
+     * @brief 入队结果
+     */
+    enum class RingPushResult
+    {
+        QUEUED,                ///< 已入队
+        QUEUED_DROPPED_OLDEST, ///< 已入队，为此丢弃了最旧的元素
+        DROPPED_NEWEST,        ///< 缓冲区已满，新元素被丢弃
+        CLOSED                 ///< 缓冲区已关闭（阻塞等待期间被关闭），元素被丢弃
+    };
+
+    /**
+     * @brief 带溢出策略的有界环形缓冲区
+     * @tparam T 元素类型（需可默认构造和移动）
+     *
+     * @note singleProducer为true时push()只能由一个线程调用；其余方法都是线程安全的
+     */
+    template <typename T>
+    class OverflowRing
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 容量（向上取整到2的幂）
+         * @param policy 缓冲区满时的处理策略
+         * @param singleProducer 是否只有一个生产者线程（使用SPSC环形队列）
+         */
+        OverflowRing(size_t capacity, OverflowPolicy policy, bool singleProducer)
+            : policy_(policy)
+        {
+            if (singleProducer)
+            {
+                spsc_.reset(new SpscRingQueue<T>(capacity));
+            }
+            else
+            {
+                mpmc_.reset(new MpmcRingQueue<T>(capacity));
+            }
+        }
+
+        OverflowRing(const OverflowRing &) = delete;
+        OverflowRing &operator=(const OverflowRing &) = delete;
+
+        /**
+         * @brief 按溢出策略入队
+         * @param item 元素
+         * @return 入队结果
+         */
+        RingPushResult push(T item)
+        {
+            return push(std::move(item), []()
+                        { return false; },
+                        []() {});
+        }
+
+        /**
+         * @brief 按溢出策略入队，block策略等待空位期间可以插入其他工作
+         *
+         * 生产者线程阻塞在满缓冲区上时，pending()成立会中断等待并在该线程上执行service()，
+         * 之后继续等待空位。用于让接收线程在下游停滞时仍能执行控制消息；
+         * 投递方在pending()变为成立后应调用wakeBlockedProducers()。
+         *
+         * @param item 元素
+         * @param pending 是否有需要在等待期间执行的工作
+         * @param service 执行该工作
+         * @return 入队结果
+         */
+        template <typename Pending, typename Service>
+        RingPushResult push(T item, Pending pending, Service service)
+        {
+            RingPushResult result = RingPushResult::QUEUED;
+            for (;;)
+            {
+                if (closed_.load(std::memory_order_acquire) && policy_ == OverflowPolicy::BLOCK)
+                {
+                    return RingPushResult::CLOSED;
+                }
+                if (tryPushOnce(item))
+                {
+                    notEmpty_.notifyOne();
+                    return result;
+                }
+
+                switch (policy_)
+                {
+                case OverflowPolicy::DROP_NEWEST:
+                    drops_.add();
+                    return RingPushResult::DROPPED_NEWEST;
+
+                case OverflowPolicy::DROP_OLDEST:
+                {
+                    // 消费者可能同时取走元素，腾出空位后重新尝试入队即可
+                    T oldest;
+                    if (tryPopBatchOnce(&oldest, 1) == 1)
+                    {
+                        drops_.add();
+                        result = RingPushResult::QUEUED_DROPPED_OLDEST;
+                    }
+                    break;
+                }
+
+                case OverflowPolicy::BLOCK:
+                    notFull_.await([this, &pending]()
+                                   { return closed_.load(std::memory_order_acquire) || size() < capacity() || pending(); });
+                    if (pending())
+                    {
+                        service();
+                    }
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @brief 非阻塞出队
+         * @param item 输出参数，出队的元素
+         * @return 缓冲区为空时返回false
+         */
+        bool tryPop(T &item)
+        {
+            return tryPopBatch(&item, 1) == 1;
+        }
+
+        /**
+         * @brief 非阻塞批量出队
+         * @param items 输出数组，至少maxCount个元素
+         * @param maxCount 最多取出的元素数
+         * @return 取出的元素数，缓冲区为空时为0
+         */
+        size_t tryPopBatch(T *items, size_t maxCount)
+        {
+            const size_t count = tryPopBatchOnce(items, maxCount);
+            if (count > 0 && policy_ == OverflowPolicy::BLOCK)
+            {
+                notFull_.notifyMany(static_cast<uint32_t>(count));
+            }
+            return count;
+        }
+
+        /**
+         * @brief 出队，缓冲区为空时先自旋再休眠，直到有元素或缓冲区关闭
+         * @param item 输出参数，出队的元素
+         * @return 取到元素返回true，缓冲区关闭时返回false
+         */
+        bool pop(T &item)
+        {
+            return popBatch(&item, 1) == 1;
+        }
+
+        /**
+         * @brief 出队，缓冲区为空时先自旋再休眠，直到有元素、超时或缓冲区关闭
+         * @param item 输出参数，出队的元素
+         * @param timeout 超时时间
+         * @return 取到元素返回true，超时或缓冲区关闭时返回false
+         */
+        bool popFor(T &item, std::chrono::nanoseconds timeout)
+        {
+            return popBatchFor(&item, 1, timeout) == 1;
+        }
+
+        /**
+         * @brief 批量出队：只为第一个元素等待，之后取走已缓冲的元素直到maxCount
+         * @param items 输出数组，至少maxCount个元素
+         * @param maxCount 最多取出的元素数
+         * @return 取出的元素数，缓冲区关闭时为0
+         */
+        size_t popBatch(T *items, size_t maxCount)
+        {
+            size_t count = 0;
+            if (maxCount > 0)
+            {
+                notEmpty_.await([this, items, maxCount, &count]()
+                                { return readyToReturn(items, maxCount, count); });
+            }
+            return count;
+        }
+
+        /**
+         * @brief 批量出队：只为第一个元素等待（有超时），之后取走已缓冲的元素直到maxCount
+         * @param items 输出数组，至少maxCount个元素
+         * @param maxCount 最多取出的元素数
+         * @param timeout 超时时间
+         * @return 取出的元素数，超时或缓冲区关闭时为0
+         */
+        size_t popBatchFor(T *items, size_t maxCount, std::chrono::nanoseconds timeout)
+        {
+            size_t count = 0;
+            if (maxCount > 0)
+            {
+                notEmpty_.awaitFor([this, items, maxCount, &count]()
+                                   { return readyToReturn(items, maxCount, count); },
+                                   timeout);
+            }
+            return count;
+        }
+
+        /**
+         * @brief 关闭缓冲区：唤醒所有等待的生产者与消费者，之后的阻塞出队立即返回
+         */
+        void close()
+        {
+            closed_.store(true, std::memory_order_release);
+            notEmpty_.notifyAll();
+            notFull_.notifyAll();
+        }
+
+        /**
+         * @brief 唤醒阻塞在满缓冲区上的生产者，使其重新检查push()的pending条件
+         */
+        void wakeBlockedProducers()
+        {
+            notFull_.notifyAll();
+        }
+
+        /**
+         * @brief 重新打开缓冲区（重新启动时调用）
+         */
+        void reopen()
+        {
+            closed_.store(false, std::memory_order_release);
+        }
+
+        /**
+         * @brief 检查缓冲区是否已关闭
+         * @return 是否已关闭
+         */
+        bool isClosed() const
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief 丢弃缓冲区中的全部元素
+         * @return 丢弃的元素数
+         */
+        size_t clear()
+        {
+            size_t count = 0;
+            T item;
+            while (tryPopBatchOnce(&item, 1) == 1)
+            {
+                ++count;
+            }
+            notFull_.notifyAll();
+            return count;
+        }
+
+        /**
+         * @brief 获取元素数量（近似值）
+         * @return 元素数量
+         */
+        size_t size() const
+        {
+            return spsc_ ? spsc_->size() : mpmc_->size();
+        }
+
+        /**
+         * @brief 获取容量
+         * @return 容量（2的幂）
+         */
+        size_t capacity() const
+        {
+            return spsc_ ? spsc_->capacity() : mpmc_->capacity();
+        }
+
+        /**
+         * @brief 获取溢出策略
+         * @return 溢出策略
+         */
+        OverflowPolicy getPolicy() const
+        {
+            return policy_;
+        }
+
+        /**
+         * @brief 是否为单生产者（SPSC）模式
+         * @return 是否为单生产者模式
+         */
+        bool isSingleProducer() const
+        {
+            return spsc_ != nullptr;
+        }
+
+        /**
+         * @brief 获取因溢出丢弃的元素总数
+         * @return 丢弃数
+         */
+        uint64_t getDroppedCount() const
+        {
+            return drops_.getTotal();
+        }
+
+        /**
+         * @brief 限频取出待报告的丢弃数
+         * @param interval 最短报告间隔
+         * @return 待报告的丢弃数
+         * @see DropCounter::takeToReport
+         */
+        uint64_t takeDropsToReport(std::chrono::nanoseconds interval)
+        {
+            return drops_.takeToReport(interval);
+        }
+
+    private:
+        /**
+         * @brief 入队一次，不处理溢出
+         */
+        bool tryPushOnce(T &item)
+        {
+            return spsc_ ? spsc_->tryPush(item) : mpmc_->tryPush(item);
+        }
+
+        /**
+         * @brief 批量出队一次（SPSC模式下为空时不加锁，否则只加一次锁）
+         */
+        size_t tryPopBatchOnce(T *items, size_t maxCount)
+        {
+            if (!spsc_)
+            {
+                size_t count = 0;
+                while (count < maxCount && mpmc_->tryPop(items[count]))
+                {
+                    ++count;
+                }
+                return count;
+            }
+            if (spsc_->empty())
+            {
+                return 0;
+            }
+            std::lock_guard<std::mutex> lock(consumerMutex_);
+            return spsc_->tryPopBatch(items, maxCount);
+        }
+
+        /**
+         * @brief 阻塞出队的等待条件：关闭时立即返回（不再交付），否则尝试出队
+         */
+        bool readyToReturn(T *items, size_t maxCount, size_t &count)
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return true;
+            }
+            count = tryPopBatch(items, maxCount);
+            return count > 0;
+        }
+
+        const OverflowPolicy policy_;            ///< 溢出策略
+        std::unique_ptr<SpscRingQueue<T>> spsc_; ///< 单生产者时的底层队列
+        std::unique_ptr<MpmcRingQueue<T>> mpmc_; ///< 多生产者时的底层队列
+        std::mutex consumerMutex_;               ///< SPSC模式下串行化出队方
+        EventCount notEmpty_;                    ///< 有元素通知
+        EventCount notFull_;                     ///< 有空位通知（仅block策略）
+        std::atomic<bool> closed_{false};        ///< 是否已关闭
+        DropCounter drops_;                      ///< 因溢出丢弃的元素数
+    };
+
+} // namespace radar
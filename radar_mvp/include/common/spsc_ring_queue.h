@@ -0,0 +1,176 @@
+/**
+ * @file spsc_ring_queue.h
+ * @brief 有界无锁单生产者单消费者环形队列
+ *
+ * 生产者只写入队下标，消费者只写出队下标，双方各自缓存对方的下标：
+ * 只有缓存显示队列满（或空）时才读取对方所在的缓存行，入队与出队都没有CAS。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see MpmcRingQueue
+ * @see OverflowRing
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace radar
+{
+
+    /**
+     * @brief 有界无锁SPSC环形队列
+     * @tparam T 元素类型（需可默认构造和移动）
+     *
+     * @note tryPush()只能由一个线程（生产者）调用，tryPop()/tryPopBatch()只能由一个线程（消费者）调用；
+     *       消费者角色可以在线程间转交，但转交双方之间需要有同步（例如互斥锁）。
+     *       size()与empty()可在任意线程调用，并发访问时为近似值
+     */
+    template <typename T>
+    class SpscRingQueue
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 容量（向上取整到2的幂，至少为2）
+         */
+        explicit SpscRingQueue(size_t capacity = 1024)
+        {
+            size_t rounded = 2;
+            while (rounded < capacity)
+            {
+                rounded <<= 1;
+            }
+            capacity_ = rounded;
+            mask_ = rounded - 1;
+            slots_.reset(new T[rounded]);
+        }
+
+        SpscRingQueue(const SpscRingQueue &) = delete;
+        SpscRingQueue &operator=(const SpscRingQueue &) = delete;
+
+        /**
+         * @brief 入队（仅生产者）
+         * @param item 元素（成功时被移走）
+         * @return 队列已满时返回false
+         */
+        bool tryPush(T &item)
+        {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - cachedHead_ == capacity_)
+            {
+                cachedHead_ = head_.load(std::memory_order_acquire);
+                if (tail - cachedHead_ == capacity_)
+                {
+                    return false;
+                }
+            }
+
+            slots_[tail & mask_] = std::move(item);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 出队（仅消费者）
+         * @param item 输出参数，出队的元素
+         * @return 队列为空时返回false
+         */
+        bool tryPop(T &item)
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (head == cachedTail_)
+            {
+                cachedTail_ = tail_.load(std::memory_order_acquire);
+                if (head == cachedTail_)
+                {
+                    return false;
+                }
+            }
+
+            T &slot = slots_[head & mask_];
+            item = std::move(slot);
+            slot = T(); // 及时释放元素持有的资源（如shared_ptr）
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 批量出队（仅消费者）
+         *
+         * 一次读取入队下标、一次发布出队下标，取走至多maxCount个元素。
+         *
+         * @param items 输出数组，至少maxCount个元素
+         * @param maxCount 最多取出的元素数
+         * @return 取出的元素数，队列为空时为0
+         */
+        size_t tryPopBatch(T *items, size_t maxCount)
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (cachedTail_ - head < maxCount)
+            {
+                cachedTail_ = tail_.load(std::memory_order_acquire);
+            }
+
+            const size_t available = cachedTail_ - head;
+            const size_t count = available < maxCount ? available : maxCount;
+            for (size_t i = 0; i < count; ++i)
+            {
+                T &slot = slots_[(head + i) & mask_];
+                items[i] = std::move(slot);
+                slot = T();
+            }
+            if (count > 0)
+            {
+                head_.store(head + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * @brief 获取元素数量（近似值）
+         * @return 元素数量
+         */
+        size_t size() const
+        {
+            const size_t head = head_.load(std::memory_order_acquire);
+            const size_t tail = tail_.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        /**
+         * @brief 检查是否为空（近似值）
+         * @return 是否为空
+         */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief 获取容量
+         * @return 容量
+         */
+        size_t capacity() const
+        {
+            return capacity_;
+        }
+
+    private:
+        std::unique_ptr<T[]> slots_; ///< 槽位数组
+        size_t capacity_ = 0;        ///< 容量（2的幂）
+        size_t mask_ = 0;            ///< 下标掩码
+
+        alignas(64) std::atomic<size_t> head_{0}; ///< 下一个出队位置（消费者写）
+        size_t cachedTail_ = 0;                   ///< 消费者缓存的入队位置
+        alignas(64) std::atomic<size_t> tail_{0}; ///< 下一个入队位置（生产者写）
+        size_t cachedHead_ = 0;                   ///< 生产者缓存的出队位置
+    };
+
+} // namespace radar
@@ -22,6 +22,7 @@
 #include <string>
 #include <cstdint>
 #include <complex>
+#include <map>
 
 namespace radar
 {
@@ -88,6 +89,34 @@ namespace radar
     // 配置参数结构体
     //==============================================================================
 
+    /**
+     * @brief 线程放置配置参数
+     * @details 控制模块线程的CPU亲和性、NUMA节点与实时调度策略，对应配置文件中各模块的placement节。
+     *          多个工作线程按下标依次分配：先按numaNodes轮流选节点，再在节点内的CPU中轮流选一个（pinPerCpu）
+     */
+    struct ThreadPlacementConfig
+    {
+        std::vector<uint32_t> cpus;          ///< 允许运行的CPU（为空表示不限制，通常取isolcpus隔离出的核）
+        std::vector<int32_t> numaNodes;      ///< 工作线程轮流分配到的NUMA节点（与cpus取交集）
+        bool pinPerCpu = false;              ///< 是否每个线程只绑定一个CPU（否则可在整个集合内迁移）
+        std::string realtimePolicy = "none"; ///< 实时调度策略（none/fifo/rr），缺少CAP_SYS_NICE时回退为普通调度
+        int32_t realtimePriority = 50;       ///< 实时优先级（1~99）
+    };
+
+    /**
+     * @brief 线程实际放置状态
+     * @details 线程完成放置后从内核读回的结果，而不是配置的期望值
+     */
+    struct ThreadPlacementStatus
+    {
+        std::string threadName;                 ///< 线程名称
+        std::vector<uint32_t> cpus;             ///< 允许运行的CPU
+        int32_t numaNode = -1;                  ///< 所在NUMA节点（CPU跨节点或未知时为-1）
+        std::string schedulingPolicy = "other"; ///< 调度策略（other/fifo/rr）
+        int32_t priority = 0;                   ///< 实时优先级（普通调度为0）
+        bool realtimeFallback = false;          ///< 请求了实时调度但权限不足，已回退为普通调度
+    };
+
     /**
      * @brief 数据接收配置参数
      * @details 控制数据接收模块的行为参数
@@ -99,7 +128,28 @@ namespace radar
         uint32_t packetSizeBytes = 4096;            ///< 数据包大小(字节)
         uint32_t generationIntervalMs = 10;         ///< 数据生成间隔(毫秒)
         uint32_t maxQueueSize = 1000;               ///< 最大队列大小
-        std::string overflowPolicy = "drop_oldest"; ///< 溢出处理策略
+        std::string overflowPolicy = "drop_oldest"; ///< 溢出处理策略（drop_oldest/drop_newest/block）
+        uint32_t producerThreads = 1;               ///< 向接收缓冲区写入的线程数（1时使用SPSC环形队列）
+        ThreadPlacementConfig threadPlacement;      ///< 接收线程放置
+        std::string backpressurePolicy = "none";    ///< 下游无信用时的处理（none/throttle/drop）
+        uint32_t backpressureMaxWaitMs = 50;        ///< throttle策略下每个数据包最长等待信用的时间(毫秒)
+        uint32_t sensorId = 0;                      ///< 传感器（阵列）编号，写入每个数据包，调度时作为租户
+    };
+
+    /**
+     * @brief 处理阶段配置参数
+     * @details 描述处理阶段图（DAG）中的单个节点，对应配置文件中
+     *          data_processor.pipeline.stages 列表的一项
+     */
+    struct ProcessingStageConfig
+    {
+        std::string name;                      ///< 阶段实例名称（图内唯一）
+        std::string type;                      ///< 阶段类型（fft, filter, detect, beamform）
+        std::vector<std::string> inputs;       ///< 上游阶段名称（"input"表示原始数据包）
+        std::string output;                    ///< 结果映射（range_profile, doppler_spectrum, beamformed）
+        bool enabled = true;                   ///< 是否启用（禁用时下游直接连接到本阶段的输入）
+        bool optional = false;                 ///< 是否可选（过载降级时可跳过，如MVDR等自适应处理）
+        std::map<std::string, double> params;  ///< 阶段参数
     };
 
     /**
@@ -108,12 +158,30 @@ namespace radar
      */
     struct DataProcessorConfig
     {
-        ProcessingStrategy strategy = ProcessingStrategy::CPU_BASIC; ///< 处理策略
-        uint32_t workerThreads = 4;                                  ///< 工作线程数量
-        uint32_t batchSize = 16;                                     ///< 批处理大小
-        uint32_t processingTimeoutMs = 100;                          ///< 处理超时时间(毫秒)
-        uint32_t gpuDeviceId = 0;                                    ///< GPU设备ID
-        uint32_t memoryPoolMb = 256;                                 ///< 内存池大小(MB)
+        ProcessingStrategy strategy = ProcessingStrategy::CPU_BASIC;      ///< 处理策略
+        uint32_t workerThreads = 4;                                       ///< 工作线程数量
+        uint32_t batchSize = 16;                                          ///< 批处理大小（自适应批处理的初始值）
+        bool adaptiveBatching = true;                                     ///< 是否按延迟预算自适应调整批大小
+        uint32_t processingTimeoutMs = 100;                               ///< 处理超时时间，同时作为端到端延迟预算(毫秒)
+        uint32_t gpuDeviceId = 0;                                         ///< GPU设备ID
+        uint32_t memoryPoolMb = 256;                                      ///< 内存池大小(MB)
+        std::vector<ProcessingStageConfig> pipelineStages;                ///< 处理阶段图（为空时使用默认处理链）
+        bool intraPacketParallel = true;                                  ///< 大数据包是否启用包内并行
+        uint64_t parallelThresholdElements = 64 * 1024;                   ///< 包内并行阈值（单阶段处理元素数）
+        bool loadSheddingEnabled = true;                                  ///< 是否启用截止时间准入控制与过载降级
+        std::vector<uint32_t> degradationBacklogThresholds{4, 8, 16, 32}; ///< 进入各降级级别的积压数据包阈值（递增）
+        ThreadPlacementConfig threadPlacement;                            ///< 处理线程与包内并行工作线程放置
+    };
+
+    /**
+     * @brief 调度租户配置
+     * @details 一个租户对应一路传感器（阵列）的处理流水线，多个租户共享同一个工作线程池
+     */
+    struct TenantConfig
+    {
+        uint32_t id = 0;     ///< 租户编号（与数据包的sensorId对应）
+        std::string name;    ///< 租户名称
+        uint32_t weight = 1; ///< 权重，繁忙时按权重比例分配工作线程的CPU时间
     };
 
     /**
@@ -122,12 +190,29 @@ namespace radar
      */
     struct TaskSchedulerConfig
     {
-        uint32_t coreThreads = 4;              ///< 核心线程数
-        uint32_t maxThreads = 8;               ///< 最大线程数
-        uint32_t queueCapacity = 500;          ///< 队列容量
-        uint32_t keepAliveMs = 60000;          ///< 线程存活时间(毫秒)
-        std::string schedulingPolicy = "fifo"; ///< 调度策略
-        uint32_t maxRetryCount = 3;            ///< 最大重试次数
+        uint32_t coreThreads = 4;               ///< 核心线程数
+        uint32_t maxThreads = 8;                ///< 最大线程数
+        uint32_t queueCapacity = 500;           ///< 队列容量（等待执行的任务数上限）
+        std::string queueFullPolicy = "reject"; ///< 队列满时的提交策略（block/reject/drop_by_priority）
+        uint32_t queueFullBlockMs = 100;        ///< block策略下提交者最长阻塞时间(毫秒)，超时后拒绝
+        uint32_t keepAliveMs = 60000;           ///< 线程存活时间(毫秒)
+        uint32_t scaleUpWaitUs = 2000;          ///< 排队等待持续超过该值时增加线程(微秒)
+        std::string schedulingPolicy = "fifo";  ///< 调度策略（fifo/priority/edf）
+        std::string loadBalancePolicy = "p2c";  ///< 负载均衡调度器选择处理器实例的方式（jsq/p2c）
+        uint32_t stickyRouteCapacity = 4096;    ///< 负载均衡调度器最多固定的亲和键数，超出时淘汰最久未出现的键
+        uint32_t maxRetryCount = 3;             ///< 最大重试次数
+
+        // 最早截止时间优先（EDF）调度：截止时间 = 数据采集时间戳 + 所属优先级的延迟预算
+        std::string deadlineMissPolicy = "demote"; ///< 错过截止时间的处理策略（drop/demote）
+        uint32_t latencyBudgetLowMs = 200;         ///< LOW优先级延迟预算（毫秒）
+        uint32_t latencyBudgetNormalMs = 100;      ///< NORMAL优先级延迟预算（毫秒）
+        uint32_t latencyBudgetHighMs = 50;         ///< HIGH优先级延迟预算（毫秒）
+        uint32_t latencyBudgetCriticalMs = 20;     ///< CRITICAL优先级延迟预算（毫秒）
+
+        ThreadPlacementConfig threadPlacement; ///< 工作线程与定时器线程放置
+
+        // 多传感器共享同一线程池：按租户加权公平调度，为空时不启用
+        std::vector<TenantConfig> tenants; ///< 租户及权重（未列出的租户任务归入0号默认租户）
     };
 
     /**
@@ -158,6 +243,7 @@ namespace radar
         uint32_t maxFileSize = 100 * 1024 * 1024;         ///< 最大文件大小(字节)
         bool compressionEnabled = false;                  ///< 是否启用压缩
         std::string timestampFormat = "ISO8601";          ///< 时间戳格式
+        ThreadPlacementConfig threadPlacement;            ///< 显示线程放置
     };
 
     /**
@@ -203,6 +289,48 @@ namespace radar
         std::string schedulerInfo;                    ///< 调度器信息描述
     };
 
+    /**
+     * @brief 线程池线程数变化记录
+     */
+    struct ThreadPoolSizeSample
+    {
+        Timestamp timestamp;      ///< 变化时间
+        uint32_t threadCount = 0; ///< 变化后的线程数
+        uint64_t queueWaitUs = 0; ///< 变化时观测到的最长排队等待（微秒）
+    };
+
+    /**
+     * @brief 延迟分布摘要（由直方图聚合，分位数误差不超过约3%）
+     */
+    struct LatencyPercentiles
+    {
+        uint64_t count = 0;  ///< 样本数
+        double meanUs = 0.0; ///< 平均值（微秒）
+        double p50Us = 0.0;  ///< 中位数（微秒）
+        double p90Us = 0.0;  ///< 90分位（微秒）
+        double p99Us = 0.0;  ///< 99分位（微秒）
+        double p999Us = 0.0; ///< 99.9分位（微秒）
+        double maxUs = 0.0;  ///< 最大值（微秒，精确值）
+    };
+
+    /**
+     * @brief 租户（传感器）调度状态
+     */
+    struct TenantStatus
+    {
+        uint32_t id = 0;                     ///< 租户编号
+        std::string name;                    ///< 租户名称
+        uint32_t weight = 0;                 ///< 权重
+        double configuredShare = 0.0;        ///< 按权重应得的CPU份额（0~1，所有租户都繁忙时）
+        double cpuShare = 0.0;               ///< 实际获得的CPU份额（0~1）
+        uint32_t pendingTasks = 0;           ///< 等待任务数
+        uint64_t completedTasks = 0;         ///< 已执行任务数
+        double cpuTimeMs = 0.0;              ///< 累计执行时间（毫秒）
+        double throughputTasksPerSec = 0.0;  ///< 吞吐量（任务/秒）
+        LatencyPercentiles queueWaitLatency; ///< 等待分布
+        LatencyPercentiles executionLatency; ///< 执行时间分布
+    };
+
     /**
      * @brief 调度器状态信息
      * @details 描述任务调度器的当前运行状态
@@ -215,7 +343,22 @@ namespace radar
         uint32_t failedTasks = 0;                                ///< 失败任务数
         double averageExecutionTimeMs = 0.0;                     ///< 平均执行时间（毫秒）
         double throughputTasksPerSec = 0.0;                      ///< 吞吐量（任务/秒）
+        uint64_t deadlineMisses = 0;                             ///< 错过截止时间的任务数
+        double deadlineMissRate = 0.0;                           ///< 截止时间错过率（0~1）
         ModuleState schedulerState = ModuleState::UNINITIALIZED; ///< 调度器状态
+        std::vector<ThreadPlacementStatus> workerPlacement;      ///< 各工作线程的实际放置（按工作线程下标）
+        uint32_t poolThreads = 0;                                ///< 当前工作线程数（弹性伸缩后）
+        uint32_t queueCapacity = 0;                              ///< 等待队列容量（0表示不限）
+        double queueOccupancy = 0.0;                             ///< 等待队列占用率（0~1）
+        uint64_t rejectedTasks = 0;                              ///< 因队列满被拒绝的任务数
+        uint64_t blockedSubmissions = 0;                         ///< 因队列满阻塞过的提交数
+        uint64_t preemptions = 0;                                ///< 长任务在检查点让出给高优先级任务的次数
+        double averagePreemptionLatencyUs = 0.0;                 ///< 抢占执行的任务从提交到开始的平均等待（微秒）
+        uint64_t maxPreemptionLatencyUs = 0;                     ///< 抢占执行的任务从提交到开始的最长等待（微秒）
+        std::vector<ThreadPoolSizeSample> poolSizeHistory;       ///< 最近的线程数变化（时间升序）
+        LatencyPercentiles queueWaitLatency;                     ///< 任务从提交到开始执行的等待分布
+        LatencyPercentiles executionLatency;                     ///< 任务执行时间分布
+        std::vector<TenantStatus> tenants;                       ///< 各租户的份额、吞吐量与延迟（启用公平共享时）
     };
 
     //==============================================================================
@@ -232,6 +375,7 @@ namespace radar
         Timestamp timestamp;        ///< 数据采集时间戳
         uint64_t sequenceId;        ///< 数据包序列号
         PacketPriority priority;    ///< 数据包优先级
+        uint32_t sensorId = 0;      ///< 来源传感器（阵列）编号
         uint32_t channelCount;      ///< 通道数量
         uint32_t samplesPerChannel; ///< 每通道采样点数
 
@@ -276,9 +420,10 @@ namespace radar
      */
     struct ProcessingResult
     {
-        Timestamp processingTime; ///< 处理完成时间戳
-        uint64_t sourcePacketId;  ///< 源数据包ID
-        bool processingSuccess;   ///< 处理是否成功
+        Timestamp processingTime;     ///< 处理完成时间戳
+        uint64_t sourcePacketId;      ///< 源数据包ID
+        bool processingSuccess;       ///< 处理是否成功
+        uint8_t degradationLevel = 0; ///< 处理时的降级级别（0表示完整处理链，见DegradationLevel）
 
         /// 处理后的数据
         AlignedFloatVector rangeProfile;    ///< 距离剖面数据
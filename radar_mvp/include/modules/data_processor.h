@@ -14,25 +14,34 @@
  * @see IDataProcessor
  * @see CPUDataProcessor
  * @see GPUDataProcessor
+ * @see StaticPipelineProcessor
+ * @see StageGraph
+ * @see AdmissionController
  */
 
 #pragma once
 
 #include "common/interfaces.h"
 #include "common/types.h"
+#include "common/control_lane.h"
 #include "common/error_codes.h"
+#include "common/event_count.h"
 #include "common/logger.h"
+#include "common/thread_placement.h"
+#include "modules/data_processor/adaptive_batch_controller.h"
+#include "modules/data_processor/admission_controller.h"
+#include "modules/data_processor/processing_stage.h"
+#include "modules/data_processor/stage_graph.h"
+#include "modules/data_processor/static_pipeline.h"
 #include <thread>
 #include <queue>
 #include <mutex>
-#include <condition_variable>
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 #include <chrono>
-#include <future>
 
 namespace radar
 {
@@ -52,6 +61,12 @@ namespace radar
         std::atomic<double> cpuUsagePercent{0.0};         ///< CPU使用率
         std::atomic<double> gpuUsagePercent{0.0};         ///< GPU使用率（如果适用）
         std::atomic<size_t> memoryUsageBytes{0};          ///< 内存使用量（字节）
+        std::atomic<uint64_t> expiredPackets{0};          ///< 超过截止时间被丢弃的数据包数
+        std::atomic<uint64_t> shedPackets{0};             ///< 过载丢弃的低优先级数据包数
+        std::atomic<uint64_t> degradedPackets{0};         ///< 降级处理的数据包数
+        std::atomic<uint8_t> degradationLevel{0};         ///< 最近一次处理的降级级别
+        std::atomic<uint32_t> currentBatchSize{0};        ///< 异步处理的当前批大小
+        std::atomic<double> p99LatencyMs{0.0};            ///< 异步处理的p99端到端延迟（毫秒）
 
         std::chrono::system_clock::time_point startTime_;      ///< 开始处理时间
         std::chrono::system_clock::time_point lastUpdateTime_; ///< 最后更新时间
@@ -69,6 +84,12 @@ namespace radar
             cpuUsagePercent = 0.0;
             gpuUsagePercent = 0.0;
             memoryUsageBytes = 0;
+            expiredPackets = 0;
+            shedPackets = 0;
+            degradedPackets = 0;
+            degradationLevel = 0;
+            currentBatchSize = 0;
+            p99LatencyMs = 0.0;
             startTime_ = std::chrono::system_clock::now();
             lastUpdateTime_ = startTime_;
         }
@@ -103,6 +124,12 @@ namespace radar
             snapshot.cpuUsagePercent = cpuUsagePercent.load();
             snapshot.gpuUsagePercent = gpuUsagePercent.load();
             snapshot.memoryUsageBytes = memoryUsageBytes.load();
+            snapshot.expiredPackets = expiredPackets.load();
+            snapshot.shedPackets = shedPackets.load();
+            snapshot.degradedPackets = degradedPackets.load();
+            snapshot.degradationLevel = degradationLevel.load();
+            snapshot.currentBatchSize = currentBatchSize.load();
+            snapshot.p99LatencyMs = p99LatencyMs.load();
             snapshot.startTime_ = startTime_;
             snapshot.lastUpdateTime_ = lastUpdateTime_;
         }
@@ -135,6 +162,8 @@ namespace radar
         using StateChangeCallback = std::function<void(ModuleState, ModuleState)>;
 
     protected:
+        using PendingTask = std::pair<RawDataPacketPtr, Promise<ProcessingResultPtr>>; ///< 排队的处理任务
+
         std::thread processingThread_;                                      ///< 数据处理线程
         std::atomic<bool> running_{false};                                  ///< 运行状态标志
         std::atomic<bool> shouldStop_{false};                               ///< 停止请求标志
@@ -144,16 +173,23 @@ namespace radar
         ErrorCallback errorCallback_;                   ///< 错误处理回调函数
         StateChangeCallback stateChangeCallback_;       ///< 状态变化回调函数
 
-        mutable std::mutex statsMutex_;         ///< 统计信息互斥锁
-        mutable std::mutex taskQueueMutex_;     ///< 任务队列互斥锁
-        std::condition_variable taskAvailable_; ///< 任务可用条件变量
+        mutable std::mutex statsMutex_;     ///< 统计信息互斥锁
+        mutable std::mutex taskQueueMutex_; ///< 任务队列互斥锁
+        EventCount taskAvailable_;          ///< 任务可用通知
 
-        std::queue<std::pair<RawDataPacketPtr, std::promise<ProcessingResultPtr>>> taskQueue_; ///< 处理任务队列
-        ProcessingStatistics statistics_;                                                      ///< 处理统计信息
+        std::queue<PendingTask> taskQueue_;       ///< 处理任务队列
+        std::atomic<size_t> queuedTasks_{0};      ///< 队列中的任务数（修改受taskQueueMutex_保护，可无锁读取）
+        std::atomic<size_t> batchedTasks_{0};     ///< 已取入本批、尚未开始处理的任务数（计入准入积压）
+        ProcessingStatistics statistics_;         ///< 处理统计信息
+        AdmissionController admission_;           ///< 截止时间准入控制器
+        AdaptiveBatchController batchController_; ///< 自适应批大小控制器
+        std::atomic<uint32_t> activePackets_{0};  ///< 正在处理的数据包数
+        ControlLane controlLane_;                 ///< 控制通道（绕过数据队列，处理线程在数据包之间执行）
 
         std::shared_ptr<spdlog::logger> logger_;      ///< 日志记录器
         std::unique_ptr<DataProcessorConfig> config_; ///< 配置参数
         ProcessingStrategy currentStrategy_;          ///< 当前处理策略
+        ThreadPlacementConfig threadPlacement_;       ///< 生效的线程放置（initialize时确定，处理线程为下标0）
 
         std::string moduleName_{"DataProcessor"}; ///< 模块名称
 
@@ -199,9 +235,9 @@ namespace radar
         /**
          * @brief 异步处理数据包
          * @param inputPacket 输入数据包
-         * @return 处理结果的future对象
+         * @return 处理结果的Future；处理开始前取消则跳过该数据包
          */
-        std::future<ProcessingResultPtr> processPacketAsync(
+        Future<ProcessingResultPtr> processPacketAsync(
             const RawDataPacketPtr &inputPacket) override;
 
         /**
@@ -238,6 +274,12 @@ namespace radar
          */
         ProcessorCapabilities getCapabilities() const override;
 
+        /**
+         * @brief 获取当前积压的数据包数
+         * @return 队列中等待、已取入本批与正在处理的数据包总数
+         */
+        size_t getQueueDepth() const override;
+
         // IModule 接口实现
         /**
          * @brief 初始化模块
@@ -319,6 +361,40 @@ namespace radar
          */
         void resetStatistics();
 
+        /**
+         * @brief 获取准入控制与降级统计
+         * @return 统计快照（含当前降级级别、各级别处理数、丢弃数）
+         */
+        AdmissionStatistics getAdmissionStatistics() const;
+
+        /**
+         * @brief 获取异步处理的自适应批处理统计
+         * @return 统计快照（含当前批大小与p99延迟）
+         */
+        BatchingStatistics getBatchingStatistics() const;
+
+        /**
+         * @brief 投递控制消息（不经过数据队列）
+         *
+         * 消息在处理线程上、相邻两个异步数据包之间按投递顺序执行，因此可以安全地修改
+         * 异步处理路径使用的参数（如CFAR虚警率、波束集合）。数据队列再满也不影响控制消息：
+         * 延迟上限为一个数据包的处理时间加唤醒时间。
+         *
+         * @param action 控制消息
+         * @return 操作结果错误码
+         * @retval SystemErrors::SUCCESS 已投递
+         * @retval SystemErrors::INVALID_PARAMETER 消息为空
+         * @retval SystemErrors::RESOURCE_UNAVAILABLE 控制通道已满
+         * @note 处理线程未启动时，消息保留到start()之后执行
+         */
+        ErrorCode postControl(ControlLane::Action action);
+
+        /**
+         * @brief 获取控制通道统计
+         * @return 统计快照（含投递到执行的延迟）
+         */
+        ControlLaneStatistics getControlStatistics() const;
+
     protected:
         /**
          * @brief 数据处理主循环（虚函数）
@@ -342,6 +418,31 @@ namespace radar
          */
         virtual ProcessingResultPtr executeProcessing(const RawDataPacketPtr &inputPacket) = 0;
 
+        /**
+         * @brief 按降级级别执行处理算法
+         *
+         * 默认实现忽略降级级别，直接调用executeProcessing()。
+         * 支持降级执行的派生类重写该方法。
+         *
+         * @param inputPacket 输入数据包
+         * @param level 准入控制给出的降级级别
+         * @return 处理结果智能指针
+         */
+        virtual ProcessingResultPtr executeDegraded(const RawDataPacketPtr &inputPacket,
+                                                    DegradationLevel level);
+
+        /**
+         * @brief 准入控制后执行处理（同步与异步处理路径共用）
+         *
+         * @param packet 输入数据包（已通过校验）
+         * @param result 输出参数，处理结果
+         * @return 操作结果错误码
+         * @retval SystemErrors::SUCCESS 已处理（result可能为空，由调用者检查）
+         * @retval DataProcessorErrors::DEADLINE_EXCEEDED 数据包已超过截止时间，未处理
+         * @retval DataProcessorErrors::PACKET_SHED 过载时丢弃的低优先级数据包，未处理
+         */
+        ErrorCode admitAndExecute(const RawDataPacketPtr &packet, ProcessingResultPtr &result);
+
         /**
          * @brief 验证输入数据包
          *
@@ -395,7 +496,7 @@ namespace radar
          * @param promise 结果承诺对象
          */
         void enqueueTask(const RawDataPacketPtr &packet,
-                         std::promise<ProcessingResultPtr> &&promise);
+                         Promise<ProcessingResultPtr> &&promise);
 
         /**
          * @brief 从队列取出处理任务
@@ -406,8 +507,28 @@ namespace radar
          * @return 是否成功取出任务
          */
         bool dequeueTask(RawDataPacketPtr &packet,
-                         std::promise<ProcessingResultPtr> &promise,
+                         Promise<ProcessingResultPtr> &promise,
                          uint32_t timeoutMs = 1000);
+
+        /**
+         * @brief 在一次加锁内从队列取出一批处理任务
+         *
+         * @param tasks 输出参数，追加取出的任务
+         * @param maxTasks 最多取出的任务数
+         * @param remaining 输出参数，取出后队列中剩余的任务数
+         * @param timeoutMs 队列为空时的等待超时（毫秒）
+         * @return 取出的任务数，超时或收到停止信号时返回0
+         */
+        size_t dequeueBatch(std::vector<PendingTask> &tasks, size_t maxTasks,
+                            size_t &remaining, uint32_t timeoutMs = 1000);
+
+        /**
+         * @brief 处理一个排队任务并兑现其promise
+         *
+         * @param task 排队的任务
+         * @return 数据包被处理时返回true（用于延迟统计），被丢弃或失败时返回false
+         */
+        bool runQueuedTask(PendingTask &task);
     };
 
     // =============================================================================
@@ -418,13 +539,16 @@ namespace radar
      * @brief CPU基础数据处理器
      *
      * 基于CPU的基础信号处理实现，适用于低延迟和小数据量场景。
-     * 提供基本的FFT变换、滤波和检测算法。
+     * 处理链由可配置的处理阶段图（StageGraph）描述，默认为
+     * FFT变换→滤波→检测，以及滤波→波束形成。
      *
      * @details
      * 特性：
-     * - 单线程串行处理
+     * - 小数据包单线程串行处理
+     * - 宽阵列/长距离窗的大数据包自动切换为包内并行（共享分叉-汇合线程池），
+     *   降低单包延迟
+     * - 过载时按准入控制给出的降级级别执行：跳过可选阶段、缩减通道、抽取采样点
      * - 内存占用小
-     * - 延迟低但吞吐量有限
      * - 适用于实时性要求高的场景
      *
      * @note 不支持GPU加速
@@ -449,6 +573,23 @@ namespace radar
          */
         ProcessorCapabilities getCapabilities() const override;
 
+        /**
+         * @brief 初始化处理器并构建处理阶段图
+         *
+         * 阶段图来源优先级：DataProcessorConfig::pipelineStages >
+         * 配置文件 data_processor.pipeline > 默认处理链。
+         * DataProcessorConfig::intraPacketParallel为true时启用包内并行。
+         *
+         * @return 操作结果错误码
+         */
+        ErrorCode initialize() override;
+
+        /**
+         * @brief 获取各处理阶段的耗时统计
+         * @return 按执行顺序排列的阶段耗时统计
+         */
+        std::vector<StageTimingInfo> getStageTimings() const;
+
     protected:
         /**
          * @brief 执行CPU处理算法
@@ -457,57 +598,96 @@ namespace radar
          */
         ProcessingResultPtr executeProcessing(const RawDataPacketPtr &inputPacket) override;
 
+        /**
+         * @brief 按降级级别执行阶段图
+         * @param inputPacket 输入数据包
+         * @param level 降级级别（映射为StageExecutionOptions）
+         * @return 处理结果智能指针
+         */
+        ProcessingResultPtr executeDegraded(const RawDataPacketPtr &inputPacket,
+                                            DegradationLevel level) override;
+
     private:
+        StageGraph stageGraph_;                 ///< 处理阶段图执行器
+        std::unique_ptr<ForkJoinPool> ownPool_; ///< 配置了线程放置时独占的包内并行线程池（否则使用共享实例）
+
         /**
-         * @brief 执行FFT变换
-         * @param inputData 输入复数据
-         * @param outputData 输出频域数据
-         * @return 操作结果错误码
+         * @brief 获取当前CPU使用率
+         * @return CPU使用率百分比
          */
-        ErrorCode performFFT(const AlignedComplexVector &inputData,
-                             AlignedComplexVector &outputData);
+        double getCurrentCPUUsage() const;
 
         /**
-         * @brief 执行数字滤波
-         * @param inputData 输入数据
-         * @param outputData 输出数据
-         * @return 操作结果错误码
+         * @brief 估算处理过程的内存使用量
+         * @param packet 输入数据包
+         * @return 估计的内存使用量（字节）
          */
-        ErrorCode performFiltering(const AlignedComplexVector &inputData,
-                                   AlignedComplexVector &outputData);
+        size_t estimateMemoryUsage(const RawDataPacketPtr &packet) const;
+    };
 
+    /**
+     * @brief 编译期流水线数据处理器
+     *
+     * 处理链在编译期由模板参数确定（见pipeline::Pipeline），
+     * 适用于处理链固定、对单包延迟敏感的生产部署。
+     * 与CPUDataProcessor的动态阶段图相比，没有虚函数分派和运行期缓冲区管理，
+     * 查找表均为编译期常量。
+     *
+     * @details
+     * 特性：
+     * - 每通道长度固定为PipelineT::LENGTH，长度不符的数据包在校验阶段被拒绝
+     * - 逐通道执行整条处理链，结果写入rangeProfile
+     * - 成员函数在static_pipeline_processor.cpp中定义并显式实例化，
+     *   新增处理链组合时需同时添加显式实例化
+     *
+     * @tparam PipelineT 编译期流水线类型
+     */
+    template <typename PipelineT>
+    class StaticPipelineProcessor : public DataProcessor
+    {
+    public:
         /**
-         * @brief 执行目标检测
-         * @param inputData 输入数据
-         * @param detectionResults 检测结果
-         * @return 操作结果错误码
+         * @brief 构造函数
+         * @param logger 日志记录器实例
          */
-        ErrorCode performDetection(const AlignedComplexVector &inputData,
-                                   std::vector<double> &detectionResults);
+        explicit StaticPipelineProcessor(std::shared_ptr<spdlog::logger> logger = nullptr);
 
         /**
-         * @brief 执行波束形成
-         * @param inputData 输入多通道数据
-         * @param beamformedData 波束形成结果
-         * @return 操作结果错误码
+         * @brief 析构函数
          */
-        ErrorCode performBeamforming(const std::vector<AlignedComplexVector> &inputData,
-                                     AlignedComplexVector &beamformedData);
+        ~StaticPipelineProcessor() override = default;
 
         /**
-         * @brief 获取当前CPU使用率
-         * @return CPU使用率百分比
+         * @brief 获取处理器能力信息
+         * @return 处理器能力描述
          */
-        double getCurrentCPUUsage() const;
+        ProcessorCapabilities getCapabilities() const override;
 
+    protected:
         /**
-         * @brief 估算处理过程的内存使用量
+         * @brief 执行编译期流水线
+         * @param inputPacket 输入数据包
+         * @return 处理结果智能指针
+         */
+        ProcessingResultPtr executeProcessing(const RawDataPacketPtr &inputPacket) override;
+
+        /**
+         * @brief 验证输入数据包（额外检查每通道采样点数）
          * @param packet 输入数据包
-         * @return 估计的内存使用量（字节）
+         * @return 数据包是否有效
          */
-        size_t estimateMemoryUsage(const RawDataPacketPtr &packet) const;
+        bool validateInputPacket(const RawDataPacketPtr &packet) const override;
+
+    private:
+        PipelineT pipeline_;               ///< 流水线实例（含阶段间缓冲区）
+        mutable std::mutex pipelineMutex_; ///< 流水线互斥锁（缓冲区不可并发使用）
     };
 
+    /// 生产处理链处理器（Hann窗 → 1024点FFT → 求模 → CA-CFAR）
+    using ProductionPipelineProcessor = StaticPipelineProcessor<pipeline::ProductionPipeline>;
+
+    extern template class StaticPipelineProcessor<pipeline::ProductionPipeline>;
+
     /**
      * @brief GPU加速数据处理器
      *
@@ -663,9 +843,10 @@ namespace radar
          */
         enum class ProcessorType
         {
-            CPU_PROCESSOR,   ///< CPU处理器
-            GPU_PROCESSOR,   ///< GPU处理器
-            HYBRID_PROCESSOR ///< 混合处理器（预留）
+            CPU_PROCESSOR,            ///< CPU处理器
+            GPU_PROCESSOR,            ///< GPU处理器
+            HYBRID_PROCESSOR,         ///< 混合处理器（预留）
+            STATIC_PIPELINE_PROCESSOR ///< 编译期流水线处理器（生产处理链）
         };
 
         /**
@@ -690,6 +871,19 @@ namespace radar
             const DataProcessorConfig &config,
             std::shared_ptr<spdlog::logger> logger = nullptr);
 
+        /**
+         * @brief 创建编译期流水线数据处理器
+         *
+         * 处理链为pipeline::ProductionPipeline，要求每通道采样点数与其长度一致。
+         *
+         * @param config 处理器配置
+         * @param logger 日志记录器实例
+         * @return 处理器智能指针，创建失败时返回 nullptr
+         */
+        std::unique_ptr<ProductionPipelineProcessor> createStaticPipelineProcessor(
+            const DataProcessorConfig &config,
+            std::shared_ptr<spdlog::logger> logger = nullptr);
+
         /**
          * @brief 自动创建合适的数据处理器
          *
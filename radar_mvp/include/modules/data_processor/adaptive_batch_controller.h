@@ -0,0 +1,131 @@
+/**
+ * @file adaptive_batch_controller.h
+ * @brief 面向延迟预算的自适应批大小控制
+ *
+ * 处理线程每次从任务队列中一次性取出至多"当前批大小"个任务。
+ * 批大小按加性增、乘性减（AIMD）调整：
+ * - 队列积压超过一批且p99延迟远低于预算时，增大批大小以摊薄出队与唤醒开销
+ * - p99延迟接近预算时，批大小减半，优先保证延迟
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see DataProcessor::processingLoop
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace radar
+{
+
+    /// 按批大小统计p99的分桶数（1, 2, 4, ..., 128）
+    constexpr size_t BATCH_SIZE_BUCKET_COUNT = 8;
+
+    /**
+     * @brief 自适应批处理策略
+     */
+    struct BatchingPolicy
+    {
+        bool adaptive = true;           ///< 是否自适应调整（关闭时固定为initialBatchSize）
+        uint32_t initialBatchSize = 16; ///< 初始批大小
+        uint32_t minBatchSize = 1;      ///< 最小批大小
+        uint32_t maxBatchSize = 128;    ///< 最大批大小
+        uint32_t latencyBudgetMs = 100; ///< 端到端延迟预算（毫秒）
+        double shrinkRatio = 0.8;       ///< p99超过预算该比例时批大小减半
+        double growRatio = 0.5;         ///< p99低于预算该比例且队列仍有积压时增大批大小
+        uint32_t latencyWindow = 256;   ///< p99统计窗口（最近的延迟样本数）
+    };
+
+    /**
+     * @brief 自适应批处理统计快照
+     */
+    struct BatchingStatistics
+    {
+        uint32_t currentBatchSize = 0;                                ///< 当前批大小
+        uint64_t batchesProcessed = 0;                                ///< 已处理的批次数
+        uint64_t tasksProcessed = 0;                                  ///< 已处理的任务数
+        uint64_t growEvents = 0;                                      ///< 批大小增大次数
+        uint64_t shrinkEvents = 0;                                    ///< 批大小减小次数
+        double averageBatchSize = 0.0;                                ///< 实际平均批大小
+        double p99LatencyMs = 0.0;                                    ///< 最近窗口的p99端到端延迟（毫秒）
+        std::array<double, BATCH_SIZE_BUCKET_COUNT> p99ByBatchSize{}; ///< 各批大小分桶下最近观测到的p99（毫秒）
+    };
+
+    /**
+     * @brief 自适应批大小控制器
+     *
+     * 处理线程在每批处理完成后调用recordBatch()上报本批各任务的延迟和剩余积压，
+     * 控制器据此更新p99并调整下一批的大小。
+     *
+     * @note 所有公共方法都是线程安全的
+     */
+    class AdaptiveBatchController
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param policy 批处理策略
+         */
+        explicit AdaptiveBatchController(const BatchingPolicy &policy = BatchingPolicy());
+
+        /**
+         * @brief 更新策略并重置批大小与统计
+         * @param policy 批处理策略
+         */
+        void configure(const BatchingPolicy &policy);
+
+        /**
+         * @brief 获取下一批的批大小
+         * @return 批大小
+         */
+        uint32_t getBatchSize() const;
+
+        /**
+         * @brief 上报一批处理结果并调整批大小
+         * @param taskCount 本批任务数
+         * @param remainingBacklog 取出本批后队列中剩余的任务数
+         * @param latenciesMs 本批各任务的端到端延迟（毫秒）
+         */
+        void recordBatch(size_t taskCount, size_t remainingBacklog, const std::vector<double> &latenciesMs);
+
+        /**
+         * @brief 获取统计快照
+         * @return 统计信息
+         */
+        BatchingStatistics getStatistics() const;
+
+        /**
+         * @brief 重置批大小与统计
+         */
+        void reset();
+
+    private:
+        /**
+         * @brief 计算窗口内的p99延迟（调用者需持有mutex_）
+         * @return p99延迟（毫秒）
+         */
+        double computeP99Locked();
+
+        /**
+         * @brief 重置状态（调用者需持有mutex_）
+         */
+        void resetLocked();
+
+        BatchingPolicy policy_;             ///< 批处理策略
+        uint32_t batchSize_ = 1;            ///< 当前批大小
+        std::vector<double> latencyWindow_; ///< 延迟样本环形窗口
+        size_t windowNext_ = 0;             ///< 下一个写入位置
+        std::vector<double> scratch_;       ///< p99计算用的临时缓冲区
+        BatchingStatistics statistics_;     ///< 统计信息
+        mutable std::mutex mutex_;          ///< 状态互斥锁
+    };
+
+} // namespace radar
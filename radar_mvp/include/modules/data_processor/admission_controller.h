@@ -0,0 +1,189 @@
+/**
+ * @file admission_controller.h
+ * @brief 基于截止时间的准入控制与分级降级
+ *
+ * 每个数据包的截止时间为采集时间戳（RawDataPacket::timestamp）加上延迟预算。
+ * 准入控制器在数据包开始处理前做出决策：
+ * - 已超过截止时间的数据包直接丢弃（结果已无实时价值）
+ * - 根据积压深度和近期端到端延迟，逐级选择降级级别：
+ *   跳过可选阶段 → 减少处理通道 → 采样点抽取 → 丢弃低优先级数据包
+ * - 积压消退后逐级恢复（带滞回，避免在相邻级别间抖动）
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see DataProcessor
+ * @see StageExecutionOptions
+ */
+
+#pragma once
+
+#include "common/types.h"
+#include "modules/data_processor/stage_graph.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace radar
+{
+
+    /**
+     * @brief 处理降级级别（数值越大降级越深，高级别包含低级别的全部降级措施）
+     */
+    enum class DegradationLevel : uint8_t
+    {
+        FULL = 0,         ///< 完整处理链
+        SKIP_OPTIONAL,    ///< 跳过可选阶段（如MVDR等自适应处理）
+        REDUCED_CHANNELS, ///< 减少参与处理的通道（波束）数
+        DECIMATED,        ///< 采样点抽取
+        SHED_LOW_PRIORITY ///< 丢弃低优先级数据包
+    };
+
+    /// 降级级别数量
+    constexpr size_t DEGRADATION_LEVEL_COUNT = 5;
+
+    /**
+     * @brief 获取降级级别名称
+     * @param level 降级级别
+     * @return 级别名称字符串
+     */
+    const char *getDegradationLevelName(DegradationLevel level);
+
+    /**
+     * @brief 准入控制策略
+     */
+    struct AdmissionPolicy
+    {
+        bool enabled = true;                                                 ///< 是否启用准入控制
+        uint32_t latencyBudgetMs = 100;                                      ///< 端到端延迟预算（毫秒）
+        std::array<uint32_t, DEGRADATION_LEVEL_COUNT - 1> backlogThresholds{ ///< 进入各降级级别的积压阈值
+            {4, 8, 16, 32}};
+        double latencyPressureRatio = 0.8; ///< 平均延迟超过预算该比例时视为延迟压力
+        double recoveryRatio = 0.5;        ///< 积压降到当前级别进入阈值的该比例以下时恢复一级
+        uint32_t minPacketsPerLevel = 8;   ///< 因延迟压力升级或恢复前，当前级别至少处理的数据包数
+        uint32_t channelDivisor = 2;       ///< REDUCED_CHANNELS级别的通道缩减倍数
+        uint32_t decimationFactor = 2;     ///< DECIMATED级别的采样点抽取因子
+    };
+
+    /**
+     * @brief 准入决策
+     */
+    enum class AdmissionDecision : uint8_t
+    {
+        ADMIT = 0, ///< 接受处理（可能降级）
+        EXPIRED,   ///< 已超过截止时间，丢弃
+        SHED       ///< 过载保护，丢弃低优先级数据包
+    };
+
+    /**
+     * @brief 准入控制统计快照
+     */
+    struct AdmissionStatistics
+    {
+        DegradationLevel currentLevel = DegradationLevel::FULL;          ///< 当前降级级别
+        uint64_t admittedPackets = 0;                                    ///< 接受处理的数据包数
+        uint64_t expiredPackets = 0;                                     ///< 超过截止时间被丢弃的数据包数
+        uint64_t shedPackets = 0;                                        ///< 过载丢弃的低优先级数据包数
+        uint64_t levelChanges = 0;                                       ///< 降级级别变化次数
+        std::array<uint64_t, DEGRADATION_LEVEL_COUNT> packetsPerLevel{}; ///< 各级别下接受处理的数据包数
+        std::array<uint64_t, DEGRADATION_LEVEL_COUNT> levelEntries{};    ///< 进入各级别的次数
+        double latencyEwmaMs = 0.0;                                      ///< 端到端延迟指数滑动平均（毫秒）
+    };
+
+    /**
+     * @brief 截止时间准入控制器
+     *
+     * @details
+     * - 升级：积压达到更高级别的阈值时立即升级；平均延迟持续超过预算时每
+     *   minPacketsPerLevel个数据包升一级
+     * - 恢复：无延迟压力且积压低于当前级别阈值的recoveryRatio倍时，每
+     *   minPacketsPerLevel个数据包降一级
+     * - 未设置采集时间戳的数据包没有截止时间，也不参与延迟统计
+     *
+     * @note 所有公共方法都是线程安全的
+     */
+    class AdmissionController
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param policy 准入控制策略
+         */
+        explicit AdmissionController(const AdmissionPolicy &policy = AdmissionPolicy());
+
+        /**
+         * @brief 更新策略并重置级别与统计
+         * @param policy 准入控制策略
+         */
+        void configure(const AdmissionPolicy &policy);
+
+        /**
+         * @brief 计算数据包的截止时间
+         * @param packet 数据包
+         * @return 截止时间，未设置采集时间戳时返回Timestamp::max()
+         */
+        Timestamp getDeadline(const RawDataPacket &packet) const;
+
+        /**
+         * @brief 对即将处理的数据包做准入决策，并按积压更新降级级别
+         * @param packet 数据包
+         * @param backlog 当前积压数据包数（排队与处理中）
+         * @param now 当前时间
+         * @param level 输出参数，接受处理时应采用的降级级别
+         * @return 准入决策
+         */
+        AdmissionDecision admit(const RawDataPacket &packet, size_t backlog,
+                                Timestamp now, DegradationLevel &level);
+
+        /**
+         * @brief 记录数据包处理完成，更新端到端延迟统计
+         * @param packet 数据包
+         * @param completionTime 完成时间
+         */
+        void recordCompletion(const RawDataPacket &packet, Timestamp completionTime);
+
+        /**
+         * @brief 获取降级级别对应的阶段图执行选项
+         * @param level 降级级别
+         * @param channelCount 数据包通道数
+         * @return 执行选项
+         */
+        StageExecutionOptions getExecutionOptions(DegradationLevel level, uint32_t channelCount) const;
+
+        /**
+         * @brief 获取当前降级级别
+         * @return 降级级别
+         */
+        DegradationLevel getLevel() const;
+
+        /**
+         * @brief 获取统计快照
+         * @return 统计信息
+         */
+        AdmissionStatistics getStatistics() const;
+
+        /**
+         * @brief 重置级别与统计
+         */
+        void reset();
+
+    private:
+        /**
+         * @brief 计算下一个降级级别（调用者需持有mutex_）
+         * @param backlog 当前积压数据包数
+         * @return 目标级别
+         */
+        DegradationLevel nextLevelLocked(size_t backlog) const;
+
+        AdmissionPolicy policy_;                          ///< 准入控制策略
+        DegradationLevel level_ = DegradationLevel::FULL; ///< 当前降级级别
+        uint64_t packetsAtLevel_ = 0;                     ///< 当前级别下已接受的数据包数
+        bool latencySampled_ = false;                     ///< 是否已有延迟样本
+        AdmissionStatistics statistics_;                  ///< 统计信息
+        mutable std::mutex mutex_;                        ///< 状态互斥锁
+    };
+
+} // namespace radar
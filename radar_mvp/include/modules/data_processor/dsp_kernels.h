@@ -0,0 +1,322 @@
+/**
+ * @file dsp_kernels.h
+ * @brief 雷达信号处理基础内核
+ *
+ * 提供加窗、基2 FFT、求模、CFAR检测等基础内核的内联实现，
+ * 以及编译期可求值的三角函数和查找表生成函数。
+ * 动态阶段图（StageGraph）与编译期流水线（pipeline::Pipeline）
+ * 共用同一套内核：前者传入运行期长度，后者传入编译期常量长度，
+ * 由编译器完成常量传播、循环展开和内联。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see FFTStage
+ * @see pipeline::Pipeline
+ */
+
+#pragma once
+
+#include "common/types.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace radar
+{
+    namespace dsp
+    {
+        /// 圆周率
+        constexpr double PI = 3.14159265358979323846;
+
+        /**
+         * @brief 旋转因子（实部/虚部分开存放，便于编译期构造）
+         */
+        struct TwiddleFactor
+        {
+            float re; ///< 实部
+            float im; ///< 虚部
+        };
+
+        /**
+         * @brief CFAR检测模式
+         */
+        enum class CFARMode : uint8_t
+        {
+            CELL_AVERAGING = 0, ///< 单元平均（CA-CFAR）
+            GREATEST_OF,        ///< 选大（GO-CFAR）
+            SMALLEST_OF         ///< 选小（SO-CFAR）
+        };
+
+        //==============================================================================
+        // 编译期工具函数
+        //==============================================================================
+
+        /**
+         * @brief 判断是否为2的幂
+         */
+        constexpr bool isPowerOfTwo(size_t n)
+        {
+            return n != 0 && (n & (n - 1)) == 0;
+        }
+
+        /**
+         * @brief 向上取整到2的幂
+         */
+        constexpr size_t nextPowerOfTwo(size_t n)
+        {
+            size_t power = 1;
+            while (power < n)
+            {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        /**
+         * @brief 以2为底的对数（向下取整）
+         */
+        constexpr uint32_t log2Floor(size_t n)
+        {
+            uint32_t bits = 0;
+            while (n > 1)
+            {
+                n >>= 1;
+                ++bits;
+            }
+            return bits;
+        }
+
+        /**
+         * @brief 位反转
+         * @param value 原始索引
+         * @param bits 有效位数
+         */
+        constexpr uint32_t reverseBits(uint32_t value, uint32_t bits)
+        {
+            uint32_t reversed = 0;
+            for (uint32_t i = 0; i < bits; ++i)
+            {
+                reversed = (reversed << 1) | ((value >> i) & 1u);
+            }
+            return reversed;
+        }
+
+        /**
+         * @brief 编译期正弦（泰勒级数，先归约到[-π, π]）
+         */
+        constexpr double sinConstexpr(double x)
+        {
+            while (x > PI)
+            {
+                x -= 2.0 * PI;
+            }
+            while (x < -PI)
+            {
+                x += 2.0 * PI;
+            }
+
+            double term = x;
+            double sum = x;
+            for (int i = 1; i < 14; ++i)
+            {
+                term *= -x * x / ((2.0 * i) * (2.0 * i + 1.0));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief 编译期余弦
+         */
+        constexpr double cosConstexpr(double x)
+        {
+            return sinConstexpr(x + PI / 2.0);
+        }
+
+        /**
+         * @brief 计算第k个N点旋转因子 exp(-j2πk/N)
+         */
+        constexpr TwiddleFactor makeTwiddle(size_t k, size_t n)
+        {
+            const double angle = -2.0 * PI * static_cast<double>(k) / static_cast<double>(n);
+            return TwiddleFactor{static_cast<float>(cosConstexpr(angle)),
+                                 static_cast<float>(sinConstexpr(angle))};
+        }
+
+        /**
+         * @brief 计算N点Hann窗第i个系数
+         */
+        constexpr float hannCoefficient(size_t i, size_t n)
+        {
+            return n <= 1 ? 1.0f
+                          : static_cast<float>(0.5 - 0.5 * cosConstexpr(2.0 * PI * static_cast<double>(i) /
+                                                                        static_cast<double>(n - 1)));
+        }
+
+        //==============================================================================
+        // 处理内核
+        //==============================================================================
+
+        /**
+         * @brief 加窗
+         * @param input 输入复数据
+         * @param window 窗系数
+         * @param output 输出复数据
+         * @param n 采样点数
+         */
+        inline void applyWindow(const ComplexFloat *input, const float *window,
+                                ComplexFloat *output, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                output[i] = ComplexFloat(input[i].real() * window[i], input[i].imag() * window[i]);
+            }
+        }
+
+        /**
+         * @brief 基2按时间抽取FFT（非原位）
+         *
+         * 复数乘法手工展开，避免std::complex乘法的NaN/Inf处理路径。
+         *
+         * @param input 输入复数据
+         * @param inputCount 输入点数（不足n时补零）
+         * @param output 输出频域数据（n点）
+         * @param n FFT点数（2的幂）
+         * @param twiddles n/2个旋转因子
+         * @param bitReverse n个位反转索引
+         */
+        inline void fftRadix2(const ComplexFloat *input, size_t inputCount, ComplexFloat *output,
+                              size_t n, const TwiddleFactor *twiddles, const uint32_t *bitReverse)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                const size_t source = bitReverse[i];
+                output[i] = source < inputCount ? input[source] : ComplexFloat(0.0f, 0.0f);
+            }
+
+            float *data = reinterpret_cast<float *>(output);
+            for (size_t length = 2; length <= n; length <<= 1)
+            {
+                const size_t half = length >> 1;
+                const size_t step = n / length;
+                for (size_t block = 0; block < n; block += length)
+                {
+                    for (size_t j = 0; j < half; ++j)
+                    {
+                        const TwiddleFactor w = twiddles[j * step];
+                        float *even = data + 2 * (block + j);
+                        float *odd = data + 2 * (block + j + half);
+
+                        const float tr = odd[0] * w.re - odd[1] * w.im;
+                        const float ti = odd[0] * w.im + odd[1] * w.re;
+
+                        odd[0] = even[0] - tr;
+                        odd[1] = even[1] - ti;
+                        even[0] += tr;
+                        even[1] += ti;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief 求模
+         * @param input 输入复数据
+         * @param output 输出幅度
+         * @param n 采样点数
+         */
+        inline void magnitude(const ComplexFloat *input, float *output, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                const float re = input[i].real();
+                const float im = input[i].imag();
+                output[i] = std::sqrt(re * re + im * im);
+            }
+        }
+
+        /**
+         * @brief CFAR恒虚警检测
+         *
+         * 参考窗在被测单元两侧各取train个单元，中间隔开guard个保护单元；
+         * 边界处只使用可用的一侧。滑动窗口增量更新，复杂度O(n)。
+         * 超过门限的单元输出原幅度，否则输出0。
+         *
+         * @param input 输入幅度
+         * @param output 检测结果
+         * @param n 采样点数
+         * @param train 单侧参考单元数
+         * @param guard 单侧保护单元数
+         * @param scale 门限系数
+         * @param mode 检测模式
+         */
+        inline void cfarDetect(const float *input, float *output, size_t n,
+                               size_t train, size_t guard, float scale, CFARMode mode)
+        {
+            // 滞后窗口 [i-guard-train, i-guard-1]，超前窗口 [i+guard+1, i+guard+train]
+            double lagSum = 0.0;
+            double leadSum = 0.0;
+            size_t lagCount = 0;
+            size_t leadCount = 0;
+
+            for (size_t k = guard + 1; k <= guard + train && k < n; ++k)
+            {
+                leadSum += input[k];
+                ++leadCount;
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                float noise = 0.0f;
+                const double lagMean = lagCount > 0 ? lagSum / lagCount : 0.0;
+                const double leadMean = leadCount > 0 ? leadSum / leadCount : 0.0;
+
+                switch (mode)
+                {
+                case CFARMode::GREATEST_OF:
+                    noise = static_cast<float>(std::max(lagMean, leadMean));
+                    break;
+                case CFARMode::SMALLEST_OF:
+                    noise = static_cast<float>(lagCount == 0    ? leadMean
+                                               : leadCount == 0 ? lagMean
+                                                                : std::min(lagMean, leadMean));
+                    break;
+                default:
+                    noise = (lagCount + leadCount) > 0
+                                ? static_cast<float>((lagSum + leadSum) / (lagCount + leadCount))
+                                : 0.0f;
+                    break;
+                }
+
+                output[i] = input[i] > scale * noise ? input[i] : 0.0f;
+
+                // 窗口右移一个单元
+                if (i >= guard)
+                {
+                    lagSum += input[i - guard];
+                    ++lagCount;
+                }
+                if (i >= guard + train)
+                {
+                    lagSum -= input[i - guard - train];
+                    --lagCount;
+                }
+                if (i + guard + train + 1 < n)
+                {
+                    leadSum += input[i + guard + train + 1];
+                    ++leadCount;
+                }
+                if (i + guard + 1 < n)
+                {
+                    leadSum -= input[i + guard + 1];
+                    --leadCount;
+                }
+            }
+        }
+
+    } // namespace dsp
+} // namespace radar
@@ -0,0 +1,134 @@
+/**
+ * @file fork_join_pool.h
+ * @brief 包内并行处理的分叉-汇合线程池
+ *
+ * 为单个数据包内的可划分工作（逐通道FFT/滤波、逐距离单元波束形成等）
+ * 提供分叉-汇合执行：调用线程把工作切成若干块发布到共享线程池，
+ * 自身也参与执行，全部块完成后返回。调用线程参与执行保证了
+ * 多个处理器并发提交或工作线程全忙时不会死锁，最坏情况退化为串行。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see StageGraph
+ */
+
+#pragma once
+
+#include "common/error_codes.h"
+#include "common/event_count.h"
+#include "common/thread_placement.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief 分叉-汇合线程池
+     *
+     * @details
+     * - parallelFor()把区间[0, count)切分为块，块通过原子计数器动态认领，
+     *   慢块不会拖住整批工作
+     * - 块函数返回非SUCCESS或抛出异常时，记录第一个错误码，剩余块照常完成后返回
+     * - 进程内共享一个实例（getShared()），避免每个处理器各自创建线程
+     *
+     * @note 所有公共方法都是线程安全的
+     */
+    class ForkJoinPool
+    {
+    public:
+        /// 块函数：处理[begin, end)区间
+        using RangeFunction = std::function<ErrorCode(uint32_t begin, uint32_t end)>;
+
+        /**
+         * @brief 构造函数
+         * @param workerCount 工作线程数（不含调用线程），0表示硬件并发数减一
+         * @param placement 工作线程放置，第i个工作线程使用下标i+1（下标0留给调用线程）
+         * @param name 线程名称前缀
+         */
+        explicit ForkJoinPool(uint32_t workerCount = 0, const ThreadPlacementConfig &placement = {},
+                              const std::string &name = "ForkJoin");
+
+        /**
+         * @brief 析构函数，等待工作线程退出
+         */
+        ~ForkJoinPool();
+
+        ForkJoinPool(const ForkJoinPool &) = delete;
+        ForkJoinPool &operator=(const ForkJoinPool &) = delete;
+
+        /**
+         * @brief 并行执行区间任务并等待完成
+         * @param count 工作单元总数
+         * @param body 块函数
+         * @param maxChunks 最大切分块数，0表示按线程数自动确定
+         * @return 第一个失败块的错误码，全部成功时返回SUCCESS
+         */
+        ErrorCode parallelFor(uint32_t count, const RangeFunction &body, uint32_t maxChunks = 0);
+
+        /**
+         * @brief 获取工作线程数（不含调用线程）
+         * @return 工作线程数
+         */
+        uint32_t getWorkerCount() const;
+
+        /**
+         * @brief 获取进程共享实例
+         * @return 共享线程池
+         */
+        static ForkJoinPool &getShared();
+
+    private:
+        /**
+         * @brief 一次parallelFor调用的共享状态
+         */
+        struct Job
+        {
+            const RangeFunction *body = nullptr;                      ///< 块函数（调用方栈上，汇合前有效）
+            uint32_t count = 0;                                       ///< 工作单元总数
+            uint32_t chunkSize = 0;                                   ///< 每块工作单元数
+            uint32_t chunkCount = 0;                                  ///< 块数
+            std::atomic<uint32_t> nextChunk{0};                       ///< 下一个待认领的块
+            std::atomic<uint32_t> doneChunks{0};                      ///< 已完成的块数
+            std::atomic<ErrorCode> firstError{SystemErrors::SUCCESS}; ///< 第一个错误码
+            EventCount done;                                          ///< 完成通知（汇合方先自旋再休眠）
+        };
+
+        /**
+         * @brief 认领并执行一个块
+         * @param job 任务状态
+         * @return 认领到块返回true，块已分完返回false
+         */
+        static bool runChunk(Job &job);
+
+        /**
+         * @brief 取出队首任务（队列为空时不加锁）
+         * @param job 输出参数，取到的任务；停止时置空
+         * @return 取到任务或线程池正在停止时返回true
+         */
+        bool takeJob(std::shared_ptr<Job> &job);
+
+        /**
+         * @brief 工作线程主循环
+         */
+        void workerLoop();
+
+        std::vector<std::thread> workers_;      ///< 工作线程
+        std::deque<std::shared_ptr<Job>> jobs_; ///< 尚有未认领块的任务
+        std::atomic<size_t> jobCount_{0};       ///< 任务数（修改受jobsMutex_保护，可无锁读取）
+        mutable std::mutex jobsMutex_;          ///< 任务队列互斥锁
+        EventCount jobsAvailable_;              ///< 任务可用通知
+        std::atomic<bool> stopping_{false};     ///< 停止标志
+    };
+
+} // namespace radar
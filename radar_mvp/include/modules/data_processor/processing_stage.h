@@ -0,0 +1,419 @@
+/**
+ * @file processing_stage.h
+ * @brief 雷达信号处理阶段接口与内置阶段定义
+ *
+ * 定义了处理阶段图（DAG）中单个节点的抽象接口IProcessingStage，
+ * 以及阶段间数据缓冲区的形状描述。内置加窗、FFT、滤波、检测、CFAR、
+ * 波束形成等阶段，并通过ProcessingStageFactory按类型名称创建。
+ * 数值计算与编译期流水线共用dsp_kernels.h中的内核。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see StageGraph
+ * @see CPUDataProcessor
+ */
+
+#pragma once
+
+#include "common/types.h"
+#include "common/error_codes.h"
+#include "modules/data_processor/dsp_kernels.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace radar
+{
+
+    //==============================================================================
+    // 阶段数据形状与缓冲区
+    //==============================================================================
+
+    /**
+     * @brief 阶段数据类型枚举
+     */
+    enum class StageDataKind : uint8_t
+    {
+        COMPLEX = 0, ///< 复数数据（I/Q或频域）
+        REAL         ///< 实数数据（幅度、检测统计量）
+    };
+
+    /**
+     * @brief 阶段数据形状描述
+     *
+     * 阶段间数据均按通道主序连续存放：第ch通道的第i个采样位于
+     * ch * samples + i 处，与RawDataPacket::iqData布局一致。
+     */
+    struct StageShape
+    {
+        StageDataKind kind = StageDataKind::COMPLEX; ///< 数据类型
+        uint32_t channels = 0;                       ///< 通道数量
+        uint32_t samples = 0;                        ///< 每通道采样点数
+
+        /**
+         * @brief 获取元素总数
+         * @return 通道数与采样点数之积
+         */
+        size_t elementCount() const
+        {
+            return static_cast<size_t>(channels) * samples;
+        }
+
+        bool operator==(const StageShape &other) const
+        {
+            return kind == other.kind && channels == other.channels && samples == other.samples;
+        }
+
+        bool operator!=(const StageShape &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * @brief 阶段输入视图
+     *
+     * 指向上游阶段输出缓冲区（或原始数据包）的只读视图，不持有数据。
+     * 根据shape.kind，complexData与realData中只有一个有效。
+     */
+    struct StageInput
+    {
+        StageShape shape;                          ///< 输入数据形状
+        const ComplexFloat *complexData = nullptr; ///< 复数数据指针
+        const float *realData = nullptr;           ///< 实数数据指针
+    };
+
+    /**
+     * @brief 阶段输出缓冲区
+     *
+     * 由StageGraph根据形状协商结果预先分配，处理过程中阶段只写入
+     * 已分配的内存，不再触发重新分配。
+     */
+    struct StageBuffer
+    {
+        StageShape shape;                 ///< 输出数据形状
+        AlignedComplexVector complexData; ///< 复数数据存储
+        AlignedFloatVector realData;      ///< 实数数据存储
+
+        /**
+         * @brief 按形状分配缓冲区
+         * @param newShape 协商得到的输出形状
+         */
+        void allocate(const StageShape &newShape)
+        {
+            shape = newShape;
+            if (shape.kind == StageDataKind::COMPLEX)
+            {
+                complexData.assign(shape.elementCount(), ComplexFloat(0.0f, 0.0f));
+                realData.clear();
+                realData.shrink_to_fit();
+            }
+            else
+            {
+                realData.assign(shape.elementCount(), 0.0f);
+                complexData.clear();
+                complexData.shrink_to_fit();
+            }
+        }
+
+        /**
+         * @brief 获取指向本缓冲区的输入视图
+         * @return 只读视图
+         */
+        StageInput view() const
+        {
+            StageInput input;
+            input.shape = shape;
+            input.complexData = complexData.empty() ? nullptr : complexData.data();
+            input.realData = realData.empty() ? nullptr : realData.data();
+            return input;
+        }
+    };
+
+    //==============================================================================
+    // 处理阶段接口
+    //==============================================================================
+
+    /**
+     * @brief 处理阶段抽象接口
+     *
+     * 处理阶段图中的一个节点。生命周期分为两步：
+     * 1. negotiateShape()：根据上游形状声明本阶段的输出形状，
+     *    StageGraph据此预分配输出缓冲区
+     * 2. process()：对每个数据包执行一次，写入预分配的输出缓冲区
+     *
+     * 工作量大的数据包可以在包内并行：getPartitionCount()声明可独立处理的
+     * 工作单元数（如通道数），StageGraph把[0, N)切块后在线程池上并发调用
+     * processPartition()，全部完成后才执行下游阶段。
+     *
+     * @note 同一阶段实例不会被并发调用process()；processPartition()会以
+     *       互不重叠的区间并发调用，实现只能写入区间对应的输出
+     */
+    class IProcessingStage
+    {
+    public:
+        virtual ~IProcessingStage() = default;
+
+        /**
+         * @brief 获取阶段实例名称
+         * @return 阶段名称
+         */
+        virtual const std::string &getName() const = 0;
+
+        /**
+         * @brief 获取阶段类型名称
+         * @return 阶段类型
+         */
+        virtual const std::string &getType() const = 0;
+
+        /**
+         * @brief 形状协商
+         * @param inputShapes 上游输出形状（顺序与配置中的inputs一致）
+         * @param outputShape 输出参数，本阶段的输出形状
+         * @return 操作结果错误码
+         */
+        virtual ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                         StageShape &outputShape) = 0;
+
+        /**
+         * @brief 执行阶段处理
+         * @param inputs 上游数据视图
+         * @param output 预分配的输出缓冲区
+         * @return 操作结果错误码
+         */
+        virtual ErrorCode process(const std::vector<StageInput> &inputs,
+                                  StageBuffer &output) = 0;
+
+        /**
+         * @brief 获取可并行划分的工作单元数（形状协商后有效）
+         * @return 工作单元数，1表示不可划分
+         */
+        virtual uint32_t getPartitionCount() const { return 1; }
+
+        /**
+         * @brief 处理部分工作单元
+         *
+         * 默认实现不可划分，直接执行整个process()。
+         *
+         * @param inputs 上游数据视图
+         * @param output 预分配的输出缓冲区
+         * @param begin 起始工作单元（含）
+         * @param end 结束工作单元（不含）
+         * @return 操作结果错误码
+         */
+        virtual ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                           [[maybe_unused]] uint32_t begin, [[maybe_unused]] uint32_t end)
+        {
+            return process(inputs, output);
+        }
+    };
+
+    using ProcessingStagePtr = std::unique_ptr<IProcessingStage>;
+
+    /**
+     * @brief 处理阶段基类
+     *
+     * 保存阶段名称、类型和参数，并提供单输入阶段的通用校验。
+     */
+    class ProcessingStageBase : public IProcessingStage
+    {
+    public:
+        explicit ProcessingStageBase(const ProcessingStageConfig &config);
+
+        const std::string &getName() const override { return name_; }
+        const std::string &getType() const override { return type_; }
+        uint32_t getPartitionCount() const override { return partitionCount_; }
+
+    protected:
+        /**
+         * @brief 读取数值参数
+         * @param key 参数名
+         * @param defaultValue 参数缺失时的默认值
+         * @return 参数值
+         */
+        double getParam(const std::string &key, double defaultValue) const;
+
+        /**
+         * @brief 校验单一输入的形状
+         * @param inputShapes 上游输出形状
+         * @param expectedKind 期望的数据类型
+         * @return 操作结果错误码
+         */
+        ErrorCode checkSingleInput(const std::vector<StageShape> &inputShapes,
+                                   StageDataKind expectedKind) const;
+
+        std::string name_;                     ///< 阶段实例名称
+        std::string type_;                     ///< 阶段类型
+        std::map<std::string, double> params_; ///< 阶段参数
+        uint32_t partitionCount_ = 1;          ///< 可并行划分的工作单元数
+    };
+
+    //==============================================================================
+    // 内置处理阶段
+    //==============================================================================
+
+    /**
+     * @brief 加窗阶段（逐通道Hann窗）
+     *
+     * 窗系数在形状协商时按采样点数生成。
+     */
+    class WindowStage : public ProcessingStageBase
+    {
+    public:
+        using ProcessingStageBase::ProcessingStageBase;
+
+        ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                 StageShape &outputShape) override;
+        ErrorCode process(const std::vector<StageInput> &inputs, StageBuffer &output) override;
+        ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                   uint32_t begin, uint32_t end) override;
+
+    private:
+        std::vector<float> coefficients_; ///< 窗系数
+    };
+
+    /**
+     * @brief FFT变换阶段（逐通道基2 FFT）
+     *
+     * 输入：COMPLEX[channels x samples]，输出：COMPLEX[channels x N]，
+     * N为不小于samples的2的幂，不足部分补零。
+     * 旋转因子和位反转表在形状协商时生成。
+     */
+    class FFTStage : public ProcessingStageBase
+    {
+    public:
+        using ProcessingStageBase::ProcessingStageBase;
+
+        ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                 StageShape &outputShape) override;
+        ErrorCode process(const std::vector<StageInput> &inputs, StageBuffer &output) override;
+        ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                   uint32_t begin, uint32_t end) override;
+
+    private:
+        std::vector<dsp::TwiddleFactor> twiddles_; ///< 旋转因子
+        std::vector<uint32_t> bitReverse_;         ///< 位反转索引
+    };
+
+    /**
+     * @brief 数字滤波阶段（逐通道滑动平均）
+     *
+     * 参数：taps - 滑动窗口长度（奇数，默认3）
+     */
+    class FilterStage : public ProcessingStageBase
+    {
+    public:
+        using ProcessingStageBase::ProcessingStageBase;
+
+        ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                 StageShape &outputShape) override;
+        ErrorCode process(const std::vector<StageInput> &inputs, StageBuffer &output) override;
+        ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                   uint32_t begin, uint32_t end) override;
+
+    private:
+        uint32_t halfWidth_ = 1; ///< 滑动窗口半宽
+    };
+
+    /**
+     * @brief 目标检测阶段（幅度检测）
+     *
+     * 输入：COMPLEX[channels x samples]，输出：REAL[channels x samples]
+     */
+    class DetectionStage : public ProcessingStageBase
+    {
+    public:
+        using ProcessingStageBase::ProcessingStageBase;
+
+        ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                 StageShape &outputShape) override;
+        ErrorCode process(const std::vector<StageInput> &inputs, StageBuffer &output) override;
+        ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                   uint32_t begin, uint32_t end) override;
+    };
+
+    /**
+     * @brief CFAR检测阶段（逐通道）
+     *
+     * 输入：REAL[channels x samples]，输出：REAL[channels x samples]，
+     * 超过门限的单元保留原幅度，其余置0。
+     * 参数：train - 单侧参考单元数（默认16），guard - 单侧保护单元数（默认4），
+     * scale - 门限系数（默认3.0），mode - 0:CA 1:GO 2:SO（默认0）
+     */
+    class CFARStage : public ProcessingStageBase
+    {
+    public:
+        using ProcessingStageBase::ProcessingStageBase;
+
+        ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                 StageShape &outputShape) override;
+        ErrorCode process(const std::vector<StageInput> &inputs, StageBuffer &output) override;
+        ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                   uint32_t begin, uint32_t end) override;
+
+    private:
+        size_t train_ = 16;                                   ///< 单侧参考单元数
+        size_t guard_ = 4;                                    ///< 单侧保护单元数
+        float scale_ = 3.0f;                                  ///< 门限系数
+        dsp::CFARMode mode_ = dsp::CFARMode::CELL_AVERAGING; ///< 检测模式
+    };
+
+    /**
+     * @brief 波束形成阶段（通道加权平均）
+     *
+     * 输入：COMPLEX[channels x samples]，输出：COMPLEX[1 x samples]，
+     * 包内并行时按距离单元（采样点）划分
+     */
+    class BeamformingStage : public ProcessingStageBase
+    {
+    public:
+        using ProcessingStageBase::ProcessingStageBase;
+
+        ErrorCode negotiateShape(const std::vector<StageShape> &inputShapes,
+                                 StageShape &outputShape) override;
+        ErrorCode process(const std::vector<StageInput> &inputs, StageBuffer &output) override;
+        ErrorCode processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                   uint32_t begin, uint32_t end) override;
+    };
+
+    //==============================================================================
+    // 工厂函数
+    //==============================================================================
+
+    /**
+     * @brief 处理阶段工厂命名空间
+     */
+    namespace ProcessingStageFactory
+    {
+        /// 阶段创建函数类型
+        using StageCreator = std::function<ProcessingStagePtr(const ProcessingStageConfig &)>;
+
+        /**
+         * @brief 按配置创建处理阶段
+         * @param config 阶段配置
+         * @return 阶段实例，类型未注册时返回 nullptr
+         */
+        ProcessingStagePtr createStage(const ProcessingStageConfig &config);
+
+        /**
+         * @brief 注册自定义阶段类型
+         * @param type 阶段类型名称
+         * @param creator 创建函数
+         * @return 注册成功返回true，类型已存在时返回false
+         */
+        bool registerStageType(const std::string &type, StageCreator creator);
+
+        /**
+         * @brief 检查阶段类型是否可用
+         * @param type 阶段类型名称
+         * @return 类型是否已注册
+         */
+        bool isStageTypeAvailable(const std::string &type);
+
+    } // namespace ProcessingStageFactory
+
+} // namespace radar
@@ -0,0 +1,273 @@
+/**
+ * @file stage_graph.h
+ * @brief 雷达信号处理阶段图（DAG）执行器
+ *
+ * 根据配置构建处理阶段的有向无环图，按拓扑顺序执行各阶段。
+ * 阶段间缓冲区在形状协商时一次性预分配，数据包形状不变时
+ * 处理过程中不产生内存分配。执行器记录每个阶段的耗时统计，
+ * 用于定位处理链中的性能瓶颈。工作量超过阈值的阶段可在
+ * 分叉-汇合线程池上包内并行执行，以降低单包延迟。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see IProcessingStage
+ * @see CPUDataProcessor
+ */
+
+#pragma once
+
+#include "modules/data_processor/processing_stage.h"
+#include "modules/data_processor/fork_join_pool.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace YAML
+{
+    class Node;
+}
+
+namespace radar
+{
+
+    /**
+     * @brief 阶段耗时统计快照
+     */
+    struct StageTimingInfo
+    {
+        std::string stageName;      ///< 阶段实例名称
+        std::string stageType;      ///< 阶段类型
+        uint64_t invocations = 0;   ///< 执行次数
+        uint64_t failures = 0;      ///< 失败次数
+        uint64_t parallelRuns = 0;  ///< 包内并行执行次数
+        double lastTimeMs = 0.0;    ///< 最近一次耗时（毫秒）
+        double averageTimeMs = 0.0; ///< 平均耗时（毫秒）
+        double peakTimeMs = 0.0;    ///< 峰值耗时（毫秒）
+        double totalTimeMs = 0.0;   ///< 累计耗时（毫秒）
+        uint64_t skippedRuns = 0;   ///< 降级执行时被跳过的次数（仅可选阶段）
+        bool optional = false;      ///< 是否为可选阶段
+    };
+
+    /**
+     * @brief 阶段图降级执行选项
+     *
+     * 默认值表示完整执行。降级选项只改变本次执行处理的数据量，
+     * 不修改图结构；形状变化时缓冲区按新形状重新协商。
+     */
+    struct StageExecutionOptions
+    {
+        bool skipOptionalStages = false; ///< 跳过可选阶段（输入原样传递到输出）
+        uint32_t maxChannels = 0;        ///< 只处理前maxChannels个通道，0表示全部通道
+        uint32_t decimation = 1;         ///< 采样点抽取因子，1表示不抽取
+    };
+
+    /**
+     * @brief 处理阶段图执行器
+     *
+     * 使用流程：
+     * 1. build()：根据阶段配置创建阶段实例、解析依赖并拓扑排序
+     * 2. execute()：处理数据包；输入形状变化时自动重新协商并分配缓冲区
+     * 3. getStageTimings()：获取每个阶段的耗时统计
+     *
+     * 图中的虚拟节点"input"代表原始数据包的I/Q数据。
+     * 配置中enabled为false的阶段会被旁路：其下游直接连接到它的输入。
+     *
+     * 设置线程池后（setParallelExecution()），处理元素数达到阈值且可划分的阶段
+     * 会切块并行执行，每个阶段结束即汇合，下游阶段总能看到完整的输入。
+     *
+     * 配置中optional为true的阶段在降级执行时可被跳过，这类阶段必须只有一个
+     * 输入且输出形状与输入相同（形状协商时检查）。
+     *
+     * @note execute()内部串行化，同一执行器可被多个线程安全调用
+     */
+    class StageGraph
+    {
+    public:
+        /// 原始数据包输入节点名称
+        static constexpr const char *INPUT_NODE_NAME = "input";
+
+        /// 默认包内并行阈值（单阶段处理的元素数，约64通道x1024点）
+        static constexpr uint64_t DEFAULT_PARALLEL_THRESHOLD = 64 * 1024;
+
+        StageGraph();
+        ~StageGraph();
+
+        StageGraph(const StageGraph &) = delete;
+        StageGraph &operator=(const StageGraph &) = delete;
+
+        /**
+         * @brief 构建阶段图
+         * @param stageConfigs 阶段配置列表
+         * @return 操作结果错误码
+         * @retval SystemErrors::SUCCESS 构建成功
+         * @retval SystemErrors::CONFIGURATION_ERROR 阶段类型未知、名称重复、依赖缺失或存在环
+         */
+        ErrorCode build(const std::vector<ProcessingStageConfig> &stageConfigs);
+
+        /**
+         * @brief 按输入形状协商各阶段形状并预分配缓冲区
+         * @param inputShape 原始数据包形状
+         * @return 操作结果错误码
+         */
+        ErrorCode prepare(const StageShape &inputShape);
+
+        /**
+         * @brief 执行阶段图
+         * @param packet 输入数据包
+         * @param result 输出参数，按阶段的output映射填充结果字段
+         * @return 操作结果错误码
+         */
+        ErrorCode execute(const RawDataPacket &packet, ProcessingResult &result);
+
+        /**
+         * @brief 按降级选项执行阶段图
+         * @param packet 输入数据包
+         * @param result 输出参数，按阶段的output映射填充结果字段
+         * @param options 降级执行选项
+         * @return 操作结果错误码
+         */
+        ErrorCode execute(const RawDataPacket &packet, ProcessingResult &result,
+                          const StageExecutionOptions &options);
+
+        /**
+         * @brief 设置包内并行执行
+         * @param pool 分叉-汇合线程池，nullptr表示关闭包内并行
+         * @param thresholdElements 阶段处理元素数（输入与输出取大）达到该值时并行执行
+         */
+        void setParallelExecution(ForkJoinPool *pool,
+                                  uint64_t thresholdElements = DEFAULT_PARALLEL_THRESHOLD);
+
+        /**
+         * @brief 获取各阶段耗时统计（按执行顺序）
+         * @return 耗时统计快照列表
+         */
+        std::vector<StageTimingInfo> getStageTimings() const;
+
+        /**
+         * @brief 重置阶段耗时统计
+         */
+        void resetStageTimings();
+
+        /**
+         * @brief 获取拓扑排序后的阶段名称
+         * @return 阶段名称列表
+         */
+        std::vector<std::string> getExecutionOrder() const;
+
+        /**
+         * @brief 检查图是否已构建
+         * @return 是否已构建
+         */
+        bool isBuilt() const;
+
+        /**
+         * @brief 获取预分配缓冲区的总字节数
+         * @return 字节数
+         */
+        size_t getBufferBytes() const;
+
+        /**
+         * @brief 创建默认处理链配置（FFT→滤波→检测，滤波→波束形成）
+         * @return 阶段配置列表
+         */
+        static std::vector<ProcessingStageConfig> createDefaultConfig();
+
+        /**
+         * @brief 从YAML节点解析阶段图配置
+         * @param pipelineNode data_processor.pipeline 节点
+         * @param stageConfigs 输出参数，阶段配置列表
+         * @return 操作结果错误码
+         */
+        static ErrorCode parseConfig(const YAML::Node &pipelineNode,
+                                     std::vector<ProcessingStageConfig> &stageConfigs);
+
+        /**
+         * @brief 从全局配置管理器加载阶段图配置
+         * @param stageConfigs 输出参数，阶段配置列表
+         * @param keyPath 配置键路径
+         * @return 操作结果错误码，配置不存在时返回 SystemErrors::CONFIGURATION_ERROR
+         */
+        static ErrorCode loadConfig(std::vector<ProcessingStageConfig> &stageConfigs,
+                                    const std::string &keyPath = "data_processor.pipeline");
+
+    private:
+        /// 结果字段映射
+        enum class ResultField : uint8_t
+        {
+            NONE = 0,
+            RANGE_PROFILE,
+            DOPPLER_SPECTRUM,
+            BEAMFORMED_DATA
+        };
+
+        /// 图节点
+        struct StageNode
+        {
+            ProcessingStagePtr stage;                    ///< 阶段实例
+            std::vector<int> inputIndices;               ///< 上游节点索引（-1表示原始输入）
+            std::vector<StageShape> inputShapes;         ///< 上游形状（协商用）
+            std::vector<StageInput> inputViews;          ///< 上游数据视图（预分配）
+            StageBuffer output;                          ///< 预分配输出缓冲区
+            ResultField resultField = ResultField::NONE; ///< 结果映射
+            bool optional = false;                       ///< 降级时可跳过
+
+            uint64_t workElements = 0; ///< 单次处理的元素数（形状协商时计算）
+
+            uint64_t invocations = 0;  ///< 执行次数
+            uint64_t failures = 0;     ///< 失败次数
+            uint64_t parallelRuns = 0; ///< 包内并行执行次数
+            uint64_t skippedRuns = 0;  ///< 被跳过的次数
+            double lastTimeMs = 0.0;   ///< 最近一次耗时
+            double totalTimeMs = 0.0;  ///< 累计耗时
+            double peakTimeMs = 0.0;   ///< 峰值耗时
+        };
+
+        /**
+         * @brief 形状协商与缓冲区分配（调用者需持有executeMutex_）
+         * @param inputShape 原始数据包形状
+         * @return 操作结果错误码
+         */
+        ErrorCode prepareLocked(const StageShape &inputShape);
+
+        /**
+         * @brief 执行单个节点（按工作量选择串行或包内并行）
+         * @param node 图节点
+         * @return 操作结果错误码
+         */
+        ErrorCode runNode(StageNode &node);
+
+        /**
+         * @brief 跳过可选节点：把唯一输入原样拷贝到输出缓冲区
+         * @param node 图节点
+         */
+        static void passThrough(StageNode &node);
+
+        /**
+         * @brief 解析结果映射名称
+         * @param output 配置中的output字段
+         * @param field 输出参数，结果字段
+         * @return 名称是否有效
+         */
+        static bool parseResultField(const std::string &output, ResultField &field);
+
+        /**
+         * @brief 将节点输出写入处理结果
+         * @param node 图节点
+         * @param result 处理结果
+         */
+        static void exportResult(const StageNode &node, ProcessingResult &result);
+
+        std::vector<std::unique_ptr<StageNode>> nodes_;           ///< 拓扑排序后的节点
+        StageShape preparedShape_;                                ///< 已协商的输入形状
+        bool prepared_ = false;                                   ///< 缓冲区是否已分配
+        AlignedComplexVector reducedInput_;                       ///< 降级执行时的抽取输入缓冲区
+        ForkJoinPool *parallelPool_ = nullptr;                    ///< 包内并行线程池（不持有）
+        uint64_t parallelThreshold_ = DEFAULT_PARALLEL_THRESHOLD; ///< 包内并行阈值
+        mutable std::mutex executeMutex_;                         ///< 执行互斥锁（保护缓冲区与统计）
+    };
+
+} // namespace radar
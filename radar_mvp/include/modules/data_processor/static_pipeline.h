@@ -0,0 +1,313 @@
+/**
+ * @file static_pipeline.h
+ * @brief 编译期特化的信号处理流水线
+ *
+ * 面向固定的生产处理链，用模板在编译期组合处理阶段，例如：
+ * @code
+ * using Chain = pipeline::Pipeline<pipeline::Window, pipeline::FFT<1024>,
+ *                                  pipeline::Magnitude, pipeline::CFAR<pipeline::CA, 16, 4>>;
+ * @endcode
+ * 与动态阶段图（StageGraph）相比：
+ * - 处理长度是模板参数，旋转因子、位反转表、窗系数均为constexpr表
+ * - 阶段间缓冲区是定长std::array，没有类型擦除和虚函数分派
+ * - 整条链在一个翻译单元内展开，编译器可以完全内联
+ *
+ * 阶段类型需要提供：
+ * - InputType / OutputType：输入、输出元素类型
+ * - FIXED_SIZE：阶段要求的处理长度，0表示与长度无关
+ * - template <size_t N> void process(const InputType *, OutputType *)：处理N个元素
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see dsp_kernels.h
+ * @see StaticPipelineProcessor
+ */
+
+#pragma once
+
+#include "modules/data_processor/dsp_kernels.h"
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace radar
+{
+    namespace pipeline
+    {
+        //==============================================================================
+        // 编译期查找表
+        //==============================================================================
+
+        /**
+         * @brief N点FFT的旋转因子和位反转表
+         */
+        template <size_t N>
+        struct FFTTables
+        {
+            static_assert(dsp::isPowerOfTwo(N), "FFT size must be a power of two");
+
+            static constexpr std::array<dsp::TwiddleFactor, N / 2> makeTwiddles()
+            {
+                std::array<dsp::TwiddleFactor, N / 2> table{};
+                for (size_t k = 0; k < N / 2; ++k)
+                {
+                    table[k] = dsp::makeTwiddle(k, N);
+                }
+                return table;
+            }
+
+            static constexpr std::array<uint32_t, N> makeBitReverse()
+            {
+                std::array<uint32_t, N> table{};
+                for (size_t i = 0; i < N; ++i)
+                {
+                    table[i] = dsp::reverseBits(static_cast<uint32_t>(i), dsp::log2Floor(N));
+                }
+                return table;
+            }
+
+            static constexpr std::array<dsp::TwiddleFactor, N / 2> TWIDDLES = makeTwiddles(); ///< 旋转因子
+            static constexpr std::array<uint32_t, N> BIT_REVERSE = makeBitReverse();          ///< 位反转索引
+        };
+
+        /**
+         * @brief N点Hann窗系数表
+         */
+        template <size_t N>
+        struct HannTable
+        {
+            static constexpr std::array<float, N> makeCoefficients()
+            {
+                std::array<float, N> table{};
+                for (size_t i = 0; i < N; ++i)
+                {
+                    table[i] = dsp::hannCoefficient(i, N);
+                }
+                return table;
+            }
+
+            static constexpr std::array<float, N> COEFFICIENTS = makeCoefficients(); ///< 窗系数
+        };
+
+        //==============================================================================
+        // 流水线阶段
+        //==============================================================================
+
+        /**
+         * @brief Hann加窗阶段
+         */
+        struct Window
+        {
+            using InputType = ComplexFloat;
+            using OutputType = ComplexFloat;
+            static constexpr size_t FIXED_SIZE = 0;
+
+            template <size_t N>
+            void process(const InputType *input, OutputType *output) const
+            {
+                dsp::applyWindow(input, HannTable<N>::COEFFICIENTS.data(), output, N);
+            }
+        };
+
+        /**
+         * @brief 定长基2 FFT阶段
+         * @tparam SIZE FFT点数（2的幂），同时决定整条流水线的处理长度
+         */
+        template <size_t SIZE>
+        struct FFT
+        {
+            static_assert(dsp::isPowerOfTwo(SIZE), "FFT size must be a power of two");
+
+            using InputType = ComplexFloat;
+            using OutputType = ComplexFloat;
+            static constexpr size_t FIXED_SIZE = SIZE;
+
+            template <size_t N>
+            void process(const InputType *input, OutputType *output) const
+            {
+                static_assert(N == SIZE, "FFT stage length mismatch");
+                dsp::fftRadix2(input, N, output, N, FFTTables<N>::TWIDDLES.data(),
+                               FFTTables<N>::BIT_REVERSE.data());
+            }
+        };
+
+        /**
+         * @brief 求模阶段
+         */
+        struct Magnitude
+        {
+            using InputType = ComplexFloat;
+            using OutputType = float;
+            static constexpr size_t FIXED_SIZE = 0;
+
+            template <size_t N>
+            void process(const InputType *input, OutputType *output) const
+            {
+                dsp::magnitude(input, output, N);
+            }
+        };
+
+        /// 单元平均CFAR
+        struct CA
+        {
+            static constexpr dsp::CFARMode MODE = dsp::CFARMode::CELL_AVERAGING;
+        };
+
+        /// 选大CFAR
+        struct GO
+        {
+            static constexpr dsp::CFARMode MODE = dsp::CFARMode::GREATEST_OF;
+        };
+
+        /// 选小CFAR
+        struct SO
+        {
+            static constexpr dsp::CFARMode MODE = dsp::CFARMode::SMALLEST_OF;
+        };
+
+        /**
+         * @brief CFAR检测阶段
+         * @tparam Mode 检测模式（CA、GO、SO）
+         * @tparam TRAIN 单侧参考单元数
+         * @tparam GUARD 单侧保护单元数
+         * @tparam SCALE_PERCENT 门限系数（百分比，300表示3.0倍噪声均值）
+         */
+        template <typename Mode, size_t TRAIN, size_t GUARD, size_t SCALE_PERCENT = 300>
+        struct CFAR
+        {
+            static_assert(TRAIN > 0, "CFAR requires at least one training cell");
+
+            using InputType = float;
+            using OutputType = float;
+            static constexpr size_t FIXED_SIZE = 0;
+
+            template <size_t N>
+            void process(const InputType *input, OutputType *output) const
+            {
+                dsp::cfarDetect(input, output, N, TRAIN, GUARD,
+                                static_cast<float>(SCALE_PERCENT) / 100.0f, Mode::MODE);
+            }
+        };
+
+        //==============================================================================
+        // 流水线组合
+        //==============================================================================
+
+        namespace detail
+        {
+            /// 求阶段列表中的处理长度（第一个非零FIXED_SIZE）
+            template <typename... Stages>
+            constexpr size_t resolveLength()
+            {
+                size_t length = 0;
+                ((length = (length == 0 ? Stages::FIXED_SIZE : length)), ...);
+                return length;
+            }
+
+            /// 检查所有定长阶段的长度一致
+            template <size_t LENGTH, typename... Stages>
+            constexpr bool lengthsConsistent()
+            {
+                return ((Stages::FIXED_SIZE == 0 || Stages::FIXED_SIZE == LENGTH) && ...);
+            }
+
+            /// 检查相邻阶段的数据类型衔接
+            template <typename First, typename... Rest>
+            struct ChainCompatible
+            {
+                static constexpr bool value = true;
+            };
+
+            template <typename First, typename Second, typename... Rest>
+            struct ChainCompatible<First, Second, Rest...>
+            {
+                static constexpr bool value =
+                    std::is_same<typename First::OutputType, typename Second::InputType>::value &&
+                    ChainCompatible<Second, Rest...>::value;
+            };
+
+            /// 中间缓冲区元组（最后一个阶段直接写入调用者的输出）
+            template <size_t LENGTH, typename StageTuple, typename Indices>
+            struct IntermediateBuffers;
+
+            template <size_t LENGTH, typename StageTuple, size_t... I>
+            struct IntermediateBuffers<LENGTH, StageTuple, std::index_sequence<I...>>
+            {
+                using type = std::tuple<
+                    std::array<typename std::tuple_element<I, StageTuple>::type::OutputType, LENGTH>...>;
+            };
+
+        } // namespace detail
+
+        /**
+         * @brief 编译期组合的处理流水线
+         *
+         * 所有阶段处理相同的长度LENGTH（由定长阶段确定）。process()处理单个通道，
+         * 阶段间数据写入对象内的定长缓冲区，不产生堆分配。
+         *
+         * @tparam Stages 阶段类型列表
+         * @note 对象内含中间缓冲区，同一实例不能被并发调用
+         */
+        template <typename... Stages>
+        class Pipeline
+        {
+            static_assert(sizeof...(Stages) > 0, "Pipeline requires at least one stage");
+
+            using StageTuple = std::tuple<Stages...>;
+
+        public:
+            static constexpr size_t STAGE_COUNT = sizeof...(Stages);                 ///< 阶段数
+            static constexpr size_t LENGTH = detail::resolveLength<Stages...>();     ///< 每通道处理长度
+            using InputType = typename std::tuple_element<0, StageTuple>::type::InputType;
+            using OutputType = typename std::tuple_element<STAGE_COUNT - 1, StageTuple>::type::OutputType;
+
+            static_assert(LENGTH > 0, "Pipeline requires at least one fixed-size stage");
+            static_assert(detail::lengthsConsistent<LENGTH, Stages...>(),
+                          "All fixed-size stages must agree on the pipeline length");
+            static_assert(detail::ChainCompatible<Stages...>::value,
+                          "Adjacent stage output/input types must match");
+
+            /**
+             * @brief 处理单个通道
+             * @param input LENGTH个输入元素
+             * @param output LENGTH个输出元素
+             */
+            void process(const InputType *input, OutputType *output)
+            {
+                run<0>(input, output);
+            }
+
+        private:
+            template <size_t I>
+            using StageAt = typename std::tuple_element<I, StageTuple>::type;
+
+            template <size_t I>
+            inline void run(const typename StageAt<I>::InputType *input, OutputType *output)
+            {
+                if constexpr (I + 1 == STAGE_COUNT)
+                {
+                    std::get<I>(stages_).template process<LENGTH>(input, output);
+                }
+                else
+                {
+                    auto &buffer = std::get<I>(buffers_);
+                    std::get<I>(stages_).template process<LENGTH>(input, buffer.data());
+                    run<I + 1>(buffer.data(), output);
+                }
+            }
+
+            StageTuple stages_; ///< 阶段实例
+            typename detail::IntermediateBuffers<LENGTH, StageTuple,
+                                                 std::make_index_sequence<STAGE_COUNT - 1>>::type
+                buffers_; ///< 阶段间定长缓冲区
+        };
+
+        /// 生产处理链：Hann窗 → 1024点FFT → 求模 → CA-CFAR(16参考/4保护)
+        using ProductionPipeline = Pipeline<Window, FFT<1024>, Magnitude, CFAR<CA, 16, 4>>;
+
+    } // namespace pipeline
+} // namespace radar
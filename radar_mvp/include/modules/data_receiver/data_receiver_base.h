@@ -21,15 +21,15 @@
 #include "common/types.h"
 #include "common/error_codes.h"
 #include "common/logger.h"
+#include "common/overflow_ring.h"
+#include "common/control_lane.h"
 #include <thread>
-#include <queue>
 #include <mutex>
-#include <condition_variable>
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
-#include <future>
+#include <deque>
 
 namespace radar
 {
@@ -68,15 +68,24 @@ namespace radar
             DataCallback dataCallback_;   ///< 数据处理回调函数
             ErrorCallback errorCallback_; ///< 错误处理回调函数
 
-            mutable std::mutex statsMutex_;           ///< 统计信息互斥锁
-            mutable std::mutex packetQueueMutex_;     ///< 数据包队列互斥锁
-            std::condition_variable packetAvailable_; ///< 数据包可用条件变量
+            mutable std::mutex statsMutex_;   ///< 统计信息互斥锁
+            mutable std::mutex receiveMutex_; ///< 异步接收请求与回调互斥锁
 
-            std::queue<RawDataPacketPtr> packetQueue_; ///< 接收数据包队列
+            std::unique_ptr<OverflowRing<RawDataPacketPtr>> packetRing_; ///< 接收数据包环形缓冲区（满时按overflowPolicy处理）
+            std::deque<Promise<RawDataPacketPtr>> pendingReceives_;      ///< 等待数据包的异步接收请求（先到先得）
+            std::atomic<size_t> pendingReceiveCount_{0};                 ///< 等待中的异步接收请求数（生产者无锁读取）
 
             std::shared_ptr<spdlog::logger> logger_;     ///< 日志记录器
             std::unique_ptr<DataReceiverConfig> config_; ///< 配置参数
 
+            std::shared_ptr<const BackpressureSignal> backpressure_;                       ///< 下游背压信号（std::atomic_load/atomic_store访问）
+            std::atomic<BackpressurePolicy> backpressurePolicy_{BackpressurePolicy::NONE}; ///< 下游无信用时的处理方式
+            std::atomic<uint32_t> backpressureMaxWaitMs_{0};                               ///< 节流时每个数据包最长等待时间(毫秒)
+            std::atomic<uint64_t> receivedCount_{0};                                       ///< 累计接收数据包数
+            std::atomic<uint64_t> droppedCount_{0};                                        ///< 累计在边缘丢弃的数据包数
+            DropCounter backpressureDrops_;                                                ///< 因下游背压丢弃的数据包数（限频报告）
+            ControlLane controlLane_;                                                      ///< 控制通道（绕过接收缓冲区，接收线程在数据包之间执行）
+
         public:
             /**
              * @brief 构造函数
@@ -115,11 +124,25 @@ namespace radar
              */
             ErrorCode receivePacket(RawDataPacketPtr &packet, uint32_t timeoutMs = 0) override;
 
+            /**
+             * @brief 批量接收数据包（同步方式）
+             * @param packets 输出数组，至少maxCount个元素
+             * @param maxCount 最多接收的数据包数
+             * @param receivedCount 输出参数，实际接收的数据包数
+             * @param timeoutMs 等待第一个数据包的超时时间（毫秒），0表示无限等待
+             * @return 操作结果错误码
+             */
+            ErrorCode receivePackets(RawDataPacketPtr *packets, size_t maxCount, size_t &receivedCount,
+                                     uint32_t timeoutMs = 0) override;
+
             /**
              * @brief 异步接收数据包
-             * @return 数据包的future对象
+             * @return 数据包的Future
+             *
+             * 队列中已有数据包时立即完成；否则登记请求，下一个到达的数据包直接交给它，
+             * 不创建等待线程。接收器停止时未完成的请求以RECEIVER_NOT_READY异常完成。
              */
-            std::future<RawDataPacketPtr> receivePacketAsync() override;
+            Future<RawDataPacketPtr> receivePacketAsync() override;
 
             /**
              * @brief 设置数据包接收回调函数
@@ -133,6 +156,13 @@ namespace radar
              */
             BufferStatus getBufferStatus() const override;
 
+            /**
+             * @brief 设置下游背压信号
+             * @param signal 下游信用池，nullptr表示不受下游约束
+             * @note 可在运行中更换；无信用时enqueuePacket()按backpressurePolicy节流或丢弃
+             */
+            void setBackpressureSignal(std::shared_ptr<const BackpressureSignal> signal) override;
+
             /**
              * @brief 刷新接收缓冲区
              * @return 操作结果错误码
@@ -206,6 +236,27 @@ namespace radar
              */
             PerformanceMetricsPtr getPerformanceMetrics() const override;
 
+            /**
+             * @brief 投递控制消息（不经过接收缓冲区）
+             *
+             * 消息在接收线程上、相邻两个数据包之间按投递顺序执行，可以安全地修改接收路径使用的
+             * 参数（如模拟目标、采样配置）。接收缓冲区或下游再满也不影响控制消息的投递。
+             *
+             * @param action 控制消息
+             * @return 操作结果错误码
+             * @retval SystemErrors::SUCCESS 已投递
+             * @retval SystemErrors::INVALID_PARAMETER 消息为空
+             * @retval SystemErrors::RESOURCE_UNAVAILABLE 控制通道已满
+             * @note 接收线程未启动时，消息保留到start()之后执行
+             */
+            ErrorCode postControl(ControlLane::Action action);
+
+            /**
+             * @brief 获取控制通道统计
+             * @return 统计快照（含投递到执行的延迟）
+             */
+            ControlLaneStatistics getControlStatistics() const;
+
         protected:
             /**
              * @brief 数据接收主循环（纯虚函数）
@@ -219,6 +270,13 @@ namespace radar
              */
             virtual void receptionLoop() = 0;
 
+            /**
+             * @brief 执行待执行的控制消息
+             *
+             * @note 接收循环在每个数据包之前调用；没有消息时只是一次原子读
+             */
+            void applyControlMessages();
+
             /**
              * @brief 处理接收到的原始数据
              *
@@ -263,7 +321,8 @@ namespace radar
              * @brief 将数据包加入接收队列
              *
              * @param packet 数据包智能指针
-             * @note 该方法是线程安全的
+             * @note 设置了背压信号时先按策略节流，drop策略下无信用的数据包直接丢弃；
+             *       缓冲区满时按overflowPolicy处理。producerThreads为1时只能由一个线程调用
              */
             void enqueuePacket(RawDataPacketPtr packet);
 
@@ -276,6 +335,14 @@ namespace radar
              */
             RawDataPacketPtr dequeuePacket(uint32_t timeoutMs);
 
+            /**
+             * @brief 把缓冲区中的数据包交给等待中的异步接收请求
+             *
+             * @note 生产者入队后、请求方登记后各调用一次：两侧都先发布再检查对方，
+             *       不会出现数据包留在缓冲区而请求一直等待的情况
+             */
+            void drainToPendingReceives();
+
         private:
             ModuleState currentState_{ModuleState::UNINITIALIZED}; ///< 当前模块状态
         };
@@ -18,12 +18,13 @@
 #include "../data_receiver/data_receiver_base.h"
 #include "common/types.h"
 #include "common/error_codes.h"
+#include "common/overflow_ring.h"
+#include "common/control_lane.h"
 #include <memory>
 #include <thread>
 #include <atomic>
 #include <mutex>
-#include <condition_variable>
-#include <queue>
+#include <deque>
 #include <chrono>
 #include <random>
 #include <functional>
@@ -87,10 +88,17 @@ namespace radar
             // IDataReceiver 接口实现
             ErrorCode configure(const DataReceiverConfig &config) override;
             ErrorCode receivePacket(RawDataPacketPtr &packet, uint32_t timeoutMs = 0) override;
-            std::future<RawDataPacketPtr> receivePacketAsync() override;
+            ErrorCode receivePackets(RawDataPacketPtr *packets, size_t maxCount, size_t &receivedCount,
+                                     uint32_t timeoutMs = 0) override;
+            Future<RawDataPacketPtr> receivePacketAsync() override;
             void setPacketReceivedCallback(std::function<void(RawDataPacketPtr)> callback) override;
             BufferStatus getBufferStatus() const override;
             ErrorCode flushBuffer() override;
+            void setBackpressureSignal(std::shared_ptr<const BackpressureSignal> signal) override;
+
+            // 控制通道：消息在接收线程上、相邻两个数据包之间执行（暂停期间同样生效）
+            ErrorCode postControl(ControlLane::Action action);
+            ControlLaneStatistics getControlStatistics() const;
 
         private:
             // 硬件管理方法
@@ -110,6 +118,8 @@ namespace radar
             // 缓冲区管理方法
             ErrorCode initializeBuffer();
             bool pushToBuffer(RawDataPacketPtr packet);
+            void drainToPendingReceives();
+            void failPendingReceives();
 
             // 线程函数
             void receiverThreadFunction();
@@ -168,9 +178,16 @@ namespace radar
             std::atomic<bool> isReceiving_;
             std::atomic<bool> shouldStop_;
 
+            // 控制通道（绕过数据缓冲区）
+            ControlLane controlLane_;
+
             // 配置信息
             DataReceiverConfig config_;
 
+            // 下游背压（信号通过std::atomic_load/atomic_store访问）
+            std::shared_ptr<const BackpressureSignal> backpressure_;
+            std::atomic<BackpressurePolicy> backpressurePolicy_{BackpressurePolicy::NONE};
+
             // 硬件相关
             std::unique_ptr<void, void (*)(void *)> hardwareDevice_;
 
@@ -181,17 +198,18 @@ namespace radar
 
             // 同步对象
             mutable std::mutex stateMutex_;
-            mutable std::mutex bufferMutex_;
+            mutable std::mutex pendingMutex_;
             mutable std::mutex configMutex_;
-            std::condition_variable bufferNotEmpty_;
-            std::condition_variable bufferNotFull_;
 
-            // 数据缓冲区
-            std::queue<RawDataPacketPtr> dataBuffer_;
+            // 数据缓冲区（生产者与消费者之间无锁交接，满时按overflowPolicy处理）
+            std::unique_ptr<OverflowRing<RawDataPacketPtr>> buffer_;
+            std::deque<Promise<RawDataPacketPtr>> pendingReceives_; // 等待数据包的异步接收请求，受pendingMutex_保护
+            std::atomic<size_t> pendingReceiveCount_{0};            // 等待中的异步接收请求数，生产者无锁读取
 
             // 统计信息
             std::atomic<uint64_t> packetsReceived_;
             std::atomic<uint64_t> packetsDropped_;
+            DropCounter backpressureDrops_; // 因下游背压丢弃的数据包数（限频报告）
             std::atomic<uint64_t> bytesReceived_;
             std::atomic<uint32_t> lastSequenceId_;
 
@@ -209,6 +227,7 @@ namespace radar
             static constexpr size_t MAX_PACKET_SIZE = 65536;
             static constexpr size_t MAX_QUEUE_SIZE = 1000;
             static constexpr uint32_t DEFAULT_TIMEOUT_MS = 1000;
+            static constexpr uint32_t DROP_REPORT_INTERVAL_MS = 1000; // 缓冲区溢出与背压丢弃日志的最短间隔
         };
 
     } // namespace modules
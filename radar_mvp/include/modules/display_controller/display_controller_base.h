@@ -21,6 +21,7 @@
 #include "../../common/types.h"
 #include "../../common/error_codes.h"
 #include "../../common/logger.h"
+#include "../../common/thread_placement.h"
 #include <thread>
 #include <queue>
 #include <mutex>
@@ -172,6 +173,12 @@ namespace radar
 
             std::vector<radar::IDisplayController::DisplayFormat> getSupportedFormats() const override;
 
+            /**
+             * @brief 设置显示线程放置
+             * @param placement 放置配置（DisplayControllerConfig::threadPlacement），在下次start()启动的线程上生效
+             */
+            void setThreadPlacement(const ThreadPlacementConfig &placement);
+
         protected:
             //==============================================================================
             // 受保护的虚函数接口（由派生类实现）
@@ -259,6 +266,7 @@ namespace radar
             std::atomic<bool> shouldStop_;          ///< 停止信号标志
             std::thread displayThread_;             ///< 显示线程
             std::condition_variable dataAvailable_; ///< 数据可用条件变量
+            ThreadPlacementConfig threadPlacement_; ///< 显示线程放置（受configMutex_保护）
 
             // 数据缓冲区
             std::deque<DisplayData> displayBuffer_; ///< 显示数据缓冲区
@@ -0,0 +1,144 @@
+/**
+ * @file latency_histogram.h
+ * @brief 对数-线性分桶的延迟直方图（HDR风格）
+ *
+ * 平均值掩盖了我们真正关心的尾部延迟，这里按HDR直方图的方式分桶：
+ * - 每个2的幂区间再线性分成32个子桶，任何量级上的相对误差都不超过1/32
+ * - 记录只是几次relaxed读写，没有比较交换和锁；每个工作线程写自己的实例
+ * - 读取时把各实例的桶计数相加后再求分位数，合并是精确的
+ *
+ * 可表示的范围为0 ~ 2^40纳秒（约18分钟），更大的值计入最后一个桶，最大值单独精确记录。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#pragma once
+
+#include "common/types.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief 延迟直方图（单写者）
+     *
+     * @note record()只能由一个线程调用（通常是所属工作线程），读取可以在任何线程并发进行；
+     *       读取与记录并发时快照可能缺少正在写入的那一个样本
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr uint32_t SUB_BUCKET_BITS = 5;                      ///< 每个量级的线性子桶位数
+        static constexpr uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS; ///< 每个量级的线性子桶数
+        static constexpr uint32_t MAX_MAGNITUDE = 40;                       ///< 可区分的最高量级（2^40纳秒）
+        static constexpr size_t BUCKET_COUNT =
+            static_cast<size_t>(MAX_MAGNITUDE - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT; ///< 桶总数
+
+        /**
+         * @brief 多个直方图合并后的快照，用于求分位数
+         */
+        class Snapshot
+        {
+        public:
+            Snapshot();
+
+            /**
+             * @brief 累加一个直方图的当前计数
+             * @param histogram 直方图
+             */
+            void add(const LatencyHistogram &histogram);
+
+            /**
+             * @brief 获取样本数
+             * @return 样本数
+             */
+            uint64_t getCount() const { return count_; }
+
+            /**
+             * @brief 求分位数
+             * @param quantile 分位（0~1）
+             * @return 该分位所在桶的上界（纳秒），不超过最大值；没有样本时为0
+             */
+            uint64_t valueAtQuantile(double quantile) const;
+
+            /**
+             * @brief 生成分布摘要
+             * @return p50/p90/p99/p99.9/最大值/平均值（微秒）
+             */
+            LatencyPercentiles summarize() const;
+
+        private:
+            std::vector<uint64_t> counts_; ///< 各桶计数
+            uint64_t count_ = 0;           ///< 样本数（各桶之和）
+            uint64_t sumNs_ = 0;           ///< 样本总和（纳秒）
+            uint64_t maxNs_ = 0;           ///< 最大值（纳秒）
+        };
+
+        LatencyHistogram() = default;
+
+        LatencyHistogram(const LatencyHistogram &) = delete;
+        LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+        /**
+         * @brief 记录一个样本（单写者）
+         * @param valueNs 延迟（纳秒）
+         */
+        void record(uint64_t valueNs)
+        {
+            increment(counts_[bucketIndex(valueNs)], 1);
+            increment(sumNs_, valueNs);
+            if (valueNs > maxNs_.load(std::memory_order_relaxed))
+            {
+                maxNs_.store(valueNs, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief 累加另一个直方图（同样遵守单写者约束）
+         * @param other 另一个直方图
+         */
+        void add(const LatencyHistogram &other);
+
+        /**
+         * @brief 清零
+         * @note 与record()并发时可能保留个别样本
+         */
+        void reset();
+
+        /**
+         * @brief 计算样本所在的桶
+         * @param valueNs 延迟（纳秒）
+         * @return 桶下标
+         */
+        static size_t bucketIndex(uint64_t valueNs);
+
+        /**
+         * @brief 计算桶能表示的最大值
+         * @param index 桶下标
+         * @return 上界（纳秒，含）
+         */
+        static uint64_t bucketUpperBound(size_t index);
+
+    private:
+        /**
+         * @brief 单写者自增：relaxed读后relaxed写，不使用读-改-写指令
+         */
+        static void increment(std::atomic<uint64_t> &counter, uint64_t delta)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> counts_{}; ///< 各桶计数
+        std::atomic<uint64_t> sumNs_{0};                           ///< 样本总和（纳秒）
+        std::atomic<uint64_t> maxNs_{0};                           ///< 最大值（纳秒）
+    };
+
+} // namespace radar
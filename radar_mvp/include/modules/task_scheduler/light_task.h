@@ -0,0 +1,232 @@
+/**
+ * @file light_task.h
+ * @brief 免分配的轻量任务与结果句柄
+ *
+ * 常规任务路径每次提交都要构造ScheduledTask（shared_ptr、名称字符串、std::function），
+ * 再在互斥锁保护的映射表中登记promise。轻量任务把这些合并为一个固定大小的节点：
+ * - 闭包保存在96字节内联缓冲区的SmallFunction中
+ * - 完成状态与异常保存在节点内的结果槽中，由LightTaskFuture直接读取，没有旁路映射表
+ * - 节点直接作为PoolItem进入工作窃取线程池，不再装箱
+ * - 节点内存取自每线程空闲链表（工作线程即每个worker一份），满了/空了才与全局仓库批量交换
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see TaskScheduler::submitLightTask
+ * @see SmallFunction
+ */
+
+#pragma once
+
+#include "modules/task_scheduler/small_function.h"
+#include "modules/task_scheduler/work_stealing_pool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+namespace radar
+{
+
+    /**
+     * @brief 轻量任务节点
+     *
+     * 由线程池和（可选的）LightTaskFuture共同引用，最后一个引用释放时把内存归还空闲链表。
+     */
+    class LightTask final : public PoolItem
+    {
+    public:
+        static constexpr size_t INLINE_CAPACITY = 96; ///< 闭包内联缓冲区字节数
+
+        /// 任务闭包类型
+        using Function = SmallFunction<void(), INLINE_CAPACITY>;
+
+        /**
+         * @brief 创建任务节点
+         * @param function 可调用对象（只需可移动）
+         * @param withFuture 是否为LightTaskFuture保留一个引用
+         * @return 任务节点
+         */
+        template <typename F>
+        static LightTask *create(F &&function, bool withFuture)
+        {
+            void *memory = allocate();
+            try
+            {
+                return new (memory) LightTask(std::forward<F>(function), withFuture ? 2u : 1u);
+            }
+            catch (...)
+            {
+                deallocate(memory);
+                throw;
+            }
+        }
+
+        void run() override;
+        void discard() noexcept override;
+
+        /**
+         * @brief 检查是否已完成（成功、抛出异常或被丢弃）
+         * @return 是否已完成
+         */
+        bool isReady() const noexcept;
+
+        /**
+         * @brief 等待完成
+         */
+        void wait();
+
+        /**
+         * @brief 限时等待完成
+         * @param timeout 超时时间
+         * @return 是否已完成
+         */
+        bool waitFor(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief 获取执行时抛出的异常
+         * @return 异常，成功时为空
+         * @note 仅在isReady()之后调用
+         */
+        std::exception_ptr getError() const noexcept;
+
+        /**
+         * @brief 释放一个引用
+         */
+        void release() noexcept;
+
+        /**
+         * @brief 获取当前线程空闲链表中的节点数（测试与诊断用）
+         * @return 节点数
+         */
+        static size_t cachedBlockCount() noexcept;
+
+    private:
+        static constexpr uint32_t READY = 1u;   ///< 状态位：已完成
+        static constexpr uint32_t WAITING = 2u; ///< 状态位：有线程在等待
+
+        template <typename F>
+        LightTask(F &&function, uint32_t references)
+            : function_(std::forward<F>(function)), references_(references)
+        {
+        }
+
+        ~LightTask() override = default;
+
+        /**
+         * @brief 写入结果槽并唤醒等待者
+         * @param error 异常，成功时为空
+         */
+        void complete(std::exception_ptr error) noexcept;
+
+        /**
+         * @brief 从当前线程空闲链表分配节点内存
+         */
+        static void *allocate();
+
+        /**
+         * @brief 把节点内存归还当前线程空闲链表
+         */
+        static void deallocate(void *memory) noexcept;
+
+        Function function_;                ///< 任务闭包，执行后立即销毁以尽早释放捕获
+        std::exception_ptr error_;         ///< 结果槽：执行时抛出的异常
+        std::atomic<uint32_t> state_{0};   ///< READY/WAITING状态位
+        std::atomic<uint32_t> references_; ///< 引用计数（线程池 + 句柄）
+    };
+
+    /**
+     * @brief 轻量任务结果句柄
+     *
+     * 只移动；析构时释放对任务节点的引用，不等待任务完成。
+     */
+    class LightTaskFuture
+    {
+    public:
+        LightTaskFuture() noexcept = default;
+
+        /**
+         * @brief 接管任务节点的一个引用
+         * @param task 任务节点
+         */
+        explicit LightTaskFuture(LightTask *task) noexcept : task_(task) {}
+
+        LightTaskFuture(LightTaskFuture &&other) noexcept : task_(std::exchange(other.task_, nullptr)) {}
+
+        LightTaskFuture &operator=(LightTaskFuture &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                task_ = std::exchange(other.task_, nullptr);
+            }
+            return *this;
+        }
+
+        LightTaskFuture(const LightTaskFuture &) = delete;
+        LightTaskFuture &operator=(const LightTaskFuture &) = delete;
+
+        ~LightTaskFuture()
+        {
+            reset();
+        }
+
+        /**
+         * @brief 检查是否关联了任务
+         * @return 是否有效
+         */
+        bool valid() const noexcept { return task_ != nullptr; }
+
+        /**
+         * @brief 检查任务是否已完成
+         * @return 是否已完成，无效句柄返回false
+         */
+        bool isReady() const noexcept { return task_ != nullptr && task_->isReady(); }
+
+        /**
+         * @brief 等待任务完成
+         */
+        void wait() const
+        {
+            if (task_)
+            {
+                task_->wait();
+            }
+        }
+
+        /**
+         * @brief 限时等待任务完成
+         * @param timeout 超时时间
+         * @return 是否已完成
+         */
+        bool waitFor(std::chrono::milliseconds timeout) const
+        {
+            return task_ != nullptr && task_->waitFor(timeout);
+        }
+
+        /**
+         * @brief 等待任务完成并释放句柄，任务抛出的异常在此重新抛出
+         * @throws std::future_error 句柄无效
+         */
+        void get();
+
+        /**
+         * @brief 释放任务引用，句柄变为无效
+         */
+        void reset() noexcept
+        {
+            if (task_)
+            {
+                task_->release();
+                task_ = nullptr;
+            }
+        }
+
+    private:
+        LightTask *task_ = nullptr; ///< 任务节点
+    };
+
+} // namespace radar
@@ -0,0 +1,217 @@
+/**
+ * @file small_function.h
+ * @brief 带内联存储的只移动可调用对象
+ *
+ * 与std::function相比：
+ * - 只要求可移动，能保存捕获了unique_ptr、promise等只移动对象的lambda
+ * - 内联缓冲区可配置（任务路径使用96字节），常见的任务闭包不再单独分配堆内存
+ * - 超出缓冲区或移动构造可能抛异常的可调用对象退化为堆分配，行为不变
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see LightTask
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace radar
+{
+
+    template <typename Signature, size_t Capacity = 64>
+    class SmallFunction;
+
+    /**
+     * @brief 带内联存储的只移动可调用对象
+     * @tparam R 返回值类型
+     * @tparam Args 参数类型
+     * @tparam Capacity 内联缓冲区字节数
+     *
+     * @note 非线程安全；移动后源对象为空
+     */
+    template <typename R, typename... Args, size_t Capacity>
+    class SmallFunction<R(Args...), Capacity>
+    {
+    public:
+        SmallFunction() noexcept = default;
+
+        SmallFunction(std::nullptr_t) noexcept {}
+
+        /**
+         * @brief 从可调用对象构造
+         * @param function 可调用对象
+         */
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<F>, SmallFunction>::value>>
+        SmallFunction(F &&function)
+        {
+            using Stored = std::decay_t<F>;
+            if constexpr (fitsInline<Stored>())
+            {
+                new (storage_) Stored(std::forward<F>(function));
+                ops_ = &inlineOps<Stored>;
+            }
+            else
+            {
+                *reinterpret_cast<Stored **>(storage_) = new Stored(std::forward<F>(function));
+                ops_ = &heapOps<Stored>;
+            }
+        }
+
+        SmallFunction(SmallFunction &&other) noexcept
+        {
+            moveFrom(other);
+        }
+
+        SmallFunction &operator=(SmallFunction &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        SmallFunction(const SmallFunction &) = delete;
+        SmallFunction &operator=(const SmallFunction &) = delete;
+
+        ~SmallFunction()
+        {
+            reset();
+        }
+
+        /**
+         * @brief 调用
+         * @param args 参数
+         * @return 可调用对象的返回值
+         * @note 对象为空时行为未定义
+         */
+        R operator()(Args... args)
+        {
+            return ops_->invoke(storage_, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief 检查是否持有可调用对象
+         */
+        explicit operator bool() const noexcept
+        {
+            return ops_ != nullptr;
+        }
+
+        /**
+         * @brief 检查可调用对象是否保存在内联缓冲区中
+         * @return 是否内联保存（为空时返回false）
+         */
+        bool isInline() const noexcept
+        {
+            return ops_ != nullptr && ops_->inlined;
+        }
+
+        /**
+         * @brief 销毁持有的可调用对象
+         */
+        void reset() noexcept
+        {
+            if (ops_)
+            {
+                ops_->destroy(storage_);
+                ops_ = nullptr;
+            }
+        }
+
+        /**
+         * @brief 获取内联缓冲区字节数
+         * @return 字节数
+         */
+        static constexpr size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+    private:
+        static_assert(Capacity >= sizeof(void *), "SmallFunction capacity must hold a pointer");
+
+        /// 类型擦除的操作表（每种可调用类型一份静态实例）
+        struct Ops
+        {
+            R (*invoke)(void *, Args &&...);       ///< 调用
+            void (*move)(void *, void *) noexcept; ///< 移动到新缓冲区并销毁源对象
+            void (*destroy)(void *) noexcept;      ///< 销毁
+            bool inlined;                          ///< 是否内联保存
+        };
+
+        template <typename F>
+        static constexpr bool fitsInline()
+        {
+            return sizeof(F) <= Capacity &&
+                   alignof(F) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible<F>::value;
+        }
+
+        template <typename F>
+        static R invokeInline(void *storage, Args &&...args)
+        {
+            return (*static_cast<F *>(storage))(std::forward<Args>(args)...);
+        }
+
+        template <typename F>
+        static void moveInline(void *destination, void *source) noexcept
+        {
+            new (destination) F(std::move(*static_cast<F *>(source)));
+            static_cast<F *>(source)->~F();
+        }
+
+        template <typename F>
+        static void destroyInline(void *storage) noexcept
+        {
+            static_cast<F *>(storage)->~F();
+        }
+
+        template <typename F>
+        static R invokeHeap(void *storage, Args &&...args)
+        {
+            return (**static_cast<F **>(storage))(std::forward<Args>(args)...);
+        }
+
+        template <typename F>
+        static void moveHeap(void *destination, void *source) noexcept
+        {
+            *static_cast<F **>(destination) = *static_cast<F **>(source);
+        }
+
+        template <typename F>
+        static void destroyHeap(void *storage) noexcept
+        {
+            delete *static_cast<F **>(storage);
+        }
+
+        template <typename F>
+        static constexpr Ops inlineOps{&invokeInline<F>, &moveInline<F>, &destroyInline<F>, true};
+
+        template <typename F>
+        static constexpr Ops heapOps{&invokeHeap<F>, &moveHeap<F>, &destroyHeap<F>, false};
+
+        void moveFrom(SmallFunction &other) noexcept
+        {
+            if (other.ops_)
+            {
+                other.ops_->move(storage_, other.storage_);
+                ops_ = other.ops_;
+                other.ops_ = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char storage_[Capacity]; ///< 内联缓冲区（或堆对象指针）
+        const Ops *ops_ = nullptr;                                  ///< 操作表，为空表示不持有对象
+    };
+
+} // namespace radar
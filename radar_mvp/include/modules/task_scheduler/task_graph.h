@@ -0,0 +1,230 @@
+/**
+ * @file task_graph.h
+ * @brief 任务依赖图（DAG）执行器
+ *
+ * 把"全部通道FFT完成后做波束形成，再做CFAR"这类有依赖关系的工作描述为一张图，
+ * 整张图提交给调度器后不需要任何线程阻塞等待：
+ * - 每个节点持有一个原子依赖计数，前驱完成时递减，减到0的节点立即交给工作线程
+ * - 节点本身就是线程池的侵入式队列节点，释放后继不分配内存；
+ *   工作线程释放的后继进入本线程队列，数据留在同一缓存中
+ * - 图结构只构建一次，每次提交只重置计数器，可作为模板逐包重复执行
+ * - 任一节点抛出异常后其余节点跳过执行，图的Future以该异常完成
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see TaskScheduler::submitGraph
+ * @see WorkStealingPool
+ */
+
+#pragma once
+
+#include "common/error_codes.h"
+#include "common/future.h"
+#include "modules/task_scheduler/small_function.h"
+#include "modules/task_scheduler/work_stealing_pool.h"
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief 任务依赖图
+     *
+     * @details
+     * 节点函数在每次执行时都会被调用，需要逐包变化的数据通过捕获的上下文传入，
+     * 例如捕获一个指向"当前数据包"槽位的引用，每次提交前更新槽位。
+     *
+     * @code
+     * TaskGraph graph("range-doppler");
+     * std::vector<TaskGraph::NodeId> ffts;
+     * for (uint32_t ch = 0; ch < channels; ++ch)
+     *     ffts.push_back(graph.addNode([&, ch]() { fft(frame, ch); }));
+     * auto beamform = graph.addNode([&]() { beamformer(frame); });
+     * auto cfar = graph.addNode([&]() { detector(frame); });
+     * for (auto id : ffts)
+     *     graph.precede(id, beamform);
+     * graph.precede(beamform, cfar);
+     *
+     * frame = nextPacket();
+     * scheduler.submitGraph(graph).get();
+     * @endcode
+     *
+     * @note 构建（addNode/precede）不是线程安全的，且不能在执行期间进行；
+     *       同一张图同一时刻只能执行一次，销毁前必须等待执行完成
+     */
+    class TaskGraph
+    {
+    public:
+        using NodeId = uint32_t;                                        ///< 节点编号（按添加顺序从0开始）
+        using Function = SmallFunction<void(), 96>;                     ///< 节点函数类型
+        static constexpr NodeId INVALID_NODE = static_cast<NodeId>(-1); ///< 无效节点编号
+
+        /**
+         * @brief 构造函数
+         * @param name 图名称（日志用）
+         */
+        explicit TaskGraph(std::string name = "graph");
+
+        /**
+         * @brief 析构函数
+         * @note 图正在执行时析构属于使用错误
+         */
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph &) = delete;
+        TaskGraph &operator=(const TaskGraph &) = delete;
+
+        /**
+         * @brief 添加节点
+         * @param function 节点函数（可多次调用，不超过96字节的闭包不单独分配内存）
+         * @param name 节点名称（日志用）
+         * @return 节点编号，图正在执行时返回INVALID_NODE
+         */
+        template <typename F>
+        NodeId addNode(F &&function, std::string name = "")
+        {
+            if (running_.load(std::memory_order_acquire))
+            {
+                return INVALID_NODE;
+            }
+            const NodeId id = static_cast<NodeId>(nodes_.size());
+            nodes_.push_back(std::make_unique<Node>(this, id, Function(std::forward<F>(function)), std::move(name)));
+            compiled_ = false;
+            return id;
+        }
+
+        /**
+         * @brief 添加依赖边：before完成后after才能开始
+         * @param before 前驱节点
+         * @param after 后继节点
+         * @return 操作结果错误码
+         * @retval SystemErrors::INVALID_PARAMETER 节点编号无效或两者相同
+         * @retval TaskSchedulerErrors::GRAPH_BUSY 图正在执行
+         */
+        ErrorCode precede(NodeId before, NodeId after);
+
+        /**
+         * @brief 检查图并计算入度与根节点（提交时自动调用，结构不变时不重复计算）
+         * @return 操作结果错误码
+         * @retval TaskSchedulerErrors::GRAPH_CYCLE 图中存在环
+         * @retval TaskSchedulerErrors::GRAPH_BUSY 图正在执行
+         */
+        ErrorCode validate();
+
+        /**
+         * @brief 提交到线程池执行
+         * @param pool 工作窃取线程池
+         * @return 全部节点完成（或因异常、取消而跳过）时就绪的Future；取消后尚未开始的节点跳过执行
+         * @throws std::invalid_argument 图中存在环
+         * @throws std::runtime_error 图正在执行
+         */
+        Future<void> launch(WorkStealingPool &pool);
+
+        /**
+         * @brief 清空全部节点与依赖边
+         * @return 操作结果错误码
+         * @retval TaskSchedulerErrors::GRAPH_BUSY 图正在执行
+         */
+        ErrorCode clear();
+
+        /**
+         * @brief 获取图名称
+         * @return 名称
+         */
+        const std::string &getName() const { return name_; }
+
+        /**
+         * @brief 获取节点数
+         * @return 节点数
+         */
+        size_t getNodeCount() const { return nodes_.size(); }
+
+        /**
+         * @brief 获取节点名称
+         * @param id 节点编号
+         * @return 名称，编号无效时为空串
+         */
+        const std::string &getNodeName(NodeId id) const;
+
+        /**
+         * @brief 检查是否正在执行
+         * @return 是否正在执行
+         */
+        bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 获取已完成的执行次数
+         * @return 次数
+         */
+        uint64_t getRunCount() const { return runCount_.load(std::memory_order_relaxed); }
+
+    private:
+        /// 图节点（同时是线程池的队列节点，内存由图管理）
+        class Node final : public PoolItem
+        {
+        public:
+            Node(TaskGraph *graph, NodeId id, Function function, std::string name)
+                : graph_(graph), id_(id), function_(std::move(function)), name_(std::move(name)) {}
+
+            void run() override;
+            void discard() noexcept override;
+
+            TaskGraph *graph_;                 ///< 所属图
+            NodeId id_;                        ///< 节点编号
+            Function function_;                ///< 节点函数
+            std::string name_;                 ///< 节点名称
+            std::vector<Node *> successors_;   ///< 后继节点
+            uint32_t dependencyCount_ = 0;     ///< 入度（validate()计算）
+            std::atomic<uint32_t> pending_{0}; ///< 本次执行中尚未完成的前驱数
+        };
+
+        /**
+         * @brief 计算入度与根节点并检查环（结构未变时直接返回）
+         * @return 操作结果错误码
+         */
+        ErrorCode compile();
+
+        /**
+         * @brief 节点结束（执行或跳过）后释放后继，并在最后一个节点结束时完成图
+         * @param node 结束的节点
+         * @param submitSuccessors 是否把就绪的后继提交给线程池；线程池丢弃节点时
+         *        （持有注入队列锁）不能再提交，改为就地跳过
+         */
+        void finishNode(Node &node, bool submitSuccessors) noexcept;
+
+        /**
+         * @brief 记录第一个失败，之后的节点跳过执行
+         * @param error 异常
+         */
+        void fail(std::exception_ptr error) noexcept;
+
+        /**
+         * @brief 检查本次执行是否应跳过剩余节点
+         * @return 已失败或被取消时返回true
+         */
+        bool shouldSkip() const noexcept;
+
+        std::string name_;                         ///< 图名称
+        std::vector<std::unique_ptr<Node>> nodes_; ///< 节点（地址在图的生命周期内不变）
+        std::vector<Node *> roots_;                ///< 入度为0的节点（validate()计算）
+        bool compiled_ = false;                    ///< 入度与根节点是否与当前结构一致
+
+        WorkStealingPool *pool_ = nullptr;   ///< 本次执行使用的线程池
+        Promise<void> promise_;              ///< 本次执行的结果
+        std::atomic<bool> running_{false};   ///< 是否正在执行
+        std::atomic<uint32_t> remaining_{0}; ///< 本次执行中尚未结束的节点数
+        std::atomic<bool> failed_{false};    ///< 本次执行是否已有节点失败
+        std::exception_ptr error_;           ///< 第一个失败节点的异常（failed_置位者写入）
+        std::atomic<uint64_t> runCount_{0};  ///< 已完成的执行次数
+    };
+
+} // namespace radar
@@ -30,7 +30,7 @@ namespace radar
         {
             THREAD_POOL,  ///< 线程池调度器
             REAL_TIME,    ///< 实时调度器
-            LOAD_BALANCE, ///< 负载均衡调度器（预留）
+            LOAD_BALANCE, ///< 负载均衡调度器（多个处理器实例间派发）
             DISTRIBUTED   ///< 分布式调度器（预留）
         };
 
@@ -56,6 +56,17 @@ namespace radar
             const TaskSchedulerConfig &config,
             std::shared_ptr<spdlog::logger> logger = nullptr);
 
+        /**
+         * @brief 创建负载均衡调度器
+         *
+         * @param config 调度器配置（loadBalancePolicy选择jsq或p2c）
+         * @param logger 日志记录器实例
+         * @return 负载均衡调度器智能指针，创建失败时返回 nullptr；处理器实例需另行登记
+         */
+        std::unique_ptr<LoadBalanceScheduler> createLoadBalanceScheduler(
+            const TaskSchedulerConfig &config,
+            std::shared_ptr<spdlog::logger> logger = nullptr);
+
         /**
          * @brief 自动创建合适的任务调度器
          *
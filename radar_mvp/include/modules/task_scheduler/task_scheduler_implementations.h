@@ -13,8 +13,20 @@
 #pragma once
 
 #include "task_scheduler_interfaces.h"
+#include "work_stealing_pool.h"
+#include "light_task.h"
+#include "task_graph.h"
+#include "latency_histogram.h"
+#include "timer_wheel.h"
+#include "common/mpmc_ring_queue.h"
+#include "common/event_count.h"
+#include "common/control_lane.h"
 #include "common/interfaces.h"
+#include "common/thread_placement.h"
 #include "common/logger.h"
+#include <array>
+#include <deque>
+#include <list>
 #include <thread>
 #include <queue>
 #include <mutex>
@@ -45,44 +57,306 @@ namespace radar
         void clear() override;
 
     private:
-        mutable std::mutex queueMutex_;
-        std::condition_variable taskAvailable_;
-        std::queue<ScheduledTaskPtr> taskQueue_;
+        /**
+         * @brief 非阻塞出队（队列为空时不加锁）
+         * @param task 输出参数，出队的任务
+         * @return 是否取到任务
+         */
+        bool tryDequeue(ScheduledTaskPtr &task);
+
+        mutable std::mutex queueMutex_;          ///< 队列互斥锁
+        std::queue<ScheduledTaskPtr> taskQueue_; ///< 任务队列
+        std::atomic<size_t> count_{0};           ///< 任务数（无锁读取）
+        EventCount available_;                   ///< 任务可用通知
     };
 
     /**
      * @brief 优先级任务队列实现
+     *
+     * 每个优先级一个无锁MPMC环形队列，配合非空级别位图：入队与出队都是O(1)，
+     * 同一优先级内保持FIFO，不需要比较函数也没有全局锁。
+     * 为防止低优先级任务饿死，每agingInterval次出队改为服务最低的非空级别（老化），
+     * 低优先级任务至少获得1/agingInterval的出队份额。
      */
     class PriorityTaskQueue : public TaskQueue
     {
     public:
-        PriorityTaskQueue() = default;
+        /**
+         * @brief 构造函数
+         * @param levelCapacity 每个优先级的队列容量
+         * @param agingInterval 老化间隔（出队次数），0表示关闭老化
+         */
+        explicit PriorityTaskQueue(size_t levelCapacity = 1024, uint32_t agingInterval = 16);
         ~PriorityTaskQueue() override = default;
 
+        ErrorCode enqueue(const ScheduledTaskPtr &task) override;
+        ErrorCode dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs = 1000) override;
+        bool tryDequeueAbove(PacketPriority priority, ScheduledTaskPtr &task) override;
+        size_t size() const override;
+        bool empty() const override;
+        void clear() override;
+
+        /**
+         * @brief 获取因老化而越级服务低优先级任务的次数
+         * @return 老化出队次数
+         */
+        uint64_t getAgedDequeueCount() const;
+
+    private:
+        /**
+         * @brief 获取任务所在的优先级级别
+         * @param task 任务对象
+         * @return 级别下标
+         */
+        static size_t levelOf(const ScheduledTaskPtr &task);
+
+        /**
+         * @brief 非阻塞出队
+         * @param task 输出参数，出队的任务
+         * @return 是否取到任务
+         */
+        bool tryDequeue(ScheduledTaskPtr &task);
+
+        /**
+         * @brief 级别出队失败后清除其非空位（清位后发现并发写入则恢复）
+         * @param level 级别下标
+         */
+        void clearLevelBit(size_t level);
+
+        using LevelQueue = MpmcRingQueue<ScheduledTaskPtr>;
+
+        std::array<std::unique_ptr<LevelQueue>, TASK_PRIORITY_LEVELS> levels_; ///< 各优先级队列
+        std::atomic<uint32_t> nonEmptyMask_{0};                                ///< 非空级别位图
+        std::atomic<size_t> count_{0};                                         ///< 任务总数
+        std::atomic<uint64_t> dequeueTicket_{0};                               ///< 出队序号（老化计数）
+        std::atomic<uint64_t> agedDequeues_{0};                                ///< 老化出队次数
+        uint32_t agingInterval_;                                               ///< 老化间隔
+        EventCount available_;                                                 ///< 任务可用通知
+    };
+
+    /**
+     * @brief 最早截止时间优先（EDF）任务队列实现
+     *
+     * 按任务截止时间排序的4叉堆：堆元素内联保存截止时间键，比较时不访问任务对象，
+     * 4叉堆层数约为二叉堆的一半，每层的子节点位于相邻内存，缓存更友好。
+     * 截止时间相同的任务按入队顺序出队。没有截止时间的任务排在所有带截止时间的任务之后。
+     *
+     * 出队时若堆顶任务已过期：
+     * - DEMOTE：移入降级队列，只有在没有未过期任务时才按过期先后出队
+     * - DROP：照常按截止时间出队，由调度器丢弃并结束其future
+     */
+    class EDFTaskQueue : public TaskQueue
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 队列容量
+         * @param missPolicy 错过截止时间的处理策略
+         */
+        explicit EDFTaskQueue(size_t capacity = 1024,
+                              DeadlineMissPolicy missPolicy = DeadlineMissPolicy::DEMOTE);
+        ~EDFTaskQueue() override = default;
+
+        ErrorCode enqueue(const ScheduledTaskPtr &task) override;
+        ErrorCode dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs = 1000) override;
+        bool tryDequeueAbove(PacketPriority priority, ScheduledTaskPtr &task) override;
+        size_t size() const override;
+        bool empty() const override;
+        void clear() override;
+
+        /**
+         * @brief 获取因过期而降级的任务数
+         * @return 降级任务数
+         */
+        uint64_t getDemotedCount() const;
+
+    private:
+        static constexpr size_t HEAP_ARITY = 4; ///< 堆的分叉数
+
+        /// 堆元素
+        struct HeapEntry
+        {
+            Timestamp::rep deadline; ///< 截止时间键
+            uint64_t sequence;       ///< 入队序号（同截止时间按FIFO）
+            ScheduledTaskPtr task;   ///< 任务对象
+        };
+
+        /**
+         * @brief 比较两个堆元素
+         * @return a是否应先于b出队
+         */
+        static bool before(const HeapEntry &a, const HeapEntry &b);
+
+        /**
+         * @brief 上浮
+         * @param index 元素下标
+         */
+        void siftUp(size_t index);
+
+        /**
+         * @brief 下沉
+         * @param index 元素下标
+         */
+        void siftDown(size_t index);
+
+        /**
+         * @brief 弹出堆顶
+         * @return 堆顶元素
+         */
+        HeapEntry popTop();
+
+        /**
+         * @brief 删除任意位置的元素
+         * @param index 元素下标
+         * @return 被删除的元素
+         */
+        HeapEntry removeAt(size_t index);
+
+        /**
+         * @brief 在持锁状态下取出下一个任务
+         * @param task 输出参数，出队的任务
+         * @return 是否取到任务
+         */
+        bool tryDequeueLocked(ScheduledTaskPtr &task);
+
+        /**
+         * @brief 非阻塞出队（队列为空时不加锁）
+         * @param task 输出参数，出队的任务
+         * @return 是否取到任务
+         */
+        bool tryDequeue(ScheduledTaskPtr &task);
+
+        mutable std::mutex queueMutex_;         ///< 队列互斥锁
+        EventCount available_;                  ///< 任务可用通知
+        std::atomic<size_t> count_{0};          ///< 任务数（无锁读取）
+        std::vector<HeapEntry> heap_;           ///< 截止时间堆
+        std::deque<ScheduledTaskPtr> demoted_;  ///< 已过期的降级任务
+        size_t capacity_;                       ///< 队列容量
+        DeadlineMissPolicy missPolicy_;         ///< 错过截止时间的处理策略
+        uint64_t nextSequence_ = 0;             ///< 下一个入队序号
+        std::atomic<uint64_t> demotedCount_{0}; ///< 降级任务数
+    };
+
+    /**
+     * @brief 按租户加权公平共享的任务队列
+     *
+     * 多路传感器共享一个工作线程池时放在线程池之前：每个租户有自己的策略队列（fifo/priority/edf），
+     * 出队时按虚拟时间选择租户（起始时间公平排队）：
+     * - 租户被服务一次，虚拟时间增加"执行时间 / 权重"；出队时按该租户近期的平均执行时间预扣，
+     *   执行结束后按实际执行时间修正
+     * - 总是选择有任务等待、虚拟时间最小的租户，所有租户都繁忙时CPU时间按权重分配
+     * - 空闲租户的份额由其他租户借用（工作保持）；租户重新变为繁忙时虚拟时间追平到当前进度，
+     *   空闲期间不积攒额度，不会在恢复后长时间独占线程
+     *
+     * 任务按ScheduledTask::getTenantId()归入租户，未配置的租户归入DEFAULT_TENANT。
+     */
+    class FairShareTaskQueue : public TaskQueue
+    {
+    public:
+        FairShareTaskQueue() = default;
+        ~FairShareTaskQueue() override = default;
+
         ErrorCode enqueue(const ScheduledTaskPtr &task) override;
         ErrorCode dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs = 1000) override;
         size_t size() const override;
         bool empty() const override;
         void clear() override;
 
+        /**
+         * @brief 添加租户或修改已有租户的权重
+         * @param config 租户配置
+         * @param queue 租户的策略队列（租户已存在时忽略）
+         * @return 操作结果错误码
+         * @retval SystemErrors::INVALID_PARAMETER 权重为0，或租户不存在且未提供队列
+         */
+        ErrorCode setTenant(const TenantConfig &config, std::unique_ptr<TaskQueue> queue);
+
+        /**
+         * @brief 检查租户是否存在
+         * @param tenant 租户编号
+         * @return 是否存在
+         */
+        bool hasTenant(TenantId tenant) const;
+
+        /**
+         * @brief 记录一个任务的执行，修正预扣的虚拟时间并更新租户统计
+         * @param tenant 任务所属租户
+         * @param queueWaitNs 从提交到开始执行的等待（纳秒）
+         * @param executionNs 执行时间（纳秒）
+         */
+        void recordExecution(TenantId tenant, uint64_t queueWaitNs, uint64_t executionNs);
+
+        /**
+         * @brief 获取各租户的调度状态
+         * @param elapsedSeconds 统计时长（秒），用于计算吞吐量
+         * @return 按租户编号排序的状态
+         */
+        std::vector<TenantStatus> getTenantStatus(double elapsedSeconds) const;
+
+        /**
+         * @brief 清零各租户的统计（不影响调度状态）
+         */
+        void resetStatistics();
+
     private:
-        mutable std::mutex queueMutex_;
-        std::condition_variable taskAvailable_;
-        std::priority_queue<ScheduledTaskPtr, std::vector<ScheduledTaskPtr>,
-                            std::function<bool(const ScheduledTaskPtr &, const ScheduledTaskPtr &)>>
-            taskQueue_;
+        static constexpr uint64_t INITIAL_COST_ESTIMATE_NS = 100000; ///< 没有执行记录时预扣的执行时间（纳秒）
+
+        /// 租户状态（受queueMutex_保护）
+        struct Tenant
+        {
+            TenantConfig config;                                ///< 租户配置
+            std::unique_ptr<TaskQueue> queue;                   ///< 策略队列
+            size_t pending = 0;                                 ///< 等待任务数
+            double virtualTime = 0.0;                           ///< 虚拟时间（纳秒 / 权重）
+            uint64_t costEstimateNs = INITIAL_COST_ESTIMATE_NS; ///< 近期平均执行时间（出队时预扣）
+            uint64_t completed = 0;                             ///< 已执行任务数
+            uint64_t cpuTimeNs = 0;                             ///< 累计执行时间（纳秒）
+            LatencyHistogram queueWait;                         ///< 等待分布
+            LatencyHistogram execution;                         ///< 执行时间分布
+        };
+
+        /**
+         * @brief 查找租户
+         * @param tenant 租户编号
+         * @return 租户，不存在时返回nullptr
+         */
+        Tenant *findTenant(TenantId tenant) const;
+
+        /**
+         * @brief 在持锁状态下取出虚拟时间最小的租户的下一个任务
+         * @param task 输出参数，出队的任务
+         * @return 是否取到任务
+         */
+        bool tryDequeueLocked(ScheduledTaskPtr &task);
+
+        /**
+         * @brief 非阻塞出队（没有任务时不加锁）
+         * @param task 输出参数，出队的任务
+         * @return 是否取到任务
+         */
+        bool tryDequeue(ScheduledTaskPtr &task);
+
+        mutable std::mutex queueMutex_;                ///< 队列互斥锁
+        EventCount available_;                         ///< 任务可用通知
+        std::vector<std::unique_ptr<Tenant>> tenants_; ///< 各租户（数量很少，线性查找）
+        std::atomic<size_t> count_{0};                 ///< 任务总数（修改受queueMutex_保护，可无锁读取）
+        double virtualClock_ = 0.0;                    ///< 最近一次被服务租户的虚拟时间（只增不减）
     };
 
     /**
      * @brief 任务调度器实现类
      *
      * 实现了 ITaskScheduler 接口，提供完整的任务调度功能。
-     * 支持多种调度策略和线程池管理。
+     * 支持多种调度策略和线程池管理。任务由工作窃取线程池执行
+     * （WorkStealingPool），不为单个任务创建线程：coreThreads个线程常驻，
+     * 排队等待持续超过scaleUpWaitUs时增加到maxThreads，额外线程空闲keepAliveMs后退出。
      */
     class TaskScheduler : public ITaskScheduler
     {
     public:
         using TaskCompleteCallback = std::function<void(ScheduledTask::TaskId, ErrorCode)>;
+        using ResumableTask = std::function<bool()>; ///< 可恢复任务：每次调用执行一个分片，全部完成时返回true
+        using TimerId = TimerWheel::TimerId;
 
     public:
         /**
@@ -116,17 +390,42 @@ namespace radar
          * @brief 提交普通任务
          * @param task 任务函数
          * @param priority 任务优先级
-         * @return 任务的future对象
+         * @return 任务的Future；执行前取消则跳过任务
+         */
+        Future<void> submitTask(Task task, PacketPriority priority = PacketPriority::NORMAL) override;
+
+        /**
+         * @brief 提交带超时的普通任务
+         * @param task 任务函数
+         * @param priority 任务优先级
+         * @param timeoutMs 超时时间（毫秒，从提交时刻起算），0表示不限时
+         * @return 任务的Future；执行前取消则跳过任务
+         *
+         * 超时只做统计与告警（getTimeoutCount()），不会中断正在执行的任务。
          */
-        std::future<void> submitTask(Task task, PacketPriority priority = PacketPriority::NORMAL) override;
+        Future<void> submitTask(Task task, PacketPriority priority, uint32_t timeoutMs);
+
+        /**
+         * @brief 代表某个租户（传感器）提交普通任务
+         * @param tenant 租户编号
+         * @param task 任务函数
+         * @param priority 任务优先级
+         * @param timeoutMs 超时时间（毫秒），0表示不限时
+         * @return 任务的Future；执行前取消则跳过任务
+         *
+         * 配置了tenants时任务在所属租户的队列中排队，按租户权重公平分配工作线程；
+         * 未配置时与submitTask()相同。submitProcessingTask()按数据包的sensorId自动归入租户。
+         */
+        Future<void> submitTenantTask(TenantId tenant, Task task,
+                                      PacketPriority priority = PacketPriority::NORMAL, uint32_t timeoutMs = 0);
 
         /**
          * @brief 提交有返回值的任务
          * @param task 任务函数
          * @param priority 任务优先级
-         * @return 任务结果的future对象
+         * @return 任务结果的Future；执行前取消则跳过任务
          */
-        std::future<ProcessingResultPtr> submitTaskWithResult(
+        Future<ProcessingResultPtr> submitTaskWithResult(
             TaskWithResult task, PacketPriority priority = PacketPriority::NORMAL) override;
 
         /**
@@ -134,13 +433,87 @@ namespace radar
          * @param processor 数据处理器指针
          * @param packet 数据包指针
          * @param priority 任务优先级
-         * @return 处理结果的future对象
+         * @return 处理结果的Future；执行前取消则跳过处理
          */
-        std::future<ProcessingResultPtr> submitProcessingTask(
+        Future<ProcessingResultPtr> submitProcessingTask(
             std::shared_ptr<IDataProcessor> processor,
             RawDataPacketPtr packet,
             PacketPriority priority = PacketPriority::NORMAL) override;
 
+        /**
+         * @brief 提交轻量任务
+         * @param function 可调用对象（只需可移动，不超过96字节时不单独分配内存）
+         * @return 结果句柄，get()重新抛出任务中的异常
+         *
+         * 轻量任务不构造ScheduledTask，也不在promise映射表中登记，直接进入工作窃取线程池，
+         * 适合数量多、耗时短的任务。它不经过调度策略队列和任务统计，
+         * waitForAllTasks()/cancelPendingTasks()不跟踪轻量任务，应通过句柄等待。
+         * 调度器清理时尚未执行的轻量任务被丢弃，对应句柄的get()抛出异常。
+         */
+        template <typename F>
+        LightTaskFuture submitLightTask(F &&function)
+        {
+            LightTask *task = LightTask::create(std::forward<F>(function), true);
+            workerPool_->submitItem(task);
+            return LightTaskFuture(task);
+        }
+
+        /**
+         * @brief 提交不需要结果的轻量任务
+         * @param function 可调用对象
+         * @return 操作结果错误码
+         *
+         * 与submitLightTask()相同，但不保留结果句柄，任务中的异常被忽略。
+         */
+        template <typename F>
+        ErrorCode postLightTask(F &&function)
+        {
+            return workerPool_->submitItem(LightTask::create(std::forward<F>(function), false));
+        }
+
+        /**
+         * @brief 提交任务依赖图
+         * @param graph 任务依赖图（执行完成前不能销毁或修改）
+         * @return 全部节点完成时就绪的Future，节点抛出的第一个异常由get()重新抛出
+         * @throws std::invalid_argument 图中存在环
+         * @throws std::runtime_error 图的上一次执行尚未完成
+         *
+         * 节点像轻量任务一样直接进入工作窃取线程池，不经过调度策略队列和任务统计；
+         * 前驱全部完成的节点由完成最后一个前驱的工作线程释放，没有线程阻塞等待。
+         * 同一张图可在上一次完成后再次提交，不重新分配节点。
+         */
+        Future<void> submitGraph(TaskGraph &graph);
+
+        /**
+         * @brief 提交按分片执行的长任务
+         * @param step 分片函数，每次调用执行一段工作，全部完成时返回true
+         * @param priority 任务优先级
+         * @return 任务的Future；执行前取消则跳过任务
+         *
+         * 分片之间是检查点（yieldToHigherPriority()）：策略队列中有更高优先级的任务等待时，
+         * 工作线程先执行它们再继续下一个分片。抢占延迟不超过一个分片的执行时间，
+         * 例如大块CPI变换按距离门分片后，关键优先级的航迹更新不必等整块变换完成。
+         */
+        Future<void> submitResumableTask(ResumableTask step, PacketPriority priority = PacketPriority::LOW);
+
+        /**
+         * @brief 检查点：有更高优先级的任务等待时，在当前工作线程上先执行它们
+         * @return 是否执行了更高优先级的任务
+         *
+         * 可在任何本调度器任务的函数体内调用，返回后当前任务从原处继续。
+         * 只对priority和edf策略生效（fifo策略没有优先级），不在本调度器工作线程上调用时直接返回false。
+         * 启用租户公平共享时不做抢占：等待队列按租户份额出队，跨租户抢占会破坏份额。
+         */
+        bool yieldToHigherPriority();
+
+        /**
+         * @brief 执行Future续体（IExecutor接口）
+         * @param work 工作项
+         *
+         * 以轻量任务投递到工作窃取线程池，续体不经过调度策略队列。
+         */
+        void execute(Work work) override;
+
         /**
          * @brief 等待所有任务完成
          * @param timeoutMs 超时时间（毫秒），0表示无限等待
@@ -156,10 +529,17 @@ namespace radar
 
         /**
          * @brief 获取调度器状态信息
-         * @return 调度器状态统计
+         * @return 调度器状态统计，workerPlacement为各工作线程启动时从内核读回的实际放置
          */
         SchedulerStatus getSchedulerStatus() const override;
 
+        /**
+         * @brief 获取背压信号
+         * @return 按queueCapacity发放的信用池，每个等待执行的任务占用一个信用；
+         *         configure()改变容量时会换成新的信用池，上游需要重新获取
+         */
+        std::shared_ptr<const BackpressureSignal> getBackpressureSignal() const override;
+
         // IModule 接口实现
         /**
          * @brief 初始化模块
@@ -247,17 +627,11 @@ namespace radar
          */
         void setTaskCompleteCallback(TaskCompleteCallback callback);
 
-        /**
-         * @brief 取消指定任务
-         * @param taskId 任务ID
-         * @return 操作结果错误码
-         */
-        ErrorCode cancelTask(ScheduledTask::TaskId taskId);
-
         /**
          * @brief 获取任务状态
          * @param taskId 任务ID
-         * @return 任务状态
+         * @return 任务状态：正在执行时为RUNNING，其余（排队中或已结束）均为PENDING
+         * @note 调度器只在运行槽位中记录执行中的任务；取消排队任务应调用提交时返回的Future::cancel()
          */
         TaskState getTaskState(ScheduledTask::TaskId taskId) const;
 
@@ -284,17 +658,186 @@ namespace radar
          */
         size_t getActiveTaskCount() const;
 
+        /**
+         * @brief 获取指定优先级的超时任务数
+         * @param priority 任务优先级
+         * @return 超时任务数
+         */
+        uint64_t getTimeoutCount(PacketPriority priority) const;
+
+        /**
+         * @brief 获取指定优先级因等待队列满被拒绝的任务数
+         * @param priority 任务优先级
+         * @return 被拒绝的任务数
+         */
+        uint64_t getRejectionCount(PacketPriority priority) const;
+
+        /**
+         * @brief 设置租户权重，租户不存在时添加
+         * @param tenant 租户编号
+         * @param weight 权重（大于0）
+         * @return 操作结果错误码
+         * @retval SystemErrors::INVALID_PARAMETER 权重为0
+         * @retval TaskSchedulerErrors::SCHEDULER_NOT_READY 未通过配置启用公平共享
+         *
+         * 可在运行中调整，之后出队的任务按新权重分配。
+         */
+        ErrorCode setTenantWeight(TenantId tenant, uint32_t weight);
+
         /**
          * @brief 设置最大并发任务数
          * @param maxConcurrent 最大并发任务数
          */
         void setMaxConcurrentTasks(uint32_t maxConcurrent);
 
+        /**
+         * @brief 获取工作窃取线程池统计信息
+         * @return 线程池统计快照
+         */
+        WorkStealingPoolStatistics getWorkerPoolStatistics() const;
+
+        /**
+         * @brief 提交延迟任务
+         * @param task 任务函数
+         * @param delay 延迟时间（毫秒精度）
+         * @param priority 任务优先级
+         * @return 定时器句柄，可用cancelTimer()在到期前取消
+         *
+         * 到期时由定时器线程把任务投递到工作线程池执行，实际延迟不短于delay。
+         */
+        TimerId submitDelayed(Task task, std::chrono::milliseconds delay,
+                              PacketPriority priority = PacketPriority::NORMAL);
+
+        /**
+         * @brief 提交周期任务
+         * @param task 任务函数
+         * @param period 周期（毫秒精度，至少1毫秒）
+         * @param phase 首次执行相对提交时刻的偏移
+         * @param priority 任务优先级
+         * @return 定时器句柄，可用cancelTimer()停止后续执行
+         *
+         * 执行时刻为phase + k * period，不累积漂移；调度器停止期间错过的周期不补执行。
+         * 任务执行时间超过周期时，相邻两次执行可能重叠。
+         */
+        TimerId submitPeriodic(Task task, std::chrono::milliseconds period,
+                               std::chrono::milliseconds phase = std::chrono::milliseconds(0),
+                               PacketPriority priority = PacketPriority::NORMAL);
+
+        /**
+         * @brief 取消延迟任务或周期任务
+         * @param timerId 定时器句柄
+         * @return 定时器仍在等待并被取消时返回true
+         */
+        bool cancelTimer(TimerId timerId);
+
+        /**
+         * @brief 获取等待中的定时器数
+         * @return 定时器数（周期任务始终计为一个）
+         */
+        size_t getTimerCount() const;
+
+        /**
+         * @brief 投递控制消息（不经过等待队列与策略队列）
+         *
+         * 工作线程在相邻两个任务之间按投递顺序执行控制消息，不占用背压信用，也不排在积压任务之后：
+         * 队列再满，延迟上限也只是一个任务的执行时间；工作线程都空闲时由一个轻量任务唤醒。
+         *
+         * @param action 控制消息
+         * @return 操作结果错误码
+         * @retval SystemErrors::SUCCESS 已投递
+         * @retval SystemErrors::INVALID_PARAMETER 消息为空
+         * @retval SystemErrors::RESOURCE_UNAVAILABLE 控制通道已满
+         * @note 调度器未启动时，消息保留到start()之后执行
+         */
+        ErrorCode postControl(ControlLane::Action action);
+
+        /**
+         * @brief 获取控制通道统计
+         * @return 统计快照（含投递到执行的延迟）
+         */
+        ControlLaneStatistics getControlStatistics() const;
+
     protected:
         /**
-         * @brief 工作线程主循环
+         * @brief 生成工作线程池配置
+         * @param threadCount 配置的工作线程数
+         * @return 线程池配置
+         */
+        virtual WorkStealingPoolConfig makeWorkerPoolConfig(uint32_t threadCount) const;
+
+        /**
+         * @brief 生成工作线程与定时器线程的放置配置
+         * @return 配置结构中的放置，未配置时取配置文件task_scheduler.placement节
+         */
+        virtual ThreadPlacementConfig makeThreadPlacement() const;
+
+        /**
+         * @brief 提交任务到执行队列
+         * @param task 任务对象
+         * @return 操作结果错误码
+         *
+         * FIFO策略直接提交到工作窃取线程池；其他策略先按策略入队，
+         * 再向线程池提交一个执行凭据，由工作线程按策略顺序取出任务。
+         */
+        ErrorCode enqueueTask(const ScheduledTaskPtr &task);
+
+        /**
+         * @brief 为任务占用一个等待队列信用
+         * @param priority 任务优先级
+         * @return 操作结果错误码
+         * @retval TaskSchedulerErrors::TASK_QUEUE_FULL 按QueueFullPolicy拒绝
+         *
+         * BLOCK策略下工作线程内的提交不阻塞（等待自己所在的线程池出队可能死锁），按REJECT处理。
+         */
+        ErrorCode admitTask(PacketPriority priority);
+
+        /**
+         * @brief 计算某优先级可占用的信用上限
+         * @param priority 任务优先级
+         * @return DROP_BY_PRIORITY策略下低优先级只能占用部分容量，其他策略为全部容量
+         */
+        uint32_t admissionLimit(PacketPriority priority) const;
+
+        /**
+         * @brief 检查等待中的任务是否应抢占正在执行的任务
+         * @param waiting 等待任务的优先级
+         * @param running 正在执行任务的优先级
+         * @return 默认在等待任务优先级更高时抢占
+         */
+        virtual bool shouldPreempt(PacketPriority waiting, PacketPriority running) const;
+
+        /**
+         * @brief 提交带截止时间的有返回值任务
+         * @param task 任务函数
+         * @param priority 任务优先级
+         * @param releaseTime 截止时间的起算时刻（数据包采集时间戳或提交时刻）
+         * @param tenant 所属租户
+         * @return 任务结果的Future
+         */
+        Future<ProcessingResultPtr> submitDeadlineTask(TaskWithResult task,
+                                                       PacketPriority priority,
+                                                       Timestamp releaseTime,
+                                                       TenantId tenant = DEFAULT_TENANT);
+
+        /**
+         * @brief 计算任务截止时间
+         * @param releaseTime 起算时刻
+         * @param priority 任务优先级
+         * @return 起算时刻加上该优先级的延迟预算
+         */
+        Timestamp computeDeadline(Timestamp releaseTime, PacketPriority priority) const;
+
+        /**
+         * @brief 丢弃已错过截止时间的任务（DeadlineMissPolicy::DROP）
+         * @param task 任务对象
+         */
+        void dropExpiredTask(const ScheduledTaskPtr &task);
+
+        /**
+         * @brief 工作线程池的任务处理函数
+         * @param task 任务对象，为空时从策略队列取出下一个任务
          */
-        virtual void workerLoop();
+        void runPooledTask(ScheduledTaskPtr task);
 
         /**
          * @brief 执行任务
@@ -351,6 +894,21 @@ namespace radar
          */
         virtual std::unique_ptr<TaskQueue> createTaskQueue(SchedulingStrategy strategy);
 
+        /**
+         * @brief 按当前策略与租户配置重建等待队列
+         *
+         * 配置了tenants时等待队列是FairShareTaskQueue，每个租户一个createTaskQueue()创建的策略队列。
+         * 旧队列中仍在等待的任务先经discardQueuedTasks()以取消结束。
+         */
+        void rebuildTaskQueue();
+
+        /**
+         * @brief 取出并取消策略队列中所有等待的任务
+         *
+         * 每个任务归还一个背压信用与一个分级计数，计为已取出，其Future以取消失败完成。
+         */
+        void discardQueuedTasks();
+
         /**
          * @brief 启动工作线程池
          * @param threadCount 线程数量
@@ -360,30 +918,146 @@ namespace radar
 
         /**
          * @brief 停止工作线程池
-         * @param timeoutMs 超时时间（毫秒）
+         * @param timeoutMs 超时时间（毫秒），正在执行的任务超过该时间才结束时返回超时
          * @return 操作结果错误码
          */
         ErrorCode stopWorkerThreads(uint32_t timeoutMs = 5000);
 
         /**
-         * @brief 注册活跃任务
+         * @brief 把到期的定时任务投递到工作线程池
+         * @param task 任务函数
+         * @param priority 任务优先级
+         */
+        void dispatchTimerTask(const Task &task, PacketPriority priority);
+
+        /**
+         * @brief 添加定时器并唤醒定时器线程
+         * @param delay 首次到期相对当前时刻的延迟
+         * @param callback 到期回调
+         * @param period 周期，0表示一次性
+         * @return 定时器句柄
+         */
+        TimerId addTimer(std::chrono::milliseconds delay, TimerWheel::Callback callback,
+                         std::chrono::milliseconds period);
+
+        /**
+         * @brief 获取定时器时间基准下的当前tick
+         * @return 当前tick（毫秒）
+         */
+        uint64_t currentTimerTick() const;
+
+        /**
+         * @brief 定时器线程主循环
+         */
+        void timerLoop();
+
+        /**
+         * @brief 启动定时器线程
+         */
+        void startTimerThread();
+
+        /**
+         * @brief 停止定时器线程，等待中的定时器保留到下次启动
+         */
+        void stopTimerThread();
+
+        /// 有返回值任务的结果槽位：任务包装函数写入结果，完成时交给Promise
+        struct PendingResult
+        {
+            Promise<ProcessingResultPtr> promise;        ///< 结果Promise
+            std::shared_ptr<ProcessingResultPtr> result; ///< 任务返回的结果
+        };
+
+        /// 工作线程的运行槽位：只由所属工作线程写入，查询时逐个扫描（独占缓存行）
+        struct alignas(64) RunningSlot
+        {
+            std::atomic<ScheduledTask::TaskId> taskId{0}; ///< 正在执行的任务ID，0表示空闲
+            PacketPriority priority{PacketPriority::LOW}; ///< 正在执行任务的优先级（只由所属工作线程读写）
+        };
+
+        /// 工作线程的统计分片：只由所属工作线程写入，读取时聚合（独占缓存行）
+        struct alignas(64) WorkerStatistics
+        {
+            LatencyHistogram queueWait;              ///< 从提交到开始执行的等待（纳秒）
+            LatencyHistogram execution;              ///< 执行时间（纳秒）
+            std::atomic<uint64_t> completed{0};      ///< 成功完成的任务数
+            std::atomic<uint64_t> failed{0};         ///< 执行失败的任务数
+            std::atomic<uint64_t> dequeued{0};       ///< 取出处理的任务数（含取消与过期丢弃）
+            std::atomic<uint32_t> running{0};        ///< 正在处理的任务数（检查点抢占时嵌套计数）
+            std::atomic<uint64_t> deadlineTasks{0};  ///< 带截止时间且已结束的任务数
+            std::atomic<uint64_t> deadlineMisses{0}; ///< 错过截止时间的任务数
+        };
+
+        /**
+         * @brief 执行从策略队列或线程池取出的任务（取消、过期丢弃与统计）
          * @param task 任务对象
+         * @param fromQueue 是否从策略队列取出
          */
-        void registerActiveTask(const ScheduledTaskPtr &task);
+        void runDequeuedTask(const ScheduledTaskPtr &task, bool fromQueue);
 
         /**
-         * @brief 注销活跃任务
-         * @param taskId 任务ID
+         * @brief 检查策略队列中是否有应抢占当前任务的任务
+         * @param running 正在执行任务的优先级
+         * @return 是否有
+         */
+        bool hasPreemptingTask(PacketPriority running) const;
+
+        /**
+         * @brief 为设置了超时的任务登记超时定时器
+         * @param task 即将执行的任务
+         * @return 定时器句柄；未设置超时或已经超时时返回TimerWheel::INVALID_TIMER
+         *
+         * 超时从提交时刻起算（与ScheduledTask::isTimeout()一致），未设置超时的任务不做任何操作。
+         */
+        TimerId armTaskTimeout(const ScheduledTaskPtr &task);
+
+        /**
+         * @brief 记录任务超时
+         * @param task 超时的任务
          */
-        void unregisterActiveTask(ScheduledTask::TaskId taskId);
+        void recordTaskTimeout(const ScheduledTaskPtr &task);
 
         /**
-         * @brief 检查任务超时
+         * @brief 获取当前工作线程的运行槽位
+         * @return 运行槽位，不在本调度器的工作线程上时返回nullptr
          */
-        void checkTaskTimeouts();
+        RunningSlot *currentRunningSlot() const;
+
+        /**
+         * @brief 获取当前工作线程的统计分片
+         * @return 统计分片，不在本调度器的工作线程上时返回nullptr
+         */
+        WorkerStatistics *currentWorkerStatistics() const;
+
+        /**
+         * @brief 记录一个带截止时间的任务结束
+         * @param missed 是否错过截止时间
+         */
+        void recordDeadlineOutcome(bool missed);
+
+        /**
+         * @brief 记录一次任务执行的结果与延迟
+         * @param success 是否成功
+         * @param queueWaitNs 从提交到开始执行的等待（纳秒）
+         * @param executionNs 执行时间（纳秒）
+         *
+         * 工作线程写自己的分片，不加锁也不使用读-改-写指令；其他线程写入共享分片（加锁）。
+         */
+        void recordExecution(bool success, uint64_t queueWaitNs, uint64_t executionNs);
+
+        /**
+         * @brief 把各统计分片聚合进统计快照
+         * @param stats 统计快照（完成/失败数、等待与执行中任务数、截止时间结果、延迟分布、平均值与吞吐量）
+         */
+        void aggregateWorkerStatistics(TaskStatistics &stats) const;
+
+        /**
+         * @brief 清零所有统计分片
+         */
+        void resetWorkerStatistics();
 
     protected:
-        std::vector<std::thread> workerThreads_;                            ///< 工作线程池
+        std::unique_ptr<WorkStealingPool> workerPool_;                      ///< 工作窃取线程池
         std::atomic<bool> running_{false};                                  ///< 运行状态标志
         std::atomic<bool> shouldStop_{false};                               ///< 停止请求标志
         std::atomic<ModuleState> currentState_{ModuleState::UNINITIALIZED}; ///< 当前模块状态
@@ -392,32 +1066,57 @@ namespace radar
         ErrorCallback errorCallback_;               ///< 错误处理回调函数
         StateChangeCallback stateChangeCallback_;   ///< 状态变化回调函数
 
-        mutable std::mutex statsMutex_;   ///< 统计信息互斥锁
-        mutable std::mutex taskMapMutex_; ///< 任务映射表互斥锁
-        TaskStatistics statistics_;       ///< 调度统计信息
+        mutable std::mutex statsMutex_; ///< 统计信息互斥锁
+        TaskStatistics statistics_;     ///< 调度统计信息
+
+        std::shared_ptr<spdlog::logger> logger_;       ///< 日志记录器
+        std::unique_ptr<TaskSchedulerConfig> config_;  ///< 配置参数
+        std::unique_ptr<TaskQueue> taskQueue_;         ///< 任务队列
+        FairShareTaskQueue *fairShareQueue_ = nullptr; ///< 启用公平共享时指向taskQueue_
+
+        std::unique_ptr<RunningSlot[]> runningSlots_; ///< 各工作线程的运行槽位
+        size_t runningSlotCount_ = 0;                 ///< 运行槽位数
+        mutable std::mutex runningSlotsMutex_;        ///< 槽位数组重建与查询互斥锁（工作线程不获取）
 
-        std::shared_ptr<spdlog::logger> logger_;                                  ///< 日志记录器
-        std::unique_ptr<TaskSchedulerConfig> config_;                             ///< 配置参数
-        std::unique_ptr<TaskQueue> taskQueue_;                                    ///< 任务队列
-        std::unordered_map<ScheduledTask::TaskId, ScheduledTaskPtr> activeTasks_; ///< 活跃任务映射表
+        std::unique_ptr<WorkerStatistics[]> workerStats_; ///< 各工作线程的统计分片（与运行槽位一同重建）
+        std::unique_ptr<WorkerStatistics> externalStats_; ///< 非工作线程执行的任务及重建前分片的累计
+        mutable std::mutex externalStatsMutex_;           ///< 共享分片互斥锁
+
+        std::vector<ThreadPlacementStatus> workerPlacement_; ///< 各工作线程的实际放置（工作线程启动时写入）
+        mutable std::mutex placementMutex_;                  ///< 放置状态互斥锁
 
         std::string moduleName_{"TaskScheduler"}; ///< 模块名称
 
         // 调度参数
-        SchedulingStrategy currentStrategy_{SchedulingStrategy::FIFO}; ///< 当前调度策略
-        std::atomic<uint32_t> maxConcurrentTasks_{4};                  ///< 最大并发任务数
-        std::atomic<uint32_t> currentConcurrentTasks_{0};              ///< 当前并发任务数
+        SchedulingStrategy currentStrategy_{SchedulingStrategy::FIFO};                   ///< 当前调度策略
+        DeadlineMissPolicy deadlineMissPolicy_{DeadlineMissPolicy::DEMOTE};              ///< 错过截止时间的处理策略
+        QueueFullPolicy queueFullPolicy_{QueueFullPolicy::REJECT};                       ///< 等待队列满时的提交策略
+        std::shared_ptr<BackpressureSignal> backpressure_;                               ///< 等待队列信用（入队占用，出队归还）
+        std::array<std::atomic<uint32_t>, TASK_PRIORITY_LEVELS> queuedByPriority_{};     ///< 策略队列中各优先级的任务数
+        std::atomic<uint32_t> preemptedTokens_{0};                                       ///< 任务已在检查点被执行、尚未消费的执行凭据数
+        std::array<uint32_t, TASK_PRIORITY_LEVELS> latencyBudgetMs_{{200, 100, 50, 20}}; ///< 各优先级延迟预算（毫秒）
+        std::atomic<uint32_t> maxConcurrentTasks_{4};                                    ///< 最大并发任务数
+        ControlLane controlLane_;                                                        ///< 控制通道（工作线程在任务之间执行）
+
+        // 定时任务
+        std::unique_ptr<TimerWheel> timerWheel_;                                             ///< 时间轮（1 tick = 1毫秒）
+        std::chrono::steady_clock::time_point timerEpoch_{std::chrono::steady_clock::now()}; ///< tick零点
+        mutable std::mutex timerMutex_;                                                      ///< 时间轮互斥锁
+        std::condition_variable timerCondition_;                                             ///< 定时器线程唤醒条件
+        std::thread timerThread_;                                                            ///< 定时器线程
+        bool timerStopRequested_ = false;                                                    ///< 定时器线程停止请求（受timerMutex_保护）
 
         // Future管理
-        mutable std::mutex futuresMutex_;                                                             ///< Future映射表互斥锁
-        std::unordered_map<ScheduledTask::TaskId, std::promise<void>> promises_;                      ///< Promise映射表
-        std::unordered_map<ScheduledTask::TaskId, std::promise<ProcessingResultPtr>> resultPromises_; ///< 结果Promise映射表
+        mutable std::mutex futuresMutex_;                                         ///< Future映射表互斥锁
+        std::unordered_map<ScheduledTask::TaskId, Promise<void>> promises_;       ///< Promise映射表
+        std::unordered_map<ScheduledTask::TaskId, PendingResult> resultPromises_; ///< 结果Promise映射表
     };
 
     /**
      * @brief 线程池任务调度器
      *
      * 基于线程池的任务调度实现，支持固定线程数和动态负载均衡。
+     * 任务在固定数量的工作窃取线程上执行，空闲线程从繁忙线程窃取任务。
      */
     class ThreadPoolScheduler : public TaskScheduler
     {
@@ -437,18 +1136,183 @@ namespace radar
 
     protected:
         /**
-         * @brief 工作线程循环
+         * @brief 按构造时指定的线程数生成线程池配置
+         * @param threadCount 配置的工作线程数（忽略）
+         * @return 线程池配置（核心线程数为构造参数，maxThreads、keepAliveMs、scaleUpWaitUs取自配置）
          */
-        void workerLoop() override;
+        WorkStealingPoolConfig makeWorkerPoolConfig(uint32_t threadCount) const override;
 
     private:
         uint32_t threadCount_; ///< 线程池大小
     };
 
+    /**
+     * @brief 负载均衡任务调度器
+     *
+     * 在同一节点内横向扩展数据处理：登记多个IDataProcessor实例，submitProcessingTask()
+     * 按实时排队深度与近期服务时间把每个数据包派发给预计最早完成的实例：
+     * - 预计完成时间 =（排队深度 + 1）×近期平均服务时间；排队深度取本调度器的在途数与处理器
+     *   自报积压（IDataProcessor::getQueueDepth）中的较大者，尚无服务记录的实例只比较排队深度
+     * - jsq比较所有实例；p2c随机取两个实例比较，实例多时开销不随实例数增长
+     * - 设置亲和键后，同一键（如同一CPI或通道组）的数据包总是派发给同一实例，保持处理状态的局部性；
+     *   新键首次出现时按负载选择实例并固定下来；固定的键数有上限（stickyRouteCapacity），
+     *   超出时淘汰最久未出现的键，该键再次出现时重新按负载选择
+     */
+    class LoadBalanceScheduler : public TaskScheduler
+    {
+    public:
+        /// 亲和键：返回值相同的数据包派发给同一实例
+        using AffinityKey = std::function<uint64_t(const RawDataPacket &)>;
+
+        /**
+         * @brief 处理器实例的负载状态
+         */
+        struct InstanceStatus
+        {
+            uint32_t inFlight = 0;             ///< 已派发未完成的数据包数
+            size_t queueDepth = 0;             ///< 处理器自报的积压数据包数
+            uint64_t dispatched = 0;           ///< 累计派发数
+            uint64_t completed = 0;            ///< 累计完成数
+            double averageServiceTimeUs = 0.0; ///< 近期平均服务时间（微秒）
+            size_t stickyKeys = 0;             ///< 固定到该实例的亲和键数
+        };
+
+        /**
+         * @brief 构造函数
+         * @param logger 日志记录器实例
+         */
+        explicit LoadBalanceScheduler(std::shared_ptr<spdlog::logger> logger = nullptr);
+
+        /**
+         * @brief 析构函数
+         */
+        ~LoadBalanceScheduler() override = default;
+
+        /**
+         * @brief 配置调度参数（loadBalancePolicy选择jsq或p2c，stickyRouteCapacity限制固定的亲和键数）
+         * @param config 调度器配置
+         * @return 操作结果错误码
+         */
+        ErrorCode configure(const TaskSchedulerConfig &config) override;
+
+        /**
+         * @brief 登记处理器实例
+         * @param processor 处理器实例
+         * @return 操作结果错误码
+         * @retval SystemErrors::INVALID_PARAMETER 实例为空或已登记
+         */
+        ErrorCode addProcessor(std::shared_ptr<IDataProcessor> processor);
+
+        /**
+         * @brief 注销处理器实例
+         * @param processor 处理器实例
+         * @return 操作结果错误码
+         * @retval SystemErrors::INVALID_PARAMETER 实例未登记
+         *
+         * 已派发给它的数据包照常完成；固定到它的亲和键在下次出现时重新选择实例。
+         */
+        ErrorCode removeProcessor(const std::shared_ptr<IDataProcessor> &processor);
+
+        /**
+         * @brief 获取已登记的实例数
+         * @return 实例数
+         */
+        size_t getProcessorCount() const;
+
+        /**
+         * @brief 设置实例选择方式
+         * @param policy 选择方式
+         */
+        void setLoadBalancePolicy(LoadBalancePolicy policy);
+
+        /**
+         * @brief 设置亲和键
+         * @param key 亲和键函数，为空表示不做粘性派发
+         *
+         * 修改亲和键会清空已固定的键。
+         */
+        void setAffinityKey(AffinityKey key);
+
+        /**
+         * @brief 设置最多固定的亲和键数
+         * @param capacity 键数上限，0表示不固定（每个数据包都按负载选择）
+         *
+         * 调小上限时立即淘汰最久未出现的键。
+         */
+        void setStickyRouteCapacity(size_t capacity);
+
+        /**
+         * @brief 提交数据处理任务，派发给负载最轻的实例
+         * @param processor 没有登记任何实例时使用的处理器，可以为空
+         * @param packet 数据包指针
+         * @param priority 任务优先级
+         * @return 处理结果的Future；执行前取消则跳过处理
+         * @throws std::invalid_argument 数据包为空，或没有登记实例且processor为空
+         */
+        Future<ProcessingResultPtr> submitProcessingTask(
+            std::shared_ptr<IDataProcessor> processor,
+            RawDataPacketPtr packet,
+            PacketPriority priority = PacketPriority::NORMAL) override;
+
+        /**
+         * @brief 获取各实例的负载状态
+         * @return 按登记顺序排列的状态
+         */
+        std::vector<InstanceStatus> getInstanceStatus() const;
+
+    private:
+        /// 处理器实例及其负载（派发的任务持有共享指针，注销后仍可安全完成）
+        struct alignas(64) Instance
+        {
+            std::shared_ptr<IDataProcessor> processor; ///< 处理器实例
+            std::atomic<uint32_t> inFlight{0};         ///< 已派发未完成的数据包数
+            std::atomic<uint64_t> dispatched{0};       ///< 累计派发数
+            std::atomic<uint64_t> completed{0};        ///< 累计完成数
+            std::atomic<uint64_t> serviceTimeNs{0};    ///< 近期平均服务时间（纳秒，1/8指数平均）
+        };
+        using InstancePtr = std::shared_ptr<Instance>;
+
+        /**
+         * @brief 估计把数据包派发给实例后的完成时间
+         * @param instance 实例
+         * @return 相对代价，越小越好
+         */
+        static double expectedCompletion(const Instance &instance);
+
+        /**
+         * @brief 淘汰最久未出现的亲和键直到不超过上限（持有instancesMutex_时调用）
+         * @param capacity 键数上限
+         */
+        void trimStickyRoutesLocked(size_t capacity);
+
+        /**
+         * @brief 按负载选择实例（持有instancesMutex_时调用）
+         * @return 实例
+         */
+        InstancePtr selectByLoadLocked() const;
+
+        /**
+         * @brief 为数据包选择实例
+         * @param packet 数据包
+         * @return 实例，没有登记实例时返回nullptr
+         */
+        InstancePtr selectInstance(const RawDataPacket &packet);
+
+        mutable std::mutex instancesMutex_;                                              ///< 实例表与亲和表互斥锁
+        std::vector<InstancePtr> instances_;                                             ///< 已登记的实例
+        using StickyRoute = std::pair<uint64_t, InstancePtr>;
+        std::list<StickyRoute> stickyRoutes_;                                            ///< 亲和键到实例的固定映射（最近出现的在前）
+        std::unordered_map<uint64_t, std::list<StickyRoute>::iterator> stickyIndex_;     ///< 亲和键到stickyRoutes_位置的索引
+        size_t stickyRouteCapacity_ = 4096;                                              ///< 最多固定的亲和键数
+        AffinityKey affinityKey_;                                                        ///< 亲和键函数
+        std::atomic<LoadBalancePolicy> policy_{LoadBalancePolicy::POWER_OF_TWO_CHOICES}; ///< 实例选择方式
+    };
+
     /**
      * @brief 实时任务调度器
      *
      * 针对实时任务优化的调度器实现，支持严格的时间约束和优先级抢占。
+     * 工作线程的实时调度策略（SCHED_FIFO/SCHED_RR）与其他调度器一样由放置配置显式开启，默认不启用。
      */
     class RealTimeScheduler : public TaskScheduler
     {
@@ -480,27 +1344,23 @@ namespace radar
         ErrorCode executeTask(const ScheduledTaskPtr &task) override;
 
         /**
-         * @brief 实时工作循环
+         * @brief 生成实时线程池配置（延长自旋，减少休眠唤醒延迟）
+         * @param threadCount 配置的工作线程数
+         * @return 线程池配置
          */
-        void workerLoop() override;
-
-    private:
-        std::atomic<uint32_t> maxLatencyMs_{10};    ///< 最大延迟（毫秒）
-        std::atomic<bool> preemptionEnabled_{true}; ///< 是否启用抢占
+        WorkStealingPoolConfig makeWorkerPoolConfig(uint32_t threadCount) const override;
 
         /**
-         * @brief 检查是否需要抢占
-         * @param newTask 新任务
-         * @param runningTask 正在执行的任务
+         * @brief 检查是否需要抢占（禁用抢占时长任务的检查点不再让出）
+         * @param waiting 等待任务的优先级
+         * @param running 正在执行任务的优先级
          * @return 是否需要抢占
          */
-        bool shouldPreempt(const ScheduledTaskPtr &newTask, const ScheduledTaskPtr &runningTask) const;
+        bool shouldPreempt(PacketPriority waiting, PacketPriority running) const override;
 
-        /**
-         * @brief 设置线程调度策略为实时
-         * @return 操作结果错误码
-         */
-        ErrorCode setRealTimeScheduling();
+    private:
+        std::atomic<uint32_t> maxLatencyMs_{10};    ///< 最大延迟（毫秒）
+        std::atomic<bool> preemptionEnabled_{true}; ///< 是否启用抢占
     };
 
 } // namespace radar
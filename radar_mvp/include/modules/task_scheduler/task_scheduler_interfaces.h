@@ -46,6 +46,18 @@ namespace radar
          */
         virtual ErrorCode dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs = 1000) = 0;
 
+        /**
+         * @brief 非阻塞取出优先级严格高于指定级别的任务
+         * @param priority 基准优先级（通常是正在执行的任务的优先级）
+         * @param task 输出参数，任务对象
+         * @return 是否取到任务
+         * @note 供长任务在检查点让出时使用，不参与老化；默认不支持，返回false
+         */
+        virtual bool tryDequeueAbove(PacketPriority /*priority*/, ScheduledTaskPtr & /*task*/)
+        {
+            return false;
+        }
+
         /**
          * @brief 获取队列大小
          * @return 队列中的任务数量
@@ -14,6 +14,7 @@
 
 #include "common/types.h"
 #include "common/error_codes.h"
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -23,6 +24,15 @@
 namespace radar
 {
 
+    /// 调度器区分的数据包优先级级数（PacketPriority::LOW ~ PacketPriority::CRITICAL）
+    constexpr size_t TASK_PRIORITY_LEVELS = 4;
+
+    /// 调度租户编号（一路传感器对应一个租户，与RawDataPacket::sensorId一致）
+    using TenantId = uint32_t;
+
+    /// 默认租户：未指定租户或租户未配置的任务归入此租户
+    constexpr TenantId DEFAULT_TENANT = 0;
+
     /**
      * @brief 任务优先级枚举
      */
@@ -61,6 +71,34 @@ namespace radar
         RATE_MONOTONIC           ///< 速率单调调度
     };
 
+    /**
+     * @brief 错过截止时间的处理策略（EDF调度）
+     */
+    enum class DeadlineMissPolicy
+    {
+        DROP,  ///< 丢弃已过期任务，future以异常结束
+        DEMOTE ///< 降级：仍然执行，但排在所有未过期任务之后
+    };
+
+    /**
+     * @brief 等待队列已满（达到queueCapacity）时的提交策略
+     */
+    enum class QueueFullPolicy
+    {
+        BLOCK,           ///< 阻塞提交者直到有空位或超时（工作线程内提交不阻塞，按拒绝处理）
+        REJECT,          ///< 立即拒绝，返回TASK_QUEUE_FULL
+        DROP_BY_PRIORITY ///< 按优先级分级准入：低优先级在队列较满时先被丢弃，为高优先级保留余量
+    };
+
+    /**
+     * @brief 负载均衡调度器选择处理器实例的方式
+     */
+    enum class LoadBalancePolicy
+    {
+        JOIN_SHORTEST_QUEUE, ///< 比较所有实例，选择预计完成时间最短的实例
+        POWER_OF_TWO_CHOICES ///< 随机取两个实例比较，实例多时开销与扫描无关且避免羊群效应
+    };
+
     /**
      * @brief 内部任务包装类
      *
@@ -110,10 +148,15 @@ namespace radar
         std::chrono::system_clock::time_point getStartTime() const { return startTime_; }
         std::chrono::system_clock::time_point getFinishTime() const { return finishTime_; }
         uint32_t getTimeoutMs() const { return timeoutMs_; }
+        Timestamp getDeadline() const { return deadline_; }
+        bool hasDeadline() const { return deadline_ != Timestamp{}; }
+        TenantId getTenantId() const { return tenantId_; }
 
         // Setters
         void setPriority(PacketPriority priority) { priority_ = priority; }
         void setTimeoutMs(uint32_t timeoutMs) { timeoutMs_ = timeoutMs; }
+        void setDeadline(Timestamp deadline) { deadline_ = deadline; }
+        void setTenantId(TenantId tenantId) { tenantId_ = tenantId; }
 
         /**
          * @brief 获取执行时间
@@ -150,12 +193,14 @@ namespace radar
     private:
         static std::atomic<TaskId> nextTaskId_; ///< 全局任务ID计数器
 
-        TaskId taskId_;                ///< 任务唯一ID
-        std::string name_;             ///< 任务名称
-        TaskFunction taskFunction_;    ///< 任务执行函数
-        PacketPriority priority_;      ///< 任务优先级
-        std::atomic<TaskState> state_; ///< 任务状态
-        uint32_t timeoutMs_;           ///< 超时时间（毫秒）
+        TaskId taskId_;                      ///< 任务唯一ID
+        std::string name_;                   ///< 任务名称
+        TaskFunction taskFunction_;          ///< 任务执行函数
+        PacketPriority priority_;            ///< 任务优先级
+        std::atomic<TaskState> state_;       ///< 任务状态
+        uint32_t timeoutMs_;                 ///< 超时时间（毫秒）
+        Timestamp deadline_{};               ///< 截止时间（默认值表示无截止时间）
+        TenantId tenantId_ = DEFAULT_TENANT; ///< 所属租户
 
         // 时间戳
         std::chrono::system_clock::time_point submitTime_; ///< 提交时间
@@ -175,11 +220,25 @@ namespace radar
         std::atomic<uint64_t> totalTasksFailed{0};         ///< 失败的总任务数
         std::atomic<uint64_t> totalTasksCancelled{0};      ///< 取消的总任务数
         std::atomic<uint64_t> totalTasksTimeout{0};        ///< 超时的总任务数
-        std::atomic<uint32_t> currentPendingTasks{0};      ///< 当前等待任务数
-        std::atomic<uint32_t> currentRunningTasks{0};      ///< 当前执行任务数
+        std::atomic<uint32_t> currentPendingTasks{0};      ///< 当前等待任务数（读取时聚合）
+        std::atomic<uint32_t> currentRunningTasks{0};      ///< 当前执行任务数（读取时聚合）
         std::atomic<double> averageExecutionTimeMs{0.0};   ///< 平均执行时间（毫秒）
         std::atomic<double> averageWaitingTimeMs{0.0};     ///< 平均等待时间（毫秒）
         std::atomic<double> throughputTasksPerSecond{0.0}; ///< 吞吐量（任务/秒）
+        std::atomic<uint64_t> deadlineTasks{0};            ///< 带截止时间且已结束的任务数（读取时聚合）
+        std::atomic<uint64_t> deadlineMisses{0};           ///< 错过截止时间的任务数（读取时聚合）
+        std::atomic<uint64_t> deadlineDrops{0};            ///< 因过期被丢弃的任务数
+
+        std::array<std::atomic<uint64_t>, TASK_PRIORITY_LEVELS> timeoutsByPriority{};   ///< 各优先级超时任务数
+        std::array<std::atomic<uint64_t>, TASK_PRIORITY_LEVELS> rejectionsByPriority{}; ///< 各优先级因队列满被拒绝的任务数
+        std::atomic<uint64_t> blockedSubmissions{0};                                    ///< 因队列满阻塞过的提交数
+        std::atomic<uint64_t> preemptions{0};                                           ///< 在检查点让出给高优先级任务的次数
+        std::atomic<uint64_t> totalPreemptionLatencyUs{0};                              ///< 被抢占执行的任务从提交到开始的累计等待（微秒）
+        std::atomic<uint64_t> maxPreemptionLatencyUs{0};                                ///< 被抢占执行的任务从提交到开始的最长等待（微秒）
+
+        // 以下由调度器读取时从各工作线程的统计分片聚合
+        LatencyPercentiles queueWaitLatency; ///< 任务从提交到开始执行的等待分布
+        LatencyPercentiles executionLatency; ///< 任务执行时间分布
 
         std::chrono::system_clock::time_point startTime_;      ///< 开始时间
         std::chrono::system_clock::time_point lastUpdateTime_; ///< 最后更新时间
@@ -198,6 +257,20 @@ namespace radar
             averageExecutionTimeMs.store(other.averageExecutionTimeMs.load());
             averageWaitingTimeMs.store(other.averageWaitingTimeMs.load());
             throughputTasksPerSecond.store(other.throughputTasksPerSecond.load());
+            deadlineTasks.store(other.deadlineTasks.load());
+            deadlineMisses.store(other.deadlineMisses.load());
+            deadlineDrops.store(other.deadlineDrops.load());
+            for (size_t i = 0; i < TASK_PRIORITY_LEVELS; ++i)
+            {
+                timeoutsByPriority[i].store(other.timeoutsByPriority[i].load());
+                rejectionsByPriority[i].store(other.rejectionsByPriority[i].load());
+            }
+            blockedSubmissions.store(other.blockedSubmissions.load());
+            preemptions.store(other.preemptions.load());
+            totalPreemptionLatencyUs.store(other.totalPreemptionLatencyUs.load());
+            maxPreemptionLatencyUs.store(other.maxPreemptionLatencyUs.load());
+            queueWaitLatency = other.queueWaitLatency;
+            executionLatency = other.executionLatency;
             startTime_ = other.startTime_;
             lastUpdateTime_ = other.lastUpdateTime_;
         }
@@ -215,6 +288,20 @@ namespace radar
                 averageExecutionTimeMs.store(other.averageExecutionTimeMs.load());
                 averageWaitingTimeMs.store(other.averageWaitingTimeMs.load());
                 throughputTasksPerSecond.store(other.throughputTasksPerSecond.load());
+                deadlineTasks.store(other.deadlineTasks.load());
+                deadlineMisses.store(other.deadlineMisses.load());
+                deadlineDrops.store(other.deadlineDrops.load());
+                for (size_t i = 0; i < TASK_PRIORITY_LEVELS; ++i)
+                {
+                    timeoutsByPriority[i].store(other.timeoutsByPriority[i].load());
+                    rejectionsByPriority[i].store(other.rejectionsByPriority[i].load());
+                }
+                blockedSubmissions.store(other.blockedSubmissions.load());
+                preemptions.store(other.preemptions.load());
+                totalPreemptionLatencyUs.store(other.totalPreemptionLatencyUs.load());
+                maxPreemptionLatencyUs.store(other.maxPreemptionLatencyUs.load());
+                queueWaitLatency = other.queueWaitLatency;
+                executionLatency = other.executionLatency;
                 startTime_ = other.startTime_;
                 lastUpdateTime_ = other.lastUpdateTime_;
             }
@@ -236,17 +323,27 @@ namespace radar
             averageExecutionTimeMs = 0.0;
             averageWaitingTimeMs = 0.0;
             throughputTasksPerSecond = 0.0;
+            deadlineTasks = 0;
+            deadlineMisses = 0;
+            deadlineDrops = 0;
+            for (auto &count : timeoutsByPriority)
+            {
+                count = 0;
+            }
+            for (auto &count : rejectionsByPriority)
+            {
+                count = 0;
+            }
+            blockedSubmissions = 0;
+            preemptions = 0;
+            totalPreemptionLatencyUs = 0;
+            maxPreemptionLatencyUs = 0;
+            queueWaitLatency = LatencyPercentiles{};
+            executionLatency = LatencyPercentiles{};
             startTime_ = std::chrono::system_clock::now();
             lastUpdateTime_ = startTime_;
         }
 
-        /**
-         * @brief 更新执行统计
-         * @param executionTimeMs 执行时间（毫秒）
-         * @param waitingTimeMs 等待时间（毫秒）
-         */
-        void updateExecutionStats(double executionTimeMs, double waitingTimeMs);
-
         /**
          * @brief 记录任务失败
          */
@@ -273,6 +370,76 @@ namespace radar
             totalTasksTimeout++;
             lastUpdateTime_ = std::chrono::system_clock::now();
         }
+
+        /**
+         * @brief 记录任务超时并按优先级计数
+         * @param priority 超时任务的优先级
+         */
+        void recordTimeout(PacketPriority priority)
+        {
+            const size_t level = static_cast<size_t>(priority);
+            timeoutsByPriority[level < TASK_PRIORITY_LEVELS ? level : TASK_PRIORITY_LEVELS - 1]++;
+            recordTimeout();
+        }
+
+        /**
+         * @brief 记录因队列满被拒绝的任务
+         * @param priority 被拒绝任务的优先级
+         */
+        void recordRejection(PacketPriority priority)
+        {
+            const size_t level = static_cast<size_t>(priority);
+            rejectionsByPriority[level < TASK_PRIORITY_LEVELS ? level : TASK_PRIORITY_LEVELS - 1]++;
+            lastUpdateTime_ = std::chrono::system_clock::now();
+        }
+
+        /**
+         * @brief 获取因队列满被拒绝的任务总数
+         * @return 任务数
+         */
+        uint64_t getTotalRejections() const
+        {
+            uint64_t total = 0;
+            for (const auto &count : rejectionsByPriority)
+            {
+                total += count.load();
+            }
+            return total;
+        }
+
+        /**
+         * @brief 记录一次检查点抢占
+         * @param latencyUs 抢占执行的任务从提交到开始执行的时间（微秒）
+         */
+        void recordPreemption(uint64_t latencyUs)
+        {
+            preemptions++;
+            totalPreemptionLatencyUs += latencyUs;
+            uint64_t current = maxPreemptionLatencyUs.load();
+            while (latencyUs > current && !maxPreemptionLatencyUs.compare_exchange_weak(current, latencyUs))
+            {
+            }
+        }
+
+        /**
+         * @brief 获取平均抢占延迟
+         * @return 平均延迟（微秒），没有发生抢占时为0
+         */
+        double getAveragePreemptionLatencyUs() const
+        {
+            const uint64_t count = preemptions.load();
+            return count > 0 ? static_cast<double>(totalPreemptionLatencyUs.load()) / count : 0.0;
+        }
+
+        /**
+         * @brief 获取截止时间错过率
+         * @return 错过率（0~1），没有带截止时间的任务时为0
+         */
+        double getDeadlineMissRate() const
+        {
+            const uint64_t total = deadlineTasks.load();
+            return total > 0 ? static_cast<double>(deadlineMisses.load()) / total : 0.0;
+        }
     };
 
 } // namespace radar
@@ -0,0 +1,169 @@
+/**
+ * @file timer_wheel.h
+ * @brief 分层时间轮定时器
+ *
+ * 4级时间轮，每级64个槽位，以tick为时间单位（调度器中1 tick = 1毫秒），
+ * 覆盖约2^24个tick（约4.6小时），更远的定时器放入溢出链表，在最高级轮转一圈时重新分配。
+ * 定时器节点存放在连续数组中并以下标串成双向链表：插入、取消都是O(1)，
+ * 推进时间时只在跨越低级轮边界的时刻把上级槽位中的定时器下放（级联）。
+ * 每级维护非空槽位位图，推进时直接跳过空槽位，空闲时无需逐tick推进。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see TaskScheduler::submitDelayed
+ * @see TaskScheduler::submitPeriodic
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief 分层时间轮
+     *
+     * 只负责按tick组织定时器，不持有线程也不读取时钟：调用者按自己的时间基准
+     * 调用advanceTo()推进，并执行返回的到期回调。
+     *
+     * @note 非线程安全，调用者负责加锁
+     */
+    class TimerWheel
+    {
+    public:
+        /// 定时器句柄（0表示无效）
+        using TimerId = uint64_t;
+
+        /// 到期回调
+        using Callback = std::function<void()>;
+
+        static constexpr size_t LEVELS = 4;              ///< 时间轮级数
+        static constexpr size_t SLOT_BITS = 6;           ///< 每级槽位数的位数
+        static constexpr size_t SLOTS = 1u << SLOT_BITS; ///< 每级槽位数
+        static constexpr uint64_t SLOT_MASK = SLOTS - 1; ///< 槽位下标掩码
+        static constexpr TimerId INVALID_TIMER = 0;      ///< 无效句柄
+
+        /**
+         * @brief 构造函数
+         * @param startTick 起始tick
+         */
+        explicit TimerWheel(uint64_t startTick = 0);
+
+        /**
+         * @brief 添加定时器
+         * @param expiryTick 到期tick，不晚于当前tick时在下一个tick到期
+         * @param callback 到期回调
+         * @param periodTicks 周期（tick），0表示一次性定时器
+         * @return 定时器句柄，周期定时器重新装填后句柄不变
+         */
+        TimerId schedule(uint64_t expiryTick, Callback callback, uint64_t periodTicks = 0);
+
+        /**
+         * @brief 取消定时器
+         * @param id 定时器句柄
+         * @return 定时器仍在等待并被取消时返回true
+         */
+        bool cancel(TimerId id);
+
+        /**
+         * @brief 推进时间并收集到期回调
+         * @param targetTick 目标tick
+         * @param expired 输出参数，按到期顺序追加到期回调
+         * @return 到期的定时器数
+         *
+         * 周期定时器到期后按"上次到期时刻 + 周期"重新装填，不累积漂移；
+         * 若推进跨越了多个周期，只触发一次并跳到目标tick之后的下一个周期点。
+         */
+        size_t advanceTo(uint64_t targetTick, std::vector<Callback> &expired);
+
+        /**
+         * @brief 获取到下一个需要处理的tick的距离
+         * @return tick数（至少为1）；可能早于实际到期时刻（级联边界），但不会晚于
+         */
+        uint64_t ticksUntilNextEvent() const;
+
+        /**
+         * @brief 获取当前tick
+         * @return 当前tick
+         */
+        uint64_t now() const { return now_; }
+
+        /**
+         * @brief 获取等待中的定时器数
+         * @return 定时器数
+         */
+        size_t size() const { return count_; }
+
+        /**
+         * @brief 检查是否没有等待中的定时器
+         * @return 是否为空
+         */
+        bool empty() const { return count_ == 0; }
+
+    private:
+        static constexpr uint32_t NIL = UINT32_MAX;              ///< 空链表下标
+        static constexpr size_t OVERFLOW_LIST = LEVELS * SLOTS;  ///< 溢出链表编号
+        static constexpr size_t WHEEL_BITS = LEVELS * SLOT_BITS; ///< 时间轮覆盖的tick位数
+
+        /// 定时器节点
+        struct Node
+        {
+            Callback callback;       ///< 到期回调
+            uint64_t expiry = 0;     ///< 到期tick
+            uint64_t period = 0;     ///< 周期（tick），0表示一次性
+            uint32_t prev = NIL;     ///< 前驱节点
+            uint32_t next = NIL;     ///< 后继节点
+            uint32_t generation = 1; ///< 复用代数，防止旧句柄误取消
+            uint32_t list = 0;       ///< 所在链表编号
+            bool active = false;     ///< 是否在等待中
+        };
+
+        /**
+         * @brief 按到期tick把节点挂到对应的槽位
+         * @param index 节点下标
+         */
+        void place(uint32_t index);
+
+        /**
+         * @brief 从所在链表摘下节点
+         * @param index 节点下标
+         */
+        void unlink(uint32_t index);
+
+        /**
+         * @brief 把一个链表中的节点全部按当前tick重新分配
+         * @param list 链表编号
+         */
+        void redistribute(size_t list);
+
+        /**
+         * @brief 前进一个tick：级联上级槽位并收集第0级当前槽位的到期回调
+         * @param expired 输出参数，到期回调
+         * @param horizon 本次推进的目标tick（周期定时器跳过已错过的周期）
+         * @return 到期的定时器数
+         */
+        size_t tick(std::vector<Callback> &expired, uint64_t horizon);
+
+        /**
+         * @brief 释放节点
+         * @param index 节点下标
+         */
+        void release(uint32_t index);
+
+        std::vector<Node> nodes_;                        ///< 节点数组
+        std::vector<uint32_t> freeNodes_;                ///< 空闲节点下标
+        std::array<uint32_t, LEVELS * SLOTS + 1> heads_; ///< 各槽位链表头（末尾为溢出链表）
+        std::array<uint64_t, LEVELS> occupied_{};        ///< 各级非空槽位位图
+        uint64_t now_;                                   ///< 当前tick
+        size_t count_ = 0;                               ///< 等待中的定时器数
+    };
+
+} // namespace radar
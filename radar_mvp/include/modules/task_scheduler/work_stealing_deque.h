@@ -0,0 +1,213 @@
+/**
+ * @file work_stealing_deque.h
+ * @brief Chase-Lev工作窃取双端队列
+ *
+ * 每个工作线程持有一个双端队列：所有者在底部无锁压入/弹出（LIFO，缓存友好），
+ * 其他线程从顶部窃取（FIFO，窃取最早提交、通常也是最大的工作）。
+ * 只有队列剩最后一个元素时所有者才需要与窃取者做一次CAS竞争。
+ * 内存序按 Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP'13)。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see WorkStealingPool
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief Chase-Lev工作窃取双端队列
+     * @tparam T 元素类型，必须是指针（空指针表示队列为空或窃取失败）
+     *
+     * @note push()/pop()只能由所有者线程调用；steal()/size()/empty()可由任意线程调用
+     * @note 容量不足时所有者线程按2倍扩容，旧数组保留到析构，
+     *       因为并发窃取者可能仍在读取旧数组
+     */
+    template <typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_pointer<T>::value, "WorkStealingDeque elements must be pointers");
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 初始容量（向上取整到2的幂）
+         */
+        explicit WorkStealingDeque(size_t capacity = 256)
+        {
+            size_t rounded = 2;
+            while (rounded < capacity)
+            {
+                rounded <<= 1;
+            }
+            arrays_.emplace_back(new Array(rounded));
+            array_.store(arrays_.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque &) = delete;
+        WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+        /**
+         * @brief 在底部压入元素（仅所有者线程）
+         * @param item 元素，不能为空指针
+         */
+        void push(T item)
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed);
+            const int64_t t = top_.load(std::memory_order_acquire);
+            Array *array = array_.load(std::memory_order_relaxed);
+
+            if (b - t > static_cast<int64_t>(array->capacity) - 1)
+            {
+                array = grow(array, b, t);
+            }
+
+            array->put(b, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 从底部弹出元素（仅所有者线程）
+         * @return 元素，队列为空时返回nullptr
+         */
+        T pop()
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            Array *array = array_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T item = array->get(b);
+            if (t == b)
+            {
+                // 最后一个元素：与窃取者竞争
+                if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed))
+                {
+                    item = nullptr;
+                }
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * @brief 从顶部窃取元素（任意线程）
+         * @return 元素，队列为空或与其他线程竞争失败时返回nullptr
+         */
+        T steal()
+        {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t b = bottom_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return nullptr;
+            }
+
+            Array *array = array_.load(std::memory_order_acquire);
+            T item = array->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            return item;
+        }
+
+        /**
+         * @brief 获取元素数量（并发访问时为近似值）
+         * @return 元素数量
+         */
+        size_t size() const
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed);
+            const int64_t t = top_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        /**
+         * @brief 检查是否为空（并发访问时为近似值）
+         * @return 是否为空
+         */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief 获取当前容量
+         * @return 容量
+         */
+        size_t capacity() const
+        {
+            return array_.load(std::memory_order_relaxed)->capacity;
+        }
+
+    private:
+        /// 环形数组
+        struct Array
+        {
+            explicit Array(size_t size)
+                : capacity(size), mask(size - 1), slots(new std::atomic<T>[size])
+            {
+            }
+
+            T get(int64_t index) const
+            {
+                return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t index, T item)
+            {
+                slots[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+            }
+
+            const size_t capacity;                   ///< 容量（2的幂）
+            const size_t mask;                       ///< 下标掩码
+            std::unique_ptr<std::atomic<T>[]> slots; ///< 元素槽
+        };
+
+        /**
+         * @brief 扩容为2倍并迁移[t, b)区间（仅所有者线程）
+         */
+        Array *grow(Array *array, int64_t b, int64_t t)
+        {
+            arrays_.emplace_back(new Array(array->capacity * 2));
+            Array *grown = arrays_.back().get();
+            for (int64_t i = t; i < b; ++i)
+            {
+                grown->put(i, array->get(i));
+            }
+            array_.store(grown, std::memory_order_release);
+            return grown;
+        }
+
+        alignas(64) std::atomic<int64_t> top_{0};    ///< 窃取端下标
+        alignas(64) std::atomic<int64_t> bottom_{0}; ///< 所有者端下标
+        std::atomic<Array *> array_{nullptr};        ///< 当前数组
+        std::vector<std::unique_ptr<Array>> arrays_; ///< 全部数组（含扩容前的旧数组）
+    };
+
+} // namespace radar
@@ -0,0 +1,395 @@
+/**
+ * @file work_stealing_pool.h
+ * @brief 任务调度器的工作窃取线程池
+ *
+ * 固定数量的工作线程执行调度器的任务，取代"每个任务创建一个分离线程"的执行方式：
+ * - 每个工作线程持有一个Chase-Lev双端队列，任务内部再提交的任务压入本线程队列
+ * - 外部线程提交的任务进入全局注入队列，工作线程按批取回本地
+ * - 本地与注入队列都为空时，随机选择受害者窃取其一半任务
+ * - 短暂自旋后仍无任务则在事件计数器上休眠，提交时没有休眠线程就不进入内核
+ * - 队列中保存侵入式任务节点指针，轻量任务直接入队，提交路径不再为装箱分配内存
+ * - 工作线程先执行threadInit（线程放置）再分配自己的队列，队列内存在本NUMA节点首次访问
+ * - 弹性伸缩：排队等待持续超过阈值时逐个增加线程直到maxThreadCount，
+ *   额外线程连续空闲keepAliveMs后退出，核心线程常驻
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ *
+ * @see TaskScheduler
+ * @see WorkStealingDeque
+ */
+
+#pragma once
+
+#include "common/error_codes.h"
+#include "common/event_count.h"
+#include "common/types.h"
+#include "modules/task_scheduler/task_scheduler_types.h"
+#include "modules/task_scheduler/work_stealing_deque.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace radar
+{
+
+    /**
+     * @brief 工作窃取线程池配置
+     */
+    struct WorkStealingPoolConfig
+    {
+        uint32_t threadCount = 0;     ///< 工作线程数，0表示硬件并发数
+        uint32_t spinRounds = 64;     ///< 找不到任务时休眠前的自旋轮数
+        uint32_t localCapacity = 256; ///< 本地双端队列初始容量
+        uint32_t injectionBatch = 32; ///< 从注入队列一次取回本地的最大任务数
+        std::string name = "ws-pool"; ///< 线程池名称（日志用）
+
+        // 弹性伸缩：maxThreadCount不大于threadCount时线程数固定，不启动伸缩检查线程
+        uint32_t maxThreadCount = 0;        ///< 最大工作线程数（threadCount为常驻的核心线程数）
+        uint32_t keepAliveMs = 60000;       ///< 额外线程连续空闲多久后退出（毫秒）
+        uint32_t scaleUpWaitUs = 2000;      ///< 任务排队等待超过该值视为积压（微秒）
+        uint32_t scaleUpChecks = 3;         ///< 连续积压多少个检查周期才增加一个线程
+        uint32_t scaleCheckIntervalMs = 10; ///< 伸缩检查周期（毫秒）
+
+        /// 工作线程启动时、分配本线程队列之前调用（参数为工作线程下标），用于绑核等线程放置，
+        /// 之后分配的本地队列由该线程首次访问，落在它所在的NUMA节点上
+        std::function<void(uint32_t)> threadInit;
+    };
+
+    /**
+     * @brief 工作窃取线程池统计快照
+     */
+    struct WorkStealingPoolStatistics
+    {
+        uint32_t threadCount = 0;      ///< 工作线程数
+        uint64_t submitted = 0;        ///< 提交的任务数
+        uint64_t executed = 0;         ///< 执行的任务数
+        uint64_t localSubmits = 0;     ///< 工作线程提交到本地队列的任务数
+        uint64_t injectedSubmits = 0;  ///< 外部线程提交到注入队列的任务数
+        uint64_t stealAttempts = 0;    ///< 窃取尝试次数
+        uint64_t successfulSteals = 0; ///< 成功窃取次数
+        uint64_t stolenTasks = 0;      ///< 窃取的任务总数（一次窃取约一半）
+        uint64_t parks = 0;            ///< 工作线程休眠次数
+        size_t pendingTasks = 0;       ///< 当前等待执行的任务数
+        uint32_t coreThreadCount = 0;  ///< 核心线程数
+        uint32_t maxThreadCount = 0;   ///< 最大线程数
+        uint32_t peakThreadCount = 0;  ///< 线程数峰值
+        uint64_t threadsSpawned = 0;   ///< 弹性增加的线程数
+        uint64_t threadsRetired = 0;   ///< 空闲退出的线程数
+    };
+
+    /**
+     * @brief 线程池队列节点
+     *
+     * 线程池只保存节点的裸指针，节点的内存由实现者管理：
+     * run()或discard()调用后线程池不再访问该节点。
+     */
+    class PoolItem
+    {
+    public:
+        virtual ~PoolItem() = default;
+
+        /**
+         * @brief 执行任务并释放节点
+         * @note 异常由线程池捕获并记录
+         */
+        virtual void run() = 0;
+
+        /**
+         * @brief 未执行就被丢弃（clear()）时调用，释放节点
+         */
+        virtual void discard() noexcept = 0;
+
+        uint64_t enqueuedNs = 0; ///< 入队时间（弹性伸缩时由线程池写入，用于计算排队等待）
+    };
+
+    /**
+     * @brief 工作窃取线程池
+     *
+     * @details
+     * 任务以ScheduledTaskPtr提交，由start()时设置的处理函数执行。
+     * 允许提交空任务指针：线程池只负责把它交给处理函数，调度器用它作为
+     * "从策略队列取下一个任务"的执行凭据，从而在保持优先级等调度顺序的同时
+     * 复用工作窃取的线程管理。
+     * 也可以用submitItem()直接提交自行管理内存的PoolItem节点（如LightTask），
+     * 它们不经过处理函数，提交时不分配内存。
+     *
+     * stop()之后尚未执行的任务保留在线程池中，再次start()后继续执行。
+     *
+     * @note submit()可由任意线程调用；start()/stop()不能由工作线程调用
+     */
+    class WorkStealingPool
+    {
+    public:
+        /// 任务处理函数
+        using TaskHandler = std::function<void(ScheduledTaskPtr)>;
+
+        static constexpr size_t SIZE_HISTORY_LIMIT = 64; ///< 线程数变化记录条数上限
+        static constexpr size_t STEAL_BATCH_LIMIT = 64;  ///< 一次窃取额外带走的任务数上限
+
+        WorkStealingPool();
+
+        /**
+         * @brief 析构函数，停止工作线程并释放未执行的任务
+         */
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+        /**
+         * @brief 启动工作线程
+         * @param config 线程池配置
+         * @param handler 任务处理函数
+         * @return 操作结果错误码
+         * @retval SystemErrors::SUCCESS 启动成功
+         * @retval SystemErrors::INVALID_PARAMETER 处理函数为空
+         * @retval TaskSchedulerErrors::THREAD_POOL_ERROR 已在运行或线程创建失败
+         */
+        ErrorCode start(const WorkStealingPoolConfig &config, TaskHandler handler);
+
+        /**
+         * @brief 停止工作线程（正在执行的任务完成后返回）
+         */
+        void stop();
+
+        /**
+         * @brief 提交任务
+         * @param task 任务，允许为空指针（见类说明）
+         * @return 操作结果错误码
+         */
+        ErrorCode submit(ScheduledTaskPtr task);
+
+        /**
+         * @brief 提交侵入式任务节点（不经过处理函数，也不分配内存）
+         * @param item 任务节点，所有权转移给线程池直到run()或discard()
+         * @return 操作结果错误码
+         * @retval SystemErrors::INVALID_PARAMETER 节点为空
+         */
+        ErrorCode submitItem(PoolItem *item);
+
+        /**
+         * @brief 丢弃所有未执行的任务
+         * @return 丢弃的任务数
+         * @note 仅在线程池停止时调用
+         */
+        size_t clear();
+
+        /**
+         * @brief 检查是否正在运行
+         * @return 是否正在运行
+         */
+        bool isRunning() const;
+
+        /**
+         * @brief 获取工作线程数
+         * @return 当前工作线程数（含弹性增加的线程），未运行时为0
+         */
+        uint32_t getThreadCount() const;
+
+        /**
+         * @brief 获取线程数变化记录
+         * @return 最近的线程数变化（时间升序，最多保留SIZE_HISTORY_LIMIT条）
+         */
+        std::vector<ThreadPoolSizeSample> getSizeHistory() const;
+
+        /**
+         * @brief 获取等待执行的任务数
+         * @return 任务数
+         */
+        size_t getPendingCount() const;
+
+        /**
+         * @brief 获取统计快照
+         * @return 统计信息
+         */
+        WorkStealingPoolStatistics getStatistics() const;
+
+        /**
+         * @brief 获取当前线程在所属线程池中的工作线程下标
+         * @return 下标，当前线程不是工作线程时返回-1
+         */
+        static int getCurrentWorkerIndex();
+
+        /**
+         * @brief 检查当前线程是否是本线程池的工作线程
+         * @return 是否是
+         */
+        bool isCurrentWorker() const;
+
+    private:
+        /// ScheduledTask的队列节点（交给处理函数执行）
+        class HandlerItem final : public PoolItem
+        {
+        public:
+            HandlerItem(WorkStealingPool *pool, ScheduledTaskPtr task)
+                : pool_(pool), task_(std::move(task)) {}
+
+            void run() override;
+            void discard() noexcept override;
+
+        private:
+            WorkStealingPool *pool_; ///< 所属线程池
+            ScheduledTaskPtr task_;  ///< 任务（可为空指针）
+        };
+
+        /// 工作线程状态
+        struct Worker
+        {
+            explicit Worker(uint32_t capacity) : deque(capacity) {}
+
+            WorkStealingDeque<PoolItem *> deque;           ///< 本地双端队列
+            uint32_t index = 0;                            ///< 下标
+            uint64_t randomState = 0;                      ///< 选择受害者的随机数状态
+            alignas(64) std::atomic<uint64_t> executed{0}; ///< 执行的任务数
+            std::atomic<uint64_t> localSubmits{0};         ///< 本地提交数
+            std::atomic<uint64_t> stealAttempts{0};        ///< 窃取尝试次数
+            std::atomic<uint64_t> successfulSteals{0};     ///< 成功窃取次数
+            std::atomic<uint64_t> stolenTasks{0};          ///< 窃取的任务数
+            std::atomic<uint64_t> parks{0};                ///< 休眠次数
+            std::atomic<uint64_t> maxWaitNs{0};            ///< 本检查周期内执行的任务的最长排队等待
+        };
+
+        /// 工作线程槽位（数量为最大线程数，运行期间不增删）
+        struct WorkerSlot
+        {
+            std::atomic<Worker *> worker{nullptr}; ///< 已发布的线程状态（线程退出后保留到stop()，窃取者可安全访问）
+            std::unique_ptr<Worker> owner;         ///< 线程状态的所有权
+            std::thread thread;                    ///< 线程（只由start()、伸缩检查线程和stop()操作）
+            std::atomic<bool> active{false};       ///< 槽位上有线程在运行（含启动中）
+        };
+
+        /**
+         * @brief 工作线程入口：完成线程放置，在本线程分配工作线程状态，等全部线程就绪后进入主循环
+         * @param index 工作线程下标
+         */
+        void workerMain(uint32_t index);
+
+        /**
+         * @brief 工作线程主循环
+         * @param worker 工作线程状态
+         * @return 是否因空闲超时退出（额外线程），停止时返回false
+         */
+        bool workerLoop(Worker &worker);
+
+        /**
+         * @brief 空闲退出的额外线程交还本地任务并记录线程数变化
+         * @param worker 工作线程状态
+         */
+        void retireWorker(Worker &worker);
+
+        /**
+         * @brief 伸缩检查线程主循环
+         */
+        void scalerLoop();
+
+        /**
+         * @brief 检查排队等待，持续积压时增加一个线程
+         */
+        void checkScaling();
+
+        /**
+         * @brief 在空闲槽位上启动一个额外线程
+         * @return 是否启动成功
+         */
+        bool spawnWorker();
+
+        /**
+         * @brief 获取槽位上已发布的线程状态
+         * @param index 槽位下标
+         * @return 线程状态，尚未发布时返回nullptr
+         */
+        Worker *workerAt(uint32_t index) const
+        {
+            return slots_[index].worker.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief 记录线程数变化
+         * @param threadCount 变化后的线程数
+         * @param queueWaitNs 观测到的排队等待（纳秒）
+         */
+        void recordSize(uint32_t threadCount, uint64_t queueWaitNs);
+
+        /**
+         * @brief 依次从本地队列、注入队列和其他线程获取任务
+         * @param worker 工作线程状态
+         * @return 任务，找不到时返回nullptr
+         */
+        PoolItem *findWork(Worker &worker);
+
+        /**
+         * @brief 从注入队列取一个任务，并按批把更多任务移入本地队列
+         * @param worker 工作线程状态
+         * @return 任务，注入队列为空时返回nullptr
+         */
+        PoolItem *takeInjected(Worker &worker);
+
+        /**
+         * @brief 从其他工作线程窃取约一半任务
+         * @param worker 工作线程状态
+         * @return 第一个窃取到的任务（其余压入本地队列），失败时返回nullptr
+         */
+        PoolItem *stealWork(Worker &worker);
+
+        /**
+         * @brief 检查是否有任何可见的待执行任务
+         * @return 是否有任务
+         */
+        bool hasVisibleWork() const;
+
+        /**
+         * @brief 执行任务节点
+         * @param worker 工作线程状态
+         * @param item 任务节点
+         */
+        void runItem(Worker &worker, PoolItem *item);
+
+        WorkStealingPoolConfig config_;          ///< 线程池配置
+        TaskHandler handler_;                    ///< 任务处理函数
+        std::unique_ptr<WorkerSlot[]> slots_;    ///< 工作线程槽位
+        uint32_t slotCount_ = 0;                 ///< 槽位数（最大线程数）
+        std::atomic<uint32_t> activeWorkers_{0}; ///< 当前工作线程数
+        std::mutex startupMutex_;                ///< 启动屏障互斥锁
+        std::condition_variable startupDone_;    ///< 启动屏障条件变量
+        uint32_t readyWorkers_ = 0;              ///< 已分配好状态的核心线程数
+        bool startupAborted_ = false;            ///< 启动失败，已就绪的线程直接退出
+        std::atomic<bool> running_{false};       ///< 运行标志
+        std::atomic<bool> stopping_{false};      ///< 停止请求标志
+        mutable std::mutex lifecycleMutex_;      ///< 启停互斥锁（保护槽位数组重建与retired_）
+        WorkStealingPoolStatistics retired_;     ///< 已停止的工作线程累计的统计
+
+        std::atomic<bool> elastic_{false};             ///< 是否启用弹性伸缩（为真时给任务打入队时间戳）
+        std::thread scaler_;                           ///< 伸缩检查线程
+        std::mutex scalerMutex_;                       ///< 伸缩检查线程休眠互斥锁
+        std::condition_variable scalerWake_;           ///< 伸缩检查线程唤醒条件变量
+        bool scalerStop_ = false;                      ///< 伸缩检查线程停止标志
+        uint32_t overloadedChecks_ = 0;                ///< 连续积压的检查周期数（仅伸缩检查线程访问）
+        uint64_t lastExecuted_ = 0;                    ///< 上个检查周期的已执行任务数（仅伸缩检查线程访问）
+        uint64_t lastProgressNs_ = 0;                  ///< 最近一次观察到任务完成的时间（仅伸缩检查线程访问）
+        std::atomic<uint32_t> peakWorkers_{0};         ///< 线程数峰值
+        std::atomic<uint64_t> threadsSpawned_{0};      ///< 弹性增加的线程数
+        std::atomic<uint64_t> threadsRetired_{0};      ///< 空闲退出的线程数
+        std::deque<ThreadPoolSizeSample> sizeHistory_; ///< 线程数变化记录
+        mutable std::mutex historyMutex_;              ///< 线程数变化记录互斥锁
+
+        std::deque<PoolItem *> injectionQueue_; ///< 全局注入队列
+        mutable std::mutex injectionMutex_;     ///< 注入队列互斥锁
+        std::atomic<size_t> injectedCount_{0};  ///< 注入队列长度（无锁读取）
+
+        std::atomic<size_t> pending_{0};           ///< 等待执行的任务数
+        std::atomic<uint64_t> submitted_{0};       ///< 提交的任务数
+        std::atomic<uint64_t> injectedSubmits_{0}; ///< 注入队列提交数
+        EventCount idleEvents_;                    ///< 空闲工作线程休眠点
+    };
+
+} // namespace radar
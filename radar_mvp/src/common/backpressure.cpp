@@ -0,0 +1,119 @@
+/**
+ * @file backpressure.cpp
+ * @brief 基于信用的背压信号实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "common/backpressure.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace radar
+{
+
+    BackpressurePolicy parseBackpressurePolicy(const std::string &name)
+    {
+        if (name == "throttle")
+        {
+            return BackpressurePolicy::THROTTLE;
+        }
+        if (name == "drop")
+        {
+            return BackpressurePolicy::DROP;
+        }
+        return BackpressurePolicy::NONE;
+    }
+
+    BackpressureSignal::BackpressureSignal(uint32_t capacity) : capacity_(capacity) {}
+
+    uint32_t BackpressureSignal::getCredits() const
+    {
+        if (capacity_ == 0)
+        {
+            return std::numeric_limits<uint32_t>::max();
+        }
+        const uint32_t occupancy = occupancy_.load(std::memory_order_relaxed);
+        return occupancy < capacity_ ? capacity_ - occupancy : 0;
+    }
+
+    double BackpressureSignal::getOccupancyRatio() const
+    {
+        if (capacity_ == 0)
+        {
+            return 0.0;
+        }
+        return std::min(1.0, static_cast<double>(occupancy_.load(std::memory_order_relaxed)) / capacity_);
+    }
+
+    bool BackpressureSignal::tryAcquire(uint32_t limit)
+    {
+        if (capacity_ == 0)
+        {
+            occupancy_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        limit = std::min(limit, capacity_);
+        uint32_t occupancy = occupancy_.load(std::memory_order_relaxed);
+        while (occupancy < limit)
+        {
+            if (occupancy_.compare_exchange_weak(occupancy, occupancy + 1, std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool BackpressureSignal::acquire(uint32_t limit, std::chrono::milliseconds timeout)
+    {
+        return creditsAvailable_.awaitFor([this, limit]()
+                                          { return tryAcquire(limit); },
+                                          timeout);
+    }
+
+    void BackpressureSignal::release()
+    {
+        uint32_t occupancy = occupancy_.load(std::memory_order_relaxed);
+        while (occupancy > 0 &&
+               !occupancy_.compare_exchange_weak(occupancy, occupancy - 1, std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed))
+        {
+        }
+        creditsAvailable_.notifyAll();
+    }
+
+    void BackpressureSignal::reset()
+    {
+        occupancy_.store(0, std::memory_order_release);
+        creditsAvailable_.notifyAll();
+    }
+
+    bool BackpressureSignal::waitForCredit(std::chrono::milliseconds timeout) const
+    {
+        return creditsAvailable_.awaitFor([this]()
+                                          { return hasCredit(); },
+                                          timeout);
+    }
+
+    bool BackpressureSignal::admitUpstream(BackpressurePolicy policy, std::chrono::milliseconds maxWait) const
+    {
+        switch (policy)
+        {
+        case BackpressurePolicy::THROTTLE:
+            waitForCredit(maxWait);
+            return true;
+        case BackpressurePolicy::DROP:
+            return hasCredit();
+        default:
+            return true;
+        }
+    }
+
+} // namespace radar
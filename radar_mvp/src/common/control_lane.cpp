@@ -0,0 +1,113 @@
+/**
+ * @file control_lane.cpp
+ * @brief 控制通道实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "common/control_lane.h"
+
+namespace radar
+{
+
+    ControlLane::ControlLane(size_t capacity) : queue_(capacity) {}
+
+    bool ControlLane::post(Action action)
+    {
+        if (!action)
+        {
+            return false;
+        }
+
+        // 先计入待执行数再入队：工作线程看到计数时消息可能还在写入，下一次检查会取到
+        pending_.fetch_add(1, std::memory_order_release);
+        Message message{std::move(action), std::chrono::steady_clock::now()};
+        if (!queue_.tryPush(message))
+        {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        posted_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t ControlLane::drain()
+    {
+        size_t count = 0;
+        // 释放执行权后再检查一次，避免消息在另一个线程放弃执行的瞬间滞留
+        while (hasPending())
+        {
+            bool expected = false;
+            if (!draining_.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                break;
+            }
+
+            Message message;
+            while (queue_.tryPop(message))
+            {
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                const uint64_t latencyNs = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                         message.postedAt)
+                        .count());
+                totalLatencyNs_.fetch_add(latencyNs, std::memory_order_relaxed);
+                if (latencyNs > maxLatencyNs_.load(std::memory_order_relaxed))
+                {
+                    maxLatencyNs_.store(latencyNs, std::memory_order_relaxed);
+                }
+
+                try
+                {
+                    message.action();
+                }
+                catch (...)
+                {
+                    failed_.fetch_add(1, std::memory_order_relaxed);
+                }
+                message.action = nullptr;
+                applied_.fetch_add(1, std::memory_order_relaxed);
+                ++count;
+            }
+
+            draining_.store(false, std::memory_order_release);
+            if (queue_.empty())
+            {
+                break;
+            }
+        }
+        return count;
+    }
+
+    ControlLaneStatistics ControlLane::getStatistics() const
+    {
+        constexpr double NS_PER_US = 1000.0;
+
+        ControlLaneStatistics stats;
+        stats.posted = posted_.load(std::memory_order_relaxed);
+        stats.applied = applied_.load(std::memory_order_relaxed);
+        stats.rejected = rejected_.load(std::memory_order_relaxed);
+        stats.failed = failed_.load(std::memory_order_relaxed);
+        if (stats.applied > 0)
+        {
+            stats.meanLatencyUs = totalLatencyNs_.load(std::memory_order_relaxed) / NS_PER_US / stats.applied;
+        }
+        stats.maxLatencyUs = maxLatencyNs_.load(std::memory_order_relaxed) / NS_PER_US;
+        return stats;
+    }
+
+    void ControlLane::resetStatistics()
+    {
+        posted_.store(0, std::memory_order_relaxed);
+        applied_.store(0, std::memory_order_relaxed);
+        rejected_.store(0, std::memory_order_relaxed);
+        failed_.store(0, std::memory_order_relaxed);
+        totalLatencyNs_.store(0, std::memory_order_relaxed);
+        maxLatencyNs_.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace radar
@@ -34,6 +34,7 @@ namespace radar
         {SystemErrors::SHUTDOWN_FAILED, "关闭失败"},
         {SystemErrors::CONFIGURATION_ERROR, "配置错误"},
         {SystemErrors::PERMISSION_DENIED, "权限拒绝"},
+        {SystemErrors::OPERATION_CANCELLED, "操作已取消"},
 
         // 数据接收模块错误 (0x1000 - 0x1FFF)
         {DataReceiverErrors::RECEIVER_NOT_READY, "数据接收器未就绪"},
@@ -58,6 +59,8 @@ namespace radar
         {DataProcessorErrors::BEAMFORMING_ERROR, "波束形成算法错误"},
         {DataProcessorErrors::CALIBRATION_ERROR, "系统校准错误"},
         {DataProcessorErrors::PERFORMANCE_DEGRADED, "处理性能严重下降"},
+        {DataProcessorErrors::DEADLINE_EXCEEDED, "数据包超过处理截止时间"},
+        {DataProcessorErrors::PACKET_SHED, "过载保护丢弃低优先级数据包"},
 
         // 任务调度模块错误 (0x3000 - 0x3FFF)
         {TaskSchedulerErrors::SCHEDULER_NOT_READY, "任务调度器未就绪"},
@@ -70,6 +73,9 @@ namespace radar
         {TaskSchedulerErrors::SCHEDULING_ERROR, "任务调度策略错误"},
         {TaskSchedulerErrors::TASK_TIMEOUT, "任务执行超时"},
         {TaskSchedulerErrors::LOAD_BALANCING_ERROR, "负载均衡策略错误"},
+        {TaskSchedulerErrors::DEADLINE_MISSED, "任务错过截止时间被丢弃"},
+        {TaskSchedulerErrors::GRAPH_CYCLE, "任务依赖图中存在环"},
+        {TaskSchedulerErrors::GRAPH_BUSY, "任务依赖图正在执行"},
 
         // 显示控制模块错误 (0x4000 - 0x4FFF)
         {DisplayControllerErrors::DISPLAY_NOT_READY, "显示控制器未就绪"},
@@ -95,6 +101,7 @@ namespace radar
         {SystemErrors::SHUTDOWN_FAILED, ErrorLevel::ERROR},
         {SystemErrors::CONFIGURATION_ERROR, ErrorLevel::ERROR},
         {SystemErrors::PERMISSION_DENIED, ErrorLevel::ERROR},
+        {SystemErrors::OPERATION_CANCELLED, ErrorLevel::INFO},
 
         // 数据接收模块错误级别
         {DataReceiverErrors::RECEIVER_NOT_READY, ErrorLevel::WARNING},
@@ -119,6 +126,8 @@ namespace radar
         {DataProcessorErrors::BEAMFORMING_ERROR, ErrorLevel::ERROR},
         {DataProcessorErrors::CALIBRATION_ERROR, ErrorLevel::ERROR},
         {DataProcessorErrors::PERFORMANCE_DEGRADED, ErrorLevel::WARNING},
+        {DataProcessorErrors::DEADLINE_EXCEEDED, ErrorLevel::WARNING},
+        {DataProcessorErrors::PACKET_SHED, ErrorLevel::WARNING},
 
         // 任务调度模块错误级别
         {TaskSchedulerErrors::SCHEDULER_NOT_READY, ErrorLevel::WARNING},
@@ -131,6 +140,9 @@ namespace radar
         {TaskSchedulerErrors::SCHEDULING_ERROR, ErrorLevel::ERROR},
         {TaskSchedulerErrors::TASK_TIMEOUT, ErrorLevel::WARNING},
         {TaskSchedulerErrors::LOAD_BALANCING_ERROR, ErrorLevel::WARNING},
+        {TaskSchedulerErrors::DEADLINE_MISSED, ErrorLevel::WARNING},
+        {TaskSchedulerErrors::GRAPH_CYCLE, ErrorLevel::ERROR},
+        {TaskSchedulerErrors::GRAPH_BUSY, ErrorLevel::WARNING},
 
         // 显示控制模块错误级别
         {DisplayControllerErrors::DISPLAY_NOT_READY, ErrorLevel::WARNING},
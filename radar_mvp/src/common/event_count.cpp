@@ -0,0 +1,173 @@
+/**
+ * @file event_count.cpp
+ * @brief 事件计数器实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "common/event_count.h"
+
+#include <climits>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <ctime>
+#include <unistd.h>
+#endif
+
+namespace radar
+{
+
+#if defined(__linux__)
+    namespace
+    {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free,
+                      "futex word must be a plain 32-bit integer");
+
+        /**
+         * @brief 纪元仍为expected时休眠（超时为空表示不限时）
+         */
+        inline void futexWait(std::atomic<uint32_t> &word, uint32_t expected, const timespec *timeout)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected, timeout,
+                    nullptr, 0);
+        }
+
+        /**
+         * @brief 唤醒至多count个在word上休眠的线程
+         */
+        inline void futexWake(std::atomic<uint32_t> &word, uint32_t count)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE,
+                    static_cast<int>(count > INT_MAX ? INT_MAX : count), nullptr, nullptr, 0);
+        }
+    } // anonymous namespace
+#endif
+
+    EventCount::Key EventCount::prepareWait()
+    {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        // 保证调用者随后对条件的二次检查不会被重排到登记之前
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_seq_cst);
+    }
+
+    void EventCount::cancelWait()
+    {
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    void EventCount::wait(Key key)
+    {
+#if defined(__linux__)
+        // futex在纪元已变化时立即返回；被信号或伪唤醒打断时重新等待
+        while (epoch_.load(std::memory_order_acquire) == key)
+        {
+            futexWait(epoch_, key, nullptr);
+        }
+#else
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this, key]()
+                     { return epoch_.load(std::memory_order_acquire) != key; });
+        }
+#endif
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    bool EventCount::waitFor(Key key, std::chrono::nanoseconds timeout)
+    {
+        bool notified;
+#if defined(__linux__)
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (;;)
+        {
+            notified = epoch_.load(std::memory_order_acquire) != key;
+            const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (notified || remaining.count() <= 0)
+            {
+                break;
+            }
+            timespec relative;
+            relative.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+            relative.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+            futexWait(epoch_, key, &relative);
+        }
+#else
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            notified = cv_.wait_for(lock, timeout, [this, key]()
+                                    { return epoch_.load(std::memory_order_acquire) != key; });
+        }
+#endif
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        return notified;
+    }
+
+    void EventCount::notifyOne()
+    {
+        notify(1);
+    }
+
+    void EventCount::notifyMany(uint32_t count)
+    {
+        if (count > 0)
+        {
+            notify(count);
+        }
+    }
+
+    void EventCount::notifyAll()
+    {
+        notify(UINT32_MAX);
+    }
+
+    uint32_t EventCount::getWaiterCount() const
+    {
+        return waiters_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @note 调用者发布数据后，这里的seq_cst栅栏与prepareWait()的seq_cst登记配对：
+     *       要么通知方看到等待者，要么等待者在二次检查时看到数据
+     */
+    void EventCount::notify(uint32_t count)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint32_t waiters = waiters_.load(std::memory_order_relaxed);
+        if (waiters == 0)
+        {
+            return;
+        }
+
+#if defined(__linux__)
+        // 先推进纪元再唤醒：尚未进入futex的等待者会因纪元不符而直接返回
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        futexWake(epoch_, count);
+#else
+        {
+            // 在锁内推进纪元，保证等待者检查纪元与进入休眠之间不会漏掉通知
+            std::lock_guard<std::mutex> lock(mutex_);
+            epoch_.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        if (count >= waiters)
+        {
+            cv_.notify_all();
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                cv_.notify_one();
+            }
+        }
+#endif
+    }
+
+} // namespace radar
@@ -132,10 +132,10 @@ namespace radar
 
                 initialized_ = true;
 
-                // 现在可以安全使用RADAR_*宏了
-                RADAR_INFO("Logger system initialized successfully");
-                RADAR_DEBUG("Async mode: {}, Queue size: {}, Thread pool size: {}",
-                            config_.asyncMode, config_.asyncQueueSize, config_.threadPoolSize);
+                // 此处仍持有mutex_，RADAR_*宏会再次加锁导致自死锁，直接使用默认记录器
+                SPDLOG_LOGGER_INFO(defaultLogger, "Logger system initialized successfully");
+                SPDLOG_LOGGER_DEBUG(defaultLogger, "Async mode: {}, Queue size: {}, Thread pool size: {}",
+                                    config_.asyncMode, config_.asyncQueueSize, config_.threadPoolSize);
 
                 return SystemErrors::SUCCESS;
             }
@@ -157,7 +157,12 @@ namespace radar
 
             try
             {
-                RADAR_INFO("Shutting down logger system...");
+                // 持有mutex_时不能使用RADAR_*宏（会再次加锁）
+                auto defaultLogger = loggers_.find("default");
+                if (defaultLogger != loggers_.end())
+                {
+                    SPDLOG_LOGGER_INFO(defaultLogger->second, "Shutting down logger system...");
+                }
 
                 // 刷新所有日志
                 spdlog::shutdown();
@@ -235,7 +240,7 @@ namespace radar
                 spdlog::register_logger(logger);
                 loggers_[moduleName] = logger;
 
-                RADAR_DEBUG("Created module logger: {}", moduleName);
+                SPDLOG_DEBUG("Created module logger: {}", moduleName);
                 return logger;
             }
             catch (const std::exception &e)
@@ -261,14 +266,16 @@ namespace radar
             try
             {
                 config_.globalLevel = level;
+
+                // 持有mutex_时使用spdlog默认记录器，避免RADAR_*宏重复加锁
                 spdlog::set_level(toSpdlogLevel(level));
 
-                RADAR_INFO("Global log level changed to: {}", static_cast<int>(level));
+                SPDLOG_INFO("Global log level changed to: {}", static_cast<int>(level));
                 return SystemErrors::SUCCESS;
             }
             catch (const std::exception &e)
             {
-                RADAR_ERROR("Failed to set global log level: {}", e.what());
+                SPDLOG_ERROR("Failed to set global log level: {}", e.what());
                 return SystemErrors::CONFIGURATION_ERROR;
             }
         }
@@ -286,12 +293,12 @@ namespace radar
             try
             {
                 it->second->set_level(toSpdlogLevel(level));
-                RADAR_DEBUG("Logger '{}' level changed to: {}", loggerName, static_cast<int>(level));
+                SPDLOG_DEBUG("Logger '{}' level changed to: {}", loggerName, static_cast<int>(level));
                 return SystemErrors::SUCCESS;
             }
             catch (const std::exception &e)
             {
-                RADAR_ERROR("Failed to set logger '{}' level: {}", loggerName, e.what());
+                SPDLOG_ERROR("Failed to set logger '{}' level: {}", loggerName, e.what());
                 return SystemErrors::CONFIGURATION_ERROR;
             }
         }
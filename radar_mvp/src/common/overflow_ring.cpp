@@ -0,0 +1,43 @@
+/**
+ * @file overflow_ring.cpp
+ * @brief 溢出策略名称解析
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "common/overflow_ring.h"
+
+namespace radar
+{
+
+    OverflowPolicy parseOverflowPolicy(const std::string &name)
+    {
+        if (name == "drop_newest")
+        {
+            return OverflowPolicy::DROP_NEWEST;
+        }
+        if (name == "block")
+        {
+            return OverflowPolicy::BLOCK;
+        }
+        return OverflowPolicy::DROP_OLDEST;
+    }
+
+    const char *getOverflowPolicyName(OverflowPolicy policy)
+    {
+        switch (policy)
+        {
+        case OverflowPolicy::DROP_NEWEST:
+            return "drop_newest";
+        case OverflowPolicy::BLOCK:
+            return "block";
+        case OverflowPolicy::DROP_OLDEST:
+        default:
+            return "drop_oldest";
+        }
+    }
+
+} // namespace radar
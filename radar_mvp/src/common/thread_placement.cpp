@@ -0,0 +1,529 @@
+/**
+ * @file thread_placement.cpp
+ * @brief 线程放置实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "common/thread_placement.h"
+#include "common/config_manager.h"
+#include "common/logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace radar
+{
+
+    namespace
+    {
+        /// 内核线程名最大长度（不含结尾的'\0'）
+        constexpr size_t MAX_THREAD_NAME_LENGTH = 15;
+
+        /**
+         * @brief 读取sysfs中的CPU列表文件
+         * @param path 文件路径
+         * @param cpus 输出的CPU编号
+         * @return 是否读取并解析成功
+         */
+        bool readCpuListFile(const std::string &path, std::vector<uint32_t> &cpus)
+        {
+            std::ifstream file(path);
+            std::string text;
+            return file && std::getline(file, text) && parseCpuList(text, cpus);
+        }
+
+        /**
+         * @brief 求两个升序CPU列表的交集
+         */
+        std::vector<uint32_t> intersectCpus(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b)
+        {
+            std::vector<uint32_t> result;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+            return result;
+        }
+
+        /**
+         * @brief 从配置节点解析放置配置
+         * @param node 放置节
+         * @return 放置配置
+         * @throws YAML::Exception 字段类型错误
+         *
+         * cpus既可以写成内核格式的字符串（"2-5,8"），也可以写成整数列表。
+         */
+        ThreadPlacementConfig parsePlacementNode(const YAML::Node &node)
+        {
+            ThreadPlacementConfig config;
+            if (const YAML::Node cpus = node["cpus"])
+            {
+                if (cpus.IsSequence())
+                {
+                    for (const auto &cpu : cpus)
+                    {
+                        config.cpus.push_back(cpu.as<uint32_t>());
+                    }
+                    std::sort(config.cpus.begin(), config.cpus.end());
+                    config.cpus.erase(std::unique(config.cpus.begin(), config.cpus.end()), config.cpus.end());
+                }
+                else if (!parseCpuList(cpus.as<std::string>(), config.cpus))
+                {
+                    RADAR_WARN("Invalid cpu list '{}' in placement config, ignored", cpus.as<std::string>());
+                    config.cpus.clear();
+                }
+            }
+            if (const YAML::Node nodes = node["numa_nodes"])
+            {
+                config.numaNodes = nodes.as<std::vector<int32_t>>();
+            }
+            config.pinPerCpu = node["pin_per_cpu"].as<bool>(config.pinPerCpu);
+            config.realtimePolicy = node["realtime_policy"].as<std::string>(config.realtimePolicy);
+            config.realtimePriority = node["realtime_priority"].as<int32_t>(config.realtimePriority);
+            return config;
+        }
+
+#ifdef __linux__
+        /**
+         * @brief 把调度策略转换为名称
+         */
+        const char *policyName(int policy)
+        {
+            switch (policy)
+            {
+            case SCHED_FIFO:
+                return "fifo";
+            case SCHED_RR:
+                return "rr";
+            default:
+                return "other";
+            }
+        }
+
+        /**
+         * @brief 读取线程的CPU亲和性
+         * @param thread 线程句柄
+         * @return CPU编号（升序）
+         */
+        std::vector<uint32_t> readAffinity(pthread_t thread)
+        {
+            std::vector<uint32_t> cpus;
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (pthread_getaffinity_np(thread, sizeof(set), &set) == 0)
+            {
+                for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                {
+                    if (CPU_ISSET(cpu, &set))
+                    {
+                        cpus.push_back(cpu);
+                    }
+                }
+            }
+            return cpus;
+        }
+
+        /**
+         * @brief 设置当前线程的实时调度策略
+         * @param config 放置配置
+         * @param threadName 线程名称（日志用）
+         * @param fallback 输出：权限不足而回退
+         * @return 操作结果错误码
+         */
+        ErrorCode applyRealtimePolicy(const ThreadPlacementConfig &config, const std::string &threadName,
+                                      bool &fallback)
+        {
+            fallback = false;
+            int policy = SCHED_OTHER;
+            if (config.realtimePolicy == "fifo")
+            {
+                policy = SCHED_FIFO;
+            }
+            else if (config.realtimePolicy == "rr")
+            {
+                policy = SCHED_RR;
+            }
+            else
+            {
+                if (config.realtimePolicy != "none")
+                {
+                    RADAR_WARN("Unknown realtime policy '{}' for thread {}, ignored",
+                               config.realtimePolicy, threadName);
+                    return SystemErrors::INVALID_PARAMETER;
+                }
+                return SystemErrors::SUCCESS;
+            }
+
+            sched_param param{};
+            param.sched_priority = std::clamp(config.realtimePriority,
+                                              sched_get_priority_min(policy), sched_get_priority_max(policy));
+            const int result = pthread_setschedparam(pthread_self(), policy, &param);
+            if (result == EPERM)
+            {
+                // 没有CAP_SYS_NICE（或RLIMIT_RTPRIO不足）：保持普通调度继续运行
+                fallback = true;
+                RADAR_WARN("Thread {} lacks CAP_SYS_NICE for SCHED_{} priority {}, falling back to SCHED_OTHER",
+                           threadName, config.realtimePolicy, param.sched_priority);
+                return SystemErrors::SUCCESS;
+            }
+            if (result != 0)
+            {
+                RADAR_WARN("Failed to set SCHED_{} for thread {}: {}",
+                           config.realtimePolicy, threadName, std::strerror(result));
+                return SystemErrors::INVALID_PARAMETER;
+            }
+            return SystemErrors::SUCCESS;
+        }
+#endif
+    } // anonymous namespace
+
+    //==============================================================================
+    // CpuTopology
+    //==============================================================================
+
+    const CpuTopology &CpuTopology::instance()
+    {
+        static const CpuTopology topology;
+        return topology;
+    }
+
+    CpuTopology::CpuTopology()
+    {
+        std::vector<uint32_t> online;
+        if (!readCpuListFile("/sys/devices/system/cpu/online", online) || online.empty())
+        {
+            const uint32_t count = std::max(1u, std::thread::hardware_concurrency());
+            for (uint32_t cpu = 0; cpu < count; ++cpu)
+            {
+                online.push_back(cpu);
+            }
+        }
+
+        // 在线CPU中排除进程亲和性（容器cpuset、taskset）不允许的部分。
+        // 读取主线程的允许列表，而不是调用线程的：首次访问可能发生在已经绑核的工作线程上
+        std::vector<uint32_t> allowed;
+        std::ifstream statusFile("/proc/self/status");
+        for (std::string line; std::getline(statusFile, line);)
+        {
+            const std::string key = "Cpus_allowed_list:";
+            if (line.compare(0, key.size(), key) == 0)
+            {
+                parseCpuList(line.substr(key.size()), allowed);
+                break;
+            }
+        }
+        availableCpus_ = allowed.empty() ? online : intersectCpus(online, allowed);
+        if (availableCpus_.empty())
+        {
+            availableCpus_ = online;
+        }
+
+        std::error_code error;
+        for (const auto &entry : std::filesystem::directory_iterator("/sys/devices/system/node", error))
+        {
+            const std::string name = entry.path().filename().string();
+            if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+                !std::all_of(name.begin() + 4, name.end(), [](char c)
+                             { return c >= '0' && c <= '9'; }))
+            {
+                continue;
+            }
+
+            std::vector<uint32_t> cpus;
+            if (!readCpuListFile((entry.path() / "cpulist").string(), cpus))
+            {
+                continue;
+            }
+            const size_t node = std::stoul(name.substr(4));
+            if (nodeCpus_.size() <= node)
+            {
+                nodeCpus_.resize(node + 1);
+            }
+            nodeCpus_[node] = std::move(cpus);
+        }
+
+        if (nodeCpus_.empty())
+        {
+            nodeCpus_.push_back(online);
+        }
+    }
+
+    std::vector<uint32_t> CpuTopology::getNodeCpus(int32_t node) const
+    {
+        if (node < 0 || static_cast<size_t>(node) >= nodeCpus_.size())
+        {
+            return {};
+        }
+        return nodeCpus_[static_cast<size_t>(node)];
+    }
+
+    int32_t CpuTopology::getNodeOfCpu(uint32_t cpu) const
+    {
+        for (size_t node = 0; node < nodeCpus_.size(); ++node)
+        {
+            if (std::binary_search(nodeCpus_[node].begin(), nodeCpus_[node].end(), cpu))
+            {
+                return static_cast<int32_t>(node);
+            }
+        }
+        return -1;
+    }
+
+    //==============================================================================
+    // CPU列表
+    //==============================================================================
+
+    bool parseCpuList(const std::string &text, std::vector<uint32_t> &cpus)
+    {
+        cpus.clear();
+        size_t position = 0;
+        while (position < text.size())
+        {
+            size_t end = text.find(',', position);
+            if (end == std::string::npos)
+            {
+                end = text.size();
+            }
+
+            std::string range = text.substr(position, end - position);
+            range.erase(std::remove_if(range.begin(), range.end(), [](unsigned char c)
+                                       { return std::isspace(c); }),
+                        range.end());
+            position = end + 1;
+            if (range.empty())
+            {
+                continue;
+            }
+
+            try
+            {
+                size_t consumed = 0;
+                const unsigned long first = std::stoul(range, &consumed);
+                unsigned long last = first;
+                if (consumed < range.size())
+                {
+                    if (range[consumed] != '-')
+                    {
+                        return false;
+                    }
+                    const std::string tail = range.substr(consumed + 1);
+                    last = std::stoul(tail, &consumed);
+                    if (consumed != tail.size() || last < first)
+                    {
+                        return false;
+                    }
+                }
+                for (unsigned long cpu = first; cpu <= last; ++cpu)
+                {
+                    cpus.push_back(static_cast<uint32_t>(cpu));
+                }
+            }
+            catch (const std::exception &)
+            {
+                return false;
+            }
+        }
+
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return true;
+    }
+
+    std::string formatCpuList(const std::vector<uint32_t> &cpus)
+    {
+        std::string text;
+        for (size_t i = 0; i < cpus.size();)
+        {
+            size_t j = i;
+            while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+            {
+                ++j;
+            }
+            if (!text.empty())
+            {
+                text += ',';
+            }
+            text += std::to_string(cpus[i]);
+            if (j > i)
+            {
+                text += '-';
+                text += std::to_string(cpus[j]);
+            }
+            i = j + 1;
+        }
+        return text;
+    }
+
+    //==============================================================================
+    // 放置
+    //==============================================================================
+
+    bool hasThreadPlacement(const ThreadPlacementConfig &config)
+    {
+        return !config.cpus.empty() || !config.numaNodes.empty() || config.pinPerCpu ||
+               config.realtimePolicy != "none";
+    }
+
+    std::vector<uint32_t> resolvePlacementCpus(const ThreadPlacementConfig &config, uint32_t workerIndex)
+    {
+        if (config.cpus.empty() && config.numaNodes.empty() && !config.pinPerCpu)
+        {
+            return {};
+        }
+
+        const CpuTopology &topology = CpuTopology::instance();
+        std::vector<uint32_t> candidates = config.cpus.empty()
+                                               ? topology.getAvailableCpus()
+                                               : intersectCpus(config.cpus, topology.getAvailableCpus());
+
+        // 先选节点：工作线程按下标轮流分布到各节点
+        uint32_t slot = workerIndex;
+        if (!config.numaNodes.empty())
+        {
+            const size_t nodeCount = config.numaNodes.size();
+            candidates = intersectCpus(candidates, topology.getNodeCpus(config.numaNodes[workerIndex % nodeCount]));
+            slot = static_cast<uint32_t>(workerIndex / nodeCount);
+        }
+
+        // 再在节点内选CPU
+        if (config.pinPerCpu && !candidates.empty())
+        {
+            return {candidates[slot % candidates.size()]};
+        }
+        return candidates;
+    }
+
+    ErrorCode applyThreadPlacement(const ThreadPlacementConfig &config, const std::string &threadName,
+                                   uint32_t workerIndex, ThreadPlacementStatus *status)
+    {
+#ifdef __linux__
+        pthread_setname_np(pthread_self(), threadName.substr(0, MAX_THREAD_NAME_LENGTH).c_str());
+
+        ErrorCode result = SystemErrors::SUCCESS;
+        const bool wantsAffinity = !config.cpus.empty() || !config.numaNodes.empty() || config.pinPerCpu;
+        if (wantsAffinity)
+        {
+            const std::vector<uint32_t> cpus = resolvePlacementCpus(config, workerIndex);
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (uint32_t cpu : cpus)
+            {
+                if (cpu < CPU_SETSIZE)
+                {
+                    CPU_SET(cpu, &set);
+                }
+            }
+
+            if (CPU_COUNT(&set) == 0)
+            {
+                RADAR_WARN("No available CPU for thread {} (cpus '{}', {} NUMA nodes configured), left unpinned",
+                           threadName, formatCpuList(config.cpus), config.numaNodes.size());
+                result = SystemErrors::INVALID_PARAMETER;
+            }
+            else if (const int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); error != 0)
+            {
+                RADAR_WARN("Failed to pin thread {} to CPUs {}: {}",
+                           threadName, formatCpuList(cpus), std::strerror(error));
+                result = SystemErrors::INVALID_PARAMETER;
+            }
+        }
+
+        bool fallback = false;
+        const ErrorCode realtimeResult = applyRealtimePolicy(config, threadName, fallback);
+        if (result == SystemErrors::SUCCESS)
+        {
+            result = realtimeResult;
+        }
+
+        ThreadPlacementStatus placed = queryThreadPlacement(threadName);
+        placed.realtimeFallback = fallback;
+        if (hasThreadPlacement(config))
+        {
+            RADAR_INFO("Thread {} placed on CPUs {} (NUMA node {}, SCHED_{} priority {})",
+                       threadName, formatCpuList(placed.cpus), placed.numaNode,
+                       placed.schedulingPolicy, placed.priority);
+        }
+        if (status)
+        {
+            *status = std::move(placed);
+        }
+        return result;
+#else
+        if (status)
+        {
+            *status = queryThreadPlacement(threadName);
+        }
+        return hasThreadPlacement(config) ? SystemErrors::RESOURCE_UNAVAILABLE : SystemErrors::SUCCESS;
+#endif
+    }
+
+    ThreadPlacementStatus queryThreadPlacement(const std::string &threadName)
+    {
+        ThreadPlacementStatus status;
+        status.threadName = threadName;
+#ifdef __linux__
+        status.cpus = readAffinity(pthread_self());
+
+        int policy = SCHED_OTHER;
+        sched_param param{};
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0)
+        {
+            status.schedulingPolicy = policyName(policy);
+            status.priority = param.sched_priority;
+        }
+
+        // 允许的CPU全部位于同一节点时才报告节点
+        const CpuTopology &topology = CpuTopology::instance();
+        if (!status.cpus.empty())
+        {
+            status.numaNode = topology.getNodeOfCpu(status.cpus.front());
+            for (uint32_t cpu : status.cpus)
+            {
+                if (topology.getNodeOfCpu(cpu) != status.numaNode)
+                {
+                    status.numaNode = -1;
+                    break;
+                }
+            }
+        }
+#endif
+        return status;
+    }
+
+    ThreadPlacementConfig resolveThreadPlacement(const ThreadPlacementConfig &configured, const std::string &keyPath)
+    {
+        if (hasThreadPlacement(configured) || !RADAR_CONFIG().isLoaded())
+        {
+            return configured;
+        }
+
+        const auto node = RADAR_CONFIG().getSubConfig(keyPath);
+        if (!node || !node->IsMap())
+        {
+            return configured;
+        }
+
+        try
+        {
+            return parsePlacementNode(*node);
+        }
+        catch (const YAML::Exception &e)
+        {
+            RADAR_WARN("Invalid placement config '{}': {}", keyPath, e.what());
+            return configured;
+        }
+    }
+
+} // namespace radar
@@ -0,0 +1,148 @@
+/**
+ * @file adaptive_batch_controller.cpp
+ * @brief 自适应批大小控制器实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/data_processor/adaptive_batch_controller.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace radar
+{
+
+    namespace
+    {
+        /**
+         * @brief 批大小所在的2的幂分桶
+         * @param batchSize 批大小
+         * @return 分桶索引（1→0, 2~3→1, 4~7→2, ...）
+         */
+        size_t batchSizeBucket(uint32_t batchSize)
+        {
+            size_t bucket = 0;
+            while (batchSize > 1 && bucket + 1 < BATCH_SIZE_BUCKET_COUNT)
+            {
+                batchSize >>= 1;
+                bucket++;
+            }
+            return bucket;
+        }
+    } // anonymous namespace
+
+    AdaptiveBatchController::AdaptiveBatchController(const BatchingPolicy &policy)
+        : policy_(policy)
+    {
+        resetLocked();
+    }
+
+    void AdaptiveBatchController::configure(const BatchingPolicy &policy)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        policy_ = policy;
+        resetLocked();
+    }
+
+    uint32_t AdaptiveBatchController::getBatchSize() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batchSize_;
+    }
+
+    /**
+     * @note 加性增（每次增大约1/4，至少1）、乘性减（减半），
+     *       延迟超标时能迅速收缩，积压时逐步放大
+     */
+    void AdaptiveBatchController::recordBatch(size_t taskCount, size_t remainingBacklog,
+                                              const std::vector<double> &latenciesMs)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (double latency : latenciesMs)
+        {
+            if (latencyWindow_.size() < policy_.latencyWindow)
+            {
+                latencyWindow_.push_back(latency);
+            }
+            else
+            {
+                latencyWindow_[windowNext_] = latency;
+                windowNext_ = (windowNext_ + 1) % latencyWindow_.size();
+            }
+        }
+
+        statistics_.batchesProcessed++;
+        statistics_.tasksProcessed += taskCount;
+        statistics_.averageBatchSize =
+            static_cast<double>(statistics_.tasksProcessed) / statistics_.batchesProcessed;
+
+        const double p99 = computeP99Locked();
+        statistics_.p99LatencyMs = p99;
+        statistics_.p99ByBatchSize[batchSizeBucket(batchSize_)] = p99;
+
+        if (!policy_.adaptive)
+        {
+            return;
+        }
+
+        const double budget = static_cast<double>(policy_.latencyBudgetMs);
+        if (p99 > budget * policy_.shrinkRatio && batchSize_ > policy_.minBatchSize)
+        {
+            batchSize_ = std::max(policy_.minBatchSize, batchSize_ / 2);
+            statistics_.shrinkEvents++;
+        }
+        else if (remainingBacklog > 0 && taskCount >= batchSize_ && p99 < budget * policy_.growRatio &&
+                 batchSize_ < policy_.maxBatchSize)
+        {
+            batchSize_ = std::min(policy_.maxBatchSize, batchSize_ + std::max<uint32_t>(1, batchSize_ / 4));
+            statistics_.growEvents++;
+        }
+
+        statistics_.currentBatchSize = batchSize_;
+    }
+
+    BatchingStatistics AdaptiveBatchController::getStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return statistics_;
+    }
+
+    void AdaptiveBatchController::reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        resetLocked();
+    }
+
+    double AdaptiveBatchController::computeP99Locked()
+    {
+        if (latencyWindow_.empty())
+        {
+            return 0.0;
+        }
+
+        scratch_.assign(latencyWindow_.begin(), latencyWindow_.end());
+        const size_t rank = static_cast<size_t>(std::ceil(0.99 * scratch_.size())) - 1;
+        std::nth_element(scratch_.begin(), scratch_.begin() + rank, scratch_.end());
+        return scratch_[rank];
+    }
+
+    void AdaptiveBatchController::resetLocked()
+    {
+        policy_.minBatchSize = std::max<uint32_t>(policy_.minBatchSize, 1);
+        policy_.maxBatchSize = std::max(policy_.maxBatchSize, policy_.minBatchSize);
+        policy_.latencyWindow = std::max<uint32_t>(policy_.latencyWindow, 1);
+
+        batchSize_ = std::min(std::max(policy_.initialBatchSize, policy_.minBatchSize), policy_.maxBatchSize);
+        latencyWindow_.clear();
+        latencyWindow_.reserve(policy_.latencyWindow);
+        windowNext_ = 0;
+        statistics_ = BatchingStatistics();
+        statistics_.currentBatchSize = batchSize_;
+    }
+
+} // namespace radar
@@ -0,0 +1,243 @@
+/**
+ * @file admission_controller.cpp
+ * @brief 截止时间准入控制器实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/data_processor/admission_controller.h"
+#include "common/logger.h"
+
+// 防止Windows宏定义与枚举值冲突
+#ifdef ERROR
+#undef ERROR
+#endif
+
+#include <algorithm>
+
+namespace radar
+{
+
+    namespace
+    {
+        /// 端到端延迟滑动平均的平滑系数
+        constexpr double LATENCY_EWMA_ALPHA = 0.2;
+
+        constexpr DegradationLevel MAX_DEGRADATION_LEVEL = DegradationLevel::SHED_LOW_PRIORITY;
+
+        inline size_t levelIndex(DegradationLevel level)
+        {
+            return static_cast<size_t>(level);
+        }
+    } // anonymous namespace
+
+    const char *getDegradationLevelName(DegradationLevel level)
+    {
+        switch (level)
+        {
+        case DegradationLevel::FULL:
+            return "full";
+        case DegradationLevel::SKIP_OPTIONAL:
+            return "skip_optional";
+        case DegradationLevel::REDUCED_CHANNELS:
+            return "reduced_channels";
+        case DegradationLevel::DECIMATED:
+            return "decimated";
+        case DegradationLevel::SHED_LOW_PRIORITY:
+            return "shed_low_priority";
+        }
+        return "unknown";
+    }
+
+    AdmissionController::AdmissionController(const AdmissionPolicy &policy)
+        : policy_(policy)
+    {
+        statistics_.levelEntries[levelIndex(DegradationLevel::FULL)] = 1;
+    }
+
+    void AdmissionController::configure(const AdmissionPolicy &policy)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        policy_ = policy;
+        level_ = DegradationLevel::FULL;
+        packetsAtLevel_ = 0;
+        latencySampled_ = false;
+        statistics_ = AdmissionStatistics();
+        statistics_.levelEntries[levelIndex(DegradationLevel::FULL)] = 1;
+    }
+
+    Timestamp AdmissionController::getDeadline(const RawDataPacket &packet) const
+    {
+        if (packet.timestamp == Timestamp())
+        {
+            return Timestamp::max();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return packet.timestamp + std::chrono::milliseconds(policy_.latencyBudgetMs);
+    }
+
+    AdmissionDecision AdmissionController::admit(const RawDataPacket &packet, size_t backlog,
+                                                 Timestamp now, DegradationLevel &level)
+    {
+        const Timestamp deadline = getDeadline(packet);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!policy_.enabled)
+        {
+            level = DegradationLevel::FULL;
+            statistics_.admittedPackets++;
+            statistics_.packetsPerLevel[levelIndex(level)]++;
+            return AdmissionDecision::ADMIT;
+        }
+
+        const DegradationLevel next = nextLevelLocked(backlog);
+        if (next != level_)
+        {
+            if (next > level_)
+            {
+                MODULE_WARN(AdmissionController, "Degradation level {} -> {} (backlog {}, latency {:.2f}ms)",
+                            getDegradationLevelName(level_), getDegradationLevelName(next),
+                            backlog, statistics_.latencyEwmaMs);
+            }
+            else
+            {
+                MODULE_INFO(AdmissionController, "Degradation level {} -> {} (backlog {}, latency {:.2f}ms)",
+                            getDegradationLevelName(level_), getDegradationLevelName(next),
+                            backlog, statistics_.latencyEwmaMs);
+            }
+
+            level_ = next;
+            packetsAtLevel_ = 0;
+            statistics_.levelChanges++;
+            statistics_.levelEntries[levelIndex(next)]++;
+            statistics_.currentLevel = next;
+        }
+
+        if (now > deadline)
+        {
+            statistics_.expiredPackets++;
+            return AdmissionDecision::EXPIRED;
+        }
+
+        if (level_ == DegradationLevel::SHED_LOW_PRIORITY && packet.priority == PacketPriority::LOW)
+        {
+            statistics_.shedPackets++;
+            return AdmissionDecision::SHED;
+        }
+
+        level = level_;
+        packetsAtLevel_++;
+        statistics_.admittedPackets++;
+        statistics_.packetsPerLevel[levelIndex(level_)]++;
+        return AdmissionDecision::ADMIT;
+    }
+
+    /**
+     * @note 积压驱动的升级立即生效；延迟驱动的升级与所有恢复都要求当前级别
+     *       已处理minPacketsPerLevel个数据包，让降级措施的效果先反映到延迟上
+     */
+    DegradationLevel AdmissionController::nextLevelLocked(size_t backlog) const
+    {
+        size_t backlogLevel = 0;
+        while (backlogLevel < policy_.backlogThresholds.size() &&
+               backlog >= policy_.backlogThresholds[backlogLevel])
+        {
+            backlogLevel++;
+        }
+
+        const size_t current = levelIndex(level_);
+        if (backlogLevel > current)
+        {
+            return static_cast<DegradationLevel>(backlogLevel);
+        }
+
+        const bool settled = packetsAtLevel_ >= policy_.minPacketsPerLevel;
+        const bool latencyPressure =
+            latencySampled_ &&
+            statistics_.latencyEwmaMs > policy_.latencyBudgetMs * policy_.latencyPressureRatio;
+
+        if (latencyPressure)
+        {
+            if (settled && level_ < MAX_DEGRADATION_LEVEL)
+            {
+                return static_cast<DegradationLevel>(current + 1);
+            }
+            return level_;
+        }
+
+        if (current > 0 && settled &&
+            backlog <= policy_.backlogThresholds[current - 1] * policy_.recoveryRatio)
+        {
+            return static_cast<DegradationLevel>(current - 1);
+        }
+
+        return level_;
+    }
+
+    void AdmissionController::recordCompletion(const RawDataPacket &packet, Timestamp completionTime)
+    {
+        if (packet.timestamp == Timestamp())
+        {
+            return;
+        }
+
+        const double latencyMs =
+            std::chrono::duration<double, std::milli>(completionTime - packet.timestamp).count();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!latencySampled_)
+        {
+            statistics_.latencyEwmaMs = latencyMs;
+            latencySampled_ = true;
+        }
+        else
+        {
+            statistics_.latencyEwmaMs += LATENCY_EWMA_ALPHA * (latencyMs - statistics_.latencyEwmaMs);
+        }
+    }
+
+    StageExecutionOptions AdmissionController::getExecutionOptions(DegradationLevel level,
+                                                                   uint32_t channelCount) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        StageExecutionOptions options;
+        options.skipOptionalStages = level >= DegradationLevel::SKIP_OPTIONAL;
+        if (level >= DegradationLevel::REDUCED_CHANNELS && policy_.channelDivisor > 1)
+        {
+            options.maxChannels = std::max<uint32_t>(channelCount / policy_.channelDivisor, 1);
+        }
+        if (level >= DegradationLevel::DECIMATED)
+        {
+            options.decimation = std::max<uint32_t>(policy_.decimationFactor, 1);
+        }
+        return options;
+    }
+
+    DegradationLevel AdmissionController::getLevel() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return level_;
+    }
+
+    AdmissionStatistics AdmissionController::getStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return statistics_;
+    }
+
+    void AdmissionController::reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        level_ = DegradationLevel::FULL;
+        packetsAtLevel_ = 0;
+        latencySampled_ = false;
+        statistics_ = AdmissionStatistics();
+        statistics_.levelEntries[levelIndex(DegradationLevel::FULL)] = 1;
+    }
+
+} // namespace radar
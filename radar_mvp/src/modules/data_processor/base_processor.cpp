@@ -18,7 +18,7 @@
  *       - 常量：全大写下划线分隔 (MAX_BATCH_SIZE)
  *       - 原子变量：后缀说明类型 (running_, shouldStop_)
  *       - 互斥锁：后缀Mutex (statsMutex_, taskQueueMutex_)
- *       - 条件变量：描述性名称 (taskAvailable_)
+ *       - 事件通知：描述性名称 (taskAvailable_)
  */
 
 #include "common/types.h"
@@ -33,10 +33,8 @@
 #endif
 #include <algorithm>
 #include <chrono>
-#include <future>
 #include <numeric>
 #include <mutex>
-#include <condition_variable>
 #include <queue>
 #include <thread>
 #include <atomic>
@@ -66,6 +64,37 @@ namespace radar
         /// 内存对齐边界（字节）
         constexpr size_t MEMORY_ALIGNMENT = 32;
 
+        /**
+         * @brief 由处理器配置生成准入控制策略
+         * @param config 处理器配置
+         * @return 准入控制策略（延迟预算取processingTimeoutMs）
+         */
+        AdmissionPolicy makeAdmissionPolicy(const DataProcessorConfig &config)
+        {
+            AdmissionPolicy policy;
+            policy.enabled = config.loadSheddingEnabled;
+            policy.latencyBudgetMs = config.processingTimeoutMs;
+            std::copy_n(config.degradationBacklogThresholds.begin(),
+                        std::min(config.degradationBacklogThresholds.size(), policy.backlogThresholds.size()),
+                        policy.backlogThresholds.begin());
+            return policy;
+        }
+
+        /**
+         * @brief 由处理器配置生成自适应批处理策略
+         * @param config 处理器配置
+         * @return 批处理策略（初始批大小取batchSize，上限为MAX_BATCH_SIZE）
+         */
+        BatchingPolicy makeBatchingPolicy(const DataProcessorConfig &config)
+        {
+            BatchingPolicy policy;
+            policy.adaptive = config.adaptiveBatching;
+            policy.initialBatchSize = config.batchSize;
+            policy.maxBatchSize = static_cast<uint32_t>(MAX_BATCH_SIZE);
+            policy.latencyBudgetMs = config.processingTimeoutMs;
+            return policy;
+        }
+
         /**
          * @brief 生成唯一任务ID
          * @return 全局唯一的任务ID
@@ -196,10 +225,12 @@ namespace radar
           ,
           taskQueueMutex_() // 任务队列互斥锁，重新构造新实例
           ,
-          taskAvailable_() // 条件变量不可移动，重新构造新实例
+          taskAvailable_() // 事件计数器不可移动，重新构造新实例
           ,
           taskQueue_(std::move(other.taskQueue_)) // 移动任务队列及其中的待处理任务
           ,
+          queuedTasks_(other.queuedTasks_.exchange(0)) // 任务数随队列一起转移
+          ,
           statistics_() // 处理统计信息会在构造函数体中处理
           ,
           logger_(std::move(other.logger_)) // 移动日志记录器实例
@@ -213,6 +244,14 @@ namespace radar
         // 移动统计信息快照到新对象，然后重置源对象统计信息
         other.statistics_.getSnapshot(statistics_);
         other.statistics_.reset();
+
+        // 准入控制器与批大小控制器含互斥锁不可移动，按配置重新构建
+        if (config_)
+        {
+            admission_.configure(makeAdmissionPolicy(*config_));
+            batchController_.configure(makeBatchingPolicy(*config_));
+            threadPlacement_ = resolveThreadPlacement(config_->threadPlacement, "data_processor.placement");
+        }
     }
 
     DataProcessor &DataProcessor::operator=(DataProcessor &&other) noexcept
@@ -242,6 +281,7 @@ namespace radar
             errorCallback_ = std::move(other.errorCallback_);
             stateChangeCallback_ = std::move(other.stateChangeCallback_);
             taskQueue_ = std::move(other.taskQueue_);
+            queuedTasks_.store(other.queuedTasks_.exchange(0));
             logger_ = std::move(other.logger_);
             config_ = std::move(other.config_);
             currentStrategy_ = other.currentStrategy_;
@@ -249,6 +289,12 @@ namespace radar
 
             other.statistics_.getSnapshot(statistics_);
             other.statistics_.reset();
+
+            if (config_)
+            {
+                admission_.configure(makeAdmissionPolicy(*config_));
+                batchController_.configure(makeBatchingPolicy(*config_));
+            }
         }
         return *this;
     }
@@ -327,8 +373,12 @@ namespace radar
 
         try
         {
-            // 执行核心处理算法
-            result = executeProcessing(inputPacket);
+            // 准入控制后执行核心处理算法；被丢弃的数据包不计为处理失败
+            ErrorCode admitted = admitAndExecute(inputPacket, result);
+            if (admitted != SystemErrors::SUCCESS)
+            {
+                return admitted;
+            }
 
             if (!result)
             {
@@ -373,49 +423,44 @@ namespace radar
     /**
      * @brief 异步处理雷达数据包
      * @param inputPacket 输入的雷达数据包
-     * @return std::future<ProcessingResultPtr> 异步处理结果
+     * @return Future<ProcessingResultPtr> 异步处理结果
      * @throws ModuleException 处理器未运行或输入数据无效
      *
      * @note 此方法立即返回，实际处理在后台线程中进行
-     * @note 通过返回的future可以获取处理结果或检查处理状态
+     * @note 通过返回的Future可以获取处理结果、用then()串接后续处理，
+     *       或在处理开始前cancel()跳过该数据包
      * @warning 确保在处理器停止前获取所有future的结果
      */
-    std::future<ProcessingResultPtr> DataProcessor::processPacketAsync(
+    Future<ProcessingResultPtr> DataProcessor::processPacketAsync(
         const RawDataPacketPtr &inputPacket)
     {
         // 验证处理器状态
         if (currentState_.load() != ModuleState::RUNNING)
         {
-            std::promise<ProcessingResultPtr> promise;
-            promise.set_exception(std::make_exception_ptr(
+            return makeFailedFuture<ProcessingResultPtr>(std::make_exception_ptr(
                 ModuleException(DataProcessorErrors::PROCESSOR_NOT_READY,
                                 "Processor not in running state")));
-            return promise.get_future();
         }
 
         // 验证输入数据
         if (!validateInputPacket(inputPacket))
         {
-            std::promise<ProcessingResultPtr> promise;
-            promise.set_exception(std::make_exception_ptr(
+            return makeFailedFuture<ProcessingResultPtr>(std::make_exception_ptr(
                 ModuleException(DataProcessorErrors::INVALID_INPUT_DATA,
                                 "Invalid input packet")));
-            return promise.get_future();
         }
 
         // 创建promise并加入队列
-        std::promise<ProcessingResultPtr> promise;
-        auto future = promise.get_future();
+        Promise<ProcessingResultPtr> promise;
+        auto future = promise.getFuture();
 
         try
         {
             enqueueTask(inputPacket, std::move(promise));
         }
-        catch (const std::exception &e)
+        catch (const std::exception &)
         {
-            std::promise<ProcessingResultPtr> errorPromise;
-            errorPromise.set_exception(std::make_exception_ptr(e));
-            return errorPromise.get_future();
+            return makeFailedFuture<ProcessingResultPtr>(std::current_exception());
         }
 
         return future;
@@ -597,6 +642,12 @@ namespace radar
         return caps;
     }
 
+    size_t DataProcessor::getQueueDepth() const
+    {
+        return activePackets_.load() + queuedTasks_.load(std::memory_order_acquire) +
+               batchedTasks_.load(std::memory_order_acquire);
+    }
+
     //==============================================================================
     // IModule 接口实现
     //==============================================================================
@@ -638,6 +689,11 @@ namespace radar
             // 重置统计信息
             statistics_.reset();
 
+            // 按配置设置准入控制（延迟预算与降级阈值）与自适应批处理
+            admission_.configure(makeAdmissionPolicy(*config_));
+            batchController_.configure(makeBatchingPolicy(*config_));
+            threadPlacement_ = resolveThreadPlacement(config_->threadPlacement, "data_processor.placement");
+
             // 设置为就绪状态
             setState(ModuleState::READY);
             MODULE_INFO(DataProcessor, "DataProcessor initialized successfully");
@@ -719,7 +775,7 @@ namespace radar
         running_.store(false);
 
         // 唤醒处理线程
-        taskAvailable_.notify_all();
+        taskAvailable_.notifyAll();
 
         // 等待线程结束
         if (processingThread_.joinable())
@@ -769,7 +825,7 @@ namespace radar
 
         running_.store(true);
         setState(ModuleState::RUNNING);
-        taskAvailable_.notify_all();
+        taskAvailable_.notifyAll();
 
         MODULE_INFO(DataProcessor, "DataProcessor resumed successfully");
         return SystemErrors::SUCCESS;
@@ -785,21 +841,25 @@ namespace radar
             stop();
         }
 
+        // 清空任务队列：在锁外通知调用者，续体可能再次访问处理器
+        std::queue<PendingTask> abandoned;
+        {
+            std::lock_guard<std::mutex> queueLock(taskQueueMutex_);
+            abandoned.swap(taskQueue_);
+            queuedTasks_.store(0);
+            batchedTasks_.store(0);
+        }
+        while (!abandoned.empty())
+        {
+            abandoned.front().second.setException(std::make_exception_ptr(
+                ModuleException(SystemErrors::SHUTDOWN_FAILED, "System shutting down")));
+            abandoned.pop();
+        }
+
         std::lock_guard<std::mutex> lock(statsMutex_);
 
         try
         {
-            // 清空任务队列
-            {
-                std::lock_guard<std::mutex> queueLock(taskQueueMutex_);
-                while (!taskQueue_.empty())
-                {
-                    auto &task = taskQueue_.front();
-                    task.second.set_exception(std::make_exception_ptr(
-                        ModuleException(SystemErrors::SHUTDOWN_FAILED, "System shutting down")));
-                    taskQueue_.pop();
-                }
-            }
 
             // 重置统计信息
             statistics_.reset();
@@ -848,7 +908,9 @@ namespace radar
         // 填充处理器相关的性能指标
         metrics->dataProcessorMetrics.state = currentState_.load();
         metrics->dataProcessorMetrics.packetsProcessed = statistics_.totalPacketsProcessed.load();
-        metrics->dataProcessorMetrics.packetsDropped = statistics_.processingFailures.load();
+        metrics->dataProcessorMetrics.packetsDropped = statistics_.processingFailures.load() +
+                                                       statistics_.expiredPackets.load() +
+                                                       statistics_.shedPackets.load();
         metrics->dataProcessorMetrics.averageLatencyMs = statistics_.averageProcessingTimeMs.load();
         metrics->dataProcessorMetrics.throughputMbps = statistics_.throughputMbps.load();
 
@@ -875,9 +937,58 @@ namespace radar
     {
         std::lock_guard<std::mutex> lock(statsMutex_);
         statistics_.reset();
+        admission_.reset();
+        batchController_.reset();
+        controlLane_.resetStatistics();
         MODULE_INFO(DataProcessor, "Statistics reset");
     }
 
+    AdmissionStatistics DataProcessor::getAdmissionStatistics() const
+    {
+        return admission_.getStatistics();
+    }
+
+    BatchingStatistics DataProcessor::getBatchingStatistics() const
+    {
+        return batchController_.getStatistics();
+    }
+
+    ErrorCode DataProcessor::postControl(ControlLane::Action action)
+    {
+        if (!action)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        auto guarded = [this, action = std::move(action)]()
+        {
+            try
+            {
+                action();
+            }
+            catch (const std::exception &e)
+            {
+                MODULE_ERROR(DataProcessor, "Control message failed: {}", e.what());
+                onErrorOccurred(SystemErrors::CONFIGURATION_ERROR, e.what());
+                throw;
+            }
+        };
+        if (!controlLane_.post(std::move(guarded)))
+        {
+            MODULE_WARN(DataProcessor, "Control lane full, message rejected");
+            return SystemErrors::RESOURCE_UNAVAILABLE;
+        }
+
+        // 唤醒空闲的处理线程，消息本身不进入数据队列；处理线程未休眠时不进入内核
+        taskAvailable_.notifyAll();
+        return SystemErrors::SUCCESS;
+    }
+
+    ControlLaneStatistics DataProcessor::getControlStatistics() const
+    {
+        return controlLane_.getStatistics();
+    }
+
     //==============================================================================
     // 受保护的实现方法
     //==============================================================================
@@ -886,70 +997,65 @@ namespace radar
     {
         MODULE_INFO(DataProcessor, "Processing loop started");
 
+        // 先完成放置再分配批处理缓冲区，使其落在本线程所在的NUMA节点
+        applyThreadPlacement(threadPlacement_, moduleName_, 0);
+
+        std::vector<PendingTask> batch;
+        std::vector<double> latencies;
+        batch.reserve(MAX_BATCH_SIZE);
+        latencies.reserve(MAX_BATCH_SIZE);
+
         try
         {
             while (!shouldStop_.load())
             {
+                // 控制消息优先于数据，暂停期间同样生效
+                controlLane_.drain();
+
                 // 检查运行状态 - 支持暂停/恢复功能
                 if (!running_.load())
                 {
                     // 暂停状态，等待唤醒信号
-                    // 使用条件变量避免忙等待，节省CPU资源
-                    std::unique_lock<std::mutex> lock(taskQueueMutex_);
-                    taskAvailable_.wait(lock, [this]
-                                        { return shouldStop_.load() || running_.load(); });
+                    // 短暂自旋后休眠，避免忙等待，节省CPU资源
+                    taskAvailable_.await([this]
+                                         { return shouldStop_.load() || running_.load() ||
+                                                  controlLane_.hasPending(); });
                     continue; // 被唤醒后重新检查循环条件
                 }
 
-                // 尝试从任务队列获取待处理的数据包
-                // 使用RAII确保promise和packet在异常情况下也能正确处理
-                RawDataPacketPtr packet;
-                std::promise<ProcessingResultPtr> promise;
-
-                // 带超时的出队操作，避免线程永久阻塞
+                // 在一次加锁内取出至多"当前批大小"个任务，摊薄加锁与唤醒开销
                 // 1000ms超时确保能够定期检查停止标志
-                if (!dequeueTask(packet, promise, 1000))
+                batch.clear();
+                size_t remaining = 0;
+                if (dequeueBatch(batch, batchController_.getBatchSize(), remaining, 1000) == 0)
                 {
-                    continue; // 超时或队列为空，继续下一次循环检查
+                    continue; // 超时、队列为空或有控制消息，继续下一次循环检查
                 }
 
-                // 执行实际的数据处理
-                try
+                // 逐个处理并立即兑现promise，批内靠后的任务不必等待整批完成
+                const Timestamp dequeueTime = std::chrono::high_resolution_clock::now();
+                latencies.clear();
+                for (auto &task : batch)
                 {
-                    // 调用具体的处理算法（由子类实现）
-                    auto result = executeProcessing(packet);
-
-                    if (result)
+                    // 相邻两个数据包之间检查控制通道（无消息时只是一次原子读）
+                    if (controlLane_.hasPending())
                     {
-                        // 处理成功，设置promise的值供异步调用者获取
-                        promise.set_value(result);
-
-                        // 如果处理成功，触发完成回调通知上层模块
-                        if (result->processingSuccess)
-                        {
-                            onProcessingComplete(*result);
-                        }
+                        controlLane_.drain();
                     }
-                    else
+                    const Timestamp origin = task.first->timestamp != Timestamp() ? task.first->timestamp : dequeueTime;
+                    if (runQueuedTask(task))
                     {
-                        // 处理返回空结果，设置异常供调用者处理
-                        promise.set_exception(std::make_exception_ptr(
-                            ModuleException(DataProcessorErrors::PROCESSING_FAILED,
-                                            "Processing returned null result")));
+                        latencies.push_back(std::chrono::duration<double, std::milli>(
+                                                std::chrono::high_resolution_clock::now() - origin)
+                                                .count());
                     }
                 }
-                catch (const std::exception &e)
-                {
-                    // 处理过程中发生异常，记录错误并通知调用者
-                    MODULE_ERROR(DataProcessor, "Processing exception: {}", e.what());
-                    promise.set_exception(std::make_exception_ptr(e));
-
-                    // 更新统计信息，便于监控和诊断
-                    statistics_.recordFailure();
 
-                    // 触发错误回调，让上层模块处理错误
-                    onErrorOccurred(DataProcessorErrors::PROCESSING_FAILED, e.what());
-                }
+                // 按本批延迟与剩余积压调整下一批的大小
+                batchController_.recordBatch(batch.size(), remaining, latencies);
+                const BatchingStatistics batching = batchController_.getStatistics();
+                statistics_.currentBatchSize.store(batching.currentBatchSize);
+                statistics_.p99LatencyMs.store(batching.p99LatencyMs);
             }
         }
         catch (const std::exception &e)
@@ -963,6 +1069,127 @@ namespace radar
         MODULE_INFO(DataProcessor, "Processing loop ended");
     }
 
+    bool DataProcessor::runQueuedTask(PendingTask &task)
+    {
+        const RawDataPacketPtr &packet = task.first;
+        Promise<ProcessingResultPtr> &promise = task.second;
+
+        // 离开批内等待：之后由activePackets_计入积压（本数据包自身不计）
+        batchedTasks_.fetch_sub(1, std::memory_order_release);
+
+        // 调用者已取消：跳过处理，不占用处理时间
+        if (promise.isCancelled())
+        {
+            return false;
+        }
+
+        try
+        {
+            // 准入控制后调用具体的处理算法（由子类实现）
+            ProcessingResultPtr result;
+            ErrorCode admitted = admitAndExecute(packet, result);
+
+            if (admitted != SystemErrors::SUCCESS)
+            {
+                // 超过截止时间或过载丢弃，通知调用者该数据包未被处理
+                promise.setException(std::make_exception_ptr(
+                    ModuleException(admitted, getErrorDescription(admitted))));
+                return false;
+            }
+
+            if (!result)
+            {
+                // 处理返回空结果，设置异常供调用者处理
+                promise.setException(std::make_exception_ptr(
+                    ModuleException(DataProcessorErrors::PROCESSING_FAILED,
+                                    "Processing returned null result")));
+                return false;
+            }
+
+            // 设置promise的值供异步调用者获取
+            promise.setValue(result);
+
+            // 如果处理成功，触发完成回调通知上层模块
+            if (result->processingSuccess)
+            {
+                onProcessingComplete(*result);
+            }
+            return true;
+        }
+        catch (const std::exception &e)
+        {
+            // 处理过程中发生异常，记录错误并通知调用者
+            MODULE_ERROR(DataProcessor, "Processing exception: {}", e.what());
+            promise.setException(std::current_exception());
+
+            // 更新统计信息，便于监控和诊断
+            statistics_.recordFailure();
+
+            // 触发错误回调，让上层模块处理错误
+            onErrorOccurred(DataProcessorErrors::PROCESSING_FAILED, e.what());
+            return false;
+        }
+    }
+
+    ProcessingResultPtr DataProcessor::executeDegraded(const RawDataPacketPtr &inputPacket,
+                                                       [[maybe_unused]] DegradationLevel level)
+    {
+        return executeProcessing(inputPacket);
+    }
+
+    /**
+     * @note 积压 = 队列中等待的数据包 + 已取入本批尚未处理的数据包 + 正在处理的数据包（含并发的同步调用）
+     * @note 截止时间在开始处理前检查：已过期的数据包即使处理完成也没有实时价值
+     */
+    ErrorCode DataProcessor::admitAndExecute(const RawDataPacketPtr &packet, ProcessingResultPtr &result)
+    {
+        const size_t backlog = getQueueDepth();
+
+        DegradationLevel level = DegradationLevel::FULL;
+        AdmissionDecision decision =
+            admission_.admit(*packet, backlog, std::chrono::high_resolution_clock::now(), level);
+
+        if (decision == AdmissionDecision::EXPIRED)
+        {
+            statistics_.expiredPackets++;
+            MODULE_DEBUG(DataProcessor, "Packet {} dropped: deadline exceeded", packet->sequenceId);
+            return DataProcessorErrors::DEADLINE_EXCEEDED;
+        }
+
+        if (decision == AdmissionDecision::SHED)
+        {
+            statistics_.shedPackets++;
+            MODULE_DEBUG(DataProcessor, "Packet {} shed under overload", packet->sequenceId);
+            return DataProcessorErrors::PACKET_SHED;
+        }
+
+        statistics_.degradationLevel.store(static_cast<uint8_t>(level));
+
+        activePackets_.fetch_add(1);
+        try
+        {
+            result = executeDegraded(packet, level);
+        }
+        catch (...)
+        {
+            activePackets_.fetch_sub(1);
+            throw;
+        }
+        activePackets_.fetch_sub(1);
+
+        if (result)
+        {
+            result->degradationLevel = static_cast<uint8_t>(level);
+            if (level != DegradationLevel::FULL)
+            {
+                statistics_.degradedPackets++;
+            }
+            admission_.recordCompletion(*packet, std::chrono::high_resolution_clock::now());
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
     bool DataProcessor::validateInputPacket(const RawDataPacketPtr &packet) const
     {
         if (!packet)
@@ -1068,6 +1295,15 @@ namespace radar
             return false;
         }
 
+        const auto &thresholds = config.degradationBacklogThresholds;
+        if (thresholds.size() != DEGRADATION_LEVEL_COUNT - 1 || thresholds.front() == 0 ||
+            !std::is_sorted(thresholds.begin(), thresholds.end()))
+        {
+            MODULE_ERROR(DataProcessor, "Degradation thresholds must be {} non-zero ascending values",
+                         DEGRADATION_LEVEL_COUNT - 1);
+            return false;
+        }
+
         if (config.memoryPoolMb == 0 || config.memoryPoolMb > 8192)
         {
             MODULE_ERROR(DataProcessor, "Invalid memory pool size: {}MB", config.memoryPoolMb);
@@ -1078,7 +1314,7 @@ namespace radar
     }
 
     void DataProcessor::enqueueTask(const RawDataPacketPtr &packet,
-                                    std::promise<ProcessingResultPtr> &&promise)
+                                    Promise<ProcessingResultPtr> &&promise)
     {
         std::lock_guard<std::mutex> lock(taskQueueMutex_);
 
@@ -1095,29 +1331,27 @@ namespace radar
         // 将数据包和对应的promise作为任务加入队列
         // 使用emplace避免不必要的拷贝构造
         taskQueue_.emplace(packet, std::move(promise));
+        queuedTasks_.fetch_add(1, std::memory_order_release);
 
-        // 通知一个等待的工作线程有新任务可处理
-        taskAvailable_.notify_one();
+        // 通知一个等待的工作线程有新任务可处理（没有线程休眠时不进入内核）
+        taskAvailable_.notifyOne();
     }
 
     bool DataProcessor::dequeueTask(RawDataPacketPtr &packet,
-                                    std::promise<ProcessingResultPtr> &promise,
+                                    Promise<ProcessingResultPtr> &promise,
                                     uint32_t timeoutMs)
     {
-        std::unique_lock<std::mutex> lock(taskQueueMutex_);
-
-        // 如果队列为空，等待新任务或超时
-        if (taskQueue_.empty())
+        // 如果队列为空，先自旋再休眠，等待新任务或超时（等待期间不持有队列锁）
+        if (!taskAvailable_.awaitFor([this]
+                                     { return queuedTasks_.load(std::memory_order_acquire) > 0 ||
+                                              shouldStop_.load(); },
+                                     std::chrono::milliseconds(timeoutMs)))
         {
-            auto timeout = std::chrono::milliseconds(timeoutMs);
-            // 条件等待：直到有任务入队或收到停止信号
-            if (!taskAvailable_.wait_for(lock, timeout, [this]
-                                         { return !taskQueue_.empty() || shouldStop_.load(); }))
-            {
-                return false; // 超时返回，让调用者重新检查循环条件
-            }
+            return false; // 超时返回，让调用者重新检查循环条件
         }
 
+        std::unique_lock<std::mutex> lock(taskQueueMutex_);
+
         // 再次检查队列状态，防止竞争条件或停止信号
         if (taskQueue_.empty() || shouldStop_.load())
         {
@@ -1131,8 +1365,44 @@ namespace radar
 
         // 移除已处理的任务，维护队列状态
         taskQueue_.pop();
+        queuedTasks_.fetch_sub(1, std::memory_order_relaxed);
 
         return true; // 成功获取任务
     }
 
+    size_t DataProcessor::dequeueBatch(std::vector<PendingTask> &tasks, size_t maxTasks,
+                                       size_t &remaining, uint32_t timeoutMs)
+    {
+        remaining = 0;
+        if (!taskAvailable_.awaitFor([this]
+                                     { return queuedTasks_.load(std::memory_order_acquire) > 0 ||
+                                              shouldStop_.load() || controlLane_.hasPending(); },
+                                     std::chrono::milliseconds(timeoutMs)))
+        {
+            return 0;
+        }
+
+        std::unique_lock<std::mutex> lock(taskQueueMutex_);
+
+        if (taskQueue_.empty() || shouldStop_.load())
+        {
+            remaining = taskQueue_.size();
+            return 0;
+        }
+
+        // 同一次加锁内取出至多maxTasks个任务
+        const size_t count = std::min(std::max<size_t>(maxTasks, 1), taskQueue_.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            tasks.push_back(std::move(taskQueue_.front()));
+            taskQueue_.pop();
+        }
+        // 先计入批内任务再减队列任务，准入控制看到的积压不会因取批而下降
+        batchedTasks_.fetch_add(count, std::memory_order_release);
+        queuedTasks_.fetch_sub(count, std::memory_order_release);
+
+        remaining = taskQueue_.size();
+        return count;
+    }
+
 } // namespace radar
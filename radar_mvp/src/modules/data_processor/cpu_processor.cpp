@@ -2,8 +2,9 @@
  * @file cpu_processor.cpp
  * @brief CPU数据处理器实现
  *
- * 实现了基于CPU的雷达数据处理器CPUDataProcessor，支持FFT变换、
- * 数字滤波、目标检测、波束形成等核心算法。采用SIMD优化提升性能。
+ * 实现了基于CPU的雷达数据处理器CPUDataProcessor。处理链由可配置的
+ * 处理阶段图（StageGraph）执行，内置FFT变换、数字滤波、目标检测、
+ * 波束形成等阶段；大数据包在共享线程池上包内并行。
  *
  * @author Kelin
  * @version 1.0
@@ -13,6 +14,7 @@
 
 #include "modules/data_processor.h"
 #include "common/logger.h"
+#include "common/config_manager.h"
 
 // 防止Windows宏定义与枚举值冲突
 #ifdef ERROR
@@ -65,21 +67,103 @@ namespace radar
         return caps;
     }
 
+    /**
+     * @brief 初始化CPU处理器并构建处理阶段图
+     * @return 操作结果错误码
+     * @retval SystemErrors::SUCCESS 初始化成功
+     * @retval SystemErrors::INITIALIZATION_FAILED 基类初始化失败或阶段图配置无效
+     *
+     * @note 阶段图来源优先级：DataProcessorConfig::pipelineStages >
+     *       配置文件 data_processor.pipeline > 默认处理链
+     */
+    ErrorCode CPUDataProcessor::initialize()
+    {
+        ErrorCode baseResult = DataProcessor::initialize();
+        if (baseResult != SystemErrors::SUCCESS)
+        {
+            return baseResult;
+        }
+
+        std::vector<ProcessingStageConfig> stageConfigs = config_->pipelineStages;
+        if (stageConfigs.empty() && RADAR_CONFIG().isLoaded() &&
+            StageGraph::loadConfig(stageConfigs) != SystemErrors::SUCCESS)
+        {
+            MODULE_WARN(CPUDataProcessor, "Invalid pipeline configuration, using default chain");
+            stageConfigs.clear();
+        }
+
+        if (stageConfigs.empty())
+        {
+            stageConfigs = StageGraph::createDefaultConfig();
+        }
+
+        if (stageGraph_.build(stageConfigs) != SystemErrors::SUCCESS)
+        {
+            MODULE_ERROR(CPUDataProcessor, "Failed to build processing stage graph");
+            setState(ModuleState::ERROR);
+            return SystemErrors::INITIALIZATION_FAILED;
+        }
+
+        if (config_->intraPacketParallel)
+        {
+            // 配置了线程放置时使用独占线程池，工作线程与处理线程放在同一组CPU上（下标从1开始）
+            if (hasThreadPlacement(threadPlacement_))
+            {
+                ownPool_ = std::make_unique<ForkJoinPool>(config_->workerThreads > 1 ? config_->workerThreads - 1 : 1,
+                                                          threadPlacement_, moduleName_);
+            }
+            stageGraph_.setParallelExecution(ownPool_ ? ownPool_.get() : &ForkJoinPool::getShared(),
+                                             config_->parallelThresholdElements);
+        }
+        else
+        {
+            stageGraph_.setParallelExecution(nullptr);
+        }
+
+        MODULE_INFO(CPUDataProcessor, "Processing stage graph ready with {} stages (intra-packet parallel: {})",
+                    stageGraph_.getExecutionOrder().size(), config_->intraPacketParallel);
+        return SystemErrors::SUCCESS;
+    }
+
+    /**
+     * @brief 获取各处理阶段的耗时统计
+     * @return 按执行顺序排列的阶段耗时统计
+     */
+    std::vector<StageTimingInfo> CPUDataProcessor::getStageTimings() const
+    {
+        return stageGraph_.getStageTimings();
+    }
+
     /**
      * @brief 执行CPU数据处理
      * @param inputPacket 输入的雷达数据包
      * @return ProcessingResultPtr 处理结果指针
+     *
+     * @note 完整执行处理阶段图，等价于以DegradationLevel::FULL调用executeDegraded()
+     */
+    ProcessingResultPtr CPUDataProcessor::executeProcessing(const RawDataPacketPtr &inputPacket)
+    {
+        return executeDegraded(inputPacket, DegradationLevel::FULL);
+    }
+
+    /**
+     * @brief 按降级级别执行CPU数据处理
+     * @param inputPacket 输入的雷达数据包
+     * @param level 准入控制给出的降级级别
+     * @return ProcessingResultPtr 处理结果指针
      * @retval nullptr 处理失败
      * @retval 有效指针 处理成功的结果
      *
-     * @note 此方法执行完整的雷达信号处理流程：FFT变换、数字滤波、目标检测和波束形成
-     * @note 每个处理步骤都会检查结果，失败时提前返回
+     * @note 按拓扑顺序执行处理阶段图，各阶段的输出按配置映射到结果字段
+     * @note 降级时跳过可选阶段、只处理部分通道或抽取采样点，结果尺寸随之缩小
+     * @note 任一阶段失败时提前返回，结果标记为失败
      * @warning 输入数据包必须是有效的，否则会导致处理失败
      */
-    ProcessingResultPtr CPUDataProcessor::executeProcessing(const RawDataPacketPtr &inputPacket)
+    ProcessingResultPtr CPUDataProcessor::executeDegraded(const RawDataPacketPtr &inputPacket,
+                                                          DegradationLevel level)
     {
-        MODULE_DEBUG(CPUDataProcessor, "Executing CPU processing for packet {}",
-                     inputPacket->sequenceId);
+        MODULE_DEBUG(CPUDataProcessor, "Executing CPU processing for packet {} (level {})",
+                     inputPacket->sequenceId, getDegradationLevelName(level));
 
         auto result = std::make_shared<ProcessingResult>();
         result->sourcePacketId = inputPacket->sequenceId;
@@ -89,69 +173,17 @@ namespace radar
 
         try
         {
-            // 1. 执行FFT变换
-            AlignedComplexVector frequencyData;
-            ErrorCode fftResult = performFFT(inputPacket->iqData, frequencyData);
-            if (fftResult != SystemErrors::SUCCESS)
-            {
-                MODULE_ERROR(CPUDataProcessor, "FFT processing failed");
-                result->processingSuccess = false;
-                return result;
-            }
-
-            // 2. 执行数字滤波
-            AlignedComplexVector filteredData;
-            ErrorCode filterResult = performFiltering(frequencyData, filteredData);
-            if (filterResult != SystemErrors::SUCCESS)
-            {
-                MODULE_ERROR(CPUDataProcessor, "Filtering failed");
-                result->processingSuccess = false;
-                return result;
-            }
-
-            // 3. 执行目标检测
-            std::vector<double> detectionResults;
-            ErrorCode detectionResult = performDetection(filteredData, detectionResults);
-            if (detectionResult != SystemErrors::SUCCESS)
+            const StageExecutionOptions options =
+                admission_.getExecutionOptions(level, inputPacket->channelCount);
+            ErrorCode graphResult = stageGraph_.execute(*inputPacket, *result, options);
+            if (graphResult != SystemErrors::SUCCESS)
             {
-                MODULE_ERROR(CPUDataProcessor, "Detection failed");
+                MODULE_ERROR(CPUDataProcessor, "Stage graph execution failed: {}",
+                             getErrorDescription(graphResult));
                 result->processingSuccess = false;
                 return result;
             }
 
-            // 4. 多通道数据的波束形成（如果适用）
-            if (inputPacket->channelCount > 1)
-            {
-                std::vector<AlignedComplexVector> channelData;
-                // TODO: 分离多通道数据
-
-                AlignedComplexVector beamformedData;
-                ErrorCode beamformResult = performBeamforming(channelData, beamformedData);
-                if (beamformResult != SystemErrors::SUCCESS)
-                {
-                    MODULE_WARN(CPUDataProcessor, "Beamforming failed, using single channel");
-                }
-                result->beamformedData.resize(beamformedData.size());
-                std::transform(beamformedData.begin(), beamformedData.end(),
-                               result->beamformedData.begin(),
-                               [](const ComplexFloat &c)
-                               { return std::abs(c); });
-            }
-
-            // 填充处理结果 - 转换double到float
-            result->rangeProfile.resize(detectionResults.size());
-            std::transform(detectionResults.begin(), detectionResults.end(),
-                           result->rangeProfile.begin(),
-                           [](double d)
-                           { return static_cast<float>(d); });
-
-            // 计算多普勒频谱（示例实现）
-            result->dopplerSpectrum.resize(frequencyData.size());
-            std::transform(frequencyData.begin(), frequencyData.end(),
-                           result->dopplerSpectrum.begin(),
-                           [](const ComplexFloat &c)
-                           { return std::abs(c); });
-
             auto endTime = std::chrono::high_resolution_clock::now();
             auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
                                 endTime - startTime)
@@ -177,160 +209,6 @@ namespace radar
         return result;
     }
 
-    /**
-     * @brief 执行FFT变换处理
-     * @param inputData 输入的复数数据向量
-     * @param outputData 输出的FFT结果向量
-     * @return 处理结果错误码
-     *
-     * @note 当前为框架实现，提供基本的变换模拟
-     * @todo 使用FFTW3或Intel MKL库实现高性能FFT算法
-     * @todo 支持不同的窗函数（Hamming, Blackman, Kaiser等）
-     * @todo 实现零填充和重叠处理优化
-     */
-    ErrorCode CPUDataProcessor::performFFT(const AlignedComplexVector &inputData,
-                                           AlignedComplexVector &outputData)
-    {
-        MODULE_DEBUG(CPUDataProcessor, "Performing FFT on {} samples", inputData.size());
-
-        // TODO: 使用FFTW3库实现高性能FFT算法
-        // 计划实现：
-        // 1. 支持单精度和双精度FFT
-        // 2. 实现SIMD优化的基2算法
-        // 3. 支持任意长度的FFT（通过Chirp-Z变换）
-        // 当前为框架实现，返回输入数据的变换模拟
-        outputData = inputData;
-
-        // 示例：简单的频域变换模拟
-        for (auto &sample : outputData)
-        {
-            sample *= std::complex<float>(0.5f, 0.5f);
-        }
-
-        return SystemErrors::SUCCESS;
-    }
-
-    /**
-     * @brief 执行数字滤波处理
-     * @param inputData 输入的复数数据向量
-     * @param outputData 输出的滤波结果向量
-     * @return 处理结果错误码
-     *
-     * @note 当前为框架实现，提供简单的低通滤波模拟
-     * @todo 实现IIR/FIR滤波器设计工具
-     * @todo 支持自适应滤波算法（LMS, RLS等）
-     * @todo 实现多级滤波器组用于信道分离
-     */
-    ErrorCode CPUDataProcessor::performFiltering(const AlignedComplexVector &inputData,
-                                                 AlignedComplexVector &outputData)
-    {
-        MODULE_DEBUG(CPUDataProcessor, "Performing digital filtering");
-
-        // TODO: 实现高性能数字滤波算法
-        // 计划实现：
-        // 1. 使用Intel IPP或ARM NEON优化的FIR滤波器
-        // 2. 椭圆滤波器、切比雪夫滤波器设计
-        // 3. 多速率信号处理（抽取和插值）
-        // 4. 自适应噪声消除算法
-        // 当前为框架实现，使用简单的滑动平均滤波
-        outputData = inputData;
-
-        // 示例：简单的低通滤波模拟
-        for (size_t i = 1; i < outputData.size() - 1; ++i)
-        {
-            outputData[i] = (inputData[i - 1] + inputData[i] + inputData[i + 1]) / 3.0f;
-        }
-
-        return SystemErrors::SUCCESS;
-    }
-
-    /**
-     * @brief 执行目标检测处理
-     * @param inputData 输入的复数数据向量
-     * @param detectionResults 输出的检测结果向量
-     * @return 处理结果错误码
-     *
-     * @note 当前为框架实现，返回模拟的检测结果
-     * @todo 实现CFAR（恒虚警率）检测算法
-     * @todo 支持多目标跟踪算法（卡尔曼滤波、粒子滤波）
-     * @todo 实现多普勒频移检测和分析
-     */
-    ErrorCode CPUDataProcessor::performDetection(const AlignedComplexVector &inputData,
-                                                 std::vector<double> &detectionResults)
-    {
-        MODULE_DEBUG(CPUDataProcessor, "Performing target detection");
-
-        // TODO: 实现先进的目标检测算法
-        // 计划实现：
-        // 1. CA-CFAR, SO-CFAR, GO-CFAR等恒虚警率检测器
-        // 2. 基于机器学习的目标分类器
-        // 3. 多帧相关检测提高检测概率
-        // 4. 杂波抑制和背景估计算法
-        // 当前为框架实现，使用简单的幅度检测
-        detectionResults.resize(inputData.size());
-
-        // 示例：简单的幅度检测
-        std::transform(inputData.begin(), inputData.end(), detectionResults.begin(),
-                       [](const ComplexFloat &c)
-                       { return std::abs(c); });
-
-        return SystemErrors::SUCCESS;
-    }
-
-    /**
-     * @brief 执行波束形成处理
-     * @param inputData 多通道输入数据向量
-     * @param beamformedData 输出的波束形成结果
-     * @return 处理结果错误码
-     *
-     * @note 当前为框架实现，使用简单的通道加权求和
-     * @todo 实现自适应波束形成算法（MVDR, MUSIC等）
-     * @todo 支持数字波束形成和模拟波束形成
-     * @todo 实现零陷形成用于干扰抑制
-     */
-    ErrorCode CPUDataProcessor::performBeamforming(const std::vector<AlignedComplexVector> &inputData,
-                                                   AlignedComplexVector &beamformedData)
-    {
-        MODULE_DEBUG(CPUDataProcessor, "Performing beamforming on {} channels", inputData.size());
-
-        if (inputData.empty())
-        {
-            return SystemErrors::INVALID_PARAMETER;
-        }
-
-        // TODO: 实现高性能波束形成算法
-        // 计划实现：
-        // 1. 最小方差无失真响应（MVDR）波束形成器
-        // 2. 多重信号分类（MUSIC）算法用于到达方向估计
-        // 3. 自适应零陷波束形成用于干扰抑制
-        // 4. 子阵列处理减少计算复杂度
-        // 当前为框架实现：简单加权平均
-        beamformedData = inputData[0];
-
-        for (size_t ch = 1; ch < inputData.size(); ++ch)
-        {
-            if (inputData[ch].size() != beamformedData.size())
-            {
-                MODULE_ERROR(CPUDataProcessor, "Channel {} size mismatch", ch);
-                return DataProcessorErrors::PROCESSING_FAILED;
-            }
-
-            for (size_t i = 0; i < beamformedData.size(); ++i)
-            {
-                beamformedData[i] += inputData[ch][i];
-            }
-        }
-
-        // 归一化
-        float scale = 1.0f / inputData.size();
-        for (auto &sample : beamformedData)
-        {
-            sample *= scale;
-        }
-
-        return SystemErrors::SUCCESS;
-    }
-
     /**
      * @brief 获取当前CPU使用率
      * @return CPU使用率百分比（0.0-100.0）
@@ -360,27 +238,17 @@ namespace radar
      * @param packet 要处理的数据包
      * @return 估算的内存使用量（字节）
      *
-     * @note 当前使用简单的倍数估算，实际部署时需要精确测量
-     * @todo 实现基于历史数据的动态内存使用预测
-     * @todo 支持不同处理策略的内存使用模型
-     * @todo 集成内存池管理减少分配开销
+     * @note 中间结果大小取自阶段图实际预分配的缓冲区
      */
     size_t CPUDataProcessor::estimateMemoryUsage(const RawDataPacketPtr &packet) const
     {
         if (!packet)
             return 0;
 
-        // TODO: 实现精确的内存使用量计算
-        // 计划改进：
-        // 1. 基于实际算法复杂度的内存模型
-        // 2. 考虑SIMD指令的内存对齐要求
-        // 3. 动态调整内存池大小以优化性能
-        // 4. 支持流式处理减少峰值内存使用
-        // 当前使用简化的估算模型
-        // 估算内存使用量：输入数据 + 中间结果 + 输出数据
+        // 输入数据 + 阶段图预分配的中间缓冲区 + 输出结果
         size_t baseSize = packet->getDataSize();
-        size_t intermediateSize = baseSize * 3; // FFT、滤波、检测的中间结果
-        size_t outputSize = baseSize;           // 输出结果大小
+        size_t intermediateSize = stageGraph_.getBufferBytes();
+        size_t outputSize = baseSize;
 
         return baseSize + intermediateSize + outputSize;
     }
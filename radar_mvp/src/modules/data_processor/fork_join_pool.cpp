@@ -0,0 +1,199 @@
+/**
+ * @file fork_join_pool.cpp
+ * @brief 分叉-汇合线程池实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/data_processor/fork_join_pool.h"
+
+#include <algorithm>
+
+namespace radar
+{
+
+    ForkJoinPool::ForkJoinPool(uint32_t workerCount, const ThreadPlacementConfig &placement, const std::string &name)
+    {
+        if (workerCount == 0)
+        {
+            const uint32_t hardware = std::thread::hardware_concurrency();
+            workerCount = hardware > 1 ? hardware - 1 : 1;
+        }
+
+        workers_.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            workers_.emplace_back([this, placement, name, i]()
+                                  {
+                if (hasThreadPlacement(placement))
+                {
+                    applyThreadPlacement(placement, name + "-" + std::to_string(i + 1), i + 1);
+                }
+                workerLoop(); });
+        }
+    }
+
+    ForkJoinPool::~ForkJoinPool()
+    {
+        stopping_.store(true);
+        jobsAvailable_.notifyAll();
+
+        for (auto &worker : workers_)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+
+    ErrorCode ForkJoinPool::parallelFor(uint32_t count, const RangeFunction &body, uint32_t maxChunks)
+    {
+        if (count == 0)
+        {
+            return SystemErrors::SUCCESS;
+        }
+
+        // 每个参与线程约4块，兼顾负载均衡与认领开销
+        const uint32_t participants = static_cast<uint32_t>(workers_.size()) + 1;
+        uint32_t chunkCount = maxChunks > 0 ? maxChunks : participants * 4;
+        chunkCount = std::min(chunkCount, count);
+
+        if (chunkCount <= 1)
+        {
+            return body(0, count);
+        }
+
+        auto job = std::make_shared<Job>();
+        job->body = &body;
+        job->count = count;
+        job->chunkSize = (count + chunkCount - 1) / chunkCount;
+        job->chunkCount = (count + job->chunkSize - 1) / job->chunkSize;
+
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex_);
+            jobs_.push_back(job);
+            jobCount_.fetch_add(1, std::memory_order_release);
+        }
+        // 调用线程自己认领一块，其余块一次系统调用唤醒至多chunkCount-1个工作线程
+        jobsAvailable_.notifyMany(job->chunkCount - 1);
+
+        // 调用线程参与执行
+        while (runChunk(*job))
+        {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex_);
+            auto it = std::find(jobs_.begin(), jobs_.end(), job);
+            if (it != jobs_.end())
+            {
+                jobs_.erase(it);
+                jobCount_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        // 汇合：等待其他线程认领的块完成；剩余块通常很快完成，先自旋再休眠
+        job->done.await([&job]()
+                        { return job->doneChunks.load(std::memory_order_acquire) == job->chunkCount; });
+
+        return job->firstError.load();
+    }
+
+    uint32_t ForkJoinPool::getWorkerCount() const
+    {
+        return static_cast<uint32_t>(workers_.size());
+    }
+
+    ForkJoinPool &ForkJoinPool::getShared()
+    {
+        static ForkJoinPool sharedPool;
+        return sharedPool;
+    }
+
+    bool ForkJoinPool::runChunk(Job &job)
+    {
+        const uint32_t chunk = job.nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= job.chunkCount)
+        {
+            return false;
+        }
+
+        const uint32_t begin = chunk * job.chunkSize;
+        const uint32_t end = std::min(job.count, begin + job.chunkSize);
+
+        ErrorCode result = SystemErrors::SUCCESS;
+        try
+        {
+            result = (*job.body)(begin, end);
+        }
+        catch (...)
+        {
+            result = DataProcessorErrors::PROCESSING_FAILED;
+        }
+
+        if (result != SystemErrors::SUCCESS)
+        {
+            ErrorCode expected = SystemErrors::SUCCESS;
+            job.firstError.compare_exchange_strong(expected, result);
+        }
+
+        if (job.doneChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == job.chunkCount)
+        {
+            job.done.notifyAll();
+        }
+
+        return true;
+    }
+
+    void ForkJoinPool::workerLoop()
+    {
+        while (true)
+        {
+            std::shared_ptr<Job> job;
+            jobsAvailable_.await([this, &job]()
+                                 { return takeJob(job); });
+            if (!job)
+            {
+                return;
+            }
+
+            while (runChunk(*job))
+            {
+            }
+
+            // 块已分完，从队列移除，避免其他线程重复取到
+            std::lock_guard<std::mutex> lock(jobsMutex_);
+            if (!jobs_.empty() && jobs_.front() == job)
+            {
+                jobs_.pop_front();
+                jobCount_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool ForkJoinPool::takeJob(std::shared_ptr<Job> &job)
+    {
+        if (stopping_.load())
+        {
+            job.reset();
+            return true;
+        }
+        if (jobCount_.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(jobsMutex_);
+        if (jobs_.empty())
+        {
+            return false;
+        }
+        job = jobs_.front();
+        return true;
+    }
+
+} // namespace radar
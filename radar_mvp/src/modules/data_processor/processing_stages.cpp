@@ -0,0 +1,448 @@
+/**
+ * @file processing_stages.cpp
+ * @brief 内置处理阶段实现
+ *
+ * 实现了加窗、FFT、数字滤波、目标检测、CFAR、波束形成等内置处理阶段，
+ * 以及按类型名称创建阶段的ProcessingStageFactory。
+ * 所有阶段均逐通道处理，只写入预分配的输出缓冲区。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/data_processor/processing_stage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace radar
+{
+
+    //==============================================================================
+    // ProcessingStageBase 实现
+    //==============================================================================
+
+    ProcessingStageBase::ProcessingStageBase(const ProcessingStageConfig &config)
+        : name_(config.name), type_(config.type), params_(config.params)
+    {
+    }
+
+    double ProcessingStageBase::getParam(const std::string &key, double defaultValue) const
+    {
+        auto it = params_.find(key);
+        return it != params_.end() ? it->second : defaultValue;
+    }
+
+    ErrorCode ProcessingStageBase::checkSingleInput(const std::vector<StageShape> &inputShapes,
+                                                    StageDataKind expectedKind) const
+    {
+        if (inputShapes.size() != 1)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        const StageShape &shape = inputShapes.front();
+        if (shape.kind != expectedKind || shape.elementCount() == 0)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // WindowStage 实现
+    //==============================================================================
+
+    ErrorCode WindowStage::negotiateShape(const std::vector<StageShape> &inputShapes,
+                                          StageShape &outputShape)
+    {
+        ErrorCode check = checkSingleInput(inputShapes, StageDataKind::COMPLEX);
+        if (check != SystemErrors::SUCCESS)
+        {
+            return check;
+        }
+
+        outputShape = inputShapes.front();
+        coefficients_.resize(outputShape.samples);
+        for (size_t i = 0; i < coefficients_.size(); ++i)
+        {
+            coefficients_[i] = dsp::hannCoefficient(i, coefficients_.size());
+        }
+        partitionCount_ = outputShape.channels;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode WindowStage::process(const std::vector<StageInput> &inputs, StageBuffer &output)
+    {
+        return processPartition(inputs, output, 0, partitionCount_);
+    }
+
+    ErrorCode WindowStage::processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                            uint32_t begin, uint32_t end)
+    {
+        const StageInput &input = inputs.front();
+        const size_t samples = input.shape.samples;
+
+        for (uint32_t ch = begin; ch < end; ++ch)
+        {
+            dsp::applyWindow(input.complexData + ch * samples, coefficients_.data(),
+                             output.complexData.data() + ch * samples, samples);
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // FFTStage 实现
+    //==============================================================================
+
+    ErrorCode FFTStage::negotiateShape(const std::vector<StageShape> &inputShapes,
+                                       StageShape &outputShape)
+    {
+        ErrorCode check = checkSingleInput(inputShapes, StageDataKind::COMPLEX);
+        if (check != SystemErrors::SUCCESS)
+        {
+            return check;
+        }
+
+        outputShape = inputShapes.front();
+        outputShape.samples = static_cast<uint32_t>(dsp::nextPowerOfTwo(outputShape.samples));
+
+        const size_t size = outputShape.samples;
+        const uint32_t bits = dsp::log2Floor(size);
+        twiddles_.resize(size / 2);
+        for (size_t k = 0; k < twiddles_.size(); ++k)
+        {
+            twiddles_[k] = dsp::makeTwiddle(k, size);
+        }
+        bitReverse_.resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            bitReverse_[i] = dsp::reverseBits(static_cast<uint32_t>(i), bits);
+        }
+
+        partitionCount_ = outputShape.channels;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode FFTStage::process(const std::vector<StageInput> &inputs, StageBuffer &output)
+    {
+        return processPartition(inputs, output, 0, partitionCount_);
+    }
+
+    /**
+     * @note 基2按时间抽取实现，采样点数不是2的幂时补零
+     * @todo 大尺寸变换可接入FFTW3或Intel MKL
+     */
+    ErrorCode FFTStage::processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                         uint32_t begin, uint32_t end)
+    {
+        const StageInput &input = inputs.front();
+        const size_t samples = input.shape.samples;
+        const size_t size = output.shape.samples;
+
+        for (uint32_t ch = begin; ch < end; ++ch)
+        {
+            dsp::fftRadix2(input.complexData + ch * samples, samples,
+                           output.complexData.data() + ch * size, size,
+                           twiddles_.data(), bitReverse_.data());
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // FilterStage 实现
+    //==============================================================================
+
+    ErrorCode FilterStage::negotiateShape(const std::vector<StageShape> &inputShapes,
+                                          StageShape &outputShape)
+    {
+        ErrorCode check = checkSingleInput(inputShapes, StageDataKind::COMPLEX);
+        if (check != SystemErrors::SUCCESS)
+        {
+            return check;
+        }
+
+        const double taps = getParam("taps", 3.0);
+        if (taps < 1.0 || static_cast<uint32_t>(taps) % 2 == 0)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        halfWidth_ = static_cast<uint32_t>(taps) / 2;
+        outputShape = inputShapes.front();
+        partitionCount_ = outputShape.channels;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode FilterStage::process(const std::vector<StageInput> &inputs, StageBuffer &output)
+    {
+        return processPartition(inputs, output, 0, partitionCount_);
+    }
+
+    /**
+     * @note 当前为框架实现，使用逐通道滑动平均；两端不足一个窗口的采样保持原值
+     * @todo 实现IIR/FIR滤波器设计工具
+     */
+    ErrorCode FilterStage::processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                            uint32_t begin, uint32_t end)
+    {
+        const StageInput &input = inputs.front();
+        const size_t samples = input.shape.samples;
+        const float scale = 1.0f / static_cast<float>(2 * halfWidth_ + 1);
+
+        for (uint32_t ch = begin; ch < end; ++ch)
+        {
+            const ComplexFloat *in = input.complexData + ch * samples;
+            ComplexFloat *out = output.complexData.data() + ch * samples;
+
+            std::copy(in, in + samples, out);
+            if (samples <= 2 * static_cast<size_t>(halfWidth_))
+            {
+                continue;
+            }
+
+            // 滑动窗口累加，每个采样点只做一次加减
+            ComplexFloat windowSum(0.0f, 0.0f);
+            for (size_t i = 0; i < 2 * static_cast<size_t>(halfWidth_) + 1; ++i)
+            {
+                windowSum += in[i];
+            }
+
+            for (size_t i = halfWidth_; i + halfWidth_ < samples; ++i)
+            {
+                out[i] = windowSum * scale;
+                if (i + halfWidth_ + 1 < samples)
+                {
+                    windowSum += in[i + halfWidth_ + 1] - in[i - halfWidth_];
+                }
+            }
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // DetectionStage 实现
+    //==============================================================================
+
+    ErrorCode DetectionStage::negotiateShape(const std::vector<StageShape> &inputShapes,
+                                             StageShape &outputShape)
+    {
+        ErrorCode check = checkSingleInput(inputShapes, StageDataKind::COMPLEX);
+        if (check != SystemErrors::SUCCESS)
+        {
+            return check;
+        }
+
+        outputShape = inputShapes.front();
+        outputShape.kind = StageDataKind::REAL;
+        partitionCount_ = outputShape.channels;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode DetectionStage::process(const std::vector<StageInput> &inputs, StageBuffer &output)
+    {
+        return processPartition(inputs, output, 0, partitionCount_);
+    }
+
+    /**
+     * @note 幅度检测；门限判决由后续的CFAR阶段完成
+     */
+    ErrorCode DetectionStage::processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                               uint32_t begin, uint32_t end)
+    {
+        const StageInput &input = inputs.front();
+        const size_t samples = input.shape.samples;
+        dsp::magnitude(input.complexData + begin * samples, output.realData.data() + begin * samples,
+                       (end - begin) * samples);
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // CFARStage 实现
+    //==============================================================================
+
+    ErrorCode CFARStage::negotiateShape(const std::vector<StageShape> &inputShapes,
+                                        StageShape &outputShape)
+    {
+        ErrorCode check = checkSingleInput(inputShapes, StageDataKind::REAL);
+        if (check != SystemErrors::SUCCESS)
+        {
+            return check;
+        }
+
+        const double train = getParam("train", 16.0);
+        const double guard = getParam("guard", 4.0);
+        const double scale = getParam("scale", 3.0);
+        const double mode = getParam("mode", 0.0);
+        if (train < 1.0 || guard < 0.0 || scale <= 0.0 || mode < 0.0 || mode > 2.0)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        train_ = static_cast<size_t>(train);
+        guard_ = static_cast<size_t>(guard);
+        scale_ = static_cast<float>(scale);
+        mode_ = static_cast<dsp::CFARMode>(static_cast<int>(mode));
+        outputShape = inputShapes.front();
+        partitionCount_ = outputShape.channels;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode CFARStage::process(const std::vector<StageInput> &inputs, StageBuffer &output)
+    {
+        return processPartition(inputs, output, 0, partitionCount_);
+    }
+
+    ErrorCode CFARStage::processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                          uint32_t begin, uint32_t end)
+    {
+        const StageInput &input = inputs.front();
+        const size_t samples = input.shape.samples;
+
+        for (uint32_t ch = begin; ch < end; ++ch)
+        {
+            dsp::cfarDetect(input.realData + ch * samples, output.realData.data() + ch * samples,
+                            samples, train_, guard_, scale_, mode_);
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // BeamformingStage 实现
+    //==============================================================================
+
+    ErrorCode BeamformingStage::negotiateShape(const std::vector<StageShape> &inputShapes,
+                                               StageShape &outputShape)
+    {
+        ErrorCode check = checkSingleInput(inputShapes, StageDataKind::COMPLEX);
+        if (check != SystemErrors::SUCCESS)
+        {
+            return check;
+        }
+
+        outputShape = inputShapes.front();
+        outputShape.channels = 1;
+        partitionCount_ = outputShape.samples;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode BeamformingStage::process(const std::vector<StageInput> &inputs, StageBuffer &output)
+    {
+        return processPartition(inputs, output, 0, partitionCount_);
+    }
+
+    /**
+     * @note 当前为框架实现：通道等权平均，按距离单元区间处理
+     * @todo 实现自适应波束形成算法（MVDR, MUSIC等）
+     */
+    ErrorCode BeamformingStage::processPartition(const std::vector<StageInput> &inputs, StageBuffer &output,
+                                                 uint32_t begin, uint32_t end)
+    {
+        const StageInput &input = inputs.front();
+        const size_t samples = input.shape.samples;
+        ComplexFloat *out = output.complexData.data();
+
+        std::copy(input.complexData + begin, input.complexData + end, out + begin);
+        for (uint32_t ch = 1; ch < input.shape.channels; ++ch)
+        {
+            const ComplexFloat *in = input.complexData + ch * samples;
+            for (size_t i = begin; i < end; ++i)
+            {
+                out[i] += in[i];
+            }
+        }
+
+        // 归一化
+        const float scale = 1.0f / static_cast<float>(input.shape.channels);
+        for (size_t i = begin; i < end; ++i)
+        {
+            out[i] *= scale;
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // ProcessingStageFactory 实现
+    //==============================================================================
+
+    namespace ProcessingStageFactory
+    {
+        namespace
+        {
+            /**
+             * @brief 阶段类型注册表
+             * @return 类型名称到创建函数的映射（首次访问时注册内置阶段）
+             */
+            std::unordered_map<std::string, StageCreator> &stageRegistry()
+            {
+                static std::unordered_map<std::string, StageCreator> registry = {
+                    {"window", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new WindowStage(config)); }},
+                    {"fft", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new FFTStage(config)); }},
+                    {"filter", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new FilterStage(config)); }},
+                    {"detect", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new DetectionStage(config)); }},
+                    {"magnitude", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new DetectionStage(config)); }},
+                    {"cfar", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new CFARStage(config)); }},
+                    {"beamform", [](const ProcessingStageConfig &config)
+                     { return ProcessingStagePtr(new BeamformingStage(config)); }}};
+                return registry;
+            }
+
+            /// 注册表互斥锁
+            std::mutex g_registryMutex;
+
+        } // anonymous namespace
+
+        ProcessingStagePtr createStage(const ProcessingStageConfig &config)
+        {
+            StageCreator creator;
+            {
+                std::lock_guard<std::mutex> lock(g_registryMutex);
+                auto &registry = stageRegistry();
+                auto it = registry.find(config.type);
+                if (it == registry.end())
+                {
+                    return nullptr;
+                }
+                creator = it->second;
+            }
+
+            return creator(config);
+        }
+
+        bool registerStageType(const std::string &type, StageCreator creator)
+        {
+            if (type.empty() || !creator)
+            {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            return stageRegistry().emplace(type, std::move(creator)).second;
+        }
+
+        bool isStageTypeAvailable(const std::string &type)
+        {
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            return stageRegistry().count(type) > 0;
+        }
+
+    } // namespace ProcessingStageFactory
+
+} // namespace radar
@@ -3,7 +3,7 @@
  * @brief 数据处理器工厂实现
  *
  * 实现了数据处理器的工厂类DataProcessorFactory，提供统一的
- * 创建接口，支持CPU、GPU、混合处理器的创建和管理。
+ * 创建接口，支持CPU、GPU、混合处理器以及编译期流水线处理器的创建和管理。
  *
  * @author Kelin
  * @version 1.0
@@ -113,6 +113,48 @@ namespace radar
             }
         }
 
+        /**
+         * @brief 创建编译期流水线数据处理器实例
+         * @param config 处理器配置参数
+         * @param logger 日志记录器，可选参数
+         * @return std::unique_ptr<ProductionPipelineProcessor> 处理器智能指针
+         * @retval nullptr 创建或配置失败
+         * @retval 有效指针 创建成功的处理器实例
+         *
+         * @note 处理链在编译期固定为pipeline::ProductionPipeline，配置中的pipelineStages不生效
+         */
+        std::unique_ptr<ProductionPipelineProcessor> createStaticPipelineProcessor(
+            const DataProcessorConfig &config,
+            std::shared_ptr<spdlog::logger> logger)
+        {
+            try
+            {
+                auto processor = std::make_unique<ProductionPipelineProcessor>(logger);
+
+                ErrorCode configResult = processor->configure(config);
+                if (configResult != SystemErrors::SUCCESS)
+                {
+                    if (logger)
+                    {
+                        MODULE_ERROR(DataProcessorFactory, "Failed to configure static pipeline processor: {}",
+                                     configResult);
+                    }
+                    return nullptr;
+                }
+
+                return processor;
+            }
+            catch (const std::exception &e)
+            {
+                if (logger)
+                {
+                    MODULE_ERROR(DataProcessorFactory, "Exception creating static pipeline processor: {}",
+                                 e.what());
+                }
+                return nullptr;
+            }
+        }
+
         /**
          * @brief 创建指定类型的数据处理器
          * @param processorType 处理器类型（CPU、GPU或混合）
@@ -153,6 +195,9 @@ namespace radar
                     return createCPUProcessor(config, logger);
                 }
 
+            case ProcessorType::STATIC_PIPELINE_PROCESSOR:
+                return createStaticPipelineProcessor(config, logger);
+
             default:
                 if (logger)
                 {
@@ -170,7 +215,7 @@ namespace radar
          * @retval true 处理器硬件可用且支持
          * @retval false 处理器硬件不可用或不支持
          *
-         * @note CPU处理器总是可用的
+         * @note CPU处理器和编译期流水线处理器总是可用的
          * @note GPU处理器需要检查CUDA设备可用性
          * @note 混合处理器的可用性等同于GPU处理器
          */
@@ -179,6 +224,7 @@ namespace radar
             switch (processorType)
             {
             case ProcessorType::CPU_PROCESSOR:
+            case ProcessorType::STATIC_PIPELINE_PROCESSOR:
                 return true; // CPU处理器总是可用，无需额外硬件支持
 
             case ProcessorType::GPU_PROCESSOR:
@@ -0,0 +1,655 @@
+/**
+ * @file stage_graph.cpp
+ * @brief 处理阶段图（DAG）执行器实现
+ *
+ * 实现了阶段图的构建（依赖解析、禁用阶段旁路、拓扑排序）、
+ * 形状协商与缓冲区预分配、按拓扑顺序执行（大工作量阶段包内并行，
+ * 过载时按降级选项跳过可选阶段、缩减通道或抽取采样点）以及逐阶段耗时统计。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/data_processor/stage_graph.h"
+#include "common/config_manager.h"
+#include "common/logger.h"
+
+// 防止Windows宏定义与枚举值冲突
+#ifdef ERROR
+#undef ERROR
+#endif
+
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <queue>
+#include <set>
+#include <unordered_map>
+
+namespace radar
+{
+
+    StageGraph::StageGraph() = default;
+
+    StageGraph::~StageGraph() = default;
+
+    //==============================================================================
+    // 图构建
+    //==============================================================================
+
+    ErrorCode StageGraph::build(const std::vector<ProcessingStageConfig> &stageConfigs)
+    {
+        std::unordered_map<std::string, size_t> configIndex;
+        for (size_t i = 0; i < stageConfigs.size(); ++i)
+        {
+            const auto &config = stageConfigs[i];
+            if (config.name.empty() || config.type.empty())
+            {
+                MODULE_ERROR(StageGraph, "Stage #{} has empty name or type", i);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            if (config.name == INPUT_NODE_NAME)
+            {
+                MODULE_ERROR(StageGraph, "Stage name '{}' is reserved", config.name);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            if (!configIndex.emplace(config.name, i).second)
+            {
+                MODULE_ERROR(StageGraph, "Duplicate stage name '{}'", config.name);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+        }
+
+        // 解析输入来源：禁用阶段被旁路到它自身的（唯一）输入
+        // 返回值：-1表示原始输入，>=0为启用阶段的配置索引，-2表示错误
+        auto resolveSource = [&](const std::string &inputName) -> long
+        {
+            std::string current = inputName;
+            std::set<std::string> visited;
+            while (current != INPUT_NODE_NAME)
+            {
+                auto it = configIndex.find(current);
+                if (it == configIndex.end())
+                {
+                    MODULE_ERROR(StageGraph, "Unknown stage input '{}'", current);
+                    return -2;
+                }
+
+                const auto &config = stageConfigs[it->second];
+                if (config.enabled)
+                {
+                    return static_cast<long>(it->second);
+                }
+
+                if (config.inputs.size() != 1 || !visited.insert(current).second)
+                {
+                    MODULE_ERROR(StageGraph, "Disabled stage '{}' cannot be bypassed", current);
+                    return -2;
+                }
+                current = config.inputs.front();
+            }
+            return -1;
+        };
+
+        // 收集启用阶段的依赖关系
+        std::vector<size_t> enabledStages;
+        std::unordered_map<size_t, std::vector<long>> sources;
+        std::unordered_map<size_t, size_t> pendingDeps;
+        std::unordered_map<size_t, std::vector<size_t>> dependents;
+
+        for (size_t i = 0; i < stageConfigs.size(); ++i)
+        {
+            const auto &config = stageConfigs[i];
+            if (!config.enabled)
+            {
+                continue;
+            }
+
+            if (config.inputs.empty())
+            {
+                MODULE_ERROR(StageGraph, "Stage '{}' has no inputs", config.name);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            enabledStages.push_back(i);
+            pendingDeps[i] = 0;
+            for (const auto &inputName : config.inputs)
+            {
+                long source = resolveSource(inputName);
+                if (source == -2)
+                {
+                    return SystemErrors::CONFIGURATION_ERROR;
+                }
+
+                sources[i].push_back(source);
+                if (source >= 0)
+                {
+                    pendingDeps[i]++;
+                    dependents[static_cast<size_t>(source)].push_back(i);
+                }
+            }
+        }
+
+        if (enabledStages.empty())
+        {
+            MODULE_ERROR(StageGraph, "Processing pipeline has no enabled stages");
+            return SystemErrors::CONFIGURATION_ERROR;
+        }
+
+        // Kahn拓扑排序，同层按配置顺序执行
+        std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> ready;
+        for (size_t index : enabledStages)
+        {
+            if (pendingDeps[index] == 0)
+            {
+                ready.push(index);
+            }
+        }
+
+        std::vector<size_t> order;
+        while (!ready.empty())
+        {
+            size_t index = ready.top();
+            ready.pop();
+            order.push_back(index);
+            for (size_t dependent : dependents[index])
+            {
+                if (--pendingDeps[dependent] == 0)
+                {
+                    ready.push(dependent);
+                }
+            }
+        }
+
+        if (order.size() != enabledStages.size())
+        {
+            MODULE_ERROR(StageGraph, "Processing pipeline contains a cycle");
+            return SystemErrors::CONFIGURATION_ERROR;
+        }
+
+        // 按拓扑顺序创建节点
+        std::vector<std::unique_ptr<StageNode>> nodes;
+        std::unordered_map<size_t, int> nodePosition;
+        for (size_t index : order)
+        {
+            const auto &config = stageConfigs[index];
+            auto node = std::make_unique<StageNode>();
+
+            node->stage = ProcessingStageFactory::createStage(config);
+            if (!node->stage)
+            {
+                MODULE_ERROR(StageGraph, "Unknown stage type '{}' for stage '{}'",
+                             config.type, config.name);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            if (!parseResultField(config.output, node->resultField))
+            {
+                MODULE_ERROR(StageGraph, "Unknown output mapping '{}' for stage '{}'",
+                             config.output, config.name);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            node->optional = config.optional;
+            if (node->optional && config.inputs.size() != 1)
+            {
+                MODULE_ERROR(StageGraph, "Optional stage '{}' must have exactly one input", config.name);
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            for (long source : sources[index])
+            {
+                node->inputIndices.push_back(source < 0 ? -1 : nodePosition.at(static_cast<size_t>(source)));
+            }
+            node->inputShapes.resize(node->inputIndices.size());
+            node->inputViews.resize(node->inputIndices.size());
+
+            nodePosition[index] = static_cast<int>(nodes.size());
+            nodes.push_back(std::move(node));
+        }
+
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        nodes_ = std::move(nodes);
+        prepared_ = false;
+
+        MODULE_INFO(StageGraph, "Processing pipeline built with {} stages", nodes_.size());
+        return SystemErrors::SUCCESS;
+    }
+
+    //==============================================================================
+    // 形状协商与执行
+    //==============================================================================
+
+    ErrorCode StageGraph::prepare(const StageShape &inputShape)
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        return prepareLocked(inputShape);
+    }
+
+    ErrorCode StageGraph::prepareLocked(const StageShape &inputShape)
+    {
+        prepared_ = false;
+        if (nodes_.empty())
+        {
+            return DataProcessorErrors::PROCESSOR_NOT_READY;
+        }
+
+        for (auto &node : nodes_)
+        {
+            for (size_t i = 0; i < node->inputIndices.size(); ++i)
+            {
+                const int source = node->inputIndices[i];
+                if (source < 0)
+                {
+                    node->inputShapes[i] = inputShape;
+                    node->inputViews[i] = StageInput{inputShape, nullptr, nullptr};
+                }
+                else
+                {
+                    node->inputShapes[i] = nodes_[source]->output.shape;
+                    node->inputViews[i] = nodes_[source]->output.view();
+                }
+            }
+
+            StageShape outputShape;
+            ErrorCode negotiated = node->stage->negotiateShape(node->inputShapes, outputShape);
+            if (negotiated != SystemErrors::SUCCESS)
+            {
+                MODULE_ERROR(StageGraph, "Shape negotiation failed at stage '{}' ({}x{})",
+                             node->stage->getName(), inputShape.channels, inputShape.samples);
+                return negotiated;
+            }
+
+            if (node->optional && outputShape != node->inputShapes.front())
+            {
+                MODULE_ERROR(StageGraph, "Optional stage '{}' must preserve its input shape",
+                             node->stage->getName());
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            node->output.allocate(outputShape);
+
+            node->workElements = outputShape.elementCount();
+            for (const auto &shape : node->inputShapes)
+            {
+                node->workElements = std::max<uint64_t>(node->workElements, shape.elementCount());
+            }
+        }
+
+        preparedShape_ = inputShape;
+        prepared_ = true;
+
+        MODULE_DEBUG(StageGraph, "Pipeline buffers prepared for {}x{} input",
+                     inputShape.channels, inputShape.samples);
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode StageGraph::execute(const RawDataPacket &packet, ProcessingResult &result)
+    {
+        return execute(packet, result, StageExecutionOptions());
+    }
+
+    ErrorCode StageGraph::execute(const RawDataPacket &packet, ProcessingResult &result,
+                                  const StageExecutionOptions &options)
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+
+        if (packet.iqData.size() != static_cast<size_t>(packet.channelCount) * packet.samplesPerChannel)
+        {
+            return DataProcessorErrors::INVALID_INPUT_DATA;
+        }
+
+        const uint32_t channels = options.maxChannels > 0
+                                      ? std::min(options.maxChannels, packet.channelCount)
+                                      : packet.channelCount;
+        const uint32_t decimation = std::max<uint32_t>(options.decimation, 1);
+        const uint32_t samples = packet.samplesPerChannel >= decimation
+                                     ? packet.samplesPerChannel / decimation
+                                     : packet.samplesPerChannel;
+        StageShape inputShape{StageDataKind::COMPLEX, channels, samples};
+
+        // 通道主序布局下前N个通道就是原始数据的前缀，无需拷贝；抽取时写入复用的缓冲区
+        const ComplexFloat *inputData = packet.iqData.data();
+        if (samples != packet.samplesPerChannel)
+        {
+            reducedInput_.resize(inputShape.elementCount());
+            for (uint32_t ch = 0; ch < channels; ++ch)
+            {
+                const ComplexFloat *source = packet.iqData.data() + static_cast<size_t>(ch) * packet.samplesPerChannel;
+                ComplexFloat *target = reducedInput_.data() + static_cast<size_t>(ch) * samples;
+                for (uint32_t i = 0; i < samples; ++i)
+                {
+                    target[i] = source[static_cast<size_t>(i) * decimation];
+                }
+            }
+            inputData = reducedInput_.data();
+        }
+
+        if (!prepared_ || inputShape != preparedShape_)
+        {
+            ErrorCode prepared = prepareLocked(inputShape);
+            if (prepared != SystemErrors::SUCCESS)
+            {
+                return prepared;
+            }
+        }
+
+        for (auto &node : nodes_)
+        {
+            for (size_t i = 0; i < node->inputIndices.size(); ++i)
+            {
+                if (node->inputIndices[i] < 0)
+                {
+                    node->inputViews[i].complexData = inputData;
+                }
+            }
+
+            if (node->optional && options.skipOptionalStages)
+            {
+                passThrough(*node);
+                node->skippedRuns++;
+                continue;
+            }
+
+            auto stageStart = std::chrono::high_resolution_clock::now();
+            ErrorCode stageResult = runNode(*node);
+            auto stageEnd = std::chrono::high_resolution_clock::now();
+
+            const double elapsedMs = std::chrono::duration<double, std::milli>(stageEnd - stageStart).count();
+
+            node->invocations++;
+            node->lastTimeMs = elapsedMs;
+            node->totalTimeMs += elapsedMs;
+            node->peakTimeMs = std::max(node->peakTimeMs, elapsedMs);
+
+            if (stageResult != SystemErrors::SUCCESS)
+            {
+                node->failures++;
+                MODULE_ERROR(StageGraph, "Stage '{}' failed with code 0x{:X}",
+                             node->stage->getName(), stageResult);
+                return stageResult;
+            }
+        }
+
+        for (const auto &node : nodes_)
+        {
+            if (node->resultField != ResultField::NONE)
+            {
+                exportResult(*node, result);
+            }
+        }
+
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode StageGraph::runNode(StageNode &node)
+    {
+        const uint32_t partitions = node.stage->getPartitionCount();
+        if (parallelPool_ == nullptr || partitions < 2 || node.workElements < parallelThreshold_)
+        {
+            return node.stage->process(node.inputViews, node.output);
+        }
+
+        node.parallelRuns++;
+        IProcessingStage &stage = *node.stage;
+        return parallelPool_->parallelFor(
+            partitions, [&stage, &node](uint32_t begin, uint32_t end)
+            { return stage.processPartition(node.inputViews, node.output, begin, end); });
+    }
+
+    void StageGraph::passThrough(StageNode &node)
+    {
+        const StageInput &input = node.inputViews.front();
+        StageBuffer &output = node.output;
+        if (output.shape.kind == StageDataKind::COMPLEX)
+        {
+            std::copy(input.complexData, input.complexData + output.complexData.size(),
+                      output.complexData.begin());
+        }
+        else
+        {
+            std::copy(input.realData, input.realData + output.realData.size(), output.realData.begin());
+        }
+    }
+
+    void StageGraph::setParallelExecution(ForkJoinPool *pool, uint64_t thresholdElements)
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        parallelPool_ = pool;
+        parallelThreshold_ = thresholdElements;
+    }
+
+    bool StageGraph::parseResultField(const std::string &output, ResultField &field)
+    {
+        if (output.empty())
+            field = ResultField::NONE;
+        else if (output == "range_profile")
+            field = ResultField::RANGE_PROFILE;
+        else if (output == "doppler_spectrum")
+            field = ResultField::DOPPLER_SPECTRUM;
+        else if (output == "beamformed")
+            field = ResultField::BEAMFORMED_DATA;
+        else
+            return false;
+
+        return true;
+    }
+
+    void StageGraph::exportResult(const StageNode &node, ProcessingResult &result)
+    {
+        AlignedFloatVector *target = nullptr;
+        switch (node.resultField)
+        {
+        case ResultField::RANGE_PROFILE:
+            target = &result.rangeProfile;
+            break;
+        case ResultField::DOPPLER_SPECTRUM:
+            target = &result.dopplerSpectrum;
+            break;
+        case ResultField::BEAMFORMED_DATA:
+            target = &result.beamformedData;
+            break;
+        default:
+            return;
+        }
+
+        const StageBuffer &buffer = node.output;
+        if (buffer.shape.kind == StageDataKind::REAL)
+        {
+            target->assign(buffer.realData.begin(), buffer.realData.end());
+        }
+        else
+        {
+            target->resize(buffer.complexData.size());
+            std::transform(buffer.complexData.begin(), buffer.complexData.end(), target->begin(),
+                           [](const ComplexFloat &c)
+                           { return std::abs(c); });
+        }
+    }
+
+    //==============================================================================
+    // 统计与查询
+    //==============================================================================
+
+    std::vector<StageTimingInfo> StageGraph::getStageTimings() const
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        std::vector<StageTimingInfo> timings;
+        timings.reserve(nodes_.size());
+
+        for (const auto &node : nodes_)
+        {
+            StageTimingInfo info;
+            info.stageName = node->stage->getName();
+            info.stageType = node->stage->getType();
+            info.invocations = node->invocations;
+            info.failures = node->failures;
+            info.parallelRuns = node->parallelRuns;
+            info.skippedRuns = node->skippedRuns;
+            info.optional = node->optional;
+            info.lastTimeMs = node->lastTimeMs;
+            info.totalTimeMs = node->totalTimeMs;
+            info.peakTimeMs = node->peakTimeMs;
+            info.averageTimeMs = info.invocations > 0 ? info.totalTimeMs / info.invocations : 0.0;
+            timings.push_back(std::move(info));
+        }
+
+        return timings;
+    }
+
+    void StageGraph::resetStageTimings()
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        for (auto &node : nodes_)
+        {
+            node->invocations = 0;
+            node->failures = 0;
+            node->parallelRuns = 0;
+            node->skippedRuns = 0;
+            node->lastTimeMs = 0.0;
+            node->totalTimeMs = 0.0;
+            node->peakTimeMs = 0.0;
+        }
+    }
+
+    std::vector<std::string> StageGraph::getExecutionOrder() const
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        std::vector<std::string> order;
+        order.reserve(nodes_.size());
+        for (const auto &node : nodes_)
+        {
+            order.push_back(node->stage->getName());
+        }
+        return order;
+    }
+
+    bool StageGraph::isBuilt() const
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        return !nodes_.empty();
+    }
+
+    size_t StageGraph::getBufferBytes() const
+    {
+        std::lock_guard<std::mutex> lock(executeMutex_);
+        size_t bytes = 0;
+        for (const auto &node : nodes_)
+        {
+            bytes += node->output.complexData.capacity() * sizeof(ComplexFloat);
+            bytes += node->output.realData.capacity() * sizeof(float);
+        }
+        return bytes;
+    }
+
+    //==============================================================================
+    // 配置
+    //==============================================================================
+
+    std::vector<ProcessingStageConfig> StageGraph::createDefaultConfig()
+    {
+        std::vector<ProcessingStageConfig> stages(4);
+
+        stages[0].name = "fft";
+        stages[0].type = "fft";
+        stages[0].inputs = {INPUT_NODE_NAME};
+        stages[0].output = "doppler_spectrum";
+
+        stages[1].name = "filter";
+        stages[1].type = "filter";
+        stages[1].inputs = {"fft"};
+        stages[1].params["taps"] = 3.0;
+
+        stages[2].name = "detect";
+        stages[2].type = "detect";
+        stages[2].inputs = {"filter"};
+        stages[2].output = "range_profile";
+
+        stages[3].name = "beamform";
+        stages[3].type = "beamform";
+        stages[3].inputs = {"filter"};
+        stages[3].output = "beamformed";
+
+        return stages;
+    }
+
+    ErrorCode StageGraph::parseConfig(const YAML::Node &pipelineNode,
+                                      std::vector<ProcessingStageConfig> &stageConfigs)
+    {
+        try
+        {
+            const YAML::Node stagesNode = pipelineNode["stages"];
+            if (!stagesNode || !stagesNode.IsSequence())
+            {
+                MODULE_ERROR(StageGraph, "Pipeline configuration requires a 'stages' sequence");
+                return SystemErrors::CONFIGURATION_ERROR;
+            }
+
+            std::vector<ProcessingStageConfig> parsed;
+            for (const auto &stageNode : stagesNode)
+            {
+                ProcessingStageConfig stage;
+                stage.name = stageNode["name"].as<std::string>("");
+                stage.type = stageNode["type"].as<std::string>(stage.name);
+                stage.output = stageNode["output"].as<std::string>("");
+                stage.enabled = stageNode["enabled"].as<bool>(true);
+                stage.optional = stageNode["optional"].as<bool>(false);
+
+                const YAML::Node inputsNode = stageNode["inputs"];
+                if (inputsNode && inputsNode.IsSequence())
+                {
+                    for (const auto &input : inputsNode)
+                    {
+                        stage.inputs.push_back(input.as<std::string>());
+                    }
+                }
+                else if (inputsNode && inputsNode.IsScalar())
+                {
+                    stage.inputs.push_back(inputsNode.as<std::string>());
+                }
+                else
+                {
+                    // 未声明输入时默认连接到上一个阶段，构成线性处理链
+                    stage.inputs.push_back(parsed.empty() ? INPUT_NODE_NAME : parsed.back().name);
+                }
+
+                const YAML::Node paramsNode = stageNode["params"];
+                if (paramsNode && paramsNode.IsMap())
+                {
+                    for (const auto &param : paramsNode)
+                    {
+                        stage.params[param.first.as<std::string>()] = param.second.as<double>();
+                    }
+                }
+
+                parsed.push_back(std::move(stage));
+            }
+
+            stageConfigs = std::move(parsed);
+            return SystemErrors::SUCCESS;
+        }
+        catch (const YAML::Exception &e)
+        {
+            MODULE_ERROR(StageGraph, "Failed to parse pipeline configuration: {}", e.what());
+            return SystemErrors::CONFIGURATION_ERROR;
+        }
+    }
+
+    ErrorCode StageGraph::loadConfig(std::vector<ProcessingStageConfig> &stageConfigs,
+                                     const std::string &keyPath)
+    {
+        auto pipelineNode = RADAR_CONFIG().getSubConfig(keyPath);
+        if (!pipelineNode)
+        {
+            return SystemErrors::CONFIGURATION_ERROR;
+        }
+
+        return parseConfig(*pipelineNode, stageConfigs);
+    }
+
+} // namespace radar
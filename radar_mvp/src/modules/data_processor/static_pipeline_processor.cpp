@@ -0,0 +1,113 @@
+/**
+ * @file static_pipeline_processor.cpp
+ * @brief 编译期流水线数据处理器实现
+ *
+ * 实现了StaticPipelineProcessor模板，并为生产处理链
+ * pipeline::ProductionPipeline提供显式实例化。整条处理链在本翻译单元内
+ * 展开，编译器可以将各阶段内核完全内联。
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/data_processor.h"
+#include "common/logger.h"
+
+// 防止Windows宏定义与枚举值冲突
+#ifdef ERROR
+#undef ERROR
+#endif
+
+#include <chrono>
+
+namespace radar
+{
+
+    //==============================================================================
+    // StaticPipelineProcessor 实现
+    //==============================================================================
+
+    template <typename PipelineT>
+    StaticPipelineProcessor<PipelineT>::StaticPipelineProcessor(std::shared_ptr<spdlog::logger> logger)
+        : DataProcessor(logger)
+    {
+        moduleName_ = "StaticPipelineProcessor";
+        MODULE_INFO(StaticPipelineProcessor, "Static pipeline processor created ({} stages, length {})",
+                    PipelineT::STAGE_COUNT, PipelineT::LENGTH);
+    }
+
+    template <typename PipelineT>
+    ProcessorCapabilities StaticPipelineProcessor<PipelineT>::getCapabilities() const
+    {
+        ProcessorCapabilities caps = DataProcessor::getCapabilities();
+        caps.supportsCPU = true;
+        caps.supportsGPU = false;
+        caps.supportedStrategies = {ProcessingStrategy::CPU_OPTIMIZED};
+        caps.processorInfo = "CPU radar signal processor with compile-time specialized pipeline";
+        return caps;
+    }
+
+    template <typename PipelineT>
+    bool StaticPipelineProcessor<PipelineT>::validateInputPacket(const RawDataPacketPtr &packet) const
+    {
+        if (!DataProcessor::validateInputPacket(packet))
+        {
+            return false;
+        }
+
+        if (packet->samplesPerChannel != PipelineT::LENGTH)
+        {
+            MODULE_DEBUG(StaticPipelineProcessor, "Samples per channel {} does not match pipeline length {}",
+                         packet->samplesPerChannel, PipelineT::LENGTH);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @note 逐通道执行整条处理链，输出写入rangeProfile（通道主序）
+     * @note 流水线对象持有阶段间缓冲区，执行期间加锁
+     */
+    template <typename PipelineT>
+    ProcessingResultPtr StaticPipelineProcessor<PipelineT>::executeProcessing(const RawDataPacketPtr &inputPacket)
+    {
+        static_assert(std::is_same<typename PipelineT::InputType, ComplexFloat>::value,
+                      "Pipeline input must be complex I/Q samples");
+        static_assert(std::is_same<typename PipelineT::OutputType, float>::value,
+                      "Pipeline output must be real-valued");
+
+        auto result = std::make_shared<ProcessingResult>();
+        result->sourcePacketId = inputPacket->sequenceId;
+        result->processingTime = std::chrono::high_resolution_clock::now();
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        const size_t channels = inputPacket->channelCount;
+        result->rangeProfile.resize(channels * PipelineT::LENGTH);
+        {
+            std::lock_guard<std::mutex> lock(pipelineMutex_);
+            for (size_t ch = 0; ch < channels; ++ch)
+            {
+                pipeline_.process(inputPacket->iqData.data() + ch * PipelineT::LENGTH,
+                                  result->rangeProfile.data() + ch * PipelineT::LENGTH);
+            }
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        result->statistics.processingDurationMs =
+            std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() / 1000.0;
+        result->statistics.gpuUsagePercent = 0.0;
+        result->statistics.memoryUsageBytes =
+            inputPacket->getDataSize() + sizeof(PipelineT) + result->rangeProfile.size() * sizeof(float);
+        result->processingSuccess = true;
+
+        return result;
+    }
+
+    // 生产处理链显式实例化
+    template class StaticPipelineProcessor<pipeline::ProductionPipeline>;
+
+} // namespace radar
@@ -14,6 +14,7 @@
 #include "modules/data_receiver/data_receiver_base.h"
 #include "common/logger.h"
 #include "common/error_codes.h"
+#include "common/thread_placement.h"
 
 // 防止Windows宏定义与枚举值冲突
 #ifdef ERROR
@@ -22,7 +23,7 @@
 
 #include <algorithm>
 #include <chrono>
-#include <future>
+#include <optional>
 #include <thread>
 #include <atomic>
 #include <cstring>
@@ -31,12 +32,27 @@ namespace radar
 {
     namespace modules
     {
+        namespace
+        {
+            constexpr uint32_t DROP_REPORT_INTERVAL_MS = 1000; ///< 缓冲区溢出日志的最短间隔(毫秒)
+
+            /**
+             * @brief 按配置创建接收缓冲区
+             */
+            std::unique_ptr<OverflowRing<RawDataPacketPtr>> makePacketRing(const DataReceiverConfig &config)
+            {
+                return std::make_unique<OverflowRing<RawDataPacketPtr>>(
+                    config.maxQueueSize, parseOverflowPolicy(config.overflowPolicy), config.producerThreads <= 1);
+            }
+        } // anonymous namespace
+
         //==============================================================================
         // DataReceiver 构造函数和析构函数
         //==============================================================================
 
         DataReceiver::DataReceiver(std::shared_ptr<spdlog::logger> logger)
-            : logger_(logger ? logger : spdlog::default_logger())
+            : packetRing_(makePacketRing(DataReceiverConfig{})),
+              logger_(logger ? logger : spdlog::default_logger())
         {
             if (logger_)
             {
@@ -74,9 +90,16 @@ namespace radar
               shouldStop_(other.shouldStop_.load()),
               dataCallback_(std::move(other.dataCallback_)),
               errorCallback_(std::move(other.errorCallback_)),
-              packetQueue_(std::move(other.packetQueue_)),
+              packetRing_(std::move(other.packetRing_)),
+              pendingReceives_(std::move(other.pendingReceives_)),
+              pendingReceiveCount_(other.pendingReceiveCount_.exchange(0)),
               logger_(std::move(other.logger_)),
-              config_(std::move(other.config_))
+              config_(std::move(other.config_)),
+              backpressure_(std::atomic_load(&other.backpressure_)),
+              backpressurePolicy_(other.backpressurePolicy_.load()),
+              backpressureMaxWaitMs_(other.backpressureMaxWaitMs_.load()),
+              receivedCount_(other.receivedCount_.load()),
+              droppedCount_(other.droppedCount_.load())
         {
             other.running_.store(false);
             other.shouldStop_.store(false);
@@ -98,9 +121,16 @@ namespace radar
                 shouldStop_.store(other.shouldStop_.load());
                 dataCallback_ = std::move(other.dataCallback_);
                 errorCallback_ = std::move(other.errorCallback_);
-                packetQueue_ = std::move(other.packetQueue_);
+                packetRing_ = std::move(other.packetRing_);
+                pendingReceives_ = std::move(other.pendingReceives_);
+                pendingReceiveCount_.store(other.pendingReceiveCount_.exchange(0));
                 logger_ = std::move(other.logger_);
                 config_ = std::move(other.config_);
+                std::atomic_store(&backpressure_, std::atomic_load(&other.backpressure_));
+                backpressurePolicy_.store(other.backpressurePolicy_.load());
+                backpressureMaxWaitMs_.store(other.backpressureMaxWaitMs_.load());
+                receivedCount_.store(other.receivedCount_.load());
+                droppedCount_.store(other.droppedCount_.load());
 
                 // 重置被移动对象的状态
                 other.running_.store(false);
@@ -120,6 +150,13 @@ namespace radar
             try
             {
                 config_ = std::make_unique<DataReceiverConfig>(config);
+                // 容量、溢出策略和生产者数在缓冲区构造时确定，运行中保留原缓冲区
+                if (!running_.load())
+                {
+                    packetRing_ = makePacketRing(config);
+                }
+                backpressurePolicy_.store(parseBackpressurePolicy(config.backpressurePolicy));
+                backpressureMaxWaitMs_.store(config.backpressureMaxWaitMs);
                 if (logger_)
                 {
                     logger_->info("DataReceiver configured successfully");
@@ -138,64 +175,83 @@ namespace radar
 
         ErrorCode DataReceiver::receivePacket(RawDataPacketPtr &packet, uint32_t timeoutMs)
         {
-            std::unique_lock<std::mutex> lock(packetQueueMutex_);
+            size_t receivedCount = 0;
+            return receivePackets(&packet, 1, receivedCount, timeoutMs);
+        }
 
+        ErrorCode DataReceiver::receivePackets(RawDataPacketPtr *packets, size_t maxCount, size_t &receivedCount,
+                                               uint32_t timeoutMs)
+        {
+            receivedCount = 0;
+            if (!packets || maxCount == 0)
+            {
+                return SystemErrors::INVALID_PARAMETER;
+            }
+
+            // 停止时缓冲区关闭，关闭优先于缓冲区中的数据，与停止后不再交付数据包的约定一致
             if (timeoutMs == 0)
             {
                 // 无限等待
-                packetAvailable_.wait(lock, [this]
-                                      { return !packetQueue_.empty() || shouldStop_.load(); });
+                receivedCount = packetRing_->popBatch(packets, maxCount);
             }
             else
             {
                 // 有超时等待
-                auto timeout = std::chrono::milliseconds(timeoutMs);
-                if (!packetAvailable_.wait_for(lock, timeout, [this]
-                                               { return !packetQueue_.empty() || shouldStop_.load(); }))
-                {
-                    return SystemErrors::OPERATION_TIMEOUT;
-                }
+                receivedCount = packetRing_->popBatchFor(packets, maxCount, std::chrono::milliseconds(timeoutMs));
             }
 
-            if (shouldStop_.load())
+            if (receivedCount > 0)
             {
-                return DataReceiverErrors::RECEIVER_NOT_READY;
-            }
-
-            if (!packetQueue_.empty())
-            {
-                packet = packetQueue_.front();
-                packetQueue_.pop();
                 return SystemErrors::SUCCESS;
             }
-
-            return DataReceiverErrors::RECEIVER_NOT_READY;
+            return packetRing_->isClosed() ? DataReceiverErrors::RECEIVER_NOT_READY : SystemErrors::OPERATION_TIMEOUT;
         }
 
-        std::future<RawDataPacketPtr> DataReceiver::receivePacketAsync()
+        Future<RawDataPacketPtr> DataReceiver::receivePacketAsync()
         {
-            auto promise = std::make_shared<std::promise<RawDataPacketPtr>>();
-            auto future = promise->get_future();
+            Promise<RawDataPacketPtr> promise;
+            auto future = promise.getFuture();
 
-            std::thread([this, promise]()
-                        {
-                RawDataPacketPtr packet;
-                ErrorCode result = receivePacket(packet, 0);
+            RawDataPacketPtr packet;
+            if (packetRing_->tryPop(packet))
+            {
+                promise.setValue(std::move(packet));
+                return future;
+            }
 
-                if (result == SystemErrors::SUCCESS && packet) {
-                    promise->set_value(packet);
-                } else {
-                    promise->set_exception(std::make_exception_ptr(
-                        std::runtime_error("Failed to receive packet")));
-                } })
-                .detach();
+            bool registered = false;
+            {
+                // 停止标志在锁内检查，与stop()取走全部请求互斥
+                std::lock_guard<std::mutex> lock(receiveMutex_);
+                if (!shouldStop_.load())
+                {
+                    // 顺便清理队首已被取消的请求，避免长时间无数据时请求堆积
+                    while (!pendingReceives_.empty() && pendingReceives_.front().isCancelled())
+                    {
+                        pendingReceives_.pop_front();
+                    }
+                    pendingReceives_.push_back(std::move(promise));
+                    pendingReceiveCount_.store(pendingReceives_.size(), std::memory_order_seq_cst);
+                    registered = true;
+                }
+            }
+
+            if (registered)
+            {
+                // 已登记：取走检查缓冲区之后、登记之前入队的数据包
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                drainToPendingReceives();
+                return future;
+            }
 
+            promise.setException(std::make_exception_ptr(
+                ModuleException(DataReceiverErrors::RECEIVER_NOT_READY, "Receiver is stopping")));
             return future;
         }
 
         void DataReceiver::setPacketReceivedCallback(std::function<void(RawDataPacketPtr)> callback)
         {
-            std::lock_guard<std::mutex> lock(packetQueueMutex_);
+            std::lock_guard<std::mutex> lock(receiveMutex_);
             dataCallback_ = callback;
             if (logger_)
             {
@@ -205,25 +261,24 @@ namespace radar
 
         BufferStatus DataReceiver::getBufferStatus() const
         {
-            std::lock_guard<std::mutex> lock(packetQueueMutex_);
-
             BufferStatus status{};
-            status.totalCapacity = 1000; // 默认容量
-            status.currentSize = static_cast<uint32_t>(packetQueue_.size());
+            status.totalCapacity = static_cast<uint32_t>(packetRing_->capacity());
+            status.currentSize = static_cast<uint32_t>(packetRing_->size());
             status.peakSize = status.currentSize; // 简化实现
-            status.totalReceived = 0;             // TODO: 实现统计
-            status.totalDropped = 0;              // TODO: 实现统计
+            status.totalReceived = receivedCount_.load();
+            status.totalDropped = droppedCount_.load();
 
             return status;
         }
 
-        ErrorCode DataReceiver::flushBuffer()
+        void DataReceiver::setBackpressureSignal(std::shared_ptr<const BackpressureSignal> signal)
         {
-            std::lock_guard<std::mutex> lock(packetQueueMutex_);
+            std::atomic_store(&backpressure_, std::move(signal));
+        }
 
-            size_t flushedCount = packetQueue_.size();
-            std::queue<RawDataPacketPtr> empty;
-            packetQueue_.swap(empty);
+        ErrorCode DataReceiver::flushBuffer()
+        {
+            const size_t flushedCount = packetRing_->clear();
 
             if (logger_)
             {
@@ -272,10 +327,15 @@ namespace radar
             {
                 shouldStop_.store(false);
                 running_.store(true);
+                packetRing_->reopen();
 
-                // 启动接收线程
-                receptionThread_ = std::thread([this]()
-                                               { receptionLoop(); });
+                // 启动接收线程，线程先完成放置再进入接收循环
+                const ThreadPlacementConfig placement =
+                    resolveThreadPlacement(config_->threadPlacement, "data_receiver.placement");
+                receptionThread_ = std::thread([this, placement]()
+                                               {
+                    applyThreadPlacement(placement, "DataReceiver");
+                    receptionLoop(); });
 
                 if (logger_)
                 {
@@ -310,8 +370,21 @@ namespace radar
                 shouldStop_.store(true);
                 running_.store(false);
 
-                // 通知所有等待的线程
-                packetAvailable_.notify_all();
+                // 关闭缓冲区，唤醒所有等待的消费者和block策略下等待空位的接收线程
+                packetRing_->close();
+
+                // 未完成的异步接收请求在锁外完成，续体可能再次访问接收器
+                std::deque<Promise<RawDataPacketPtr>> pending;
+                {
+                    std::lock_guard<std::mutex> lock(receiveMutex_);
+                    pending.swap(pendingReceives_);
+                    pendingReceiveCount_.store(0, std::memory_order_relaxed);
+                }
+                for (auto &promise : pending)
+                {
+                    promise.setException(std::make_exception_ptr(
+                        ModuleException(DataReceiverErrors::RECEIVER_NOT_READY, "Receiver stopped")));
+                }
 
                 // 等待接收线程结束
                 if (receptionThread_.joinable())
@@ -415,22 +488,115 @@ namespace radar
             return nullptr;
         }
 
+        ErrorCode DataReceiver::postControl(ControlLane::Action action)
+        {
+            if (!action)
+            {
+                return SystemErrors::INVALID_PARAMETER;
+            }
+
+            auto guarded = [this, action = std::move(action)]()
+            {
+                try
+                {
+                    action();
+                }
+                catch (const std::exception &e)
+                {
+                    if (logger_)
+                    {
+                        logger_->error("Control message failed: {}", e.what());
+                    }
+                    throw;
+                }
+            };
+            if (!controlLane_.post(std::move(guarded)))
+            {
+                if (logger_)
+                {
+                    logger_->warn("Control lane full, message rejected");
+                }
+                return SystemErrors::RESOURCE_UNAVAILABLE;
+            }
+            // 接收线程可能阻塞在满缓冲区上（block策略），唤醒它执行控制消息
+            if (packetRing_)
+            {
+                packetRing_->wakeBlockedProducers();
+            }
+            return SystemErrors::SUCCESS;
+        }
+
+        ControlLaneStatistics DataReceiver::getControlStatistics() const
+        {
+            return controlLane_.getStatistics();
+        }
+
         //==============================================================================
         // 受保护的辅助方法
         //==============================================================================
 
+        void DataReceiver::applyControlMessages()
+        {
+            if (controlLane_.hasPending())
+            {
+                controlLane_.drain();
+            }
+        }
+
         void DataReceiver::enqueuePacket(RawDataPacketPtr packet)
         {
             if (!packet)
                 return;
+            receivedCount_++;
+            if (config_)
+            {
+                // 多传感器共享调度器时按来源传感器分配份额
+                packet->sensorId = config_->sensorId;
+            }
+
+            // 下游积压时在边缘节流或丢弃，不把积压推进接收队列和调度器
+            const auto backpressure = std::atomic_load(&backpressure_);
+            if (backpressure &&
+                !backpressure->admitUpstream(backpressurePolicy_.load(std::memory_order_relaxed),
+                                             std::chrono::milliseconds(backpressureMaxWaitMs_.load(std::memory_order_relaxed))))
+            {
+                droppedCount_++;
+                backpressureDrops_.add();
+                const uint64_t drops = backpressureDrops_.takeToReport(std::chrono::milliseconds(DROP_REPORT_INTERVAL_MS));
+                if (drops > 0 && logger_)
+                {
+                    logger_->warn("Downstream backpressure, {} packets dropped at the edge", drops);
+                }
+                return;
+            }
 
+            // 缓冲区满时在环形缓冲区内按溢出策略处理，溢出日志限频输出
+            // block策略下等待空位期间仍执行控制消息，下游停滞时控制通道不被阻塞
+            const RingPushResult result = packetRing_->push(packet, [this]()
+                                                            { return controlLane_.hasPending(); },
+                                                            [this]()
+                                                            { applyControlMessages(); });
+            if (result != RingPushResult::QUEUED)
             {
-                std::lock_guard<std::mutex> lock(packetQueueMutex_);
-                packetQueue_.push(packet);
+                droppedCount_++;
+                const uint64_t drops = packetRing_->takeDropsToReport(std::chrono::milliseconds(DROP_REPORT_INTERVAL_MS));
+                if (drops > 0 && logger_)
+                {
+                    logger_->warn("Receive buffer overflow ({}), {} packets dropped",
+                                  getOverflowPolicyName(packetRing_->getPolicy()), drops);
+                }
+                if (result != RingPushResult::QUEUED_DROPPED_OLDEST)
+                {
+                    return;
+                }
             }
 
-            // 通知等待的线程
-            packetAvailable_.notify_one();
+            // 与receivePacketAsync()的登记配对：要么这里看到请求，要么请求方登记后看到数据包
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (pendingReceiveCount_.load(std::memory_order_relaxed) > 0)
+            {
+                drainToPendingReceives();
+            }
 
             // 调用用户回调
             if (dataCallback_)
@@ -456,6 +622,42 @@ namespace radar
             return packet;
         }
 
+        void DataReceiver::drainToPendingReceives()
+        {
+            RawDataPacketPtr packet;
+            for (;;)
+            {
+                std::optional<Promise<RawDataPacketPtr>> waiter;
+                {
+                    std::lock_guard<std::mutex> lock(receiveMutex_);
+                    while (!pendingReceives_.empty() && pendingReceives_.front().isCancelled())
+                    {
+                        pendingReceives_.pop_front();
+                    }
+                    if (pendingReceives_.empty() || (!packet && !packetRing_->tryPop(packet)))
+                    {
+                        pendingReceiveCount_.store(pendingReceives_.size(), std::memory_order_relaxed);
+                        break;
+                    }
+                    waiter.emplace(std::move(pendingReceives_.front()));
+                    pendingReceives_.pop_front();
+                    pendingReceiveCount_.store(pendingReceives_.size(), std::memory_order_relaxed);
+                }
+
+                // 在锁外完成，续体可能再次调用receivePacketAsync；交付前被取消则交给下一个请求
+                if (waiter->setValue(packet))
+                {
+                    packet.reset();
+                }
+            }
+
+            if (packet)
+            {
+                // 已取出的数据包不能放回单生产者缓冲区，唯一的请求恰好在交付前取消时计为丢弃
+                droppedCount_++;
+            }
+        }
+
         bool DataReceiver::validateRawData(const uint8_t *data, size_t size) const
         {
             return data != nullptr && size > 0;
@@ -52,6 +52,9 @@ namespace radar
                 // TODO: 实现实际的文件读取逻辑
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
+                // 相邻两个数据包之间执行控制消息
+                applyControlMessages();
+
                 // 模拟接收数据包
                 const size_t dataSize = 1024;
                 auto buffer = std::make_unique<uint8_t[]>(dataSize);
@@ -18,6 +18,7 @@
 #include "modules/data_receiver/hardware_receiver.h"
 #include "modules/data_receiver/data_receiver_implementations.h"
 #include "common/logger.h"
+#include "common/thread_placement.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -30,6 +31,7 @@
 #include <condition_variable>
 #include <future>
 #include <functional>
+#include <optional>
 
 namespace radar::modules
 {
@@ -67,6 +69,9 @@ namespace radar::modules
             // TODO: 实现实际的硬件接收逻辑
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
+            // 相邻两个数据包之间执行控制消息
+            applyControlMessages();
+
             // 模拟接收数据包
             const size_t dataSize = 1024;
             auto buffer = std::make_unique<uint8_t[]>(dataSize);
@@ -204,6 +209,8 @@ namespace radar
               isReceiving_(false),
               shouldStop_(false),
               hardwareDevice_(nullptr, [](void *) {}),
+              buffer_(std::make_unique<OverflowRing<RawDataPacketPtr>>(
+                  config_.maxQueueSize, parseOverflowPolicy(config_.overflowPolicy), true)),
               packetsReceived_(0),
               packetsDropped_(0),
               bytesReceived_(0),
@@ -315,6 +322,7 @@ namespace radar
             // 重置控制标志
             shouldStop_ = false;
             isReceiving_ = true;
+            buffer_->reopen();
 
             // 启动接收线程
             receiverThread_ = std::thread(&HardwareReceiver::receiverThreadFunction, this);
@@ -339,9 +347,9 @@ namespace radar
             shouldStop_ = true;
             isReceiving_ = false;
 
-            // 通知所有等待的线程
-            bufferNotEmpty_.notify_all();
-            bufferNotFull_.notify_all();
+            // 关闭缓冲区，唤醒所有等待的消费者和block策略下等待空位的接收线程
+            buffer_->close();
+            failPendingReceives();
 
             // 等待线程结束
             if (receiverThread_.joinable())
@@ -396,7 +404,6 @@ namespace radar
 
             isReceiving_ = true;
             setState(ModuleState::RUNNING);
-            bufferNotFull_.notify_all();
 
             MODULE_INFO(DataReceiver, "HardwareReceiver resumed");
 
@@ -420,13 +427,7 @@ namespace radar
             }
 
             // 清理缓冲区
-            {
-                std::lock_guard<std::mutex> lock(bufferMutex_);
-                while (!dataBuffer_.empty())
-                {
-                    dataBuffer_.pop();
-                }
-            }
+            buffer_->clear();
 
             // 清理线程池
             receiverThreadPool_.reset();
@@ -475,6 +476,13 @@ namespace radar
             }
 
             config_ = config;
+            backpressurePolicy_ = parseBackpressurePolicy(config.backpressurePolicy);
+
+            // 容量、溢出策略和生产者数在缓冲区构造时确定，接收线程未运行时按新配置重建
+            if (state_ == ModuleState::READY)
+            {
+                initializeBuffer();
+            }
 
             // 重新初始化（如果需要）
             if (state_ != ModuleState::UNINITIALIZED)
@@ -489,56 +497,75 @@ namespace radar
 
         ErrorCode HardwareReceiver::receivePacket(RawDataPacketPtr &packet, uint32_t timeoutMs)
         {
-            // 检查状态
-            if (state_ != ModuleState::RUNNING && state_ != ModuleState::PAUSED)
+            size_t receivedCount = 0;
+            return receivePackets(&packet, 1, receivedCount, timeoutMs);
+        }
+
+        ErrorCode HardwareReceiver::receivePackets(RawDataPacketPtr *packets, size_t maxCount,
+                                                   size_t &receivedCount, uint32_t timeoutMs)
+        {
+            receivedCount = 0;
+            if (!packets || maxCount == 0)
             {
-                return DataReceiverErrors::RECEIVER_NOT_READY;
+                return SystemErrors::INVALID_PARAMETER;
             }
 
-            std::unique_lock<std::mutex> lock(bufferMutex_);
-
-            // 等待数据或超时
-            auto waitResult = bufferNotEmpty_.wait_for(
-                lock,
-                std::chrono::milliseconds(timeoutMs),
-                [this]
-                { return !dataBuffer_.empty() || shouldStop_; });
-
-            if (shouldStop_)
+            // 检查状态
+            if (state_ != ModuleState::RUNNING && state_ != ModuleState::PAUSED)
             {
-                return SystemErrors::OPERATION_TIMEOUT;
+                return DataReceiverErrors::RECEIVER_NOT_READY;
             }
 
-            if (!waitResult)
+            // 只为第一个数据包等待（先自旋再休眠），停止时缓冲区关闭并立即返回
+            receivedCount = buffer_->popBatchFor(packets, maxCount, std::chrono::milliseconds(timeoutMs));
+            if (receivedCount == 0)
             {
                 return SystemErrors::OPERATION_TIMEOUT;
             }
 
-            // 从缓冲区取出数据包
-            packet = dataBuffer_.front();
-            dataBuffer_.pop();
-
-            // 通知生产者线程
-            bufferNotFull_.notify_one();
-
-            // 更新统计
             performanceMonitor_.lastReceiveTime = std::chrono::high_resolution_clock::now();
-
             return SystemErrors::SUCCESS;
         }
 
-        std::future<RawDataPacketPtr> HardwareReceiver::receivePacketAsync()
+        Future<RawDataPacketPtr> HardwareReceiver::receivePacketAsync()
         {
-            return std::async(std::launch::async, [this]() -> RawDataPacketPtr
-                              {
-        RawDataPacketPtr packet;
-        ErrorCode result = receivePacket(packet, 0);  // 无限等待
+            Promise<RawDataPacketPtr> promise;
+            auto future = promise.getFuture();
 
-        if (isSuccess(result)) {
-            return packet;
-        }
+            RawDataPacketPtr packet;
+            if (buffer_->tryPop(packet))
+            {
+                promise.setValue(std::move(packet));
+                return future;
+            }
+
+            bool registered = false;
+            {
+                std::lock_guard<std::mutex> lock(pendingMutex_);
+                if (!shouldStop_)
+                {
+                    // 没有数据时登记请求，由接收线程在下一个数据包到达时直接完成
+                    while (!pendingReceives_.empty() && pendingReceives_.front().isCancelled())
+                    {
+                        pendingReceives_.pop_front();
+                    }
+                    pendingReceives_.push_back(std::move(promise));
+                    pendingReceiveCount_.store(pendingReceives_.size(), std::memory_order_seq_cst);
+                    registered = true;
+                }
+            }
 
-        return nullptr; });
+            if (registered)
+            {
+                // 取走检查缓冲区之后、登记之前入队的数据包
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                drainToPendingReceives();
+                return future;
+            }
+
+            promise.setException(std::make_exception_ptr(
+                ModuleException(DataReceiverErrors::RECEIVER_NOT_READY, "Receiver is stopping")));
+            return future;
         }
 
         void HardwareReceiver::setPacketReceivedCallback(
@@ -553,11 +580,9 @@ namespace radar
 
         BufferStatus HardwareReceiver::getBufferStatus() const
         {
-            std::lock_guard<std::mutex> lock(bufferMutex_);
-
             BufferStatus status;
-            status.totalCapacity = config_.maxQueueSize;
-            status.currentSize = static_cast<uint32_t>(dataBuffer_.size());
+            status.totalCapacity = static_cast<uint32_t>(buffer_->capacity());
+            status.currentSize = static_cast<uint32_t>(buffer_->size());
             status.peakSize = static_cast<uint32_t>(performanceMonitor_.peakBufferSize);
             status.totalReceived = packetsReceived_;
             status.totalDropped = packetsDropped_;
@@ -565,19 +590,52 @@ namespace radar
             return status;
         }
 
-        ErrorCode HardwareReceiver::flushBuffer()
+        void HardwareReceiver::setBackpressureSignal(std::shared_ptr<const BackpressureSignal> signal)
         {
-            std::lock_guard<std::mutex> lock(bufferMutex_);
+            std::atomic_store(&backpressure_, std::move(signal));
+        }
 
-            MODULE_WARN(DataReceiver, "Flushing buffer, {} packets will be dropped",
-                        dataBuffer_.size());
+        ErrorCode HardwareReceiver::postControl(ControlLane::Action action)
+        {
+            if (!action)
+            {
+                return SystemErrors::INVALID_PARAMETER;
+            }
 
-            while (!dataBuffer_.empty())
+            auto guarded = [action = std::move(action)]()
             {
-                dataBuffer_.pop();
+                try
+                {
+                    action();
+                }
+                catch (const std::exception &e)
+                {
+                    MODULE_ERROR(DataReceiver, "Control message failed: {}", e.what());
+                    throw;
+                }
+            };
+            if (!controlLane_.post(std::move(guarded)))
+            {
+                MODULE_WARN(DataReceiver, "Control lane full, message rejected");
+                return SystemErrors::RESOURCE_UNAVAILABLE;
             }
+            // 采集线程可能阻塞在满缓冲区上（block策略），唤醒它执行控制消息
+            if (buffer_)
+            {
+                buffer_->wakeBlockedProducers();
+            }
+            return SystemErrors::SUCCESS;
+        }
 
-            bufferNotFull_.notify_all();
+        ControlLaneStatistics HardwareReceiver::getControlStatistics() const
+        {
+            return controlLane_.getStatistics();
+        }
+
+        ErrorCode HardwareReceiver::flushBuffer()
+        {
+            const size_t flushedCount = buffer_->clear();
+            MODULE_WARN(DataReceiver, "Buffer flushed, {} packets dropped", flushedCount);
 
             return SystemErrors::SUCCESS;
         }
@@ -680,6 +738,7 @@ namespace radar
                 packet->timestamp = std::chrono::high_resolution_clock::now();
                 packet->sequenceId = ++lastSequenceId_;
                 packet->priority = PacketPriority::NORMAL;
+                packet->sensorId = config_.sensorId;
 
                 // 4. 验证数据完整性
                 if (!packet->isValid())
@@ -731,6 +790,7 @@ namespace radar
             packet->timestamp = std::chrono::high_resolution_clock::now();
             packet->sequenceId = ++lastSequenceId_;
             packet->priority = PacketPriority::NORMAL;
+            packet->sensorId = config_.sensorId;
             packet->channelCount = 4; // 模拟4通道
             packet->samplesPerChannel = config_.packetSizeBytes / (sizeof(ComplexFloat) * packet->channelCount);
 
@@ -836,78 +896,132 @@ namespace radar
             MODULE_INFO(DataReceiver, "Initializing receive buffer with size {}",
                         config_.maxQueueSize);
 
-            // 清空缓冲区
-            while (!dataBuffer_.empty())
+            // 环形缓冲区在构造时一次分配全部槽位（容量向上取整到2的幂），运行中不再分配
+            const OverflowPolicy policy = parseOverflowPolicy(config_.overflowPolicy);
+            buffer_ = std::make_unique<OverflowRing<RawDataPacketPtr>>(
+                config_.maxQueueSize, policy, config_.producerThreads <= 1);
+
+            MODULE_DEBUG(DataReceiver, "Receive buffer: capacity {}, overflow policy {}, {} producer",
+                         buffer_->capacity(), getOverflowPolicyName(policy),
+                         buffer_->isSingleProducer() ? "single" : "multi");
+
+            return SystemErrors::SUCCESS;
+        }
+
+        void HardwareReceiver::drainToPendingReceives()
+        {
+            RawDataPacketPtr packet;
+            while (true)
             {
-                dataBuffer_.pop();
+                std::optional<Promise<RawDataPacketPtr>> waiter;
+                {
+                    std::lock_guard<std::mutex> lock(pendingMutex_);
+                    while (!pendingReceives_.empty() && pendingReceives_.front().isCancelled())
+                    {
+                        pendingReceives_.pop_front();
+                    }
+                    if (pendingReceives_.empty() || (!packet && !buffer_->tryPop(packet)))
+                    {
+                        pendingReceiveCount_.store(pendingReceives_.size(), std::memory_order_relaxed);
+                        break;
+                    }
+                    waiter.emplace(std::move(pendingReceives_.front()));
+                    pendingReceives_.pop_front();
+                    pendingReceiveCount_.store(pendingReceives_.size(), std::memory_order_relaxed);
+                }
+
+                // 在锁外完成，续体可能再次调用receivePacketAsync；交付前被取消则换下一个请求
+                if (waiter->setValue(packet))
+                {
+                    performanceMonitor_.lastReceiveTime = std::chrono::high_resolution_clock::now();
+                    packet.reset();
+                }
             }
 
-            // 预分配内存（可选，用于减少运行时分配）
-            // 这里使用队列，不需要预分配
+            if (packet)
+            {
+                // 已取出的数据包不能放回单生产者缓冲区，唯一的请求恰好在交付前取消时计为丢弃
+                packetsDropped_++;
+            }
+        }
 
-            return SystemErrors::SUCCESS;
+        void HardwareReceiver::failPendingReceives()
+        {
+            std::deque<Promise<RawDataPacketPtr>> pending;
+            {
+                std::lock_guard<std::mutex> lock(pendingMutex_);
+                pending.swap(pendingReceives_);
+                pendingReceiveCount_.store(0, std::memory_order_relaxed);
+            }
+            for (auto &promise : pending)
+            {
+                promise.setException(std::make_exception_ptr(
+                    ModuleException(DataReceiverErrors::RECEIVER_NOT_READY, "Receiver stopped")));
+            }
         }
 
         bool HardwareReceiver::pushToBuffer(RawDataPacketPtr packet)
         {
-            std::unique_lock<std::mutex> lock(bufferMutex_);
-
-            // 检查缓冲区是否已满
-            if (dataBuffer_.size() >= config_.maxQueueSize)
+            // 下游积压时节流采集线程，或在进入缓冲区之前丢弃
+            const auto backpressure = std::atomic_load(&backpressure_);
+            if (backpressure &&
+                !backpressure->admitUpstream(backpressurePolicy_.load(std::memory_order_relaxed),
+                                             std::chrono::milliseconds(config_.backpressureMaxWaitMs)))
             {
-                // 根据溢出策略处理
-                if (config_.overflowPolicy == "drop_oldest")
+                packetsDropped_++;
+                backpressureDrops_.add();
+                const uint64_t drops = backpressureDrops_.takeToReport(std::chrono::milliseconds(DROP_REPORT_INTERVAL_MS));
+                if (drops > 0)
                 {
-                    // 丢弃最旧的数据包
-                    dataBuffer_.pop();
-                    packetsDropped_++;
-                    MODULE_WARN(DataReceiver, "Buffer overflow, dropping oldest packet");
+                    MODULE_WARN(DataReceiver, "Downstream backpressure, {} packets dropped at the edge", drops);
                 }
-                else if (config_.overflowPolicy == "drop_newest")
+                return false;
+            }
+
+            // 缓冲区满时在环形缓冲区内按溢出策略处理，溢出日志限频输出
+            // block策略下等待空位期间仍执行控制消息，下游停滞时控制通道不被阻塞
+            const RingPushResult result = buffer_->push(packet, [this]()
+                                                        { return controlLane_.hasPending(); },
+                                                        [this]()
+                                                        { controlLane_.drain(); });
+            if (result != RingPushResult::QUEUED)
+            {
+                packetsDropped_++;
+                const uint64_t drops = buffer_->takeDropsToReport(std::chrono::milliseconds(DROP_REPORT_INTERVAL_MS));
+                if (drops > 0)
                 {
-                    // 丢弃新数据包
-                    packetsDropped_++;
-                    MODULE_WARN(DataReceiver, "Buffer overflow, dropping newest packet");
-                    return false;
+                    MODULE_WARN(DataReceiver, "Buffer overflow ({}), {} packets dropped",
+                                getOverflowPolicyName(buffer_->getPolicy()), drops);
                 }
-                else
+                if (result != RingPushResult::QUEUED_DROPPED_OLDEST)
                 {
-                    // 等待缓冲区有空间
-                    bufferNotFull_.wait(lock, [this]
-                                        { return dataBuffer_.size() < config_.maxQueueSize || shouldStop_; });
-
-                    if (shouldStop_)
-                    {
-                        return false;
-                    }
+                    return false;
                 }
             }
 
-            // 添加到缓冲区
-            dataBuffer_.push(packet);
-
             // 更新统计
             packetsReceived_++;
             bytesReceived_ += packet->getDataSize();
 
             // 更新峰值
-            if (dataBuffer_.size() > performanceMonitor_.peakBufferSize)
+            const size_t bufferedCount = buffer_->size();
+            if (bufferedCount > performanceMonitor_.peakBufferSize)
             {
-                performanceMonitor_.peakBufferSize = dataBuffer_.size();
+                performanceMonitor_.peakBufferSize = bufferedCount;
             }
 
-            // 通知等待的消费者
-            bufferNotEmpty_.notify_one();
+            // 与receivePacketAsync()的登记配对：要么这里看到请求，要么请求方登记后看到数据包
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (pendingReceiveCount_.load(std::memory_order_relaxed) > 0)
+            {
+                drainToPendingReceives();
+            }
 
             // 触发回调（如果设置）
+            std::lock_guard<std::mutex> callbackLock(callbackMutex_);
             if (packetReceivedCallback_)
             {
-                lock.unlock(); // 释放锁后再调用回调
-                std::lock_guard<std::mutex> callbackLock(callbackMutex_);
-                if (packetReceivedCallback_)
-                {
-                    packetReceivedCallback_(packet);
-                }
+                packetReceivedCallback_(packet);
             }
 
             return true;
@@ -920,9 +1034,17 @@ namespace radar
         void HardwareReceiver::receiverThreadFunction()
         {
             MODULE_INFO(DataReceiver, "Receiver thread started");
+            applyThreadPlacement(resolveThreadPlacement(config_.threadPlacement, "data_receiver.placement"),
+                                 "HardwareReceiver");
 
             while (!shouldStop_)
             {
+                // 控制消息优先于数据，暂停期间同样生效
+                if (controlLane_.hasPending())
+                {
+                    controlLane_.drain();
+                }
+
                 if (!isReceiving_)
                 {
                     // 暂停状态，等待恢复
@@ -953,11 +1075,8 @@ namespace radar
 
                     if (isSuccess(result) && packet)
                     {
-                        // 添加到缓冲区
-                        if (!pushToBuffer(packet))
-                        {
-                            MODULE_WARN(DataReceiver, "Failed to push packet to buffer");
-                        }
+                        // 添加到缓冲区；丢弃已在pushToBuffer()中计数并限频报告
+                        pushToBuffer(packet);
 
                         // 更新性能统计
                         updatePerformanceMetrics();
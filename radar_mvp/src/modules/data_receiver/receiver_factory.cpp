@@ -431,6 +431,11 @@ namespace radar
                     return false;
                 }
 
+                if (config.producerThreads == 0)
+                {
+                    return false;
+                }
+
                 // 特定类型的配置验证
                 switch (receiverType)
                 {
@@ -81,6 +81,9 @@ namespace radar
             {
                 try
                 {
+                    // 相邻两个数据包之间执行控制消息
+                    applyControlMessages();
+
                     // 生成并入队数据包
                     auto packet = generateSimulatedPacket();
                     if (packet)
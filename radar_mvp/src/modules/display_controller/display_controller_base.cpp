@@ -127,6 +127,12 @@ namespace radar
             return SystemErrors::SUCCESS;
         }
 
+        void DisplayControllerBase::setThreadPlacement(const ThreadPlacementConfig &placement)
+        {
+            std::lock_guard<std::mutex> lock(configMutex_);
+            threadPlacement_ = placement;
+        }
+
         ErrorCode DisplayControllerBase::pause()
         {
             std::lock_guard<std::mutex> lock(stateMutex_);
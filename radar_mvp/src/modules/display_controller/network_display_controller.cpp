@@ -216,6 +216,12 @@ namespace radar
         void NetworkDisplayController::acceptConnectionsLoop()
         {
             RADAR_INFO("Accept connections thread started");
+            ThreadPlacementConfig placement;
+            {
+                std::lock_guard<std::mutex> lock(configMutex_);
+                placement = threadPlacement_;
+            }
+            applyThreadPlacement(resolveThreadPlacement(placement, "display_controller.placement"), moduleName_);
 
             while (running_)
             {
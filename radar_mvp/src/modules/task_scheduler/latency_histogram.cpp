@@ -0,0 +1,151 @@
+/**
+ * @file latency_histogram.cpp
+ * @brief 延迟直方图实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/task_scheduler/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace radar
+{
+
+    namespace
+    {
+        /**
+         * @brief 最高有效位的位置（value > 0）
+         */
+        inline uint32_t highestBit(uint64_t value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#else
+            uint32_t bit = 0;
+            while (value >>= 1)
+            {
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+    } // anonymous namespace
+
+    /**
+     * @note 小于32的值各占一个桶；量级m（2^m ≤ v < 2^(m+1)）的值取最高6位，
+     *       落在第(m - 4)组的32个子桶之一，组与组首尾相接
+     */
+    size_t LatencyHistogram::bucketIndex(uint64_t valueNs)
+    {
+        if (valueNs < SUB_BUCKET_COUNT)
+        {
+            return static_cast<size_t>(valueNs);
+        }
+
+        const uint32_t magnitude = highestBit(valueNs);
+        if (magnitude > MAX_MAGNITUDE)
+        {
+            return BUCKET_COUNT - 1;
+        }
+        const uint32_t shift = magnitude - SUB_BUCKET_BITS;
+        const uint64_t subBucket = (valueNs >> shift) - SUB_BUCKET_COUNT;
+        return static_cast<size_t>(shift + 1) * SUB_BUCKET_COUNT + static_cast<size_t>(subBucket);
+    }
+
+    uint64_t LatencyHistogram::bucketUpperBound(size_t index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+        {
+            return index;
+        }
+
+        const uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKET_COUNT) - 1;
+        const uint64_t subBucket = index % SUB_BUCKET_COUNT;
+        return ((SUB_BUCKET_COUNT + subBucket + 1) << shift) - 1;
+    }
+
+    void LatencyHistogram::add(const LatencyHistogram &other)
+    {
+        for (size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            increment(counts_[i], other.counts_[i].load(std::memory_order_relaxed));
+        }
+        increment(sumNs_, other.sumNs_.load(std::memory_order_relaxed));
+        const uint64_t otherMax = other.maxNs_.load(std::memory_order_relaxed);
+        if (otherMax > maxNs_.load(std::memory_order_relaxed))
+        {
+            maxNs_.store(otherMax, std::memory_order_relaxed);
+        }
+    }
+
+    void LatencyHistogram::reset()
+    {
+        for (auto &count : counts_)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+        sumNs_.store(0, std::memory_order_relaxed);
+        maxNs_.store(0, std::memory_order_relaxed);
+    }
+
+    LatencyHistogram::Snapshot::Snapshot() : counts_(BUCKET_COUNT, 0) {}
+
+    void LatencyHistogram::Snapshot::add(const LatencyHistogram &histogram)
+    {
+        for (size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            const uint64_t count = histogram.counts_[i].load(std::memory_order_relaxed);
+            counts_[i] += count;
+            count_ += count;
+        }
+        sumNs_ += histogram.sumNs_.load(std::memory_order_relaxed);
+        maxNs_ = std::max(maxNs_, histogram.maxNs_.load(std::memory_order_relaxed));
+    }
+
+    uint64_t LatencyHistogram::Snapshot::valueAtQuantile(double quantile) const
+    {
+        if (count_ == 0)
+        {
+            return 0;
+        }
+
+        // 第rank个样本（从1起）所在的桶
+        const double clamped = std::min(std::max(quantile, 0.0), 1.0);
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * count_)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += counts_[i];
+            if (seen >= rank)
+            {
+                return std::min(bucketUpperBound(i), maxNs_);
+            }
+        }
+        return maxNs_;
+    }
+
+    LatencyPercentiles LatencyHistogram::Snapshot::summarize() const
+    {
+        constexpr double NS_PER_US = 1000.0;
+
+        LatencyPercentiles summary;
+        summary.count = count_;
+        if (count_ == 0)
+        {
+            return summary;
+        }
+        summary.meanUs = static_cast<double>(sumNs_) / count_ / NS_PER_US;
+        summary.p50Us = valueAtQuantile(0.50) / NS_PER_US;
+        summary.p90Us = valueAtQuantile(0.90) / NS_PER_US;
+        summary.p99Us = valueAtQuantile(0.99) / NS_PER_US;
+        summary.p999Us = valueAtQuantile(0.999) / NS_PER_US;
+        summary.maxUs = maxNs_ / NS_PER_US;
+        return summary;
+    }
+
+} // namespace radar
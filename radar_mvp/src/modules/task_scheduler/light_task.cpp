@@ -0,0 +1,247 @@
+/**
+ * @file light_task.cpp
+ * @brief 轻量任务实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/task_scheduler/light_task.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace radar
+{
+
+    namespace
+    {
+        /// 每次与全局仓库交换的节点数
+        constexpr size_t MAGAZINE_SIZE = 64;
+
+        /// 每线程空闲链表的上限（超过后把一批节点还给全局仓库）
+        constexpr size_t LOCAL_CACHE_LIMIT = 2 * MAGAZINE_SIZE;
+
+        /// 等待前的自旋轮数
+        constexpr int WAIT_SPIN_ROUNDS = 64;
+
+        /// 等待者休眠点的分片数（按节点地址散列，避免每个节点各带一把锁）
+        constexpr size_t PARKING_STRIPES = 64;
+
+        /**
+         * @brief 全局节点仓库
+         *
+         * 生产者线程与执行线程通常不是同一个，节点会在线程之间单向流动，
+         * 仓库负责按批把多出来的节点转交给缺节点的线程。
+         */
+        struct BlockDepot
+        {
+            std::mutex mutex;           ///< 互斥锁
+            std::vector<void *> blocks; ///< 空闲节点
+        };
+
+        /**
+         * @brief 获取全局仓库
+         * @note 有意不析构：线程局部缓存在进程退出阶段仍可能归还节点
+         */
+        BlockDepot &depot()
+        {
+            static BlockDepot *instance = new BlockDepot();
+            return *instance;
+        }
+
+        /**
+         * @brief 每线程空闲链表，线程退出时把节点还给全局仓库
+         */
+        struct BlockCache
+        {
+            std::vector<void *> blocks; ///< 空闲节点
+
+            BlockCache()
+            {
+                blocks.reserve(LOCAL_CACHE_LIMIT + 1);
+            }
+
+            ~BlockCache()
+            {
+                BlockDepot &shared = depot();
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                shared.blocks.insert(shared.blocks.end(), blocks.begin(), blocks.end());
+            }
+        };
+
+        thread_local BlockCache localCache;
+
+        /// 等待者休眠点
+        struct alignas(64) ParkingStripe
+        {
+            std::mutex mutex;              ///< 互斥锁
+            std::condition_variable ready; ///< 完成通知
+        };
+
+        ParkingStripe parkingStripes[PARKING_STRIPES];
+
+        ParkingStripe &stripeFor(const void *address)
+        {
+            return parkingStripes[std::hash<const void *>()(address) % PARKING_STRIPES];
+        }
+    } // anonymous namespace
+
+    void LightTask::run()
+    {
+        std::exception_ptr error;
+        try
+        {
+            function_();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        function_.reset();
+        complete(std::move(error));
+        release();
+    }
+
+    void LightTask::discard() noexcept
+    {
+        function_.reset();
+        complete(std::make_exception_ptr(std::runtime_error("Task discarded before execution")));
+        release();
+    }
+
+    bool LightTask::isReady() const noexcept
+    {
+        return (state_.load(std::memory_order_acquire) & READY) != 0;
+    }
+
+    void LightTask::wait()
+    {
+        for (int i = 0; i < WAIT_SPIN_ROUNDS; ++i)
+        {
+            if (isReady())
+            {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        // 在休眠点锁内登记等待：完成方看到WAITING就会加同一把锁再通知，不会丢失唤醒
+        ParkingStripe &stripe = stripeFor(this);
+        std::unique_lock<std::mutex> lock(stripe.mutex);
+        if (state_.fetch_or(WAITING, std::memory_order_acq_rel) & READY)
+        {
+            return;
+        }
+        stripe.ready.wait(lock, [this]()
+                          { return isReady(); });
+    }
+
+    bool LightTask::waitFor(std::chrono::milliseconds timeout)
+    {
+        if (isReady())
+        {
+            return true;
+        }
+
+        ParkingStripe &stripe = stripeFor(this);
+        std::unique_lock<std::mutex> lock(stripe.mutex);
+        if (state_.fetch_or(WAITING, std::memory_order_acq_rel) & READY)
+        {
+            return true;
+        }
+        return stripe.ready.wait_for(lock, timeout, [this]()
+                                     { return isReady(); });
+    }
+
+    std::exception_ptr LightTask::getError() const noexcept
+    {
+        return error_;
+    }
+
+    void LightTask::release() noexcept
+    {
+        if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            this->~LightTask();
+            deallocate(this);
+        }
+    }
+
+    size_t LightTask::cachedBlockCount() noexcept
+    {
+        return localCache.blocks.size();
+    }
+
+    void LightTask::complete(std::exception_ptr error) noexcept
+    {
+        error_ = std::move(error);
+        const uint32_t previous = state_.exchange(READY, std::memory_order_acq_rel);
+        if (previous & WAITING)
+        {
+            // 同一分片上可能有其他节点的等待者，只能全部唤醒
+            ParkingStripe &stripe = stripeFor(this);
+            std::lock_guard<std::mutex> lock(stripe.mutex);
+            stripe.ready.notify_all();
+        }
+    }
+
+    void *LightTask::allocate()
+    {
+        std::vector<void *> &blocks = localCache.blocks;
+        if (blocks.empty())
+        {
+            BlockDepot &shared = depot();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            const size_t count = std::min(MAGAZINE_SIZE, shared.blocks.size());
+            blocks.insert(blocks.end(), shared.blocks.end() - count, shared.blocks.end());
+            shared.blocks.resize(shared.blocks.size() - count);
+        }
+
+        if (!blocks.empty())
+        {
+            void *memory = blocks.back();
+            blocks.pop_back();
+            return memory;
+        }
+        return ::operator new(sizeof(LightTask));
+    }
+
+    void LightTask::deallocate(void *memory) noexcept
+    {
+        std::vector<void *> &blocks = localCache.blocks;
+        if (blocks.size() >= LOCAL_CACHE_LIMIT)
+        {
+            BlockDepot &shared = depot();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.blocks.insert(shared.blocks.end(), blocks.end() - MAGAZINE_SIZE, blocks.end());
+            blocks.resize(blocks.size() - MAGAZINE_SIZE);
+        }
+        blocks.push_back(memory);
+    }
+
+    void LightTaskFuture::get()
+    {
+        if (!task_)
+        {
+            throw std::future_error(std::future_errc::no_state);
+        }
+
+        task_->wait();
+        std::exception_ptr error = task_->getError();
+        reset();
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+} // namespace radar
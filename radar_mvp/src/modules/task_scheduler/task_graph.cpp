@@ -0,0 +1,251 @@
+/**
+ * @file task_graph.cpp
+ * @brief 任务依赖图执行器实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/task_scheduler/task_graph.h"
+#include "common/logger.h"
+
+#include <stdexcept>
+
+namespace radar
+{
+
+    TaskGraph::TaskGraph(std::string name) : name_(std::move(name)) {}
+
+    TaskGraph::~TaskGraph()
+    {
+        if (running_.load(std::memory_order_acquire))
+        {
+            RADAR_ERROR("Task graph {} destroyed while running", name_);
+        }
+    }
+
+    ErrorCode TaskGraph::precede(NodeId before, NodeId after)
+    {
+        if (running_.load(std::memory_order_acquire))
+        {
+            return TaskSchedulerErrors::GRAPH_BUSY;
+        }
+        if (before >= nodes_.size() || after >= nodes_.size() || before == after)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        nodes_[before]->successors_.push_back(nodes_[after].get());
+        compiled_ = false;
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode TaskGraph::validate()
+    {
+        if (running_.load(std::memory_order_acquire))
+        {
+            return TaskSchedulerErrors::GRAPH_BUSY;
+        }
+        return compile();
+    }
+
+    /**
+     * @note Kahn拓扑排序：能依次移除全部节点则无环
+     */
+    ErrorCode TaskGraph::compile()
+    {
+        if (compiled_)
+        {
+            return SystemErrors::SUCCESS;
+        }
+
+        for (auto &node : nodes_)
+        {
+            node->dependencyCount_ = 0;
+        }
+        for (auto &node : nodes_)
+        {
+            for (Node *successor : node->successors_)
+            {
+                successor->dependencyCount_++;
+            }
+        }
+
+        roots_.clear();
+        std::vector<Node *> ready;
+        std::vector<uint32_t> indegree;
+        indegree.reserve(nodes_.size());
+        for (auto &node : nodes_)
+        {
+            indegree.push_back(node->dependencyCount_);
+            if (node->dependencyCount_ == 0)
+            {
+                roots_.push_back(node.get());
+                ready.push_back(node.get());
+            }
+        }
+
+        size_t visited = 0;
+        while (!ready.empty())
+        {
+            Node *node = ready.back();
+            ready.pop_back();
+            visited++;
+            for (Node *successor : node->successors_)
+            {
+                if (--indegree[successor->id_] == 0)
+                {
+                    ready.push_back(successor);
+                }
+            }
+        }
+
+        if (visited != nodes_.size())
+        {
+            roots_.clear();
+            RADAR_ERROR("Task graph {} has a cycle ({} of {} nodes reachable in order)", name_, visited,
+                        nodes_.size());
+            return TaskSchedulerErrors::GRAPH_CYCLE;
+        }
+
+        compiled_ = true;
+        return SystemErrors::SUCCESS;
+    }
+
+    Future<void> TaskGraph::launch(WorkStealingPool &pool)
+    {
+        if (running_.exchange(true, std::memory_order_acq_rel))
+        {
+            throw std::runtime_error("Task graph " + name_ + " is already running");
+        }
+
+        if (compile() != SystemErrors::SUCCESS)
+        {
+            running_.store(false, std::memory_order_release);
+            throw std::invalid_argument("Task graph " + name_ + " has a cycle");
+        }
+
+        if (nodes_.empty())
+        {
+            running_.store(false, std::memory_order_release);
+            runCount_.fetch_add(1, std::memory_order_relaxed);
+            return makeReadyFuture();
+        }
+
+        // 重新装填：结构与节点内存不变，只重置计数器
+        for (auto &node : nodes_)
+        {
+            node->pending_.store(node->dependencyCount_, std::memory_order_relaxed);
+        }
+        pool_ = &pool;
+        failed_.store(false, std::memory_order_relaxed);
+        error_ = nullptr;
+        promise_ = Promise<void>();
+        Future<void> future = promise_.getFuture();
+        remaining_.store(static_cast<uint32_t>(nodes_.size()), std::memory_order_release);
+
+        for (Node *root : roots_)
+        {
+            pool.submitItem(root);
+        }
+        return future;
+    }
+
+    ErrorCode TaskGraph::clear()
+    {
+        if (running_.load(std::memory_order_acquire))
+        {
+            return TaskSchedulerErrors::GRAPH_BUSY;
+        }
+        nodes_.clear();
+        roots_.clear();
+        compiled_ = false;
+        return SystemErrors::SUCCESS;
+    }
+
+    const std::string &TaskGraph::getNodeName(NodeId id) const
+    {
+        static const std::string empty;
+        return id < nodes_.size() ? nodes_[id]->name_ : empty;
+    }
+
+    void TaskGraph::finishNode(Node &node, bool submitSuccessors) noexcept
+    {
+        for (Node *successor : node.successors_)
+        {
+            if (successor->pending_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                continue;
+            }
+            if (submitSuccessors)
+            {
+                pool_->submitItem(successor);
+            }
+            else
+            {
+                successor->discard();
+            }
+        }
+
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+
+        // 最后一个节点：先取走结果和异常再清除运行标志，之后图可以立即被再次提交
+        Promise<void> promise = std::move(promise_);
+        std::exception_ptr error = std::move(error_);
+        runCount_.fetch_add(1, std::memory_order_relaxed);
+        running_.store(false, std::memory_order_release);
+        if (error)
+        {
+            promise.setException(std::move(error));
+        }
+        else
+        {
+            promise.setValue();
+        }
+    }
+
+    void TaskGraph::fail(std::exception_ptr error) noexcept
+    {
+        if (!failed_.exchange(true, std::memory_order_acq_rel))
+        {
+            error_ = std::move(error);
+        }
+    }
+
+    bool TaskGraph::shouldSkip() const noexcept
+    {
+        return failed_.load(std::memory_order_acquire) || promise_.isCancelled();
+    }
+
+    void TaskGraph::Node::run()
+    {
+        TaskGraph &graph = *graph_;
+        if (!graph.shouldSkip())
+        {
+            try
+            {
+                function_();
+            }
+            catch (...)
+            {
+                RADAR_WARN("Task graph {} node {} failed, skipping remaining nodes", graph.name_, name_);
+                graph.fail(std::current_exception());
+            }
+        }
+        graph.finishNode(*this, true);
+    }
+
+    void TaskGraph::Node::discard() noexcept
+    {
+        TaskGraph &graph = *graph_;
+        graph.fail(std::make_exception_ptr(
+            std::runtime_error("Task graph " + graph.name_ + " discarded before completion")));
+        graph.finishNode(*this, false);
+    }
+
+} // namespace radar
@@ -66,6 +66,29 @@ namespace radar
             }
         }
 
+        std::unique_ptr<LoadBalanceScheduler> createLoadBalanceScheduler(
+            const TaskSchedulerConfig &config,
+            std::shared_ptr<spdlog::logger> logger)
+        {
+            try
+            {
+                auto scheduler = std::make_unique<LoadBalanceScheduler>(logger);
+                ErrorCode result = scheduler->configure(config);
+                if (result != SystemErrors::SUCCESS)
+                {
+                    RADAR_ERROR("Failed to configure load balance scheduler: {}", static_cast<int>(result));
+                    return nullptr;
+                }
+                RADAR_INFO("Created load balance scheduler ({})", config.loadBalancePolicy);
+                return scheduler;
+            }
+            catch (const std::exception &e)
+            {
+                RADAR_ERROR("Exception creating load balance scheduler: {}", e.what());
+                return nullptr;
+            }
+        }
+
         std::unique_ptr<TaskScheduler> createScheduler(
             SchedulerType schedulerType,
             const TaskSchedulerConfig &config,
@@ -78,8 +101,7 @@ namespace radar
             case SchedulerType::REAL_TIME:
                 return createRealTimeScheduler(config, logger);
             case SchedulerType::LOAD_BALANCE:
-                RADAR_WARN("Load balance scheduler not implemented yet, using thread pool");
-                return createThreadPoolScheduler(config, logger);
+                return createLoadBalanceScheduler(config, logger);
             case SchedulerType::DISTRIBUTED:
                 RADAR_WARN("Distributed scheduler not implemented yet, using thread pool");
                 return createThreadPoolScheduler(config, logger);
@@ -95,8 +117,8 @@ namespace radar
             {
             case SchedulerType::THREAD_POOL:
             case SchedulerType::REAL_TIME:
-                return true;
             case SchedulerType::LOAD_BALANCE:
+                return true;
             case SchedulerType::DISTRIBUTED:
                 return false; // 预留功能，暂未实现
             default:
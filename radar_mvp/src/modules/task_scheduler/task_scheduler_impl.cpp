@@ -15,14 +15,57 @@
 #include "common/error_codes.h"
 #include <algorithm>
 #include <chrono>
+#include <optional>
 #include <thread>
 
 namespace radar
 {
 
+    namespace
+    {
+        /**
+         * @brief 调用者取消Future时把尚未执行的任务标记为已取消，工作线程取出后跳过
+         */
+        template <typename T>
+        void cancelOnFutureCancel(Promise<T> &promise, const ScheduledTaskPtr &task)
+        {
+            std::weak_ptr<ScheduledTask> weakTask = task;
+            promise.setCancelHandler([weakTask]()
+                                     {
+                if (auto pending = weakTask.lock())
+                {
+                    pending->cancel();
+                } });
+        }
+
+        /**
+         * @brief 统计分片计数器加减
+         * @param counter 计数器
+         * @param delta 增量
+         * @param owned 是否由所属工作线程写入：是则普通读写即可，不使用读-改-写指令；
+         *              共享分片可能被多个线程写入，使用原子加
+         */
+        template <typename T>
+        void addToShard(std::atomic<T> &counter, int delta, bool owned)
+        {
+            if (owned)
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + static_cast<T>(delta),
+                              std::memory_order_release);
+            }
+            else
+            {
+                counter.fetch_add(static_cast<T>(delta), std::memory_order_acq_rel);
+            }
+        }
+    } // anonymous namespace
+
     // TaskScheduler 实现
     TaskScheduler::TaskScheduler(std::shared_ptr<spdlog::logger> logger)
-        : logger_(logger)
+        : workerPool_(std::make_unique<WorkStealingPool>()),
+          logger_(logger),
+          externalStats_(std::make_unique<WorkerStatistics>()),
+          timerWheel_(std::make_unique<TimerWheel>())
     {
         if (!logger_)
         {
@@ -44,7 +87,8 @@ namespace radar
     }
 
     TaskScheduler::TaskScheduler(TaskScheduler &&other) noexcept
-        : running_(other.running_.load()),
+        : workerPool_(std::move(other.workerPool_)),
+          running_(other.running_.load()),
           shouldStop_(other.shouldStop_.load()),
           currentState_(other.currentState_.load()),
           taskCompleteCallback_(std::move(other.taskCompleteCallback_)),
@@ -54,19 +98,32 @@ namespace radar
           logger_(std::move(other.logger_)),
           config_(std::move(other.config_)),
           taskQueue_(std::move(other.taskQueue_)),
-          activeTasks_(std::move(other.activeTasks_)),
+          fairShareQueue_(other.fairShareQueue_),
+          runningSlots_(std::move(other.runningSlots_)),
+          runningSlotCount_(other.runningSlotCount_),
+          workerStats_(std::move(other.workerStats_)),
+          externalStats_(std::move(other.externalStats_)),
           moduleName_(std::move(other.moduleName_)),
           currentStrategy_(other.currentStrategy_),
+          deadlineMissPolicy_(other.deadlineMissPolicy_),
+          queueFullPolicy_(other.queueFullPolicy_),
+          backpressure_(std::move(other.backpressure_)),
+          latencyBudgetMs_(other.latencyBudgetMs_),
           maxConcurrentTasks_(other.maxConcurrentTasks_.load()),
-          currentConcurrentTasks_(other.currentConcurrentTasks_.load()),
+          timerWheel_(std::move(other.timerWheel_)),
+          timerEpoch_(other.timerEpoch_),
           promises_(std::move(other.promises_)),
           resultPromises_(std::move(other.resultPromises_))
     {
         // 移动后重置原对象状态
+        other.workerPool_ = std::make_unique<WorkStealingPool>();
+        other.timerWheel_ = std::make_unique<TimerWheel>();
         other.running_ = false;
         other.shouldStop_ = false;
         other.currentState_ = ModuleState::UNINITIALIZED;
-        other.currentConcurrentTasks_ = 0;
+        other.runningSlotCount_ = 0;
+        other.externalStats_ = std::make_unique<WorkerStatistics>();
+        other.fairShareQueue_ = nullptr;
     }
 
     TaskScheduler &TaskScheduler::operator=(TaskScheduler &&other) noexcept
@@ -79,6 +136,8 @@ namespace radar
                 stop();
             }
 
+            workerPool_ = std::move(other.workerPool_);
+            other.workerPool_ = std::make_unique<WorkStealingPool>();
             running_ = other.running_.load();
             shouldStop_ = other.shouldStop_.load();
             currentState_ = other.currentState_.load();
@@ -88,33 +147,34 @@ namespace radar
             logger_ = std::move(other.logger_);
             config_ = std::move(other.config_);
             taskQueue_ = std::move(other.taskQueue_);
-            activeTasks_ = std::move(other.activeTasks_);
+            fairShareQueue_ = other.fairShareQueue_;
+            other.fairShareQueue_ = nullptr;
+            runningSlots_ = std::move(other.runningSlots_);
+            runningSlotCount_ = other.runningSlotCount_;
+            other.runningSlotCount_ = 0;
+            workerStats_ = std::move(other.workerStats_);
+            externalStats_ = std::move(other.externalStats_);
+            other.externalStats_ = std::make_unique<WorkerStatistics>();
             moduleName_ = std::move(other.moduleName_);
             currentStrategy_ = other.currentStrategy_;
+            deadlineMissPolicy_ = other.deadlineMissPolicy_;
+            queueFullPolicy_ = other.queueFullPolicy_;
+            backpressure_ = std::move(other.backpressure_);
+            latencyBudgetMs_ = other.latencyBudgetMs_;
             maxConcurrentTasks_ = other.maxConcurrentTasks_.load();
-            currentConcurrentTasks_ = other.currentConcurrentTasks_.load();
+            timerWheel_ = std::move(other.timerWheel_);
+            other.timerWheel_ = std::make_unique<TimerWheel>();
+            timerEpoch_ = other.timerEpoch_;
             promises_ = std::move(other.promises_);
             resultPromises_ = std::move(other.resultPromises_);
 
             // 复制统计信息
-            statistics_.totalTasksSubmitted.store(other.statistics_.totalTasksSubmitted.load());
-            statistics_.totalTasksCompleted.store(other.statistics_.totalTasksCompleted.load());
-            statistics_.totalTasksFailed.store(other.statistics_.totalTasksFailed.load());
-            statistics_.totalTasksCancelled.store(other.statistics_.totalTasksCancelled.load());
-            statistics_.totalTasksTimeout.store(other.statistics_.totalTasksTimeout.load());
-            statistics_.currentPendingTasks.store(other.statistics_.currentPendingTasks.load());
-            statistics_.currentRunningTasks.store(other.statistics_.currentRunningTasks.load());
-            statistics_.averageExecutionTimeMs.store(other.statistics_.averageExecutionTimeMs.load());
-            statistics_.averageWaitingTimeMs.store(other.statistics_.averageWaitingTimeMs.load());
-            statistics_.throughputTasksPerSecond.store(other.statistics_.throughputTasksPerSecond.load());
-            statistics_.startTime_ = other.statistics_.startTime_;
-            statistics_.lastUpdateTime_ = other.statistics_.lastUpdateTime_;
+            statistics_ = other.statistics_;
 
             // 重置原对象
             other.running_ = false;
             other.shouldStop_ = false;
             other.currentState_ = ModuleState::UNINITIALIZED;
-            other.currentConcurrentTasks_ = 0;
         }
         return *this;
     }
@@ -137,21 +197,56 @@ namespace radar
         {
             currentStrategy_ = SchedulingStrategy::PRIORITY;
         }
+        else if (config.schedulingPolicy == "edf")
+        {
+            currentStrategy_ = SchedulingStrategy::EARLIEST_DEADLINE_FIRST;
+        }
         else
         {
             currentStrategy_ = SchedulingStrategy::FIFO; // 默认
         }
+        deadlineMissPolicy_ = config.deadlineMissPolicy == "drop" ? DeadlineMissPolicy::DROP
+                                                                  : DeadlineMissPolicy::DEMOTE;
+        if (config.queueFullPolicy == "block")
+        {
+            queueFullPolicy_ = QueueFullPolicy::BLOCK;
+        }
+        else if (config.queueFullPolicy == "drop_by_priority")
+        {
+            queueFullPolicy_ = QueueFullPolicy::DROP_BY_PRIORITY;
+        }
+        else
+        {
+            queueFullPolicy_ = QueueFullPolicy::REJECT; // 默认
+        }
+        if (!backpressure_ || backpressure_->getCapacity() != config.queueCapacity)
+        {
+            backpressure_ = std::make_shared<BackpressureSignal>(config.queueCapacity);
+        }
+        latencyBudgetMs_ = {config.latencyBudgetLowMs, config.latencyBudgetNormalMs,
+                            config.latencyBudgetHighMs, config.latencyBudgetCriticalMs};
         maxConcurrentTasks_ = config.maxThreads; // 使用maxThreads作为并发任务数
 
         // 创建任务队列
-        taskQueue_ = createTaskQueue(currentStrategy_);
+        rebuildTaskQueue();
 
         RADAR_INFO("TaskScheduler configured with strategy {} and {} max concurrent tasks",
                    config.schedulingPolicy, maxConcurrentTasks_.load());
         return SystemErrors::SUCCESS;
     }
 
-    std::future<void> TaskScheduler::submitTask(Task task, PacketPriority priority)
+    Future<void> TaskScheduler::submitTask(Task task, PacketPriority priority)
+    {
+        return submitTask(std::move(task), priority, 0);
+    }
+
+    Future<void> TaskScheduler::submitTask(Task task, PacketPriority priority, uint32_t timeoutMs)
+    {
+        return submitTenantTask(DEFAULT_TENANT, std::move(task), priority, timeoutMs);
+    }
+
+    Future<void> TaskScheduler::submitTenantTask(TenantId tenant, Task task, PacketPriority priority,
+                                                 uint32_t timeoutMs)
     {
         if (!task)
         {
@@ -160,35 +255,47 @@ namespace radar
         }
 
         auto scheduledTask = std::make_shared<ScheduledTask>(
-            std::move(task), priority, 0, "");
+            std::move(task), priority, timeoutMs, "");
+        scheduledTask->setDeadline(computeDeadline(Timestamp::clock::now(), priority));
+        scheduledTask->setTenantId(tenant);
 
-        std::promise<void> promise;
-        auto future = promise.get_future();
+        Promise<void> promise;
+        auto future = promise.getFuture();
+        cancelOnFutureCancel(promise, scheduledTask);
 
         {
             std::unique_lock<std::mutex> lock(futuresMutex_);
             promises_[scheduledTask->getId()] = std::move(promise);
         }
 
-        ErrorCode result = taskQueue_->enqueue(scheduledTask);
+        ErrorCode result = enqueueTask(scheduledTask);
         if (result != SystemErrors::SUCCESS)
         {
             std::unique_lock<std::mutex> lock(futuresMutex_);
             promises_.erase(scheduledTask->getId());
+            if (result == TaskSchedulerErrors::TASK_QUEUE_FULL)
+            {
+                RADAR_THROW(result, "Task queue is full");
+            }
             RADAR_ERROR("Failed to enqueue task: {}", static_cast<int>(result));
             throw std::runtime_error("Failed to enqueue task");
         }
 
         statistics_.totalTasksSubmitted++;
-        statistics_.currentPendingTasks++;
 
         RADAR_DEBUG("Submitted task {} with priority {}", scheduledTask->getId(),
                     static_cast<int>(priority));
         return future;
     }
 
-    std::future<ProcessingResultPtr> TaskScheduler::submitTaskWithResult(
+    Future<ProcessingResultPtr> TaskScheduler::submitTaskWithResult(
         TaskWithResult task, PacketPriority priority)
+    {
+        return submitDeadlineTask(std::move(task), priority, Timestamp::clock::now());
+    }
+
+    Future<ProcessingResultPtr> TaskScheduler::submitDeadlineTask(
+        TaskWithResult task, PacketPriority priority, Timestamp releaseTime, TenantId tenant)
     {
         if (!task)
         {
@@ -196,40 +303,45 @@ namespace radar
             throw std::invalid_argument("Task cannot be null");
         }
 
+        // 包装函数把返回值写入结果槽位，任务成功完成时再交给Promise
+        auto resultSlot = std::make_shared<ProcessingResultPtr>();
         auto scheduledTask = std::make_shared<ScheduledTask>(
-            [task]()
-            {
-                // 这里需要包装任务以返回结果
-                // 简化实现，实际需要更复杂的处理
-            },
+            [task, resultSlot]()
+            { *resultSlot = task(); },
             priority, 0, "");
+        scheduledTask->setDeadline(computeDeadline(releaseTime, priority));
+        scheduledTask->setTenantId(tenant);
 
-        std::promise<ProcessingResultPtr> promise;
-        auto future = promise.get_future();
+        PendingResult pending{Promise<ProcessingResultPtr>(), resultSlot};
+        auto future = pending.promise.getFuture();
+        cancelOnFutureCancel(pending.promise, scheduledTask);
 
         {
             std::unique_lock<std::mutex> lock(futuresMutex_);
-            resultPromises_[scheduledTask->getId()] = std::move(promise);
+            resultPromises_[scheduledTask->getId()] = std::move(pending);
         }
 
-        ErrorCode result = taskQueue_->enqueue(scheduledTask);
+        ErrorCode result = enqueueTask(scheduledTask);
         if (result != SystemErrors::SUCCESS)
         {
             std::unique_lock<std::mutex> lock(futuresMutex_);
             resultPromises_.erase(scheduledTask->getId());
+            if (result == TaskSchedulerErrors::TASK_QUEUE_FULL)
+            {
+                RADAR_THROW(result, "Task queue is full");
+            }
             RADAR_ERROR("Failed to enqueue task with result: {}", static_cast<int>(result));
             throw std::runtime_error("Failed to enqueue task");
         }
 
         statistics_.totalTasksSubmitted++;
-        statistics_.currentPendingTasks++;
 
         RADAR_DEBUG("Submitted task with result {} with priority {}", scheduledTask->getId(),
                     static_cast<int>(priority));
         return future;
     }
 
-    std::future<ProcessingResultPtr> TaskScheduler::submitProcessingTask(
+    Future<ProcessingResultPtr> TaskScheduler::submitProcessingTask(
         std::shared_ptr<IDataProcessor> processor,
         RawDataPacketPtr packet,
         PacketPriority priority)
@@ -253,7 +365,10 @@ namespace radar
             return result;
         };
 
-        return submitTaskWithResult(task, priority);
+        // 截止时间从数据采集时刻起算，排队与传输耗时都计入延迟预算
+        const Timestamp releaseTime = packet->timestamp == Timestamp{} ? Timestamp::clock::now()
+                                                                       : packet->timestamp;
+        return submitDeadlineTask(task, priority, releaseTime, packet->sensorId);
     }
 
     ErrorCode TaskScheduler::waitForAllTasks(uint32_t timeoutMs)
@@ -270,13 +385,11 @@ namespace radar
 
         while (true)
         {
+            TaskStatistics stats;
+            getStatistics(stats);
+            if (stats.currentPendingTasks.load() == 0 && stats.currentRunningTasks.load() == 0)
             {
-                std::unique_lock<std::mutex> lock(statsMutex_);
-                if (statistics_.currentPendingTasks.load() == 0 &&
-                    statistics_.currentRunningTasks.load() == 0)
-                {
-                    break;
-                }
+                break;
             }
 
             if (std::chrono::steady_clock::now() - startTime > timeout)
@@ -305,17 +418,50 @@ namespace radar
 
     SchedulerStatus TaskScheduler::getSchedulerStatus() const
     {
+        TaskStatistics aggregated;
+        getStatistics(aggregated);
+
         SchedulerStatus status;
-        status.activeThreads = currentConcurrentTasks_.load();
-        status.pendingTasks = statistics_.currentPendingTasks.load();
-        status.completedTasks = statistics_.totalTasksCompleted.load();
-        status.failedTasks = statistics_.totalTasksFailed.load();
-        status.averageExecutionTimeMs = statistics_.averageExecutionTimeMs.load();
-        status.throughputTasksPerSec = statistics_.throughputTasksPerSecond.load();
+        status.activeThreads = aggregated.currentRunningTasks.load();
+        status.pendingTasks = aggregated.currentPendingTasks.load();
+        status.completedTasks = aggregated.totalTasksCompleted.load();
+        status.failedTasks = aggregated.totalTasksFailed.load();
+        status.averageExecutionTimeMs = aggregated.averageExecutionTimeMs.load();
+        status.throughputTasksPerSec = aggregated.throughputTasksPerSecond.load();
+        status.queueWaitLatency = aggregated.queueWaitLatency;
+        status.executionLatency = aggregated.executionLatency;
+        if (fairShareQueue_)
+        {
+            status.tenants = fairShareQueue_->getTenantStatus(
+                std::chrono::duration<double>(std::chrono::system_clock::now() - aggregated.startTime_).count());
+        }
+        status.deadlineMisses = aggregated.deadlineMisses.load();
+        status.deadlineMissRate = aggregated.getDeadlineMissRate();
         status.schedulerState = getState();
+        {
+            std::lock_guard<std::mutex> lock(placementMutex_);
+            status.workerPlacement = workerPlacement_;
+        }
+        status.poolThreads = workerPool_->getThreadCount();
+        status.poolSizeHistory = workerPool_->getSizeHistory();
+        if (backpressure_)
+        {
+            status.queueCapacity = backpressure_->getCapacity();
+            status.queueOccupancy = backpressure_->getOccupancyRatio();
+        }
+        status.rejectedTasks = statistics_.getTotalRejections();
+        status.blockedSubmissions = statistics_.blockedSubmissions.load();
+        status.preemptions = statistics_.preemptions.load();
+        status.averagePreemptionLatencyUs = statistics_.getAveragePreemptionLatencyUs();
+        status.maxPreemptionLatencyUs = statistics_.maxPreemptionLatencyUs.load();
         return status;
     }
 
+    std::shared_ptr<const BackpressureSignal> TaskScheduler::getBackpressureSignal() const
+    {
+        return backpressure_;
+    }
+
     // IModule 接口实现
     ErrorCode TaskScheduler::initialize()
     {
@@ -332,6 +478,7 @@ namespace radar
         }
 
         statistics_.reset();
+        resetWorkerStatistics();
         setState(ModuleState::READY);
 
         RADAR_INFO("TaskScheduler initialized");
@@ -362,6 +509,13 @@ namespace radar
             RADAR_ERROR("Failed to start worker threads");
             return result;
         }
+        startTimerThread();
+        if (controlLane_.hasPending())
+        {
+            // 启动前投递的控制消息
+            postLightTask([this]()
+                          { controlLane_.drain(); });
+        }
 
         setState(ModuleState::RUNNING);
         RADAR_INFO("TaskScheduler started with {} threads", config_->coreThreads);
@@ -379,6 +533,8 @@ namespace radar
         shouldStop_ = true;
         running_ = false;
 
+        // 先停定时器线程，避免停止过程中继续向线程池投递任务
+        stopTimerThread();
         ErrorCode result = stopWorkerThreads();
         if (result != SystemErrors::SUCCESS)
         {
@@ -425,24 +581,42 @@ namespace radar
             stop();
         }
 
-        // 清理资源
+        // 清理资源：未完成的Promise在锁外析构，其Future以broken_promise完成并触发续体
+        std::unordered_map<ScheduledTask::TaskId, Promise<void>> abandoned;
+        std::unordered_map<ScheduledTask::TaskId, PendingResult> abandonedResults;
         {
             std::unique_lock<std::mutex> lock(futuresMutex_);
-            promises_.clear();
-            resultPromises_.clear();
+            abandoned.swap(promises_);
+            abandonedResults.swap(resultPromises_);
         }
+        abandoned.clear();
+        abandonedResults.clear();
 
+        if (taskQueue_)
         {
-            std::unique_lock<std::mutex> lock(taskMapMutex_);
-            activeTasks_.clear();
+            taskQueue_->clear();
         }
+        workerPool_->clear();
 
-        if (taskQueue_)
+        // 工作线程已停止，占用信用的只有刚丢弃的任务：全部归还，分级计数与执行凭据一并清零，
+        // 否则重新启动后准入一直少这些信用，检查点也会看到并不存在的高优先级任务
+        if (backpressure_)
         {
-            taskQueue_->clear();
+            backpressure_->reset();
+        }
+        for (auto &queued : queuedByPriority_)
+        {
+            queued.store(0, std::memory_order_relaxed);
+        }
+        preemptedTokens_.store(0, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(timerMutex_);
+            timerWheel_ = std::make_unique<TimerWheel>(currentTimerTick());
         }
 
         statistics_.reset();
+        resetWorkerStatistics();
         setState(ModuleState::UNINITIALIZED);
 
         RADAR_INFO("TaskScheduler cleaned up");
@@ -490,7 +664,7 @@ namespace radar
         }
 
         currentStrategy_ = strategy;
-        taskQueue_ = createTaskQueue(strategy);
+        rebuildTaskQueue();
 
         RADAR_INFO("Scheduling strategy changed to {}", static_cast<int>(strategy));
         return SystemErrors::SUCCESS;
@@ -506,52 +680,70 @@ namespace radar
         taskCompleteCallback_ = std::move(callback);
     }
 
-    ErrorCode TaskScheduler::cancelTask(ScheduledTask::TaskId taskId)
-    {
-        std::unique_lock<std::mutex> lock(taskMapMutex_);
-        auto it = activeTasks_.find(taskId);
-        if (it != activeTasks_.end())
-        {
-            return it->second->cancel();
-        }
-
-        RADAR_WARN("Task {} not found for cancellation", taskId);
-        return TaskSchedulerErrors::SCHEDULING_ERROR;
-    }
-
     TaskState TaskScheduler::getTaskState(ScheduledTask::TaskId taskId) const
     {
-        std::unique_lock<std::mutex> lock(taskMapMutex_);
-        auto it = activeTasks_.find(taskId);
-        if (it != activeTasks_.end())
+        std::lock_guard<std::mutex> lock(runningSlotsMutex_);
+        for (size_t i = 0; i < runningSlotCount_; ++i)
         {
-            return it->second->getState();
+            if (runningSlots_[i].taskId.load(std::memory_order_acquire) == taskId)
+            {
+                return TaskState::RUNNING;
+            }
         }
         return TaskState::PENDING; // 默认状态
     }
 
     void TaskScheduler::getStatistics(TaskStatistics &stats) const
     {
-        std::unique_lock<std::mutex> lock(statsMutex_);
-        stats = statistics_;
+        {
+            std::unique_lock<std::mutex> lock(statsMutex_);
+            stats = statistics_;
+        }
+        aggregateWorkerStatistics(stats);
     }
 
     void TaskScheduler::resetStatistics()
     {
         std::unique_lock<std::mutex> lock(statsMutex_);
         statistics_.reset();
+        resetWorkerStatistics();
+        if (fairShareQueue_)
+        {
+            fairShareQueue_->resetStatistics();
+        }
         RADAR_INFO("TaskScheduler statistics reset");
     }
 
     size_t TaskScheduler::getQueueSize() const
     {
-        return taskQueue_ ? taskQueue_->size() : 0;
+        // 每个等待中的任务在线程池中恰好对应一个元素（任务本身或执行凭据）
+        return workerPool_->getPendingCount();
     }
 
     size_t TaskScheduler::getActiveTaskCount() const
     {
-        std::unique_lock<std::mutex> lock(taskMapMutex_);
-        return activeTasks_.size();
+        std::lock_guard<std::mutex> lock(runningSlotsMutex_);
+        size_t count = 0;
+        for (size_t i = 0; i < runningSlotCount_; ++i)
+        {
+            if (runningSlots_[i].taskId.load(std::memory_order_acquire) != 0)
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    uint64_t TaskScheduler::getTimeoutCount(PacketPriority priority) const
+    {
+        const size_t level = std::min<size_t>(static_cast<size_t>(priority), TASK_PRIORITY_LEVELS - 1);
+        return statistics_.timeoutsByPriority[level].load();
+    }
+
+    uint64_t TaskScheduler::getRejectionCount(PacketPriority priority) const
+    {
+        const size_t level = std::min<size_t>(static_cast<size_t>(priority), TASK_PRIORITY_LEVELS - 1);
+        return statistics_.rejectionsByPriority[level].load();
     }
 
     void TaskScheduler::setMaxConcurrentTasks(uint32_t maxConcurrent)
@@ -560,50 +752,367 @@ namespace radar
         RADAR_INFO("Max concurrent tasks set to {}", maxConcurrent);
     }
 
-    // 保护方法实现
-    void TaskScheduler::workerLoop()
+    WorkStealingPoolStatistics TaskScheduler::getWorkerPoolStatistics() const
+    {
+        return workerPool_->getStatistics();
+    }
+
+    Future<void> TaskScheduler::submitGraph(TaskGraph &graph)
     {
-        RADAR_DEBUG("Worker thread started");
+        RADAR_DEBUG("Submitting task graph {} with {} nodes", graph.getName(), graph.getNodeCount());
+        return graph.launch(*workerPool_);
+    }
 
-        while (!shouldStop_.load())
+    Future<void> TaskScheduler::submitResumableTask(ResumableTask step, PacketPriority priority)
+    {
+        if (!step)
         {
-            ScheduledTaskPtr task;
-            ErrorCode result = taskQueue_->dequeue(task, 100); // 100ms 超时
+            RADAR_ERROR("Cannot submit null resumable task");
+            throw std::invalid_argument("Task cannot be null");
+        }
 
-            if (result == SystemErrors::SUCCESS && task)
+        return submitTask(
+            [this, step = std::move(step)]()
             {
-                if (currentConcurrentTasks_.load() < maxConcurrentTasks_.load())
+                while (!step())
                 {
-                    currentConcurrentTasks_++;
-                    statistics_.currentPendingTasks--;
-
-                    // 异步执行任务
-                    std::thread([this, task]()
-                                {
-                        executeTask(task);
-                        currentConcurrentTasks_--; })
-                        .detach();
-                }
-                else
-                {
-                    // 重新入队
-                    taskQueue_->enqueue(task);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    yieldToHigherPriority();
                 }
+            },
+            priority);
+    }
+
+    bool TaskScheduler::yieldToHigherPriority()
+    {
+        RunningSlot *slot = currentRunningSlot();
+        if (!slot || !taskQueue_ || currentStrategy_ == SchedulingStrategy::FIFO || fairShareQueue_)
+        {
+            return false;
+        }
+
+        // 只在确有更高优先级任务时才访问策略队列，没有时检查点只读几个计数器。
+        // 只取优先级严格更高的任务且不触发老化；EDF策略在这些任务中取最早到期的
+        bool yielded = false;
+        while (hasPreemptingTask(slot->priority))
+        {
+            ScheduledTaskPtr urgent;
+            if (!taskQueue_->tryDequeueAbove(slot->priority, urgent) || !urgent)
+            {
+                break;
             }
-            else if (result == TaskSchedulerErrors::TASK_TIMEOUT)
+            preemptedTokens_.fetch_add(1, std::memory_order_relaxed);
+
+            const auto waited = std::chrono::system_clock::now() - urgent->getSubmitTime();
+            statistics_.recordPreemption(static_cast<uint64_t>(std::max<int64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(waited).count(), 0)));
+            RADAR_DEBUG("Task {} preempted at checkpoint by task {}", slot->taskId.load(std::memory_order_relaxed),
+                        urgent->getId());
+
+            runDequeuedTask(urgent, true);
+            yielded = true;
+        }
+        return yielded;
+    }
+
+    void TaskScheduler::execute(Work work)
+    {
+        if (!work)
+        {
+            throw std::invalid_argument("Work cannot be null");
+        }
+        postLightTask(std::move(work));
+    }
+
+    TaskScheduler::TimerId TaskScheduler::submitDelayed(Task task, std::chrono::milliseconds delay,
+                                                        PacketPriority priority)
+    {
+        if (!task)
+        {
+            RADAR_ERROR("Cannot submit null delayed task");
+            throw std::invalid_argument("Task cannot be null");
+        }
+
+        TimerId timerId = addTimer(
+            delay,
+            [this, task = std::move(task), priority]()
+            { dispatchTimerTask(task, priority); },
+            std::chrono::milliseconds(0));
+
+        RADAR_DEBUG("Submitted delayed task with timer {} due in {}ms", timerId, delay.count());
+        return timerId;
+    }
+
+    TaskScheduler::TimerId TaskScheduler::submitPeriodic(Task task, std::chrono::milliseconds period,
+                                                         std::chrono::milliseconds phase,
+                                                         PacketPriority priority)
+    {
+        if (!task)
+        {
+            RADAR_ERROR("Cannot submit null periodic task");
+            throw std::invalid_argument("Task cannot be null");
+        }
+        if (period.count() <= 0)
+        {
+            RADAR_ERROR("Invalid period {}ms for periodic task", period.count());
+            throw std::invalid_argument("Period must be at least 1ms");
+        }
+
+        // 周期回调每次到期都会被复制，任务函数放在共享对象里避免重复复制
+        auto sharedTask = std::make_shared<Task>(std::move(task));
+        TimerId timerId = addTimer(
+            phase,
+            [this, sharedTask, priority]()
+            { dispatchTimerTask(*sharedTask, priority); },
+            period);
+
+        RADAR_INFO("Submitted periodic task with timer {} every {}ms", timerId, period.count());
+        return timerId;
+    }
+
+    bool TaskScheduler::cancelTimer(TimerId timerId)
+    {
+        std::lock_guard<std::mutex> lock(timerMutex_);
+        return timerWheel_->cancel(timerId);
+    }
+
+    size_t TaskScheduler::getTimerCount() const
+    {
+        std::lock_guard<std::mutex> lock(timerMutex_);
+        return timerWheel_->size();
+    }
+
+    ErrorCode TaskScheduler::postControl(ControlLane::Action action)
+    {
+        if (!action)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        auto guarded = [this, action = std::move(action)]()
+        {
+            try
             {
-                // 超时，继续循环
-                continue;
+                action();
+            }
+            catch (const std::exception &e)
+            {
+                onErrorOccurred(SystemErrors::CONFIGURATION_ERROR, std::string("Control message failed: ") + e.what());
+                throw;
+            }
+        };
+        if (!controlLane_.post(std::move(guarded)))
+        {
+            RADAR_WARN("Control lane full, message rejected");
+            return SystemErrors::RESOURCE_UNAVAILABLE;
+        }
+
+        // 繁忙的工作线程在任务之间就会执行消息；这个轻量任务只为唤醒空闲的工作线程，
+        // 它排在积压之后执行时通道多半已经清空，drain()立即返回
+        if (running_.load())
+        {
+            postLightTask([this]()
+                          { controlLane_.drain(); });
+        }
+        return SystemErrors::SUCCESS;
+    }
+
+    ControlLaneStatistics TaskScheduler::getControlStatistics() const
+    {
+        return controlLane_.getStatistics();
+    }
+
+    // 保护方法实现
+    WorkStealingPoolConfig TaskScheduler::makeWorkerPoolConfig(uint32_t threadCount) const
+    {
+        WorkStealingPoolConfig poolConfig;
+        poolConfig.threadCount = threadCount;
+        poolConfig.name = moduleName_;
+        if (config_)
+        {
+            // coreThreads常驻，积压时增加到maxThreads，额外线程空闲keepAliveMs后退出
+            poolConfig.maxThreadCount = config_->maxThreads;
+            poolConfig.keepAliveMs = config_->keepAliveMs;
+            poolConfig.scaleUpWaitUs = config_->scaleUpWaitUs;
+        }
+        return poolConfig;
+    }
+
+    ThreadPlacementConfig TaskScheduler::makeThreadPlacement() const
+    {
+        return resolveThreadPlacement(config_ ? config_->threadPlacement : ThreadPlacementConfig{},
+                                      "task_scheduler.placement");
+    }
+
+    ErrorCode TaskScheduler::enqueueTask(const ScheduledTaskPtr &task)
+    {
+        // 先占用信用再入队，任务出队时（runPooledTask）归还
+        ErrorCode result = admitTask(task->getPriority());
+        if (result != SystemErrors::SUCCESS)
+        {
+            return result;
+        }
+
+        if (currentStrategy_ == SchedulingStrategy::FIFO && !fairShareQueue_)
+        {
+            result = workerPool_->submit(task);
+        }
+        else
+        {
+            // 先计数再入队，检查点看到计数时任务可能尚未发布，取不到时下个检查点再试
+            const size_t level = std::min<size_t>(static_cast<size_t>(task->getPriority()), TASK_PRIORITY_LEVELS - 1);
+            queuedByPriority_[level].fetch_add(1, std::memory_order_relaxed);
+            result = taskQueue_->enqueue(task);
+            if (result == SystemErrors::SUCCESS)
+            {
+                result = workerPool_->submit(nullptr);
             }
             else
             {
-                // 其他错误，记录并继续
-                RADAR_ERROR("Failed to dequeue task: {}", static_cast<int>(result));
+                queuedByPriority_[level].fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        if (result != SystemErrors::SUCCESS && backpressure_)
+        {
+            backpressure_->release();
+        }
+        return result;
+    }
+
+    ErrorCode TaskScheduler::admitTask(PacketPriority priority)
+    {
+        if (!backpressure_)
+        {
+            return SystemErrors::SUCCESS;
+        }
+
+        const uint32_t limit = admissionLimit(priority);
+        if (backpressure_->tryAcquire(limit))
+        {
+            return SystemErrors::SUCCESS;
+        }
+
+        if (queueFullPolicy_ == QueueFullPolicy::BLOCK && WorkStealingPool::getCurrentWorkerIndex() < 0)
+        {
+            statistics_.blockedSubmissions++;
+            const auto timeout = std::chrono::milliseconds(config_ ? config_->queueFullBlockMs : 0);
+            if (backpressure_->acquire(limit, timeout))
+            {
+                return SystemErrors::SUCCESS;
+            }
+        }
+
+        statistics_.recordRejection(priority);
+        RADAR_DEBUG("Rejected task with priority {}: queue occupancy {}/{}", static_cast<int>(priority),
+                    backpressure_->getOccupancy(), backpressure_->getCapacity());
+        return TaskSchedulerErrors::TASK_QUEUE_FULL;
+    }
+
+    /**
+     * @note DROP_BY_PRIORITY按优先级分级准入：低、普通、高优先级分别只能占满容量的
+     *       1/2、3/4、9/10，队列接近满时先拒绝低优先级，关键任务始终保有余量
+     */
+    uint32_t TaskScheduler::admissionLimit(PacketPriority priority) const
+    {
+        const uint32_t capacity = backpressure_ ? backpressure_->getCapacity() : 0;
+        if (queueFullPolicy_ != QueueFullPolicy::DROP_BY_PRIORITY || capacity == 0)
+        {
+            return capacity;
+        }
+
+        static constexpr std::array<uint32_t, TASK_PRIORITY_LEVELS> SHARE_PERCENT{{50, 75, 90, 100}};
+        const size_t level = std::min<size_t>(static_cast<size_t>(priority), TASK_PRIORITY_LEVELS - 1);
+        return std::max<uint32_t>(1, static_cast<uint32_t>(static_cast<uint64_t>(capacity) *
+                                                           SHARE_PERCENT[level] / 100));
+    }
+
+    void TaskScheduler::runPooledTask(ScheduledTaskPtr task)
+    {
+        // 相邻两个任务之间检查控制通道（无消息时只是一次原子读）
+        if (controlLane_.hasPending())
+        {
+            controlLane_.drain();
+        }
+
+        if (task)
+        {
+            runDequeuedTask(task, false);
+            return;
+        }
+
+        // 执行凭据：按策略队列的顺序取出当前应执行的任务。凭据总在任务入队之后提交，
+        // 短超时只用于跨过无锁队列中"已认领未发布"的瞬时状态；
+        // 队列为空且有任务已在检查点被执行时，这个凭据就是它的，直接消费
+        if (!taskQueue_)
+        {
+            return;
+        }
+        auto consumePreemptedToken = [this]()
+        {
+            uint32_t preempted = preemptedTokens_.load(std::memory_order_relaxed);
+            while (preempted > 0 &&
+                   !preemptedTokens_.compare_exchange_weak(preempted, preempted - 1, std::memory_order_relaxed))
+            {
             }
+            return preempted > 0;
+        };
+        if (taskQueue_->dequeue(task, 0) != SystemErrors::SUCCESS || !task)
+        {
+            if (consumePreemptedToken())
+            {
+                return;
+            }
+            if (taskQueue_->dequeue(task, 1) != SystemErrors::SUCCESS || !task)
+            {
+                // 检查点可能刚取走任务、尚未登记
+                consumePreemptedToken();
+                return;
+            }
+        }
+        runDequeuedTask(task, true);
+    }
+
+    /**
+     * @note 等待与执行中任务数记在本线程的统计分片上，读取时由提交数减去各分片的取出数得到；
+     *       先计入执行中再计入已取出，读取方先读取出数，因此不会在任务取出后、开始前看到两者都为0。
+     *       每个任务仍有两处共享的读-改-写：策略队列的分级计数（检查点据此判断有无更高优先级任务）
+     *       和背压信用的归还（有界队列的准入需要全局占用数）
+     */
+    void TaskScheduler::runDequeuedTask(const ScheduledTaskPtr &task, bool fromQueue)
+    {
+        WorkerStatistics *shard = currentWorkerStatistics();
+        WorkerStatistics &counters = shard ? *shard : *externalStats_;
+        addToShard(counters.running, 1, shard != nullptr);
+        addToShard(counters.dequeued, 1, shard != nullptr);
+
+        if (fromQueue)
+        {
+            const size_t level = std::min<size_t>(static_cast<size_t>(task->getPriority()), TASK_PRIORITY_LEVELS - 1);
+            queuedByPriority_[level].fetch_sub(1, std::memory_order_relaxed);
+        }
+        if (backpressure_)
+        {
+            backpressure_->release();
         }
 
-        RADAR_DEBUG("Worker thread stopped");
+        if (task->getState() == TaskState::CANCELLED)
+        {
+            // 调用者在执行前取消了Future
+            statistics_.recordCancellation();
+            onTaskComplete(task->getId(), SystemErrors::OPERATION_CANCELLED);
+        }
+        else if (currentStrategy_ == SchedulingStrategy::EARLIEST_DEADLINE_FIRST &&
+                 deadlineMissPolicy_ == DeadlineMissPolicy::DROP &&
+                 task->hasDeadline() && Timestamp::clock::now() > task->getDeadline())
+        {
+            dropExpiredTask(task);
+        }
+        else
+        {
+            executeTask(task);
+        }
+
+        addToShard(counters.running, -1, shard != nullptr);
     }
 
     ErrorCode TaskScheduler::executeTask(const ScheduledTaskPtr &task)
@@ -613,36 +1122,88 @@ namespace radar
             return TaskSchedulerErrors::TASK_EXECUTION_FAILED;
         }
 
-        registerActiveTask(task);
-        statistics_.currentRunningTasks++;
+        // 检查点上被抢占执行的任务嵌套在长任务之内，结束后恢复槽位
+        RunningSlot *slot = currentRunningSlot();
+        ScheduledTask::TaskId outerTaskId = 0;
+        PacketPriority outerPriority = PacketPriority::LOW;
+        if (slot)
+        {
+            outerTaskId = slot->taskId.load(std::memory_order_relaxed);
+            outerPriority = slot->priority;
+            slot->taskId.store(task->getId(), std::memory_order_release);
+            slot->priority = task->getPriority();
+        }
+        const TimerId timeoutTimer = armTaskTimeout(task);
 
+        const auto queueWait = std::chrono::system_clock::now() - task->getSubmitTime();
         auto startTime = std::chrono::steady_clock::now();
         ErrorCode result = task->execute();
         auto endTime = std::chrono::steady_clock::now();
 
-        statistics_.currentRunningTasks--;
-
-        double executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-                                   endTime - startTime)
-                                   .count();
-
-        if (result == SystemErrors::SUCCESS)
+        if (timeoutTimer != TimerWheel::INVALID_TIMER)
         {
-            statistics_.totalTasksCompleted++;
-            statistics_.updateExecutionStats(executionTime, task->getWaitingTimeMs());
+            cancelTimer(timeoutTimer);
         }
-        else
+        if (slot)
         {
-            statistics_.totalTasksFailed++;
-            statistics_.recordFailure();
+            slot->taskId.store(outerTaskId, std::memory_order_release);
+            slot->priority = outerPriority;
+        }
+        if (task->hasDeadline())
+        {
+            recordDeadlineOutcome(Timestamp::clock::now() > task->getDeadline());
+        }
+
+        const auto queueWaitNs = static_cast<uint64_t>(std::max<int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(queueWait).count(), 0));
+        const auto executionNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+        recordExecution(result == SystemErrors::SUCCESS, queueWaitNs, executionNs);
+        if (fairShareQueue_)
+        {
+            fairShareQueue_->recordExecution(task->getTenantId(), queueWaitNs, executionNs);
         }
 
-        unregisterActiveTask(task->getId());
         onTaskComplete(task->getId(), result);
 
         return result;
     }
 
+    bool TaskScheduler::hasPreemptingTask(PacketPriority running) const
+    {
+        for (size_t level = TASK_PRIORITY_LEVELS; level-- > static_cast<size_t>(running) + 1;)
+        {
+            if (queuedByPriority_[level].load(std::memory_order_relaxed) > 0 &&
+                shouldPreempt(static_cast<PacketPriority>(level), running))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TaskScheduler::shouldPreempt(PacketPriority waiting, PacketPriority running) const
+    {
+        return static_cast<int>(waiting) > static_cast<int>(running);
+    }
+
+    Timestamp TaskScheduler::computeDeadline(Timestamp releaseTime, PacketPriority priority) const
+    {
+        const size_t level = std::min<size_t>(static_cast<size_t>(priority), TASK_PRIORITY_LEVELS - 1);
+        return releaseTime + std::chrono::milliseconds(latencyBudgetMs_[level]);
+    }
+
+    void TaskScheduler::dropExpiredTask(const ScheduledTaskPtr &task)
+    {
+        task->cancel();
+        statistics_.recordCancellation();
+        recordDeadlineOutcome(true);
+        statistics_.deadlineDrops++;
+
+        RADAR_DEBUG("Dropped task {} past its deadline", task->getId());
+        onTaskComplete(task->getId(), TaskSchedulerErrors::DEADLINE_MISSED);
+    }
+
     bool TaskScheduler::validateTask(const ScheduledTaskPtr &task) const
     {
         return task && task->getId() > 0;
@@ -650,41 +1211,55 @@ namespace radar
 
     void TaskScheduler::onTaskComplete(ScheduledTask::TaskId taskId, ErrorCode result)
     {
-        // 设置 promise
+        const char *failureReason = result == TaskSchedulerErrors::DEADLINE_MISSED
+                                        ? "Task deadline missed"
+                                        : "Task execution failed";
+
+        // 先从映射表取出Promise再完成：续体在完成线程上执行，可能再次提交任务
+        std::optional<Promise<void>> promise;
+        std::optional<PendingResult> pending;
         {
             std::unique_lock<std::mutex> lock(futuresMutex_);
             auto it = promises_.find(taskId);
             if (it != promises_.end())
             {
-                if (result == SystemErrors::SUCCESS)
-                {
-                    it->second.set_value();
-                }
-                else
-                {
-                    it->second.set_exception(std::make_exception_ptr(
-                        std::runtime_error("Task execution failed")));
-                }
+                promise.emplace(std::move(it->second));
                 promises_.erase(it);
             }
 
             auto rit = resultPromises_.find(taskId);
             if (rit != resultPromises_.end())
             {
-                if (result == SystemErrors::SUCCESS)
-                {
-                    // 这里需要实际的处理结果
-                    rit->second.set_value(nullptr);
-                }
-                else
-                {
-                    rit->second.set_exception(std::make_exception_ptr(
-                        std::runtime_error("Task execution failed")));
-                }
+                pending.emplace(std::move(rit->second));
                 resultPromises_.erase(rit);
             }
         }
 
+        // 已被调用者取消的Promise忽略结果
+        if (result == SystemErrors::SUCCESS)
+        {
+            if (promise)
+            {
+                promise->setValue();
+            }
+            if (pending)
+            {
+                pending->promise.setValue(std::move(*pending->result));
+            }
+        }
+        else if (promise || pending)
+        {
+            const auto error = std::make_exception_ptr(std::runtime_error(failureReason));
+            if (promise)
+            {
+                promise->setException(error);
+            }
+            if (pending)
+            {
+                pending->promise.setException(error);
+            }
+        }
+
         // 调用回调
         if (taskCompleteCallback_)
         {
@@ -734,87 +1309,430 @@ namespace radar
         case SchedulingStrategy::FIFO:
             return std::make_unique<FIFOTaskQueue>();
         case SchedulingStrategy::PRIORITY:
-            return std::make_unique<PriorityTaskQueue>();
+            return std::make_unique<PriorityTaskQueue>(config_ ? config_->queueCapacity : 1024);
+        case SchedulingStrategy::EARLIEST_DEADLINE_FIRST:
+            return std::make_unique<EDFTaskQueue>(config_ ? config_->queueCapacity : 1024,
+                                                  deadlineMissPolicy_);
         default:
             RADAR_WARN("Unknown scheduling strategy {}, using FIFO", static_cast<int>(strategy));
             return std::make_unique<FIFOTaskQueue>();
         }
     }
 
+    void TaskScheduler::rebuildTaskQueue()
+    {
+        discardQueuedTasks();
+        fairShareQueue_ = nullptr;
+        if (!config_ || config_->tenants.empty())
+        {
+            taskQueue_ = createTaskQueue(currentStrategy_);
+            return;
+        }
+
+        auto fairShare = std::make_unique<FairShareTaskQueue>();
+        for (const auto &tenant : config_->tenants)
+        {
+            if (fairShare->setTenant(tenant, createTaskQueue(currentStrategy_)) != SystemErrors::SUCCESS)
+            {
+                RADAR_WARN("Ignoring tenant {} with weight {}", tenant.id, tenant.weight);
+            }
+        }
+        if (!fairShare->hasTenant(DEFAULT_TENANT))
+        {
+            fairShare->setTenant(TenantConfig{DEFAULT_TENANT, "default", 1}, createTaskQueue(currentStrategy_));
+        }
+        fairShareQueue_ = fairShare.get();
+        taskQueue_ = std::move(fairShare);
+        RADAR_INFO("Fair sharing enabled for {} tenants", config_->tenants.size());
+    }
+
+    void TaskScheduler::discardQueuedTasks()
+    {
+        if (!taskQueue_)
+        {
+            return;
+        }
+
+        // 线程池中对应的执行凭据留在原处：取不到任务时直接返回
+        ScheduledTaskPtr task;
+        while (taskQueue_->dequeue(task, 0) == SystemErrors::SUCCESS && task)
+        {
+            const size_t level = std::min<size_t>(static_cast<size_t>(task->getPriority()), TASK_PRIORITY_LEVELS - 1);
+            queuedByPriority_[level].fetch_sub(1, std::memory_order_relaxed);
+            if (backpressure_)
+            {
+                backpressure_->release();
+            }
+            addToShard(externalStats_->dequeued, 1, false);
+
+            task->cancel();
+            statistics_.recordCancellation();
+            onTaskComplete(task->getId(), SystemErrors::OPERATION_CANCELLED);
+            task.reset();
+        }
+    }
+
+    ErrorCode TaskScheduler::setTenantWeight(TenantId tenant, uint32_t weight)
+    {
+        if (!fairShareQueue_)
+        {
+            RADAR_ERROR("Fair sharing is not enabled; configure tenants first");
+            return TaskSchedulerErrors::SCHEDULER_NOT_READY;
+        }
+        if (weight == 0)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        ErrorCode result = fairShareQueue_->setTenant(
+            TenantConfig{tenant, "", weight},
+            fairShareQueue_->hasTenant(tenant) ? nullptr : createTaskQueue(currentStrategy_));
+        if (result == SystemErrors::SUCCESS)
+        {
+            RADAR_INFO("Tenant {} weight set to {}", tenant, weight);
+        }
+        return result;
+    }
+
     ErrorCode TaskScheduler::startWorkerThreads(uint32_t threadCount)
     {
-        try
+        WorkStealingPoolConfig poolConfig = makeWorkerPoolConfig(threadCount);
+        if (poolConfig.threadCount == 0)
+        {
+            poolConfig.threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        // 放置状态与运行槽位按最大线程数准备，弹性增加的线程也有自己的下标
+        const uint32_t slotCount = std::max(poolConfig.threadCount, poolConfig.maxThreadCount);
+
+        // 每个工作线程先完成放置，再分配自己的队列（首次访问落在本NUMA节点）
+        const ThreadPlacementConfig placement = makeThreadPlacement();
         {
-            workerThreads_.reserve(threadCount);
-            for (uint32_t i = 0; i < threadCount; ++i)
+            std::lock_guard<std::mutex> lock(placementMutex_);
+            workerPlacement_.assign(slotCount, ThreadPlacementStatus{});
+        }
+        poolConfig.threadInit = [this, placement, name = poolConfig.name](uint32_t index)
+        {
+            ThreadPlacementStatus status;
+            applyThreadPlacement(placement, name + "-" + std::to_string(index), index, &status);
+            std::lock_guard<std::mutex> lock(placementMutex_);
+            workerPlacement_[index] = std::move(status);
+        };
+
+        // 槽位必须在工作线程启动前就绪
+        {
+            std::lock_guard<std::mutex> lock(runningSlotsMutex_);
+            if (runningSlotCount_ != slotCount)
             {
-                workerThreads_.emplace_back([this]()
-                                            { workerLoop(); });
+                // 旧分片的计数并入共享分片，重启不丢统计
+                if (workerStats_)
+                {
+                    std::lock_guard<std::mutex> statsLock(externalStatsMutex_);
+                    for (size_t i = 0; i < runningSlotCount_; ++i)
+                    {
+                        externalStats_->queueWait.add(workerStats_[i].queueWait);
+                        externalStats_->execution.add(workerStats_[i].execution);
+                        externalStats_->completed += workerStats_[i].completed.load(std::memory_order_relaxed);
+                        externalStats_->failed += workerStats_[i].failed.load(std::memory_order_relaxed);
+                        // 等待数由提交数减去取出数得到，取出数丢失会让等待数永久偏大
+                        externalStats_->dequeued += workerStats_[i].dequeued.load(std::memory_order_relaxed);
+                        externalStats_->running += workerStats_[i].running.load(std::memory_order_relaxed);
+                        externalStats_->deadlineTasks += workerStats_[i].deadlineTasks.load(std::memory_order_relaxed);
+                        externalStats_->deadlineMisses += workerStats_[i].deadlineMisses.load(std::memory_order_relaxed);
+                    }
+                }
+                runningSlots_.reset(new RunningSlot[slotCount]);
+                workerStats_.reset(new WorkerStatistics[slotCount]);
+                runningSlotCount_ = slotCount;
             }
-            RADAR_INFO("Started {} worker threads", threadCount);
-            return SystemErrors::SUCCESS;
         }
-        catch (const std::exception &e)
+
+        ErrorCode result = workerPool_->start(poolConfig,
+                                              [this](ScheduledTaskPtr task)
+                                              { runPooledTask(std::move(task)); });
+        if (result != SystemErrors::SUCCESS)
         {
-            RADAR_ERROR("Failed to start worker threads: {}", e.what());
+            RADAR_ERROR("Failed to start worker threads: {}", static_cast<int>(result));
             return TaskSchedulerErrors::THREAD_POOL_ERROR;
         }
+
+        RADAR_INFO("Started {} worker threads", workerPool_->getThreadCount());
+        return SystemErrors::SUCCESS;
     }
 
     ErrorCode TaskScheduler::stopWorkerThreads(uint32_t timeoutMs)
     {
         shouldStop_ = true;
 
-        // 等待线程结束
+        // 线程池等待正在执行的任务结束，未开始的任务保留到下次启动
         auto startTime = std::chrono::steady_clock::now();
-        auto timeout = std::chrono::milliseconds(timeoutMs);
+        workerPool_->stop();
 
-        for (auto &thread : workerThreads_)
+        if (std::chrono::steady_clock::now() - startTime > std::chrono::milliseconds(timeoutMs))
         {
-            if (thread.joinable())
-            {
-                if (std::chrono::steady_clock::now() - startTime > timeout)
-                {
-                    RADAR_WARN("Timeout waiting for worker threads to stop");
-                    return TaskSchedulerErrors::TASK_TIMEOUT;
-                }
-                thread.join();
-            }
+            RADAR_WARN("Worker threads took longer than {}ms to stop", timeoutMs);
+            return TaskSchedulerErrors::TASK_TIMEOUT;
         }
 
-        workerThreads_.clear();
         RADAR_INFO("All worker threads stopped");
         return SystemErrors::SUCCESS;
     }
 
-    void TaskScheduler::registerActiveTask(const ScheduledTaskPtr &task)
+    void TaskScheduler::dispatchTimerTask(const Task &task, PacketPriority priority)
     {
-        std::unique_lock<std::mutex> lock(taskMapMutex_);
-        activeTasks_[task->getId()] = task;
+        auto scheduledTask = std::make_shared<ScheduledTask>(task, priority, 0, "");
+        scheduledTask->setDeadline(computeDeadline(Timestamp::clock::now(), priority));
+
+        ErrorCode result = enqueueTask(scheduledTask);
+        if (result != SystemErrors::SUCCESS)
+        {
+            RADAR_WARN("Failed to dispatch timer task {}: {}", scheduledTask->getId(), static_cast<int>(result));
+            return;
+        }
+
+        statistics_.totalTasksSubmitted++;
+    }
+
+    TaskScheduler::TimerId TaskScheduler::addTimer(std::chrono::milliseconds delay,
+                                                   TimerWheel::Callback callback,
+                                                   std::chrono::milliseconds period)
+    {
+        TimerId timerId;
+        {
+            std::lock_guard<std::mutex> lock(timerMutex_);
+            // 当前tick向下取整，再加一个tick保证实际延迟不短于请求值
+            const uint64_t expiry = currentTimerTick() + 1 + static_cast<uint64_t>(std::max<int64_t>(delay.count(), 0));
+            timerId = timerWheel_->schedule(expiry, std::move(callback), static_cast<uint64_t>(period.count()));
+        }
+        // 新定时器可能早于定时器线程当前的休眠截止时刻
+        timerCondition_.notify_one();
+        return timerId;
     }
 
-    void TaskScheduler::unregisterActiveTask(ScheduledTask::TaskId taskId)
+    uint64_t TaskScheduler::currentTimerTick() const
     {
-        std::unique_lock<std::mutex> lock(taskMapMutex_);
-        activeTasks_.erase(taskId);
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                         std::chrono::steady_clock::now() - timerEpoch_)
+                                         .count());
     }
 
-    void TaskScheduler::checkTaskTimeouts()
+    void TaskScheduler::timerLoop()
     {
-        std::unique_lock<std::mutex> lock(taskMapMutex_);
-        for (auto it = activeTasks_.begin(); it != activeTasks_.end();)
+        // 定时器线程与工作线程使用同一CPU集合和实时策略，但不独占某个CPU
+        ThreadPlacementConfig placement = makeThreadPlacement();
+        placement.pinPerCpu = false;
+        applyThreadPlacement(placement, moduleName_ + "-timer");
+
+        std::vector<TimerWheel::Callback> expired;
+        std::unique_lock<std::mutex> lock(timerMutex_);
+        while (!timerStopRequested_)
         {
-            if (it->second->isTimeout())
+            timerWheel_->advanceTo(currentTimerTick(), expired);
+            if (!expired.empty())
             {
-                it->second->cancel();
-                statistics_.recordTimeout();
-                it = activeTasks_.erase(it);
+                // 回调只负责投递任务，在锁外执行，不阻塞定时器的增删
+                lock.unlock();
+                for (auto &callback : expired)
+                {
+                    callback();
+                }
+                expired.clear();
+                lock.lock();
+                continue;
+            }
+
+            if (timerWheel_->empty())
+            {
+                timerCondition_.wait(lock);
             }
             else
             {
-                ++it;
+                const uint64_t wakeTick = timerWheel_->now() + timerWheel_->ticksUntilNextEvent();
+                timerCondition_.wait_until(lock, timerEpoch_ + std::chrono::milliseconds(wakeTick));
+            }
+        }
+    }
+
+    void TaskScheduler::startTimerThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(timerMutex_);
+            timerStopRequested_ = false;
+        }
+        timerThread_ = std::thread(&TaskScheduler::timerLoop, this);
+    }
+
+    void TaskScheduler::stopTimerThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(timerMutex_);
+            timerStopRequested_ = true;
+        }
+        timerCondition_.notify_all();
+        if (timerThread_.joinable())
+        {
+            timerThread_.join();
+        }
+    }
+
+    TaskScheduler::TimerId TaskScheduler::armTaskTimeout(const ScheduledTaskPtr &task)
+    {
+        const uint32_t timeoutMs = task->getTimeoutMs();
+        if (timeoutMs == 0)
+        {
+            return TimerWheel::INVALID_TIMER;
+        }
+
+        const auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - task->getSubmitTime());
+        if (waited.count() >= timeoutMs)
+        {
+            // 排队期间已经超时
+            recordTaskTimeout(task);
+            return TimerWheel::INVALID_TIMER;
+        }
+
+        return addTimer(
+            std::chrono::milliseconds(timeoutMs) - waited,
+            [this, task]()
+            {
+                // 任务可能恰好在定时器触发后、取消前结束
+                if (task->getState() == TaskState::RUNNING)
+                {
+                    recordTaskTimeout(task);
+                }
+            },
+            std::chrono::milliseconds(0));
+    }
+
+    void TaskScheduler::recordTaskTimeout(const ScheduledTaskPtr &task)
+    {
+        statistics_.recordTimeout(task->getPriority());
+        RADAR_WARN("Task {} exceeded its {}ms timeout", task->getId(), task->getTimeoutMs());
+    }
+
+    TaskScheduler::RunningSlot *TaskScheduler::currentRunningSlot() const
+    {
+        // 槽位数组只在工作线程启动前重建，工作线程读取时无需加锁
+        const int index = WorkStealingPool::getCurrentWorkerIndex();
+        if (!workerPool_->isCurrentWorker() || index < 0 || static_cast<size_t>(index) >= runningSlotCount_)
+        {
+            return nullptr;
+        }
+        return &runningSlots_[index];
+    }
+
+    TaskScheduler::WorkerStatistics *TaskScheduler::currentWorkerStatistics() const
+    {
+        // 与currentRunningSlot()相同，分片数组只在工作线程启动前重建
+        const int index = WorkStealingPool::getCurrentWorkerIndex();
+        if (workerPool_->isCurrentWorker() && index >= 0 && static_cast<size_t>(index) < runningSlotCount_)
+        {
+            return &workerStats_[index];
+        }
+        return nullptr;
+    }
+
+    void TaskScheduler::recordDeadlineOutcome(bool missed)
+    {
+        WorkerStatistics *shard = currentWorkerStatistics();
+        WorkerStatistics &counters = shard ? *shard : *externalStats_;
+        addToShard(counters.deadlineTasks, 1, shard != nullptr);
+        if (missed)
+        {
+            addToShard(counters.deadlineMisses, 1, shard != nullptr);
+        }
+    }
+
+    void TaskScheduler::recordExecution(bool success, uint64_t queueWaitNs, uint64_t executionNs)
+    {
+        if (WorkerStatistics *shard = currentWorkerStatistics())
+        {
+            shard->queueWait.record(queueWaitNs);
+            shard->execution.record(executionNs);
+            addToShard(success ? shard->completed : shard->failed, 1, true);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(externalStatsMutex_);
+        externalStats_->queueWait.record(queueWaitNs);
+        externalStats_->execution.record(executionNs);
+        (success ? externalStats_->completed : externalStats_->failed)++;
+    }
+
+    /**
+     * @note 读取不阻塞工作线程：各分片按relaxed顺序读取，并发记录时快照可能差几个样本
+     */
+    void TaskScheduler::aggregateWorkerStatistics(TaskStatistics &stats) const
+    {
+        LatencyHistogram::Snapshot queueWait;
+        LatencyHistogram::Snapshot execution;
+        uint64_t completed = 0;
+        uint64_t failed = 0;
+        uint64_t dequeued = 0;
+        uint64_t running = 0;
+        uint64_t deadlineTasks = 0;
+        uint64_t deadlineMisses = 0;
+        auto addShard = [&](const WorkerStatistics &shard)
+        {
+            queueWait.add(shard.queueWait);
+            execution.add(shard.execution);
+            completed += shard.completed.load(std::memory_order_relaxed);
+            failed += shard.failed.load(std::memory_order_relaxed);
+            // 先读取出数再读执行中数，与runDequeuedTask()的写入顺序配对
+            dequeued += shard.dequeued.load(std::memory_order_acquire);
+            running += shard.running.load(std::memory_order_acquire);
+            deadlineTasks += shard.deadlineTasks.load(std::memory_order_relaxed);
+            deadlineMisses += shard.deadlineMisses.load(std::memory_order_relaxed);
+        };
+        {
+            std::lock_guard<std::mutex> lock(runningSlotsMutex_);
+            for (size_t i = 0; i < runningSlotCount_; ++i)
+            {
+                addShard(workerStats_[i]);
             }
+            std::lock_guard<std::mutex> statsLock(externalStatsMutex_);
+            addShard(*externalStats_);
+        }
+
+        // 重置统计时仍有任务在途，取出数可能暂时超过提交数
+        const uint64_t submitted = stats.totalTasksSubmitted.load();
+        stats.currentPendingTasks = static_cast<uint32_t>(submitted > dequeued ? submitted - dequeued : 0);
+        stats.currentRunningTasks = static_cast<uint32_t>(running);
+        stats.deadlineTasks = deadlineTasks;
+        stats.deadlineMisses = deadlineMisses;
+        stats.totalTasksCompleted = completed;
+        stats.totalTasksFailed = failed;
+        stats.queueWaitLatency = queueWait.summarize();
+        stats.executionLatency = execution.summarize();
+        stats.averageWaitingTimeMs = stats.queueWaitLatency.meanUs / 1000.0;
+        stats.averageExecutionTimeMs = stats.executionLatency.meanUs / 1000.0;
+
+        const double elapsedSeconds =
+            std::chrono::duration<double>(std::chrono::system_clock::now() - stats.startTime_).count();
+        stats.throughputTasksPerSecond = elapsedSeconds > 0.0 ? completed / elapsedSeconds : 0.0;
+    }
+
+    void TaskScheduler::resetWorkerStatistics()
+    {
+        std::lock_guard<std::mutex> lock(runningSlotsMutex_);
+        for (size_t i = 0; i < runningSlotCount_; ++i)
+        {
+            workerStats_[i].queueWait.reset();
+            workerStats_[i].execution.reset();
+            workerStats_[i].completed.store(0, std::memory_order_relaxed);
+            workerStats_[i].failed.store(0, std::memory_order_relaxed);
+            workerStats_[i].dequeued.store(0, std::memory_order_relaxed);
+            workerStats_[i].deadlineTasks.store(0, std::memory_order_relaxed);
+            workerStats_[i].deadlineMisses.store(0, std::memory_order_relaxed);
         }
+        std::lock_guard<std::mutex> statsLock(externalStatsMutex_);
+        externalStats_->queueWait.reset();
+        externalStats_->execution.reset();
+        externalStats_->completed = 0;
+        externalStats_->failed = 0;
+        externalStats_->dequeued = 0;
+        externalStats_->deadlineTasks = 0;
+        externalStats_->deadlineMisses = 0;
     }
 
 } // namespace radar
@@ -12,7 +12,9 @@
 
 #include "modules/task_scheduler/task_scheduler_implementations.h"
 #include "common/logger.h"
+#include <algorithm>
 #include <chrono>
+#include <limits>
 
 namespace radar
 {
@@ -29,8 +31,9 @@ namespace radar
         {
             std::unique_lock<std::mutex> lock(queueMutex_);
             taskQueue_.push(task);
+            count_.fetch_add(1, std::memory_order_release);
         }
-        taskAvailable_.notify_one();
+        available_.notifyOne();
 
         RADAR_DEBUG("Enqueued task {} to FIFO queue", task->getId());
         return SystemErrors::SUCCESS;
@@ -38,48 +41,56 @@ namespace radar
 
     ErrorCode FIFOTaskQueue::dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs)
     {
-        std::unique_lock<std::mutex> lock(queueMutex_);
+        if (tryDequeue(task))
+        {
+            return SystemErrors::SUCCESS;
+        }
 
         if (timeoutMs == 0)
         {
             // 非阻塞模式
-            if (taskQueue_.empty())
-            {
-                return TaskSchedulerErrors::TASK_QUEUE_FULL;
-            }
-            task = taskQueue_.front();
-            taskQueue_.pop();
-            return SystemErrors::SUCCESS;
+            return TaskSchedulerErrors::TASK_QUEUE_FULL;
         }
 
-        // 阻塞模式，支持超时
-        auto timeout = std::chrono::milliseconds(timeoutMs);
-        if (taskAvailable_.wait_for(lock, timeout, [this]()
-                                    { return !taskQueue_.empty(); }))
+        // 阻塞模式：先自旋再休眠，支持超时
+        if (available_.awaitFor([this, &task]()
+                                { return tryDequeue(task); },
+                                std::chrono::milliseconds(timeoutMs)))
         {
-            if (!taskQueue_.empty())
-            {
-                task = taskQueue_.front();
-                taskQueue_.pop();
-                RADAR_DEBUG("Dequeued task {} from FIFO queue", task->getId());
-                return SystemErrors::SUCCESS;
-            }
+            RADAR_DEBUG("Dequeued task {} from FIFO queue", task->getId());
+            return SystemErrors::SUCCESS;
         }
 
         RADAR_DEBUG("Timeout waiting for task in FIFO queue");
         return TaskSchedulerErrors::TASK_TIMEOUT;
     }
 
-    size_t FIFOTaskQueue::size() const
+    bool FIFOTaskQueue::tryDequeue(ScheduledTaskPtr &task)
     {
+        if (count_.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
         std::unique_lock<std::mutex> lock(queueMutex_);
-        return taskQueue_.size();
+        if (taskQueue_.empty())
+        {
+            return false;
+        }
+        task = std::move(taskQueue_.front());
+        taskQueue_.pop();
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t FIFOTaskQueue::size() const
+    {
+        return count_.load(std::memory_order_relaxed);
     }
 
     bool FIFOTaskQueue::empty() const
     {
-        std::unique_lock<std::mutex> lock(queueMutex_);
-        return taskQueue_.empty();
+        return size() == 0;
     }
 
     void FIFOTaskQueue::clear()
@@ -89,10 +100,46 @@ namespace radar
         {
             taskQueue_.pop();
         }
+        count_.store(0, std::memory_order_relaxed);
         RADAR_INFO("FIFO queue cleared");
     }
 
     // PriorityTaskQueue 实现
+    namespace
+    {
+        /// 无锁队列暂时不一致（生产者已认领槽位但尚未发布）时的最大重试次数
+        constexpr int MAX_DEQUEUE_ATTEMPTS = 8;
+
+        inline size_t highestLevel(uint32_t mask)
+        {
+            size_t level = TASK_PRIORITY_LEVELS - 1;
+            while ((mask & (1u << level)) == 0)
+            {
+                level--;
+            }
+            return level;
+        }
+
+        inline size_t lowestLevel(uint32_t mask)
+        {
+            size_t level = 0;
+            while ((mask & (1u << level)) == 0)
+            {
+                level++;
+            }
+            return level;
+        }
+    } // anonymous namespace
+
+    PriorityTaskQueue::PriorityTaskQueue(size_t levelCapacity, uint32_t agingInterval)
+        : agingInterval_(agingInterval)
+    {
+        for (auto &level : levels_)
+        {
+            level = std::make_unique<LevelQueue>(levelCapacity);
+        }
+    }
+
     ErrorCode PriorityTaskQueue::enqueue(const ScheduledTaskPtr &task)
     {
         if (!task)
@@ -101,11 +148,17 @@ namespace radar
             return TaskSchedulerErrors::SCHEDULING_ERROR;
         }
 
+        const size_t level = levelOf(task);
+        ScheduledTaskPtr item = task;
+        if (!levels_[level]->tryPush(item))
         {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            taskQueue_.push(task);
+            RADAR_WARN("Priority level {} queue is full", level);
+            return TaskSchedulerErrors::TASK_QUEUE_FULL;
         }
-        taskAvailable_.notify_one();
+
+        count_.fetch_add(1, std::memory_order_relaxed);
+        nonEmptyMask_.fetch_or(1u << level, std::memory_order_release);
+        available_.notifyOne();
 
         RADAR_DEBUG("Enqueued task {} to priority queue", task->getId());
         return SystemErrors::SUCCESS;
@@ -113,58 +166,632 @@ namespace radar
 
     ErrorCode PriorityTaskQueue::dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs)
     {
-        std::unique_lock<std::mutex> lock(queueMutex_);
+        if (tryDequeue(task))
+        {
+            return SystemErrors::SUCCESS;
+        }
 
         if (timeoutMs == 0)
         {
             // 非阻塞模式
-            if (taskQueue_.empty())
+            return TaskSchedulerErrors::TASK_QUEUE_FULL;
+        }
+
+        // 阻塞模式：先自旋再休眠，支持超时
+        if (available_.awaitFor([this, &task]()
+                                { return tryDequeue(task); },
+                                std::chrono::milliseconds(timeoutMs)))
+        {
+            RADAR_DEBUG("Dequeued task {} from priority queue", task->getId());
+            return SystemErrors::SUCCESS;
+        }
+
+        RADAR_DEBUG("Timeout waiting for task in priority queue");
+        return TaskSchedulerErrors::TASK_TIMEOUT;
+    }
+
+    /**
+     * @note 只看高于基准的级别并总是取其中最高的非空级别，不推进老化计数：
+     *       老化是为了让低优先级任务不被饿死，不能让检查点让出给同级或更低的任务
+     */
+    bool PriorityTaskQueue::tryDequeueAbove(PacketPriority priority, ScheduledTaskPtr &task)
+    {
+        const size_t floor = static_cast<size_t>(priority) + 1;
+        if (floor >= TASK_PRIORITY_LEVELS)
+        {
+            return false;
+        }
+        const uint32_t aboveMask = ~((1u << floor) - 1);
+
+        for (int attempt = 0; attempt < MAX_DEQUEUE_ATTEMPTS; ++attempt)
+        {
+            const uint32_t mask = nonEmptyMask_.load(std::memory_order_acquire) & aboveMask;
+            if (mask == 0)
+            {
+                return false;
+            }
+
+            const size_t level = highestLevel(mask);
+            if (levels_[level]->tryPop(task))
             {
+                count_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            clearLevelBit(level);
+        }
+        return false;
+    }
+
+    size_t PriorityTaskQueue::size() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    bool PriorityTaskQueue::empty() const
+    {
+        return size() == 0;
+    }
+
+    void PriorityTaskQueue::clear()
+    {
+        ScheduledTaskPtr task;
+        for (auto &level : levels_)
+        {
+            while (level->tryPop(task))
+            {
+                count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+        nonEmptyMask_.store(0, std::memory_order_release);
+        RADAR_INFO("Priority queue cleared");
+    }
+
+    uint64_t PriorityTaskQueue::getAgedDequeueCount() const
+    {
+        return agedDequeues_.load(std::memory_order_relaxed);
+    }
+
+    size_t PriorityTaskQueue::levelOf(const ScheduledTaskPtr &task)
+    {
+        return std::min<size_t>(static_cast<size_t>(task->getPriority()), TASK_PRIORITY_LEVELS - 1);
+    }
+
+    /**
+     * @note 位图只是提示：级别出队失败时先清位，再检查队列是否被并发写入，
+     *       写入方总是先入队后置位，因此不会有任务滞留在未置位的级别中
+     */
+    bool PriorityTaskQueue::tryDequeue(ScheduledTaskPtr &task)
+    {
+        const uint64_t ticket = dequeueTicket_.fetch_add(1, std::memory_order_relaxed) + 1;
+        const bool aging = agingInterval_ > 0 && ticket % agingInterval_ == 0;
+
+        for (int attempt = 0; attempt < MAX_DEQUEUE_ATTEMPTS; ++attempt)
+        {
+            const uint32_t mask = nonEmptyMask_.load(std::memory_order_acquire);
+            if (mask == 0)
+            {
+                return false;
+            }
+
+            const size_t top = highestLevel(mask);
+            const size_t level = aging ? lowestLevel(mask) : top;
+            if (levels_[level]->tryPop(task))
+            {
+                count_.fetch_sub(1, std::memory_order_relaxed);
+                if (level != top)
+                {
+                    agedDequeues_.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+            clearLevelBit(level);
+        }
+        return false;
+    }
+
+    void PriorityTaskQueue::clearLevelBit(size_t level)
+    {
+        const uint32_t bit = 1u << level;
+        nonEmptyMask_.fetch_and(~bit, std::memory_order_acq_rel);
+        if (!levels_[level]->empty())
+        {
+            nonEmptyMask_.fetch_or(bit, std::memory_order_release);
+        }
+    }
+
+    // EDFTaskQueue 实现
+    EDFTaskQueue::EDFTaskQueue(size_t capacity, DeadlineMissPolicy missPolicy)
+        : capacity_(capacity), missPolicy_(missPolicy)
+    {
+        heap_.reserve(capacity);
+    }
+
+    ErrorCode EDFTaskQueue::enqueue(const ScheduledTaskPtr &task)
+    {
+        if (!task)
+        {
+            RADAR_ERROR("Cannot enqueue null task");
+            return TaskSchedulerErrors::SCHEDULING_ERROR;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            if (heap_.size() + demoted_.size() >= capacity_)
+            {
+                RADAR_WARN("EDF queue is full");
                 return TaskSchedulerErrors::TASK_QUEUE_FULL;
             }
-            task = taskQueue_.top();
-            taskQueue_.pop();
+
+            // 没有截止时间的任务取最大键，排在所有带截止时间的任务之后
+            const Timestamp::rep key = task->hasDeadline()
+                                           ? task->getDeadline().time_since_epoch().count()
+                                           : std::numeric_limits<Timestamp::rep>::max();
+            heap_.push_back(HeapEntry{key, nextSequence_++, task});
+            siftUp(heap_.size() - 1);
+            count_.fetch_add(1, std::memory_order_release);
+        }
+        available_.notifyOne();
+
+        RADAR_DEBUG("Enqueued task {} to EDF queue", task->getId());
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode EDFTaskQueue::dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs)
+    {
+        if (tryDequeue(task))
+        {
             return SystemErrors::SUCCESS;
         }
 
-        // 阻塞模式，支持超时
-        auto timeout = std::chrono::milliseconds(timeoutMs);
-        if (taskAvailable_.wait_for(lock, timeout, [this]()
-                                    { return !taskQueue_.empty(); }))
+        if (timeoutMs == 0)
+        {
+            // 非阻塞模式
+            return TaskSchedulerErrors::TASK_QUEUE_FULL;
+        }
+
+        // 阻塞模式：先自旋再休眠，支持超时
+        if (available_.awaitFor([this, &task]()
+                                { return tryDequeue(task); },
+                                std::chrono::milliseconds(timeoutMs)))
+        {
+            RADAR_DEBUG("Dequeued task {} from EDF queue", task->getId());
+            return SystemErrors::SUCCESS;
+        }
+
+        RADAR_DEBUG("Timeout waiting for task in EDF queue");
+        return TaskSchedulerErrors::TASK_TIMEOUT;
+    }
+
+    /**
+     * @note 在优先级更高的任务中按截止时间选最早的，需要扫描整个堆；
+     *       只在确有更高优先级任务排队时由检查点调用。降级策略下已过期的任务不参与让出
+     */
+    bool EDFTaskQueue::tryDequeueAbove(PacketPriority priority, ScheduledTaskPtr &task)
+    {
+        if (count_.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        const Timestamp::rep now = missPolicy_ == DeadlineMissPolicy::DEMOTE
+                                       ? Timestamp::clock::now().time_since_epoch().count()
+                                       : std::numeric_limits<Timestamp::rep>::min();
+        size_t best = heap_.size();
+        for (size_t i = 0; i < heap_.size(); ++i)
         {
-            if (!taskQueue_.empty())
+            const HeapEntry &entry = heap_[i];
+            if (entry.task->getPriority() > priority && entry.deadline >= now &&
+                (best == heap_.size() || before(entry, heap_[best])))
             {
-                task = taskQueue_.top();
-                taskQueue_.pop();
-                RADAR_DEBUG("Dequeued task {} from priority queue", task->getId());
-                return SystemErrors::SUCCESS;
+                best = i;
             }
         }
+        if (best == heap_.size())
+        {
+            return false;
+        }
 
-        RADAR_DEBUG("Timeout waiting for task in priority queue");
+        task = std::move(removeAt(best).task);
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t EDFTaskQueue::size() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    bool EDFTaskQueue::empty() const
+    {
+        return size() == 0;
+    }
+
+    void EDFTaskQueue::clear()
+    {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        heap_.clear();
+        demoted_.clear();
+        count_.store(0, std::memory_order_relaxed);
+        RADAR_INFO("EDF queue cleared");
+    }
+
+    uint64_t EDFTaskQueue::getDemotedCount() const
+    {
+        return demotedCount_.load(std::memory_order_relaxed);
+    }
+
+    bool EDFTaskQueue::before(const HeapEntry &a, const HeapEntry &b)
+    {
+        return a.deadline < b.deadline || (a.deadline == b.deadline && a.sequence < b.sequence);
+    }
+
+    void EDFTaskQueue::siftUp(size_t index)
+    {
+        HeapEntry entry = std::move(heap_[index]);
+        while (index > 0)
+        {
+            const size_t parent = (index - 1) / HEAP_ARITY;
+            if (!before(entry, heap_[parent]))
+            {
+                break;
+            }
+            heap_[index] = std::move(heap_[parent]);
+            index = parent;
+        }
+        heap_[index] = std::move(entry);
+    }
+
+    void EDFTaskQueue::siftDown(size_t index)
+    {
+        const size_t count = heap_.size();
+        HeapEntry entry = std::move(heap_[index]);
+        for (;;)
+        {
+            const size_t first = index * HEAP_ARITY + 1;
+            if (first >= count)
+            {
+                break;
+            }
+
+            // 同一父节点的子节点在内存中相邻，一次扫描选出最早的
+            const size_t last = std::min(first + HEAP_ARITY, count);
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child)
+            {
+                if (before(heap_[child], heap_[best]))
+                {
+                    best = child;
+                }
+            }
+
+            if (!before(heap_[best], entry))
+            {
+                break;
+            }
+            heap_[index] = std::move(heap_[best]);
+            index = best;
+        }
+        heap_[index] = std::move(entry);
+    }
+
+    EDFTaskQueue::HeapEntry EDFTaskQueue::popTop()
+    {
+        return removeAt(0);
+    }
+
+    EDFTaskQueue::HeapEntry EDFTaskQueue::removeAt(size_t index)
+    {
+        HeapEntry removed = std::move(heap_[index]);
+        const size_t last = heap_.size() - 1;
+        if (index != last)
+        {
+            // 末尾元素补位后可能比父节点更早（只能上浮），也可能比子节点更晚（只能下沉）
+            heap_[index] = std::move(heap_[last]);
+            heap_.pop_back();
+            if (index > 0 && before(heap_[index], heap_[(index - 1) / HEAP_ARITY]))
+            {
+                siftUp(index);
+            }
+            else
+            {
+                siftDown(index);
+            }
+        }
+        else
+        {
+            heap_.pop_back();
+        }
+        return removed;
+    }
+
+    bool EDFTaskQueue::tryDequeueLocked(ScheduledTaskPtr &task)
+    {
+        if (missPolicy_ == DeadlineMissPolicy::DEMOTE)
+        {
+            // 过期任务按截止时间顺序移入降级队列，降级队列因此仍按截止时间有序
+            const Timestamp::rep now = Timestamp::clock::now().time_since_epoch().count();
+            while (!heap_.empty() && heap_.front().deadline < now)
+            {
+                demoted_.push_back(std::move(popTop().task));
+                demotedCount_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        if (!heap_.empty())
+        {
+            task = std::move(popTop().task);
+        }
+        else if (!demoted_.empty())
+        {
+            task = std::move(demoted_.front());
+            demoted_.pop_front();
+        }
+        else
+        {
+            return false;
+        }
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool EDFTaskQueue::tryDequeue(ScheduledTaskPtr &task)
+    {
+        if (count_.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        return tryDequeueLocked(task);
+    }
+
+    // FairShareTaskQueue 实现
+    ErrorCode FairShareTaskQueue::enqueue(const ScheduledTaskPtr &task)
+    {
+        if (!task)
+        {
+            RADAR_ERROR("Cannot enqueue null task");
+            return TaskSchedulerErrors::SCHEDULING_ERROR;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            Tenant *tenant = findTenant(task->getTenantId());
+            if (!tenant)
+            {
+                tenant = findTenant(DEFAULT_TENANT);
+            }
+            if (!tenant)
+            {
+                RADAR_ERROR("No tenant for task {} (tenant {})", task->getId(), task->getTenantId());
+                return TaskSchedulerErrors::SCHEDULING_ERROR;
+            }
+
+            ErrorCode result = tenant->queue->enqueue(task);
+            if (result != SystemErrors::SUCCESS)
+            {
+                return result;
+            }
+            if (tenant->pending++ == 0)
+            {
+                // 重新变为繁忙：追平当前进度，空闲期间不积攒额度
+                tenant->virtualTime = std::max(tenant->virtualTime, virtualClock_);
+            }
+            count_.fetch_add(1, std::memory_order_release);
+        }
+        available_.notifyOne();
+        return SystemErrors::SUCCESS;
+    }
+
+    ErrorCode FairShareTaskQueue::dequeue(ScheduledTaskPtr &task, uint32_t timeoutMs)
+    {
+        if (tryDequeue(task))
+        {
+            return SystemErrors::SUCCESS;
+        }
+
+        if (timeoutMs == 0)
+        {
+            // 非阻塞模式
+            return TaskSchedulerErrors::TASK_QUEUE_FULL;
+        }
+
+        if (available_.awaitFor([this, &task]()
+                                { return tryDequeue(task); },
+                                std::chrono::milliseconds(timeoutMs)))
+        {
+            return SystemErrors::SUCCESS;
+        }
         return TaskSchedulerErrors::TASK_TIMEOUT;
     }
 
-    size_t PriorityTaskQueue::size() const
+    bool FairShareTaskQueue::tryDequeue(ScheduledTaskPtr &task)
     {
+        if (count_.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
         std::unique_lock<std::mutex> lock(queueMutex_);
-        return taskQueue_.size();
+        return tryDequeueLocked(task);
     }
 
-    bool PriorityTaskQueue::empty() const
+    size_t FairShareTaskQueue::size() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    bool FairShareTaskQueue::empty() const
+    {
+        return size() == 0;
+    }
+
+    void FairShareTaskQueue::clear()
     {
         std::unique_lock<std::mutex> lock(queueMutex_);
-        return taskQueue_.empty();
+        for (auto &tenant : tenants_)
+        {
+            tenant->queue->clear();
+            tenant->pending = 0;
+        }
+        count_.store(0, std::memory_order_relaxed);
+        RADAR_INFO("Fair share queue cleared");
     }
 
-    void PriorityTaskQueue::clear()
+    ErrorCode FairShareTaskQueue::setTenant(const TenantConfig &config, std::unique_ptr<TaskQueue> queue)
     {
+        if (config.weight == 0)
+        {
+            RADAR_ERROR("Tenant {} weight must be positive", config.id);
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
         std::unique_lock<std::mutex> lock(queueMutex_);
-        while (!taskQueue_.empty())
+        if (Tenant *tenant = findTenant(config.id))
         {
-            taskQueue_.pop();
+            tenant->config.weight = config.weight;
+            if (!config.name.empty())
+            {
+                tenant->config.name = config.name;
+            }
+            return SystemErrors::SUCCESS;
         }
-        RADAR_INFO("Priority queue cleared");
+        if (!queue)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        auto tenant = std::make_unique<Tenant>();
+        tenant->config = config;
+        if (tenant->config.name.empty())
+        {
+            tenant->config.name = "tenant-" + std::to_string(config.id);
+        }
+        tenant->queue = std::move(queue);
+        tenant->virtualTime = virtualClock_;
+        tenants_.push_back(std::move(tenant));
+        std::sort(tenants_.begin(), tenants_.end(),
+                  [](const std::unique_ptr<Tenant> &a, const std::unique_ptr<Tenant> &b)
+                  { return a->config.id < b->config.id; });
+        return SystemErrors::SUCCESS;
+    }
+
+    bool FairShareTaskQueue::hasTenant(TenantId tenant) const
+    {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        return findTenant(tenant) != nullptr;
+    }
+
+    /**
+     * @note 出队时预扣的是修正前的估计值，这里按同一个估计值修正后再更新估计（1/8指数平均）
+     */
+    void FairShareTaskQueue::recordExecution(TenantId tenantId, uint64_t queueWaitNs, uint64_t executionNs)
+    {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        Tenant *tenant = findTenant(tenantId);
+        if (!tenant)
+        {
+            tenant = findTenant(DEFAULT_TENANT);
+        }
+        if (!tenant)
+        {
+            return;
+        }
+
+        const double correction = static_cast<double>(executionNs) - static_cast<double>(tenant->costEstimateNs);
+        tenant->virtualTime += correction / tenant->config.weight;
+        tenant->costEstimateNs = std::max<uint64_t>(
+            1, static_cast<uint64_t>(static_cast<int64_t>(tenant->costEstimateNs) +
+                                     (static_cast<int64_t>(executionNs) - static_cast<int64_t>(tenant->costEstimateNs)) / 8));
+
+        ++tenant->completed;
+        tenant->cpuTimeNs += executionNs;
+        tenant->queueWait.record(queueWaitNs);
+        tenant->execution.record(executionNs);
+    }
+
+    std::vector<TenantStatus> FairShareTaskQueue::getTenantStatus(double elapsedSeconds) const
+    {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        uint64_t totalWeight = 0;
+        uint64_t totalCpuTimeNs = 0;
+        for (const auto &tenant : tenants_)
+        {
+            totalWeight += tenant->config.weight;
+            totalCpuTimeNs += tenant->cpuTimeNs;
+        }
+
+        std::vector<TenantStatus> statuses;
+        statuses.reserve(tenants_.size());
+        for (const auto &tenant : tenants_)
+        {
+            TenantStatus status;
+            status.id = tenant->config.id;
+            status.name = tenant->config.name;
+            status.weight = tenant->config.weight;
+            status.configuredShare = totalWeight > 0 ? static_cast<double>(tenant->config.weight) / totalWeight : 0.0;
+            status.cpuShare = totalCpuTimeNs > 0 ? static_cast<double>(tenant->cpuTimeNs) / totalCpuTimeNs : 0.0;
+            status.pendingTasks = static_cast<uint32_t>(tenant->pending);
+            status.completedTasks = tenant->completed;
+            status.cpuTimeMs = tenant->cpuTimeNs / 1e6;
+            status.throughputTasksPerSec = elapsedSeconds > 0.0 ? tenant->completed / elapsedSeconds : 0.0;
+
+            LatencyHistogram::Snapshot queueWait;
+            queueWait.add(tenant->queueWait);
+            status.queueWaitLatency = queueWait.summarize();
+            LatencyHistogram::Snapshot execution;
+            execution.add(tenant->execution);
+            status.executionLatency = execution.summarize();
+            statuses.push_back(std::move(status));
+        }
+        return statuses;
+    }
+
+    void FairShareTaskQueue::resetStatistics()
+    {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        for (auto &tenant : tenants_)
+        {
+            tenant->completed = 0;
+            tenant->cpuTimeNs = 0;
+            tenant->queueWait.reset();
+            tenant->execution.reset();
+        }
+    }
+
+    FairShareTaskQueue::Tenant *FairShareTaskQueue::findTenant(TenantId tenant) const
+    {
+        for (const auto &entry : tenants_)
+        {
+            if (entry->config.id == tenant)
+            {
+                return entry.get();
+            }
+        }
+        return nullptr;
+    }
+
+    bool FairShareTaskQueue::tryDequeueLocked(ScheduledTaskPtr &task)
+    {
+        Tenant *next = nullptr;
+        for (const auto &tenant : tenants_)
+        {
+            if (tenant->pending > 0 && (!next || tenant->virtualTime < next->virtualTime))
+            {
+                next = tenant.get();
+            }
+        }
+        if (!next || next->queue->dequeue(task, 0) != SystemErrors::SUCCESS || !task)
+        {
+            return false;
+        }
+
+        --next->pending;
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        virtualClock_ = std::max(virtualClock_, next->virtualTime);
+        next->virtualTime += static_cast<double>(next->costEstimateNs) / next->config.weight;
+        return true;
     }
 
 } // namespace radar
@@ -2,7 +2,7 @@
  * @file task_scheduler_specialized.cpp
  * @brief 任务调度器特殊实现
  *
- * 实现ThreadPoolScheduler和RealTimeScheduler的具体功能。
+ * 实现ThreadPoolScheduler、LoadBalanceScheduler和RealTimeScheduler的具体功能。
  *
  * @author Kelin
  * @version 1.0
@@ -13,6 +13,9 @@
 #include "common/logger.h"
 #include "modules/task_scheduler/task_scheduler_implementations.h"
 
+#include <algorithm>
+#include <random>
+
 namespace radar {
 
 // ThreadPoolScheduler 实现
@@ -24,38 +27,230 @@ ThreadPoolScheduler::ThreadPoolScheduler(uint32_t threadCount, std::shared_ptr<s
     RADAR_INFO("ThreadPoolScheduler created with {} threads", threadCount_);
 }
 
-void ThreadPoolScheduler::workerLoop() {
-    RADAR_DEBUG("ThreadPoolScheduler worker thread started");
+WorkStealingPoolConfig ThreadPoolScheduler::makeWorkerPoolConfig(uint32_t /*threadCount*/) const {
+    // 核心线程数取构造参数，弹性上限、存活时间与增长阈值仍按配置
+    WorkStealingPoolConfig poolConfig = TaskScheduler::makeWorkerPoolConfig(threadCount_);
+    poolConfig.name = "ThreadPoolScheduler";
+    return poolConfig;
+}
 
-    while (!shouldStop_.load()) {
-        ScheduledTaskPtr task;
-        ErrorCode result = taskQueue_->dequeue(task, 100);  // 100ms 超时
+// LoadBalanceScheduler 实现
+LoadBalanceScheduler::LoadBalanceScheduler(std::shared_ptr<spdlog::logger> logger) : TaskScheduler(logger) {
+    RADAR_INFO("LoadBalanceScheduler created");
+}
 
-        if (result == SystemErrors::SUCCESS && task) {
-            if (currentConcurrentTasks_.load() < maxConcurrentTasks_.load()) {
-                currentConcurrentTasks_++;
-                statistics_.currentPendingTasks--;
+ErrorCode LoadBalanceScheduler::configure(const TaskSchedulerConfig &config) {
+    ErrorCode result = TaskScheduler::configure(config);
+    if (result != SystemErrors::SUCCESS) {
+        return result;
+    }
+    setLoadBalancePolicy(config.loadBalancePolicy == "jsq" ? LoadBalancePolicy::JOIN_SHORTEST_QUEUE
+                                                            : LoadBalancePolicy::POWER_OF_TWO_CHOICES);
+    setStickyRouteCapacity(config.stickyRouteCapacity);
+    return SystemErrors::SUCCESS;
+}
 
-                // 异步执行任务
-                std::thread([this, task]() {
-                    executeTask(task);
-                    currentConcurrentTasks_--;
-                }).detach();
-            } else {
-                // 重新入队
-                taskQueue_->enqueue(task);
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            }
-        } else if (result == TaskSchedulerErrors::TASK_TIMEOUT) {
-            // 超时，继续循环
-            continue;
+ErrorCode LoadBalanceScheduler::addProcessor(std::shared_ptr<IDataProcessor> processor) {
+    if (!processor) {
+        return SystemErrors::INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    for (const auto &instance : instances_) {
+        if (instance->processor == processor) {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+    }
+    auto instance = std::make_shared<Instance>();
+    instance->processor = std::move(processor);
+    instances_.push_back(std::move(instance));
+    RADAR_INFO("Processor instance added, {} instances registered", instances_.size());
+    return SystemErrors::SUCCESS;
+}
+
+ErrorCode LoadBalanceScheduler::removeProcessor(const std::shared_ptr<IDataProcessor> &processor) {
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    auto it = std::find_if(instances_.begin(), instances_.end(),
+                           [&processor](const InstancePtr &instance) { return instance->processor == processor; });
+    if (it == instances_.end()) {
+        return SystemErrors::INVALID_PARAMETER;
+    }
+
+    const InstancePtr removed = *it;
+    instances_.erase(it);
+    for (auto route = stickyRoutes_.begin(); route != stickyRoutes_.end();) {
+        if (route->second == removed) {
+            stickyIndex_.erase(route->first);
+            route = stickyRoutes_.erase(route);
         } else {
-            // 其他错误，记录并继续
-            RADAR_ERROR("Failed to dequeue task: {}", static_cast<int>(result));
+            ++route;
         }
     }
+    RADAR_INFO("Processor instance removed, {} instances registered", instances_.size());
+    return SystemErrors::SUCCESS;
+}
 
-    RADAR_DEBUG("ThreadPoolScheduler worker thread stopped");
+size_t LoadBalanceScheduler::getProcessorCount() const {
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    return instances_.size();
+}
+
+void LoadBalanceScheduler::setLoadBalancePolicy(LoadBalancePolicy policy) {
+    policy_.store(policy, std::memory_order_relaxed);
+    RADAR_INFO("Load balance policy set to {}",
+               policy == LoadBalancePolicy::JOIN_SHORTEST_QUEUE ? "join-shortest-queue" : "power-of-two-choices");
+}
+
+void LoadBalanceScheduler::setAffinityKey(AffinityKey key) {
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    affinityKey_ = std::move(key);
+    stickyRoutes_.clear();
+    stickyIndex_.clear();
+}
+
+void LoadBalanceScheduler::setStickyRouteCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    stickyRouteCapacity_ = capacity;
+    trimStickyRoutesLocked(capacity);
+}
+
+void LoadBalanceScheduler::trimStickyRoutesLocked(size_t capacity) {
+    while (stickyRoutes_.size() > capacity) {
+        stickyIndex_.erase(stickyRoutes_.back().first);
+        stickyRoutes_.pop_back();
+    }
+}
+
+Future<ProcessingResultPtr> LoadBalanceScheduler::submitProcessingTask(std::shared_ptr<IDataProcessor> processor,
+                                                                       RawDataPacketPtr packet,
+                                                                       PacketPriority priority) {
+    if (!packet) {
+        RADAR_ERROR("Invalid packet for processing task");
+        throw std::invalid_argument("Packet cannot be null");
+    }
+
+    InstancePtr instance = selectInstance(*packet);
+    if (!instance) {
+        // 没有登记实例：退化为直接使用调用者给出的处理器
+        return TaskScheduler::submitProcessingTask(std::move(processor), std::move(packet), priority);
+    }
+
+    // 任务未执行就被取消、丢弃或拒绝时，随任务函数析构归还在途计数
+    struct DispatchGuard {
+        InstancePtr instance;
+        bool finished = false;
+        ~DispatchGuard() {
+            if (!finished) {
+                instance->inFlight.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    };
+    instance->inFlight.fetch_add(1, std::memory_order_relaxed);
+    instance->dispatched.fetch_add(1, std::memory_order_relaxed);
+    auto guard = std::make_shared<DispatchGuard>();
+    guard->instance = instance;
+
+    auto task = [guard, packet]() -> ProcessingResultPtr {
+        Instance &target = *guard->instance;
+        const auto start = std::chrono::steady_clock::now();
+        ProcessingResultPtr result;
+        ErrorCode status = target.processor->processPacket(packet, result);
+        if (status != SystemErrors::SUCCESS) {
+            result = std::make_shared<ProcessingResult>();
+        }
+        const auto serviceNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+        // 近期平均服务时间：各工作线程各自读后写，偶尔丢一次更新不影响派发
+        const uint64_t previous = target.serviceTimeNs.load(std::memory_order_relaxed);
+        const uint64_t updated =
+            previous == 0 ? serviceNs
+                          : static_cast<uint64_t>(static_cast<int64_t>(previous) +
+                                                  (static_cast<int64_t>(serviceNs) - static_cast<int64_t>(previous)) / 8);
+        target.serviceTimeNs.store(std::max<uint64_t>(updated, 1), std::memory_order_relaxed);
+        target.completed.fetch_add(1, std::memory_order_relaxed);
+        target.inFlight.fetch_sub(1, std::memory_order_relaxed);
+        guard->finished = true;
+        return result;
+    };
+
+    const Timestamp releaseTime = packet->timestamp == Timestamp{} ? Timestamp::clock::now() : packet->timestamp;
+    return submitDeadlineTask(std::move(task), priority, releaseTime, packet->sensorId);
+}
+
+std::vector<LoadBalanceScheduler::InstanceStatus> LoadBalanceScheduler::getInstanceStatus() const {
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    std::vector<InstanceStatus> statuses;
+    statuses.reserve(instances_.size());
+    for (const auto &instance : instances_) {
+        InstanceStatus status;
+        status.inFlight = instance->inFlight.load(std::memory_order_relaxed);
+        status.queueDepth = instance->processor->getQueueDepth();
+        status.dispatched = instance->dispatched.load(std::memory_order_relaxed);
+        status.completed = instance->completed.load(std::memory_order_relaxed);
+        status.averageServiceTimeUs = instance->serviceTimeNs.load(std::memory_order_relaxed) / 1000.0;
+        status.stickyKeys = static_cast<size_t>(
+            std::count_if(stickyRoutes_.begin(), stickyRoutes_.end(),
+                          [&instance](const auto &route) { return route.second == instance; }));
+        statuses.push_back(status);
+    }
+    return statuses;
+}
+
+double LoadBalanceScheduler::expectedCompletion(const Instance &instance) {
+    // 尚无服务记录时按1纳秒计，新实例先接收任务以获得服务时间
+    const uint64_t serviceNs = std::max<uint64_t>(instance.serviceTimeNs.load(std::memory_order_relaxed), 1);
+    // 处理器自报的积压已包含本调度器派发且已开始处理的数据包，取较大者避免重复计数，
+    // 同时能看到其他提交者（直接调用processPacketAsync等）造成的排队
+    const size_t depth = std::max<size_t>(instance.inFlight.load(std::memory_order_relaxed),
+                                          instance.processor->getQueueDepth());
+    return (static_cast<double>(depth) + 1.0) * static_cast<double>(serviceNs);
+}
+
+LoadBalanceScheduler::InstancePtr LoadBalanceScheduler::selectByLoadLocked() const {
+    const size_t count = instances_.size();
+    if (count == 1) {
+        return instances_.front();
+    }
+
+    if (policy_.load(std::memory_order_relaxed) == LoadBalancePolicy::POWER_OF_TWO_CHOICES) {
+        thread_local std::minstd_rand random(std::random_device{}());
+        const size_t first = random() % count;
+        const size_t second = (first + 1 + random() % (count - 1)) % count;
+        return expectedCompletion(*instances_[second]) < expectedCompletion(*instances_[first]) ? instances_[second]
+                                                                                                : instances_[first];
+    }
+
+    return *std::min_element(instances_.begin(), instances_.end(), [](const InstancePtr &a, const InstancePtr &b) {
+        return expectedCompletion(*a) < expectedCompletion(*b);
+    });
+}
+
+LoadBalanceScheduler::InstancePtr LoadBalanceScheduler::selectInstance(const RawDataPacket &packet) {
+    std::lock_guard<std::mutex> lock(instancesMutex_);
+    if (instances_.empty()) {
+        return nullptr;
+    }
+    if (!affinityKey_) {
+        return selectByLoadLocked();
+    }
+
+    // 键首次出现时按负载选择并固定，之后同一键的数据包都派发到该实例；
+    // 命中的键移到最前，超出上限时淘汰最久未出现的键
+    const uint64_t key = affinityKey_(packet);
+    auto route = stickyIndex_.find(key);
+    if (route != stickyIndex_.end()) {
+        stickyRoutes_.splice(stickyRoutes_.begin(), stickyRoutes_, route->second);
+        return route->second->second;
+    }
+    InstancePtr instance = selectByLoadLocked();
+    if (stickyRouteCapacity_ == 0) {
+        return instance;
+    }
+    trimStickyRoutesLocked(stickyRouteCapacity_ - 1);
+    stickyRoutes_.emplace_front(key, instance);
+    stickyIndex_.emplace(key, stickyRoutes_.begin());
+    return instance;
 }
 
 // RealTimeScheduler 实现
@@ -88,60 +283,17 @@ ErrorCode RealTimeScheduler::executeTask(const ScheduledTaskPtr &task) {
     return TaskScheduler::executeTask(task);
 }
 
-void RealTimeScheduler::workerLoop() {
-    RADAR_DEBUG("RealTimeScheduler worker thread started");
-
-    while (!shouldStop_.load()) {
-        ScheduledTaskPtr task;
-        ErrorCode result = taskQueue_->dequeue(task, 50);  // 更短的超时时间
-
-        if (result == SystemErrors::SUCCESS && task) {
-            // 实时调度逻辑
-            if (preemptionEnabled_) {
-                // 检查是否需要抢占当前任务
-                // 这里简化实现，实际需要更复杂的逻辑
-            }
-
-            if (currentConcurrentTasks_.load() < maxConcurrentTasks_.load()) {
-                currentConcurrentTasks_++;
-                statistics_.currentPendingTasks--;
-
-                // 异步执行任务
-                std::thread([this, task]() {
-                    executeTask(task);
-                    currentConcurrentTasks_--;
-                }).detach();
-            } else {
-                // 重新入队
-                taskQueue_->enqueue(task);
-                std::this_thread::sleep_for(std::chrono::milliseconds(5));  // 更短的睡眠时间
-            }
-        } else if (result == TaskSchedulerErrors::TASK_TIMEOUT) {
-            // 超时，继续循环
-            continue;
-        } else {
-            // 其他错误，记录并继续
-            RADAR_ERROR("Failed to dequeue task: {}", static_cast<int>(result));
-        }
-    }
-
-    RADAR_DEBUG("RealTimeScheduler worker thread stopped");
-}
-
-bool RealTimeScheduler::shouldPreempt(const ScheduledTaskPtr &newTask, const ScheduledTaskPtr &runningTask) const {
-    if (!newTask || !runningTask) {
-        return false;
-    }
-
-    // 基于优先级的抢占逻辑
-    return static_cast<int>(newTask->getPriority()) > static_cast<int>(runningTask->getPriority());
+WorkStealingPoolConfig RealTimeScheduler::makeWorkerPoolConfig(uint32_t threadCount) const {
+    WorkStealingPoolConfig poolConfig = TaskScheduler::makeWorkerPoolConfig(threadCount);
+    // 实时任务对唤醒延迟敏感：空闲线程自旋更久再休眠
+    poolConfig.spinRounds = 1024;
+    poolConfig.name = "RealTimeScheduler";
+    return poolConfig;
 }
 
-ErrorCode RealTimeScheduler::setRealTimeScheduling() {
-    // 设置线程调度策略为实时
-    // 这里需要平台特定的实现
-    RADAR_INFO("Real-time scheduling policy set");
-    return SystemErrors::SUCCESS;
+bool RealTimeScheduler::shouldPreempt(PacketPriority waiting, PacketPriority running) const {
+    // 基于优先级的抢占逻辑，长任务在检查点让出
+    return preemptionEnabled_.load(std::memory_order_relaxed) && TaskScheduler::shouldPreempt(waiting, running);
 }
 
 }  // namespace radar
@@ -141,42 +141,4 @@ namespace radar
         (void)oldState;
     }
 
-    void TaskStatistics::updateExecutionStats(double executionTimeMs, double waitingTimeMs)
-    {
-        // 更新平均执行时间
-        uint64_t completed = totalTasksCompleted.load();
-        if (completed > 0)
-        {
-            double currentAvg = averageExecutionTimeMs.load();
-            averageExecutionTimeMs.store((currentAvg * (completed - 1) + executionTimeMs) / completed);
-        }
-        else
-        {
-            averageExecutionTimeMs.store(executionTimeMs);
-        }
-
-        // 更新平均等待时间
-        if (completed > 0)
-        {
-            double currentAvg = averageWaitingTimeMs.load();
-            averageWaitingTimeMs.store((currentAvg * (completed - 1) + waitingTimeMs) / completed);
-        }
-        else
-        {
-            averageWaitingTimeMs.store(waitingTimeMs);
-        }
-
-        // 更新吞吐量（每秒任务数）
-        auto now = std::chrono::system_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
-                           now - startTime_)
-                           .count();
-        if (elapsed > 0)
-        {
-            throughputTasksPerSecond.store(static_cast<double>(completed) / elapsed);
-        }
-
-        lastUpdateTime_ = now;
-    }
-
 } // namespace radar
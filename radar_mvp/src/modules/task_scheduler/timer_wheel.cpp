@@ -0,0 +1,254 @@
+/**
+ * @file timer_wheel.cpp
+ * @brief 分层时间轮定时器实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/task_scheduler/timer_wheel.h"
+#include <algorithm>
+#include <utility>
+
+namespace radar
+{
+
+    namespace
+    {
+        inline uint64_t lowestBit(uint64_t mask)
+        {
+            return static_cast<uint64_t>(__builtin_ctzll(mask));
+        }
+    } // anonymous namespace
+
+    TimerWheel::TimerWheel(uint64_t startTick)
+        : now_(startTick)
+    {
+        heads_.fill(NIL);
+    }
+
+    TimerWheel::TimerId TimerWheel::schedule(uint64_t expiryTick, Callback callback, uint64_t periodTicks)
+    {
+        uint32_t index;
+        if (!freeNodes_.empty())
+        {
+            index = freeNodes_.back();
+            freeNodes_.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+
+        Node &node = nodes_[index];
+        node.callback = std::move(callback);
+        node.expiry = std::max(expiryTick, now_ + 1);
+        node.period = periodTicks;
+        node.active = true;
+        place(index);
+        count_++;
+
+        return (static_cast<TimerId>(node.generation) << 32) | index;
+    }
+
+    bool TimerWheel::cancel(TimerId id)
+    {
+        const uint32_t index = static_cast<uint32_t>(id & 0xFFFFFFFFull);
+        const uint32_t generation = static_cast<uint32_t>(id >> 32);
+        if (index >= nodes_.size())
+        {
+            return false;
+        }
+
+        Node &node = nodes_[index];
+        if (!node.active || node.generation != generation)
+        {
+            return false;
+        }
+
+        unlink(index);
+        node.callback = nullptr;
+        release(index);
+        return true;
+    }
+
+    size_t TimerWheel::advanceTo(uint64_t targetTick, std::vector<Callback> &expired)
+    {
+        size_t fired = 0;
+        while (now_ < targetTick)
+        {
+            if (count_ == 0)
+            {
+                now_ = targetTick;
+                break;
+            }
+
+            // 下一个事件之前的tick既没有到期定时器也不跨越级联边界，可以直接跳过
+            const uint64_t step = std::min(ticksUntilNextEvent(), targetTick - now_);
+            now_ += step - 1;
+            fired += tick(expired, targetTick);
+        }
+        return fired;
+    }
+
+    /**
+     * @note 同一级中的定时器都位于当前槽位之后，且低级的定时器总是早于高级的，
+     *       因此第一个非空级别中当前槽位之后的第一个非空槽位就是下一个事件
+     */
+    uint64_t TimerWheel::ticksUntilNextEvent() const
+    {
+        for (size_t level = 0; level < LEVELS; ++level)
+        {
+            const size_t shift = SLOT_BITS * level;
+            const uint64_t position = (now_ >> shift) & SLOT_MASK;
+            const uint64_t later = position == SLOT_MASK ? 0 : occupied_[level] & (~0ull << (position + 1));
+            if (later != 0)
+            {
+                const uint64_t slotStart = ((now_ >> shift) + (lowestBit(later) - position)) << shift;
+                return slotStart - now_;
+            }
+        }
+
+        // 只剩溢出定时器：推进到最高级轮转完一圈时重新分配
+        return (((now_ >> WHEEL_BITS) + 1) << WHEEL_BITS) - now_;
+    }
+
+    void TimerWheel::place(uint32_t index)
+    {
+        Node &node = nodes_[index];
+
+        size_t list = OVERFLOW_LIST;
+        if ((node.expiry >> WHEEL_BITS) == (now_ >> WHEEL_BITS))
+        {
+            // 选择与当前tick共享更高位的最低级：到期前一定会被级联到第0级
+            size_t level = 0;
+            while ((node.expiry >> (SLOT_BITS * (level + 1))) != (now_ >> (SLOT_BITS * (level + 1))))
+            {
+                level++;
+            }
+            const uint64_t slot = (node.expiry >> (SLOT_BITS * level)) & SLOT_MASK;
+            list = level * SLOTS + slot;
+            occupied_[level] |= 1ull << slot;
+        }
+
+        node.list = static_cast<uint32_t>(list);
+        node.prev = NIL;
+        node.next = heads_[list];
+        if (node.next != NIL)
+        {
+            nodes_[node.next].prev = index;
+        }
+        heads_[list] = index;
+    }
+
+    void TimerWheel::unlink(uint32_t index)
+    {
+        Node &node = nodes_[index];
+        if (node.prev != NIL)
+        {
+            nodes_[node.prev].next = node.next;
+        }
+        else
+        {
+            heads_[node.list] = node.next;
+        }
+        if (node.next != NIL)
+        {
+            nodes_[node.next].prev = node.prev;
+        }
+
+        if (heads_[node.list] == NIL && node.list != OVERFLOW_LIST)
+        {
+            occupied_[node.list / SLOTS] &= ~(1ull << (node.list % SLOTS));
+        }
+        node.prev = NIL;
+        node.next = NIL;
+    }
+
+    void TimerWheel::redistribute(size_t list)
+    {
+        uint32_t index = heads_[list];
+        heads_[list] = NIL;
+        if (list != OVERFLOW_LIST)
+        {
+            occupied_[list / SLOTS] &= ~(1ull << (list % SLOTS));
+        }
+
+        while (index != NIL)
+        {
+            const uint32_t next = nodes_[index].next;
+            place(index);
+            index = next;
+        }
+    }
+
+    size_t TimerWheel::tick(std::vector<Callback> &expired, uint64_t horizon)
+    {
+        now_++;
+
+        // 跨越第0级边界：从最高的换槽级别开始逐级下放
+        if ((now_ & SLOT_MASK) == 0)
+        {
+            size_t level = 1;
+            while (level < LEVELS && ((now_ >> (SLOT_BITS * level)) & SLOT_MASK) == 0)
+            {
+                level++;
+            }
+            if (level == LEVELS)
+            {
+                redistribute(OVERFLOW_LIST);
+                level = LEVELS - 1;
+            }
+            for (; level >= 1; --level)
+            {
+                redistribute(level * SLOTS + ((now_ >> (SLOT_BITS * level)) & SLOT_MASK));
+            }
+        }
+
+        const uint64_t slot = now_ & SLOT_MASK;
+        uint32_t index = heads_[slot];
+        heads_[slot] = NIL;
+        occupied_[0] &= ~(1ull << slot);
+
+        size_t fired = 0;
+        while (index != NIL)
+        {
+            Node &node = nodes_[index];
+            const uint32_t next = node.next;
+            fired++;
+
+            if (node.period > 0)
+            {
+                expired.push_back(node.callback);
+                uint64_t nextExpiry = node.expiry + node.period;
+                if (nextExpiry <= horizon)
+                {
+                    nextExpiry += ((horizon - nextExpiry) / node.period + 1) * node.period;
+                }
+                node.expiry = nextExpiry;
+                place(index);
+            }
+            else
+            {
+                expired.push_back(std::move(node.callback));
+                node.callback = nullptr;
+                release(index);
+            }
+            index = next;
+        }
+        return fired;
+    }
+
+    void TimerWheel::release(uint32_t index)
+    {
+        Node &node = nodes_[index];
+        node.active = false;
+        node.generation = node.generation == UINT32_MAX ? 1 : node.generation + 1;
+        freeNodes_.push_back(index);
+        count_--;
+    }
+
+} // namespace radar
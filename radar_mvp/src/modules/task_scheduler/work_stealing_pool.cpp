@@ -0,0 +1,797 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @brief 工作窃取线程池实现
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include "modules/task_scheduler/work_stealing_pool.h"
+#include "common/logger.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace radar
+{
+
+    namespace
+    {
+        /// 当前线程所属的线程池（非工作线程为nullptr）
+        thread_local const WorkStealingPool *tlsPool = nullptr;
+
+        /// 当前线程在所属线程池中的下标
+        thread_local int tlsWorkerIndex = -1;
+
+        /**
+         * @brief xorshift64随机数，用于分散窃取起点
+         */
+        inline uint64_t nextRandom(uint64_t &state)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+
+        /**
+         * @brief 单调时钟的当前时间（纳秒）
+         */
+        inline uint64_t nowNs()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now().time_since_epoch())
+                                             .count());
+        }
+    } // anonymous namespace
+
+    WorkStealingPool::WorkStealingPool() = default;
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        stop();
+        clear();
+    }
+
+    ErrorCode WorkStealingPool::start(const WorkStealingPoolConfig &config, TaskHandler handler)
+    {
+        if (!handler)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        std::lock_guard<std::mutex> lock(lifecycleMutex_);
+        if (running_.load())
+        {
+            return TaskSchedulerErrors::THREAD_POOL_ERROR;
+        }
+
+        config_ = config;
+        if (config_.threadCount == 0)
+        {
+            config_.threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        config_.injectionBatch = std::max<uint32_t>(config_.injectionBatch, 1);
+        config_.maxThreadCount = std::max(config_.maxThreadCount, config_.threadCount);
+        config_.scaleUpChecks = std::max<uint32_t>(config_.scaleUpChecks, 1);
+        config_.scaleCheckIntervalMs = std::max<uint32_t>(config_.scaleCheckIntervalMs, 1);
+        handler_ = std::move(handler);
+        stopping_ = false;
+        elastic_ = config_.maxThreadCount > config_.threadCount;
+
+        // 槽位按最大线程数一次分配，伸缩期间不重建，窃取者无需加锁即可遍历；
+        // 工作线程状态由各线程在完成放置后自行分配
+        slots_ = std::make_unique<WorkerSlot[]>(config_.maxThreadCount);
+        slotCount_ = config_.maxThreadCount;
+        {
+            std::lock_guard<std::mutex> startupLock(startupMutex_);
+            readyWorkers_ = 0;
+            startupAborted_ = false;
+        }
+
+        // 先置位运行标志，工作线程一启动就可以向本地队列提交
+        running_ = true;
+        uint32_t started = 0;
+        try
+        {
+            for (; started < config_.threadCount; ++started)
+            {
+                slots_[started].active = true;
+                slots_[started].thread = std::thread([this, started]()
+                                                     { workerMain(started); });
+            }
+        }
+        catch (const std::exception &e)
+        {
+            RADAR_ERROR("Failed to start {} worker threads: {}", config_.name, e.what());
+            {
+                std::lock_guard<std::mutex> startupLock(startupMutex_);
+                startupAborted_ = true;
+            }
+            startupDone_.notify_all();
+            for (uint32_t i = 0; i < started; ++i)
+            {
+                slots_[i].thread.join();
+            }
+            slots_.reset();
+            slotCount_ = 0;
+            running_ = false;
+            return TaskSchedulerErrors::THREAD_POOL_ERROR;
+        }
+
+        // 等全部核心线程就绪后再返回：之后核心槽位上的线程状态都已发布
+        {
+            std::unique_lock<std::mutex> startupLock(startupMutex_);
+            startupDone_.wait(startupLock, [this]()
+                              { return readyWorkers_ == config_.threadCount; });
+        }
+        activeWorkers_ = config_.threadCount;
+        peakWorkers_ = std::max(peakWorkers_.load(), config_.threadCount);
+
+        if (elastic_)
+        {
+            {
+                std::lock_guard<std::mutex> scalerLock(scalerMutex_);
+                scalerStop_ = false;
+            }
+            overloadedChecks_ = 0;
+            lastExecuted_ = 0;
+            lastProgressNs_ = nowNs();
+            try
+            {
+                scaler_ = std::thread([this]()
+                                      { scalerLoop(); });
+            }
+            catch (const std::exception &e)
+            {
+                // 伸缩只是优化，检查线程起不来时按核心线程数固定运行
+                RADAR_WARN("{} failed to start scaler thread, pool size fixed: {}", config_.name, e.what());
+            }
+        }
+
+        recordSize(config_.threadCount, 0);
+        RADAR_INFO("{} started with {} workers (max {})", config_.name, config_.threadCount,
+                   config_.maxThreadCount);
+        return SystemErrors::SUCCESS;
+    }
+
+    void WorkStealingPool::stop()
+    {
+        std::lock_guard<std::mutex> lock(lifecycleMutex_);
+        if (!running_.load())
+        {
+            return;
+        }
+
+        // 先停伸缩检查线程，之后不会再有线程被启动
+        if (scaler_.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> scalerLock(scalerMutex_);
+                scalerStop_ = true;
+            }
+            scalerWake_.notify_all();
+            scaler_.join();
+        }
+
+        stopping_ = true;
+        idleEvents_.notifyAll();
+
+        for (uint32_t i = 0; i < slotCount_; ++i)
+        {
+            if (slots_[i].thread.joinable())
+            {
+                slots_[i].thread.join();
+            }
+        }
+
+        // 工作线程已退出，把本地队列剩余任务移回注入队列，下次启动后继续执行。
+        // 它们比注入队列中剩余的任务更早取出，按原顺序放到队首
+        {
+            std::vector<PoolItem *> leftovers;
+            for (uint32_t i = 0; i < slotCount_; ++i)
+            {
+                if (Worker *worker = workerAt(i))
+                {
+                    const size_t first = leftovers.size();
+                    while (PoolItem *item = worker->deque.steal())
+                    {
+                        leftovers.push_back(item);
+                    }
+                    // 取回的批次倒序压入本地队列，窃取端是最晚提交的任务，倒转后恢复提交顺序
+                    std::reverse(leftovers.begin() + first, leftovers.end());
+                }
+            }
+
+            std::lock_guard<std::mutex> injectionLock(injectionMutex_);
+            injectionQueue_.insert(injectionQueue_.begin(), leftovers.begin(), leftovers.end());
+            injectedCount_.store(injectionQueue_.size(), std::memory_order_release);
+        }
+
+        for (uint32_t i = 0; i < slotCount_; ++i)
+        {
+            if (const Worker *worker = workerAt(i))
+            {
+                retired_.executed += worker->executed.load();
+                retired_.localSubmits += worker->localSubmits.load();
+                retired_.stealAttempts += worker->stealAttempts.load();
+                retired_.successfulSteals += worker->successfulSteals.load();
+                retired_.stolenTasks += worker->stolenTasks.load();
+                retired_.parks += worker->parks.load();
+            }
+        }
+        slots_.reset();
+        slotCount_ = 0;
+        activeWorkers_ = 0;
+        elastic_ = false;
+
+        running_ = false;
+        stopping_ = false;
+        RADAR_INFO("{} stopped, {} tasks left pending", config_.name, pending_.load());
+    }
+
+    ErrorCode WorkStealingPool::submit(ScheduledTaskPtr task)
+    {
+        return submitItem(new HandlerItem(this, std::move(task)));
+    }
+
+    ErrorCode WorkStealingPool::submitItem(PoolItem *item)
+    {
+        if (!item)
+        {
+            return SystemErrors::INVALID_PARAMETER;
+        }
+
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+        if (elastic_.load(std::memory_order_relaxed))
+        {
+            item->enqueuedNs = nowNs();
+        }
+
+        if (tlsPool == this && running_.load(std::memory_order_relaxed))
+        {
+            // 任务内部提交的子任务：压入本线程队列，由本线程或窃取者执行
+            Worker &worker = *workerAt(static_cast<uint32_t>(tlsWorkerIndex));
+            worker.deque.push(item);
+            worker.localSubmits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(injectionMutex_);
+            injectionQueue_.push_back(item);
+            injectedCount_.store(injectionQueue_.size(), std::memory_order_release);
+            injectedSubmits_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        idleEvents_.notifyOne();
+        return SystemErrors::SUCCESS;
+    }
+
+    size_t WorkStealingPool::clear()
+    {
+        std::lock_guard<std::mutex> lock(injectionMutex_);
+        const size_t count = injectionQueue_.size();
+        for (PoolItem *item : injectionQueue_)
+        {
+            item->discard();
+        }
+        injectionQueue_.clear();
+        injectedCount_.store(0, std::memory_order_release);
+        pending_.fetch_sub(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    bool WorkStealingPool::isRunning() const
+    {
+        return running_.load();
+    }
+
+    uint32_t WorkStealingPool::getThreadCount() const
+    {
+        return activeWorkers_.load();
+    }
+
+    std::vector<ThreadPoolSizeSample> WorkStealingPool::getSizeHistory() const
+    {
+        std::lock_guard<std::mutex> lock(historyMutex_);
+        return std::vector<ThreadPoolSizeSample>(sizeHistory_.begin(), sizeHistory_.end());
+    }
+
+    size_t WorkStealingPool::getPendingCount() const
+    {
+        return pending_.load(std::memory_order_relaxed);
+    }
+
+    WorkStealingPoolStatistics WorkStealingPool::getStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(lifecycleMutex_);
+
+        WorkStealingPoolStatistics stats = retired_;
+        stats.threadCount = activeWorkers_.load();
+        stats.coreThreadCount = running_.load() ? config_.threadCount : 0;
+        stats.maxThreadCount = running_.load() ? config_.maxThreadCount : 0;
+        stats.peakThreadCount = peakWorkers_.load();
+        stats.threadsSpawned = threadsSpawned_.load();
+        stats.threadsRetired = threadsRetired_.load();
+        stats.submitted = submitted_.load(std::memory_order_relaxed);
+        stats.injectedSubmits = injectedSubmits_.load(std::memory_order_relaxed);
+        stats.pendingTasks = pending_.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < slotCount_; ++i)
+        {
+            const Worker *worker = workerAt(i);
+            if (!worker)
+            {
+                continue;
+            }
+            stats.executed += worker->executed.load(std::memory_order_relaxed);
+            stats.localSubmits += worker->localSubmits.load(std::memory_order_relaxed);
+            stats.stealAttempts += worker->stealAttempts.load(std::memory_order_relaxed);
+            stats.successfulSteals += worker->successfulSteals.load(std::memory_order_relaxed);
+            stats.stolenTasks += worker->stolenTasks.load(std::memory_order_relaxed);
+            stats.parks += worker->parks.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    int WorkStealingPool::getCurrentWorkerIndex()
+    {
+        return tlsPool != nullptr ? tlsWorkerIndex : -1;
+    }
+
+    bool WorkStealingPool::isCurrentWorker() const
+    {
+        return tlsPool == this;
+    }
+
+    /**
+     * @note 找不到任务时先自旋spinRounds轮（每轮让出CPU），仍无任务才休眠；
+     *       休眠前登记等待并二次检查，提交方的通知不会丢失
+     */
+    void WorkStealingPool::workerMain(uint32_t index)
+    {
+        if (config_.threadInit)
+        {
+            try
+            {
+                config_.threadInit(index);
+            }
+            catch (const std::exception &e)
+            {
+                RADAR_WARN("{} worker {} init failed: {}", config_.name, index, e.what());
+            }
+        }
+
+        WorkerSlot &slot = slots_[index];
+        if (!slot.owner)
+        {
+            // 槽位上第一次启动线程：在本线程分配状态；额外线程退出后状态保留，再次启动时复用
+            slot.owner = std::make_unique<Worker>(config_.localCapacity);
+            slot.owner->index = index;
+            slot.owner->randomState = 0x9E3779B97F4A7C15ull * (index + 1);
+            slot.worker.store(slot.owner.get(), std::memory_order_release);
+        }
+        Worker &self = *slot.owner;
+
+        if (index < config_.threadCount)
+        {
+            std::unique_lock<std::mutex> lock(startupMutex_);
+            if (++readyWorkers_ == config_.threadCount)
+            {
+                startupDone_.notify_all();
+            }
+            // 核心线程同时启动，等全部就绪后再开始，start()返回时线程数即为核心线程数
+            startupDone_.wait(lock, [this]()
+                              { return readyWorkers_ == config_.threadCount || startupAborted_; });
+            if (startupAborted_)
+            {
+                return;
+            }
+        }
+
+        if (workerLoop(self))
+        {
+            retireWorker(self);
+        }
+        slot.active.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @note 额外线程（下标不小于核心线程数）休眠时带超时，从第一次找不到任务开始计时，
+     *       连续空闲keepAliveMs且没有可见任务时退出；中途执行过任务则重新计时
+     */
+    bool WorkStealingPool::workerLoop(Worker &worker)
+    {
+        tlsPool = this;
+        tlsWorkerIndex = static_cast<int>(worker.index);
+
+        const bool extra = worker.index >= config_.threadCount;
+        const uint64_t keepAliveNs = static_cast<uint64_t>(config_.keepAliveMs) * 1000000ull;
+        uint64_t idleSinceNs = 0;
+        bool retiring = false;
+
+        uint32_t idleRounds = 0;
+        while (!stopping_.load(std::memory_order_acquire))
+        {
+            if (PoolItem *item = findWork(worker))
+            {
+                runItem(worker, item);
+                idleRounds = 0;
+                idleSinceNs = 0;
+                continue;
+            }
+
+            if (++idleRounds < config_.spinRounds)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            idleRounds = 0;
+
+            const EventCount::Key key = idleEvents_.prepareWait();
+            if (stopping_.load() || hasVisibleWork())
+            {
+                idleEvents_.cancelWait();
+                continue;
+            }
+
+            worker.parks.fetch_add(1, std::memory_order_relaxed);
+            if (!extra)
+            {
+                idleEvents_.wait(key);
+                continue;
+            }
+
+            const uint64_t now = nowNs();
+            if (idleSinceNs == 0)
+            {
+                idleSinceNs = now;
+            }
+            const uint64_t idleNs = now - idleSinceNs;
+            if (idleNs >= keepAliveNs)
+            {
+                // 已在登记等待后确认没有可见任务，之后的提交会唤醒其他线程
+                idleEvents_.cancelWait();
+                retiring = true;
+                break;
+            }
+            idleEvents_.waitFor(key, std::chrono::milliseconds((keepAliveNs - idleNs + 999999) / 1000000));
+        }
+
+        tlsPool = nullptr;
+        tlsWorkerIndex = -1;
+        return retiring;
+    }
+
+    void WorkStealingPool::retireWorker(Worker &worker)
+    {
+        // 本地队列通常已空，保险起见把剩余任务交回注入队列
+        size_t moved = 0;
+        {
+            std::lock_guard<std::mutex> lock(injectionMutex_);
+            while (PoolItem *item = worker.deque.steal())
+            {
+                injectionQueue_.push_back(item);
+                moved++;
+            }
+            injectedCount_.store(injectionQueue_.size(), std::memory_order_release);
+        }
+        if (moved > 0)
+        {
+            idleEvents_.notifyOne();
+        }
+
+        const uint32_t remaining = activeWorkers_.fetch_sub(1) - 1;
+        threadsRetired_.fetch_add(1, std::memory_order_relaxed);
+        recordSize(remaining, 0);
+        RADAR_INFO("{} worker {} idle for {}ms, shrinking to {} workers", config_.name, worker.index,
+                   config_.keepAliveMs, remaining);
+    }
+
+    void WorkStealingPool::scalerLoop()
+    {
+        std::unique_lock<std::mutex> lock(scalerMutex_);
+        while (!scalerStop_)
+        {
+            scalerWake_.wait_for(lock, std::chrono::milliseconds(config_.scaleCheckIntervalMs));
+            if (scalerStop_)
+            {
+                break;
+            }
+            lock.unlock();
+            checkScaling();
+            lock.lock();
+        }
+    }
+
+    /**
+     * @note 积压信号取以下三者的最大值：
+     *       - 本周期内执行的任务的最长排队等待
+     *       - 注入队列队首任务已等待的时间
+     *       - 有待执行任务但一个周期内没有任务完成（线程全被长任务占住）时，距上次完成的时间
+     *       连续scaleUpChecks个周期超过阈值才增加一个线程，增加后重新计数，
+     *       让新线程先消化积压，避免一次突发把线程数直接拉满
+     */
+    void WorkStealingPool::checkScaling()
+    {
+        const uint64_t now = nowNs();
+        uint64_t waitNs = 0;
+        uint64_t executed = 0;
+        for (uint32_t i = 0; i < slotCount_; ++i)
+        {
+            if (Worker *worker = workerAt(i))
+            {
+                waitNs = std::max(waitNs, worker->maxWaitNs.exchange(0, std::memory_order_relaxed));
+                executed += worker->executed.load(std::memory_order_relaxed);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(injectionMutex_);
+            if (!injectionQueue_.empty() && injectionQueue_.front()->enqueuedNs != 0 &&
+                now > injectionQueue_.front()->enqueuedNs)
+            {
+                waitNs = std::max(waitNs, now - injectionQueue_.front()->enqueuedNs);
+            }
+        }
+
+        if (executed != lastExecuted_ || pending_.load(std::memory_order_relaxed) == 0)
+        {
+            lastExecuted_ = executed;
+            lastProgressNs_ = now;
+        }
+        else
+        {
+            waitNs = std::max(waitNs, now - lastProgressNs_);
+        }
+
+        if (waitNs < static_cast<uint64_t>(config_.scaleUpWaitUs) * 1000ull)
+        {
+            overloadedChecks_ = 0;
+            return;
+        }
+        if (++overloadedChecks_ < config_.scaleUpChecks || activeWorkers_.load() >= config_.maxThreadCount)
+        {
+            return;
+        }
+
+        overloadedChecks_ = 0;
+        if (spawnWorker())
+        {
+            const uint32_t count = activeWorkers_.load();
+            recordSize(count, waitNs);
+            RADAR_INFO("{} queue wait {}us over {}us, growing to {} workers", config_.name, waitNs / 1000,
+                       config_.scaleUpWaitUs, count);
+        }
+    }
+
+    bool WorkStealingPool::spawnWorker()
+    {
+        for (uint32_t i = config_.threadCount; i < slotCount_; ++i)
+        {
+            WorkerSlot &slot = slots_[i];
+            if (slot.active.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            // 上一个线程已空闲退出，回收后复用槽位
+            if (slot.thread.joinable())
+            {
+                slot.thread.join();
+            }
+
+            slot.active = true;
+            activeWorkers_.fetch_add(1);
+            try
+            {
+                slot.thread = std::thread([this, i]()
+                                          { workerMain(i); });
+            }
+            catch (const std::exception &e)
+            {
+                slot.active = false;
+                activeWorkers_.fetch_sub(1);
+                RADAR_WARN("{} failed to spawn extra worker: {}", config_.name, e.what());
+                return false;
+            }
+
+            threadsSpawned_.fetch_add(1, std::memory_order_relaxed);
+            uint32_t peak = peakWorkers_.load();
+            const uint32_t count = activeWorkers_.load();
+            while (count > peak && !peakWorkers_.compare_exchange_weak(peak, count))
+            {
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void WorkStealingPool::recordSize(uint32_t threadCount, uint64_t queueWaitNs)
+    {
+        std::lock_guard<std::mutex> lock(historyMutex_);
+        if (sizeHistory_.size() >= SIZE_HISTORY_LIMIT)
+        {
+            sizeHistory_.pop_front();
+        }
+        ThreadPoolSizeSample sample;
+        sample.timestamp = std::chrono::high_resolution_clock::now();
+        sample.threadCount = threadCount;
+        sample.queueWaitUs = queueWaitNs / 1000;
+        sizeHistory_.push_back(sample);
+    }
+
+    PoolItem *WorkStealingPool::findWork(Worker &worker)
+    {
+        if (PoolItem *item = worker.deque.pop())
+        {
+            return item;
+        }
+        if (PoolItem *item = takeInjected(worker))
+        {
+            return item;
+        }
+        return stealWork(worker);
+    }
+
+    /**
+     * @note 每次按线程数均分注入队列（不超过injectionBatch），
+     *       既摊薄加锁开销，又不让一个线程独占外部提交的全部任务
+     */
+    PoolItem *WorkStealingPool::takeInjected(Worker &worker)
+    {
+        if (injectedCount_.load(std::memory_order_acquire) == 0)
+        {
+            return nullptr;
+        }
+
+        PoolItem *first = nullptr;
+        size_t moved = 0;
+        {
+            std::lock_guard<std::mutex> lock(injectionMutex_);
+            if (injectionQueue_.empty())
+            {
+                return nullptr;
+            }
+
+            first = injectionQueue_.front();
+            injectionQueue_.pop_front();
+
+            const size_t share = std::min<size_t>(config_.injectionBatch,
+                                                  injectionQueue_.size() / std::max(1u, activeWorkers_.load()));
+            // 本地队列由所有者后进先出弹出，倒序压入才能让先提交的任务先执行
+            for (size_t i = share; i > 0; --i)
+            {
+                worker.deque.push(injectionQueue_[i - 1]);
+            }
+            injectionQueue_.erase(injectionQueue_.begin(), injectionQueue_.begin() + share);
+            moved = share;
+            injectedCount_.store(injectionQueue_.size(), std::memory_order_release);
+        }
+
+        if (moved > 0)
+        {
+            // 本地队列有了可窃取的任务，唤醒一个空闲线程分担
+            idleEvents_.notifyOne();
+        }
+        return first;
+    }
+
+    PoolItem *WorkStealingPool::stealWork(Worker &worker)
+    {
+        const size_t count = slotCount_;
+        if (count <= 1)
+        {
+            return nullptr;
+        }
+
+        // 已退出的额外线程状态仍在槽位上，它的队列为空，遍历时自然跳过
+        const size_t start = static_cast<size_t>(nextRandom(worker.randomState) % count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Worker *candidate = workerAt(static_cast<uint32_t>((start + i) % count));
+            if (!candidate || candidate == &worker || candidate->deque.empty())
+            {
+                continue;
+            }
+            Worker &victim = *candidate;
+
+            worker.stealAttempts.fetch_add(1, std::memory_order_relaxed);
+            PoolItem *first = victim.deque.steal();
+            if (!first)
+            {
+                continue;
+            }
+
+            // 再取走剩余任务的一半，减少后续窃取次数；
+            // 窃取从最早的任务开始，倒序压入本地队列以保持提交顺序
+            const size_t extra = std::min(victim.deque.size() / 2, STEAL_BATCH_LIMIT);
+            PoolItem *batch[STEAL_BATCH_LIMIT];
+            size_t moved = 0;
+            while (moved < extra)
+            {
+                PoolItem *item = victim.deque.steal();
+                if (!item)
+                {
+                    break;
+                }
+                batch[moved++] = item;
+            }
+            for (size_t i = moved; i > 0; --i)
+            {
+                worker.deque.push(batch[i - 1]);
+            }
+
+            worker.successfulSteals.fetch_add(1, std::memory_order_relaxed);
+            worker.stolenTasks.fetch_add(moved + 1, std::memory_order_relaxed);
+            if (moved > 0)
+            {
+                idleEvents_.notifyOne();
+            }
+            return first;
+        }
+        return nullptr;
+    }
+
+    bool WorkStealingPool::hasVisibleWork() const
+    {
+        if (injectedCount_.load(std::memory_order_acquire) > 0)
+        {
+            return true;
+        }
+        for (uint32_t i = 0; i < slotCount_; ++i)
+        {
+            const Worker *worker = workerAt(i);
+            if (worker && !worker->deque.empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingPool::runItem(Worker &worker, PoolItem *item)
+    {
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+
+        if (item->enqueuedNs != 0 && elastic_.load(std::memory_order_relaxed))
+        {
+            const uint64_t waitNs = nowNs() - item->enqueuedNs;
+            if (waitNs > worker.maxWaitNs.load(std::memory_order_relaxed))
+            {
+                worker.maxWaitNs.store(waitNs, std::memory_order_relaxed);
+            }
+        }
+
+        try
+        {
+            item->run();
+        }
+        catch (const std::exception &e)
+        {
+            RADAR_ERROR("{} worker {} task handler threw: {}", config_.name, worker.index, e.what());
+        }
+        catch (...)
+        {
+            RADAR_ERROR("{} worker {} task handler threw unknown exception", config_.name, worker.index);
+        }
+        worker.executed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void WorkStealingPool::HandlerItem::run()
+    {
+        // 先释放节点再执行：处理函数抛出异常时节点也不会泄漏
+        WorkStealingPool *pool = pool_;
+        ScheduledTaskPtr task = std::move(task_);
+        delete this;
+        pool->handler_(std::move(task));
+    }
+
+    void WorkStealingPool::HandlerItem::discard() noexcept
+    {
+        delete this;
+    }
+
+} // namespace radar
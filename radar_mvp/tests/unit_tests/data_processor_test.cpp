@@ -0,0 +1,903 @@
+/**
+ * @file data_processor_test.cpp
+ * @brief 数据处理模块单元测试
+ *
+ * 使用 GoogleTest 框架测试数据处理模块的各项功能：
+ * - 处理阶段图构建与配置解析
+ * - 形状协商与缓冲区预分配
+ * - 阶段耗时统计
+ * - 包内并行（分叉-汇合线程池）
+ * - 信号处理内核与编译期流水线
+ * - CPU处理器端到端处理
+ * - 截止时间准入控制与过载降级
+ * - 异步处理的自适应批处理
+ * - 批大小增长后，批内等待的数据包仍计入准入积压
+ * - 绕过数据队列的控制通道
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include <gtest/gtest.h>
+#include "modules/data_processor.h"
+#include "common/logger.h"
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <thread>
+
+using namespace radar;
+using namespace radar::common;
+
+/**
+ * @brief 数据处理测试夹具
+ */
+class DataProcessorTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // 初始化日志系统
+        LoggerConfig logConfig;
+        logConfig.console.enabled = true;
+        logConfig.file.enabled = false;
+        logConfig.globalLevel = LogLevel::WARN;
+        LoggerManager::getInstance().initialize(logConfig);
+    }
+
+    void TearDown() override
+    {
+        LoggerManager::getInstance().shutdown();
+    }
+
+    /**
+     * @brief 创建测试数据包
+     * @param channels 通道数
+     * @param samples 每通道采样点数
+     * @param value 所有采样点的取值
+     */
+    RawDataPacketPtr createPacket(uint32_t channels, uint32_t samples,
+                                  ComplexFloat value = ComplexFloat(1.0f, 0.0f))
+    {
+        auto packet = std::make_shared<RawDataPacket>();
+        packet->timestamp = std::chrono::high_resolution_clock::now();
+        packet->sequenceId = nextSequenceId_++;
+        packet->priority = PacketPriority::NORMAL;
+        packet->channelCount = channels;
+        packet->samplesPerChannel = samples;
+        packet->iqData.assign(static_cast<size_t>(channels) * samples, value);
+        return packet;
+    }
+
+    /**
+     * @brief 创建单个阶段配置
+     */
+    static ProcessingStageConfig makeStage(const std::string &name, const std::string &type,
+                                           std::vector<std::string> inputs,
+                                           const std::string &output = "")
+    {
+        ProcessingStageConfig stage;
+        stage.name = name;
+        stage.type = type;
+        stage.inputs = std::move(inputs);
+        stage.output = output;
+        return stage;
+    }
+
+    uint64_t nextSequenceId_ = 1;
+};
+
+//==============================================================================
+// 处理阶段图测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, DefaultGraphProducesAllResults)
+{
+    StageGraph graph;
+    ASSERT_EQ(graph.build(StageGraph::createDefaultConfig()), SystemErrors::SUCCESS);
+
+    auto order = graph.getExecutionOrder();
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order.front(), "fft");
+
+    auto packet = createPacket(4, 64);
+    ProcessingResult result{};
+    ASSERT_EQ(graph.execute(*packet, result), SystemErrors::SUCCESS);
+
+    EXPECT_EQ(result.rangeProfile.size(), 256u);
+    EXPECT_EQ(result.dopplerSpectrum.size(), 256u);
+    EXPECT_EQ(result.beamformedData.size(), 64u);
+
+    auto timings = graph.getStageTimings();
+    ASSERT_EQ(timings.size(), 4u);
+    for (const auto &timing : timings)
+    {
+        EXPECT_EQ(timing.invocations, 1u);
+        EXPECT_EQ(timing.failures, 0u);
+        EXPECT_GE(timing.peakTimeMs, timing.averageTimeMs);
+    }
+}
+
+TEST_F(DataProcessorTest, BuffersArePreallocatedPerShape)
+{
+    StageGraph graph;
+    ASSERT_EQ(graph.build(StageGraph::createDefaultConfig()), SystemErrors::SUCCESS);
+    ASSERT_EQ(graph.prepare(StageShape{StageDataKind::COMPLEX, 2, 128}), SystemErrors::SUCCESS);
+
+    const size_t preparedBytes = graph.getBufferBytes();
+    EXPECT_GT(preparedBytes, 0u);
+
+    ProcessingResult result{};
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(graph.execute(*createPacket(2, 128), result), SystemErrors::SUCCESS);
+        EXPECT_EQ(graph.getBufferBytes(), preparedBytes);
+    }
+
+    // 形状变化时重新协商
+    ASSERT_EQ(graph.execute(*createPacket(2, 256), result), SystemErrors::SUCCESS);
+    EXPECT_EQ(result.beamformedData.size(), 256u);
+}
+
+TEST_F(DataProcessorTest, DisabledStageIsBypassed)
+{
+    auto stages = StageGraph::createDefaultConfig();
+    for (auto &stage : stages)
+    {
+        if (stage.name == "filter" || stage.name == "beamform")
+        {
+            stage.enabled = false;
+        }
+    }
+
+    StageGraph graph;
+    ASSERT_EQ(graph.build(stages), SystemErrors::SUCCESS);
+    EXPECT_EQ(graph.getExecutionOrder(), (std::vector<std::string>{"fft", "detect"}));
+
+    ProcessingResult result{};
+    ASSERT_EQ(graph.execute(*createPacket(1, 32), result), SystemErrors::SUCCESS);
+    EXPECT_EQ(result.rangeProfile.size(), 32u);
+    EXPECT_TRUE(result.beamformedData.empty());
+}
+
+TEST_F(DataProcessorTest, InvalidGraphsAreRejected)
+{
+    StageGraph graph;
+
+    // 环路
+    std::vector<ProcessingStageConfig> cyclic = {
+        makeStage("a", "fft", {"b"}),
+        makeStage("b", "filter", {"a"})};
+    EXPECT_EQ(graph.build(cyclic), SystemErrors::CONFIGURATION_ERROR);
+
+    // 未知阶段类型
+    EXPECT_EQ(graph.build({makeStage("a", "unknown", {"input"})}),
+              SystemErrors::CONFIGURATION_ERROR);
+
+    // 未知输入
+    EXPECT_EQ(graph.build({makeStage("a", "fft", {"missing"})}),
+              SystemErrors::CONFIGURATION_ERROR);
+
+    // 重复名称
+    EXPECT_EQ(graph.build({makeStage("a", "fft", {"input"}), makeStage("a", "filter", {"input"})}),
+              SystemErrors::CONFIGURATION_ERROR);
+
+    // 未知结果映射
+    EXPECT_EQ(graph.build({makeStage("a", "fft", {"input"}, "unknown")}),
+              SystemErrors::CONFIGURATION_ERROR);
+
+    EXPECT_FALSE(graph.isBuilt());
+}
+
+TEST_F(DataProcessorTest, ShapeMismatchFailsNegotiation)
+{
+    // 检测阶段输出实数，不能作为FFT阶段的输入
+    StageGraph graph;
+    ASSERT_EQ(graph.build({makeStage("detect", "detect", {"input"}),
+                           makeStage("fft", "fft", {"detect"})}),
+              SystemErrors::SUCCESS);
+
+    EXPECT_NE(graph.prepare(StageShape{StageDataKind::COMPLEX, 1, 16}), SystemErrors::SUCCESS);
+}
+
+TEST_F(DataProcessorTest, ParsesPipelineFromYaml)
+{
+    YAML::Node node = YAML::Load(R"(
+stages:
+  - name: fft
+    type: fft
+    output: doppler_spectrum
+  - name: smooth
+    type: filter
+    params:
+      taps: 5
+  - name: detect
+    type: detect
+    output: range_profile
+  - name: beamform
+    type: beamform
+    inputs: [smooth]
+    enabled: false
+)");
+
+    std::vector<ProcessingStageConfig> stages;
+    ASSERT_EQ(StageGraph::parseConfig(node, stages), SystemErrors::SUCCESS);
+    ASSERT_EQ(stages.size(), 4u);
+    EXPECT_EQ(stages[0].inputs, (std::vector<std::string>{"input"}));
+    EXPECT_EQ(stages[1].inputs, (std::vector<std::string>{"fft"}));
+    EXPECT_EQ(stages[2].inputs, (std::vector<std::string>{"smooth"}));
+    EXPECT_DOUBLE_EQ(stages[1].params.at("taps"), 5.0);
+    EXPECT_FALSE(stages[3].enabled);
+
+    StageGraph graph;
+    ASSERT_EQ(graph.build(stages), SystemErrors::SUCCESS);
+    EXPECT_EQ(graph.getExecutionOrder().size(), 3u);
+
+    std::vector<ProcessingStageConfig> invalid;
+    EXPECT_EQ(StageGraph::parseConfig(YAML::Load("stages: 3"), invalid),
+              SystemErrors::CONFIGURATION_ERROR);
+}
+
+TEST_F(DataProcessorTest, FilterAndBeamformingNumerics)
+{
+    // 滤波：单位冲激经过3点滑动平均
+    StageGraph filterGraph;
+    ASSERT_EQ(filterGraph.build({makeStage("filter", "filter", {"input"}, "doppler_spectrum")}),
+              SystemErrors::SUCCESS);
+
+    auto impulse = createPacket(1, 5, ComplexFloat(0.0f, 0.0f));
+    impulse->iqData[2] = ComplexFloat(3.0f, 0.0f);
+    ProcessingResult filtered{};
+    ASSERT_EQ(filterGraph.execute(*impulse, filtered), SystemErrors::SUCCESS);
+    const std::vector<float> expected = {0.0f, 1.0f, 1.0f, 1.0f, 0.0f};
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(filtered.dopplerSpectrum[i], expected[i], 1e-5f);
+    }
+
+    // 波束形成：两通道取平均
+    StageGraph beamGraph;
+    ASSERT_EQ(beamGraph.build({makeStage("beam", "beamform", {"input"}, "beamformed")}),
+              SystemErrors::SUCCESS);
+
+    auto packet = createPacket(2, 8);
+    std::fill(packet->iqData.begin() + 8, packet->iqData.end(), ComplexFloat(3.0f, 0.0f));
+    ProcessingResult beamformed{};
+    ASSERT_EQ(beamGraph.execute(*packet, beamformed), SystemErrors::SUCCESS);
+    ASSERT_EQ(beamformed.beamformedData.size(), 8u);
+    for (float value : beamformed.beamformedData)
+    {
+        EXPECT_NEAR(value, 2.0f, 1e-5f);
+    }
+}
+
+//==============================================================================
+// 包内并行测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, ForkJoinPoolCoversRangeExactlyOnce)
+{
+    ForkJoinPool pool(3);
+    EXPECT_EQ(pool.getWorkerCount(), 3u);
+
+    std::vector<std::atomic<int>> hits(1000);
+    ASSERT_EQ(pool.parallelFor(static_cast<uint32_t>(hits.size()),
+                               [&hits](uint32_t begin, uint32_t end)
+                               {
+                                   for (uint32_t i = begin; i < end; ++i)
+                                   {
+                                       hits[i]++;
+                                   }
+                                   return SystemErrors::SUCCESS;
+                               }),
+              SystemErrors::SUCCESS);
+    for (const auto &hit : hits)
+    {
+        EXPECT_EQ(hit.load(), 1);
+    }
+
+    // 失败块的错误码被传回调用者
+    EXPECT_EQ(pool.parallelFor(64, [](uint32_t begin, uint32_t end)
+                               { return (begin <= 40 && 40 < end) ? DataProcessorErrors::FFT_ERROR
+                                                                  : SystemErrors::SUCCESS; }),
+              DataProcessorErrors::FFT_ERROR);
+
+    // 多个调用者并发提交
+    std::atomic<uint32_t> total{0};
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; ++t)
+    {
+        callers.emplace_back([&pool, &total]()
+                             {
+                                 for (int round = 0; round < 20; ++round)
+                                 {
+                                     pool.parallelFor(100, [&total](uint32_t begin, uint32_t end)
+                                                      {
+                                                          total += end - begin;
+                                                          return SystemErrors::SUCCESS;
+                                                      });
+                                 } });
+    }
+    for (auto &caller : callers)
+    {
+        caller.join();
+    }
+    EXPECT_EQ(total.load(), 4u * 20u * 100u);
+}
+
+TEST_F(DataProcessorTest, ParallelGraphMatchesSerial)
+{
+    auto packet = createPacket(64, 256);
+    for (size_t i = 0; i < packet->iqData.size(); ++i)
+    {
+        packet->iqData[i] = ComplexFloat(static_cast<float>(i % 17), static_cast<float>(i % 5) - 2.0f);
+    }
+
+    StageGraph serialGraph;
+    ASSERT_EQ(serialGraph.build(StageGraph::createDefaultConfig()), SystemErrors::SUCCESS);
+    ProcessingResult serial{};
+    ASSERT_EQ(serialGraph.execute(*packet, serial), SystemErrors::SUCCESS);
+
+    ForkJoinPool pool(3);
+    StageGraph parallelGraph;
+    ASSERT_EQ(parallelGraph.build(StageGraph::createDefaultConfig()), SystemErrors::SUCCESS);
+    parallelGraph.setParallelExecution(&pool, 1024);
+    ProcessingResult parallel{};
+    ASSERT_EQ(parallelGraph.execute(*packet, parallel), SystemErrors::SUCCESS);
+
+    EXPECT_EQ(parallel.rangeProfile, serial.rangeProfile);
+    EXPECT_EQ(parallel.dopplerSpectrum, serial.dopplerSpectrum);
+    EXPECT_EQ(parallel.beamformedData, serial.beamformedData);
+
+    for (const auto &timing : parallelGraph.getStageTimings())
+    {
+        EXPECT_EQ(timing.parallelRuns, 1u) << timing.stageName;
+    }
+    for (const auto &timing : serialGraph.getStageTimings())
+    {
+        EXPECT_EQ(timing.parallelRuns, 0u) << timing.stageName;
+    }
+
+    // 低于阈值的小数据包保持串行
+    ASSERT_EQ(parallelGraph.execute(*createPacket(1, 64), parallel), SystemErrors::SUCCESS);
+    EXPECT_EQ(parallelGraph.getStageTimings().front().parallelRuns, 1u);
+}
+
+TEST_F(DataProcessorTest, CPUProcessorParallelizesLargePackets)
+{
+    DataProcessorConfig config;
+    config.parallelThresholdElements = 4096;
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.start(), SystemErrors::SUCCESS);
+
+    ProcessingResultPtr result;
+    ASSERT_EQ(processor.processPacket(createPacket(64, 128), result), SystemErrors::SUCCESS);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->processingSuccess);
+    EXPECT_EQ(result->beamformedData.size(), 128u);
+    EXPECT_GT(processor.getStageTimings().front().parallelRuns, 0u);
+
+    processor.stop();
+    processor.cleanup();
+}
+
+//==============================================================================
+// 信号处理内核与编译期流水线测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, StaticFFTMatchesReference)
+{
+    constexpr size_t N = 16;
+    constexpr size_t BIN = 3;
+    std::array<ComplexFloat, N> tone{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        const double phase = 2.0 * dsp::PI * BIN * i / N;
+        tone[i] = ComplexFloat(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+    }
+
+    pipeline::Pipeline<pipeline::FFT<N>, pipeline::Magnitude> chain;
+    std::array<float, N> spectrum{};
+    chain.process(tone.data(), spectrum.data());
+
+    for (size_t k = 0; k < N; ++k)
+    {
+        EXPECT_NEAR(spectrum[k], k == BIN ? static_cast<float>(N) : 0.0f, 1e-4f) << "bin " << k;
+    }
+
+    // 编译期旋转因子与标准库结果一致
+    const auto &twiddles = pipeline::FFTTables<1024>::TWIDDLES;
+    for (size_t k = 0; k < twiddles.size(); k += 37)
+    {
+        const double angle = -2.0 * dsp::PI * k / 1024.0;
+        EXPECT_NEAR(twiddles[k].re, std::cos(angle), 1e-6);
+        EXPECT_NEAR(twiddles[k].im, std::sin(angle), 1e-6);
+    }
+}
+
+TEST_F(DataProcessorTest, CFARDetectsIsolatedTarget)
+{
+    std::vector<float> input(128, 1.0f);
+    input[50] = 20.0f;
+    input[51] = 2.0f; // 保护单元内的旁瓣不计入噪声估计
+
+    for (auto mode : {dsp::CFARMode::CELL_AVERAGING, dsp::CFARMode::GREATEST_OF,
+                      dsp::CFARMode::SMALLEST_OF})
+    {
+        std::vector<float> output(input.size());
+        dsp::cfarDetect(input.data(), output.data(), input.size(), 8, 2, 3.0f, mode);
+
+        for (size_t i = 0; i < output.size(); ++i)
+        {
+            EXPECT_FLOAT_EQ(output[i], i == 50 ? 20.0f : 0.0f) << "cell " << i;
+        }
+    }
+}
+
+TEST_F(DataProcessorTest, StaticAndDynamicPipelinesAgree)
+{
+    constexpr uint32_t N = static_cast<uint32_t>(pipeline::ProductionPipeline::LENGTH);
+    auto packet = createPacket(1, N);
+    for (uint32_t i = 0; i < N; ++i)
+    {
+        const double phase = 2.0 * dsp::PI * 200.0 * i / N;
+        packet->iqData[i] = ComplexFloat(static_cast<float>(std::cos(phase)) + 0.01f * (i % 7),
+                                         static_cast<float>(std::sin(phase)));
+    }
+
+    auto stages = std::vector<ProcessingStageConfig>{
+        makeStage("window", "window", {"input"}),
+        makeStage("fft", "fft", {"window"}),
+        makeStage("magnitude", "magnitude", {"fft"}),
+        makeStage("cfar", "cfar", {"magnitude"}, "range_profile")};
+    stages[3].params = {{"train", 16.0}, {"guard", 4.0}, {"scale", 3.0}};
+
+    StageGraph graph;
+    ASSERT_EQ(graph.build(stages), SystemErrors::SUCCESS);
+    ProcessingResult dynamicResult{};
+    ASSERT_EQ(graph.execute(*packet, dynamicResult), SystemErrors::SUCCESS);
+    ASSERT_EQ(dynamicResult.rangeProfile.size(), N);
+
+    auto chain = std::make_unique<pipeline::ProductionPipeline>();
+    std::vector<float> staticResult(N);
+    chain->process(packet->iqData.data(), staticResult.data());
+
+    EXPECT_GT(staticResult[200], 0.0f);
+    for (uint32_t i = 0; i < N; ++i)
+    {
+        EXPECT_NEAR(staticResult[i], dynamicResult.rangeProfile[i], 1e-3f) << "cell " << i;
+    }
+}
+
+TEST_F(DataProcessorTest, StaticPipelineProcessorFromFactory)
+{
+    using DataProcessorFactory::ProcessorType;
+    ASSERT_TRUE(DataProcessorFactory::isProcessorTypeAvailable(ProcessorType::STATIC_PIPELINE_PROCESSOR));
+
+    auto processor = DataProcessorFactory::createProcessor(ProcessorType::STATIC_PIPELINE_PROCESSOR,
+                                                           DataProcessorConfig{});
+    ASSERT_TRUE(processor);
+    ASSERT_EQ(processor->initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor->start(), SystemErrors::SUCCESS);
+
+    constexpr uint32_t N = static_cast<uint32_t>(pipeline::ProductionPipeline::LENGTH);
+    ProcessingResultPtr result;
+    ASSERT_EQ(processor->processPacket(createPacket(2, N), result), SystemErrors::SUCCESS);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->processingSuccess);
+    EXPECT_EQ(result->rangeProfile.size(), 2u * N);
+
+    // 长度与编译期流水线不符的数据包被拒绝
+    EXPECT_EQ(processor->processPacket(createPacket(2, N / 2), result),
+              DataProcessorErrors::INVALID_INPUT_DATA);
+
+    processor->stop();
+    processor->cleanup();
+}
+
+//==============================================================================
+// CPU处理器测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, CPUProcessorRunsConfiguredPipeline)
+{
+    DataProcessorConfig config;
+    config.pipelineStages = {
+        makeStage("fft", "fft", {"input"}, "doppler_spectrum"),
+        makeStage("detect", "detect", {"fft"}, "range_profile")};
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.start(), SystemErrors::SUCCESS);
+
+    ProcessingResultPtr result;
+    ASSERT_EQ(processor.processPacket(createPacket(1, 64), result), SystemErrors::SUCCESS);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->processingSuccess);
+    EXPECT_EQ(result->rangeProfile.size(), 64u);
+    EXPECT_TRUE(result->beamformedData.empty());
+
+    auto timings = processor.getStageTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_EQ(timings[0].stageName, "fft");
+    EXPECT_EQ(timings[1].invocations, 1u);
+
+    processor.stop();
+    processor.cleanup();
+}
+
+TEST_F(DataProcessorTest, CPUProcessorRejectsInvalidPipeline)
+{
+    DataProcessorConfig config;
+    config.pipelineStages = {makeStage("fft", "fft", {"nowhere"})};
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    EXPECT_EQ(processor.initialize(), SystemErrors::INITIALIZATION_FAILED);
+    EXPECT_EQ(processor.getState(), ModuleState::ERROR);
+}
+
+//==============================================================================
+// 准入控制与降级测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, AdmissionControllerStepsThroughDegradationLevels)
+{
+    AdmissionPolicy policy;
+    policy.backlogThresholds = {{2, 4, 6, 8}};
+    policy.minPacketsPerLevel = 2;
+    AdmissionController controller(policy);
+
+    auto packet = createPacket(4, 16);
+    const auto now = std::chrono::high_resolution_clock::now();
+    DegradationLevel level = DegradationLevel::FULL;
+
+    EXPECT_EQ(controller.admit(*packet, 0, now, level), AdmissionDecision::ADMIT);
+    EXPECT_EQ(level, DegradationLevel::FULL);
+
+    EXPECT_EQ(controller.admit(*packet, 5, now, level), AdmissionDecision::ADMIT);
+    EXPECT_EQ(level, DegradationLevel::REDUCED_CHANNELS);
+
+    // 最深一级只丢弃低优先级数据包
+    auto lowPriority = createPacket(4, 16);
+    lowPriority->priority = PacketPriority::LOW;
+    EXPECT_EQ(controller.admit(*lowPriority, 9, now, level), AdmissionDecision::SHED);
+    EXPECT_EQ(controller.admit(*packet, 9, now, level), AdmissionDecision::ADMIT);
+    EXPECT_EQ(level, DegradationLevel::SHED_LOW_PRIORITY);
+
+    // 积压消退后每minPacketsPerLevel个数据包恢复一级
+    controller.admit(*packet, 0, now, level);
+    EXPECT_EQ(level, DegradationLevel::SHED_LOW_PRIORITY);
+    controller.admit(*packet, 0, now, level);
+    EXPECT_EQ(controller.getLevel(), DegradationLevel::DECIMATED);
+
+    auto options = controller.getExecutionOptions(DegradationLevel::DECIMATED, 8);
+    EXPECT_TRUE(options.skipOptionalStages);
+    EXPECT_EQ(options.maxChannels, 4u);
+    EXPECT_EQ(options.decimation, 2u);
+
+    auto stats = controller.getStatistics();
+    EXPECT_EQ(stats.shedPackets, 1u);
+    EXPECT_EQ(stats.levelChanges, 3u);
+    EXPECT_EQ(stats.levelEntries[static_cast<size_t>(DegradationLevel::SHED_LOW_PRIORITY)], 1u);
+    EXPECT_EQ(stats.packetsPerLevel[static_cast<size_t>(DegradationLevel::FULL)], 1u);
+}
+
+TEST_F(DataProcessorTest, DegradedGraphExecutionSkipsOptionalStages)
+{
+    auto stages = std::vector<ProcessingStageConfig>{
+        makeStage("fft", "fft", {"input"}),
+        makeStage("filter", "filter", {"fft"}),
+        makeStage("detect", "detect", {"filter"}, "range_profile"),
+        makeStage("beamform", "beamform", {"filter"}, "beamformed")};
+    stages[1].optional = true;
+
+    StageGraph graph;
+    ASSERT_EQ(graph.build(stages), SystemErrors::SUCCESS);
+
+    // 跳过可选阶段等价于旁路该阶段
+    stages[1].enabled = false;
+    StageGraph bypassed;
+    ASSERT_EQ(bypassed.build(stages), SystemErrors::SUCCESS);
+
+    StageExecutionOptions options;
+    options.skipOptionalStages = true;
+    options.maxChannels = 2;
+    options.decimation = 2;
+
+    auto packet = createPacket(4, 64);
+    for (size_t i = 0; i < packet->iqData.size(); ++i)
+    {
+        packet->iqData[i] = ComplexFloat(static_cast<float>(i % 7), static_cast<float>(i % 3));
+    }
+
+    ProcessingResult degraded{};
+    ASSERT_EQ(graph.execute(*packet, degraded, options), SystemErrors::SUCCESS);
+    EXPECT_EQ(degraded.rangeProfile.size(), 2u * 32u);
+    EXPECT_EQ(degraded.beamformedData.size(), 32u);
+
+    ProcessingResult reference{};
+    options.skipOptionalStages = false;
+    ASSERT_EQ(bypassed.execute(*packet, reference, options), SystemErrors::SUCCESS);
+    ASSERT_EQ(reference.rangeProfile.size(), degraded.rangeProfile.size());
+    for (size_t i = 0; i < reference.rangeProfile.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(degraded.rangeProfile[i], reference.rangeProfile[i]);
+    }
+
+    auto timings = graph.getStageTimings();
+    EXPECT_TRUE(timings[1].optional);
+    EXPECT_EQ(timings[1].skippedRuns, 1u);
+    EXPECT_EQ(timings[1].invocations, 0u);
+
+    // 可选阶段必须保持输入形状
+    auto invalid = std::vector<ProcessingStageConfig>{makeStage("detect", "detect", {"input"}, "range_profile")};
+    invalid[0].optional = true;
+    StageGraph invalidGraph;
+    ASSERT_EQ(invalidGraph.build(invalid), SystemErrors::SUCCESS);
+    ProcessingResult unused{};
+    EXPECT_EQ(invalidGraph.execute(*packet, unused), SystemErrors::CONFIGURATION_ERROR);
+}
+
+TEST_F(DataProcessorTest, CPUProcessorDropsExpiredPackets)
+{
+    DataProcessorConfig config;
+    config.processingTimeoutMs = 20;
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.start(), SystemErrors::SUCCESS);
+
+    auto stale = createPacket(2, 64);
+    stale->timestamp -= std::chrono::milliseconds(100);
+
+    ProcessingResultPtr result;
+    EXPECT_EQ(processor.processPacket(stale, result), DataProcessorErrors::DEADLINE_EXCEEDED);
+    EXPECT_THROW(processor.processPacketAsync(stale).get(), ModuleException);
+
+    ASSERT_EQ(processor.processPacket(createPacket(2, 64), result), SystemErrors::SUCCESS);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->degradationLevel, static_cast<uint8_t>(DegradationLevel::FULL));
+
+    ProcessingStatistics stats;
+    processor.getStatistics(stats);
+    EXPECT_EQ(stats.expiredPackets.load(), 2u);
+    EXPECT_EQ(stats.processingFailures.load(), 0u);
+    EXPECT_EQ(processor.getAdmissionStatistics().expiredPackets, 2u);
+    EXPECT_EQ(processor.getPerformanceMetrics()->dataProcessorMetrics.packetsDropped, 2u);
+
+    processor.stop();
+    processor.cleanup();
+}
+
+//==============================================================================
+// 自适应批处理测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, AdaptiveBatchControllerTracksLatencyBudget)
+{
+    BatchingPolicy policy;
+    policy.initialBatchSize = 4;
+    policy.maxBatchSize = 16;
+    policy.latencyBudgetMs = 10;
+    AdaptiveBatchController controller(policy);
+
+    // 积压且延迟远低于预算：逐步增大
+    const std::vector<double> fast(4, 1.0);
+    controller.recordBatch(4, 20, fast);
+    EXPECT_EQ(controller.getBatchSize(), 5u);
+    for (int i = 0; i < 20; ++i)
+    {
+        controller.recordBatch(controller.getBatchSize(), 20, fast);
+    }
+    EXPECT_EQ(controller.getBatchSize(), 16u);
+
+    // 没有积压时保持不变
+    controller.recordBatch(3, 0, std::vector<double>(3, 1.0));
+    EXPECT_EQ(controller.getBatchSize(), 16u);
+
+    // p99接近预算：减半
+    controller.recordBatch(16, 20, std::vector<double>(16, 9.5));
+    EXPECT_EQ(controller.getBatchSize(), 8u);
+
+    auto stats = controller.getStatistics();
+    EXPECT_EQ(stats.currentBatchSize, 8u);
+    EXPECT_EQ(stats.shrinkEvents, 1u);
+    EXPECT_GT(stats.growEvents, 0u);
+    EXPECT_DOUBLE_EQ(stats.p99LatencyMs, 9.5);
+    EXPECT_DOUBLE_EQ(stats.p99ByBatchSize[4], 9.5);
+    EXPECT_DOUBLE_EQ(stats.p99ByBatchSize[2], 1.0);
+}
+
+TEST_F(DataProcessorTest, AsyncProcessingDrainsQueueInBatches)
+{
+    DataProcessorConfig config;
+    config.batchSize = 8;
+    config.processingTimeoutMs = 5000;
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.start(), SystemErrors::SUCCESS);
+
+    constexpr size_t PACKETS = 24;
+    std::vector<Future<ProcessingResultPtr>> futures;
+    for (size_t i = 0; i < PACKETS; ++i)
+    {
+        futures.push_back(processor.processPacketAsync(createPacket(2, 64)));
+    }
+    for (auto &future : futures)
+    {
+        auto result = future.get();
+        ASSERT_TRUE(result);
+        EXPECT_TRUE(result->processingSuccess);
+    }
+
+    // 批次统计在整批完成后更新
+    BatchingStatistics stats;
+    for (int i = 0; i < 100; ++i)
+    {
+        stats = processor.getBatchingStatistics();
+        if (stats.tasksProcessed == PACKETS)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(stats.tasksProcessed, PACKETS);
+    EXPECT_LE(stats.batchesProcessed, PACKETS);
+    EXPECT_GE(stats.currentBatchSize, 1u);
+    EXPECT_GT(stats.p99LatencyMs, 0.0);
+
+    ProcessingStatistics snapshot;
+    processor.getStatistics(snapshot);
+    EXPECT_EQ(snapshot.currentBatchSize.load(), stats.currentBatchSize);
+
+    processor.stop();
+    processor.cleanup();
+}
+
+TEST_F(DataProcessorTest, BatchedPacketsCountTowardAdmissionBacklog)
+{
+    DataProcessorConfig config;
+    config.batchSize = 16;
+    config.processingTimeoutMs = 5000;
+    config.degradationBacklogThresholds = {2, 4, 6, 8};
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.start(), SystemErrors::SUCCESS);
+
+    // 用控制消息占住处理线程，在此期间把数据包排入队列，放行后处理线程一次取批
+    auto runQueued = [&](size_t count, PacketPriority priority)
+    {
+        std::promise<void> gate;
+        std::promise<void> held;
+        std::shared_future<void> released = gate.get_future().share();
+        ASSERT_EQ(processor.postControl([released, &held]()
+                                        {
+            held.set_value();
+            released.wait(); }),
+                  SystemErrors::SUCCESS);
+        held.get_future().wait();
+        std::vector<Future<ProcessingResultPtr>> futures;
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto packet = createPacket(2, 64);
+            packet->priority = priority;
+            futures.push_back(processor.processPacketAsync(packet));
+        }
+        gate.set_value();
+        for (auto &future : futures)
+        {
+            future.wait();
+        }
+    };
+
+    // 队列积压时批大小增长，超过此后一次排队的数据包数
+    runQueued(64, PacketPriority::NORMAL);
+    const BatchingStatistics batching = processor.getBatchingStatistics();
+    ASSERT_GT(batching.growEvents, 0u);
+    ASSERT_GT(batching.currentBatchSize, 16u);
+
+    // 积压消退后逐级恢复到完整处理
+    ProcessingResultPtr result;
+    for (int i = 0; i < 64; ++i)
+    {
+        ASSERT_EQ(processor.processPacket(createPacket(2, 64), result), SystemErrors::SUCCESS);
+    }
+    ProcessingStatistics before;
+    processor.getStatistics(before);
+    ASSERT_EQ(before.degradationLevel.load(), static_cast<uint8_t>(DegradationLevel::FULL));
+
+    // 一次取批就取空队列：批内其余数据包仍是积压，低优先级数据包被丢弃
+    runQueued(16, PacketPriority::LOW);
+    ProcessingStatistics after;
+    processor.getStatistics(after);
+    EXPECT_GT(after.shedPackets.load(), before.shedPackets.load());
+
+    processor.stop();
+    processor.cleanup();
+}
+
+//==============================================================================
+// 控制通道测试
+//==============================================================================
+
+TEST_F(DataProcessorTest, ControlMessagesOvertakeSaturatedDataQueue)
+{
+    DataProcessorConfig config;
+    config.batchSize = 8;
+    config.processingTimeoutMs = 5000;
+
+    CPUDataProcessor processor;
+    ASSERT_EQ(processor.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(processor.start(), SystemErrors::SUCCESS);
+
+    std::atomic<size_t> processed{0};
+    processor.setProcessingCompleteCallback([&processed](const ProcessingResult &)
+                                            { processed.fetch_add(1); });
+
+    // 填满数据队列（容量为批大小的4倍）
+    constexpr size_t PACKETS = 32;
+    std::vector<Future<ProcessingResultPtr>> futures;
+    for (size_t i = 0; i < PACKETS; ++i)
+    {
+        futures.push_back(processor.processPacketAsync(createPacket(8, 4096)));
+    }
+
+    // 控制消息在处理线程上执行，不必等积压处理完
+    std::promise<std::pair<std::thread::id, size_t>> applied;
+    auto appliedFuture = applied.get_future();
+    ASSERT_EQ(processor.postControl([&]()
+                                    { applied.set_value({std::this_thread::get_id(), processed.load()}); }),
+              SystemErrors::SUCCESS);
+    ASSERT_EQ(appliedFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    const auto observed = appliedFuture.get();
+    EXPECT_NE(observed.first, std::this_thread::get_id());
+    EXPECT_LT(observed.second, PACKETS);
+
+    for (auto &future : futures)
+    {
+        EXPECT_TRUE(future.get());
+    }
+
+    // 暂停期间控制消息同样生效；失败的消息计入统计，不影响后续消息
+    ASSERT_EQ(processor.pause(), SystemErrors::SUCCESS);
+    std::atomic<int> order{0};
+    EXPECT_EQ(processor.postControl([]()
+                                    { throw std::runtime_error("bad parameter"); }),
+              SystemErrors::SUCCESS);
+    EXPECT_EQ(processor.postControl([&order]()
+                                    { order.store(1); }),
+              SystemErrors::SUCCESS);
+    EXPECT_EQ(processor.postControl(nullptr), SystemErrors::INVALID_PARAMETER);
+    for (int i = 0; i < 500 && order.load() == 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(order.load(), 1);
+
+    const ControlLaneStatistics stats = processor.getControlStatistics();
+    EXPECT_EQ(stats.posted, 3u);
+    EXPECT_EQ(stats.applied, 3u);
+    EXPECT_EQ(stats.failed, 1u);
+    EXPECT_EQ(stats.rejected, 0u);
+    EXPECT_GT(stats.maxLatencyUs, 0.0);
+    EXPECT_LE(stats.meanLatencyUs, stats.maxLatencyUs);
+
+    processor.stop();
+    processor.cleanup();
+}
@@ -8,6 +8,9 @@
  * - 错误处理测试
  * - 配置管理测试
  * - 线程安全测试
+ * - 接收环形缓冲区的溢出策略（drop_oldest/drop_newest/block）与SPSC/MPMC模式
+ * - 批量接收（只为第一个数据包等待）
+ * - 控制通道（接收线程在数据包之间执行控制消息，block策略的缓冲区满时仍执行）
  *
  * @author Kelin
  * @version 2.0
@@ -19,6 +22,7 @@
 #include "modules/data_receiver.h"
 #include "common/logger.h"
 #include "common/config_manager.h"
+#include "common/overflow_ring.h"
 #include <filesystem>
 #include <fstream>
 #include <thread>
@@ -388,6 +392,235 @@ TEST_F(DataReceiverTest, ConcurrentAccess)
     EXPECT_EQ(receiver->stop(), radar::SystemErrors::SUCCESS);
 }
 
+TEST_F(DataReceiverTest, OverflowRingAppliesPolicyInPlace)
+{
+    // drop_oldest：保留最新的数据（容量向上取整到2的幂）
+    OverflowRing<int> oldest(3, OverflowPolicy::DROP_OLDEST, true);
+    EXPECT_TRUE(oldest.isSingleProducer());
+    EXPECT_EQ(oldest.capacity(), 4u);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(oldest.push(i), RingPushResult::QUEUED);
+    }
+    EXPECT_EQ(oldest.push(4), RingPushResult::QUEUED_DROPPED_OLDEST);
+    EXPECT_EQ(oldest.push(5), RingPushResult::QUEUED_DROPPED_OLDEST);
+    EXPECT_EQ(oldest.getDroppedCount(), 2u);
+    int value = -1;
+    ASSERT_TRUE(oldest.tryPop(value));
+    EXPECT_EQ(value, 2);
+
+    // 丢弃日志限频：首次取出累计值，间隔内不再报告
+    EXPECT_EQ(oldest.takeDropsToReport(std::chrono::seconds(60)), 2u);
+    EXPECT_EQ(oldest.push(6), RingPushResult::QUEUED);
+    EXPECT_EQ(oldest.push(7), RingPushResult::QUEUED_DROPPED_OLDEST);
+    EXPECT_EQ(oldest.takeDropsToReport(std::chrono::seconds(60)), 0u);
+
+    // drop_newest：保留已缓冲的数据（MPMC模式）
+    OverflowRing<int> newest(2, OverflowPolicy::DROP_NEWEST, false);
+    EXPECT_FALSE(newest.isSingleProducer());
+    EXPECT_EQ(newest.push(1), RingPushResult::QUEUED);
+    EXPECT_EQ(newest.push(2), RingPushResult::QUEUED);
+    EXPECT_EQ(newest.push(3), RingPushResult::DROPPED_NEWEST);
+    ASSERT_TRUE(newest.popFor(value, std::chrono::milliseconds(10)));
+    EXPECT_EQ(value, 1);
+    EXPECT_EQ(newest.clear(), 1u);
+    EXPECT_FALSE(newest.popFor(value, std::chrono::milliseconds(10)));
+
+    // block：生产者等到消费者腾出空位，关闭后立即返回
+    OverflowRing<int> block(2, OverflowPolicy::BLOCK, true);
+    block.push(1);
+    block.push(2);
+    std::atomic<bool> pushed{false};
+    std::thread producer([&]()
+                         {
+        EXPECT_EQ(block.push(3), RingPushResult::QUEUED);
+        pushed = true;
+        EXPECT_EQ(block.push(4), RingPushResult::CLOSED); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(pushed.load());
+    ASSERT_TRUE(block.pop(value));
+    EXPECT_EQ(value, 1);
+    while (!pushed.load())
+    {
+        std::this_thread::yield();
+    }
+    block.close();
+    producer.join();
+    EXPECT_FALSE(block.pop(value));
+    EXPECT_EQ(block.getDroppedCount(), 0u);
+
+    // 单生产者多消费者：每个元素恰好被取走一次
+    constexpr int ITEM_COUNT = 20000;
+    OverflowRing<int> spsc(64, OverflowPolicy::BLOCK, true);
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 3; ++c)
+    {
+        consumers.emplace_back([&]()
+                               {
+            int item = 0;
+            while (spsc.pop(item))
+            {
+                sum += item;
+                consumed++;
+            } });
+    }
+    for (int i = 1; i <= ITEM_COUNT; ++i)
+    {
+        spsc.push(i);
+    }
+    while (consumed.load() < ITEM_COUNT)
+    {
+        std::this_thread::yield();
+    }
+    spsc.close();
+    for (auto &consumer : consumers)
+    {
+        consumer.join();
+    }
+    EXPECT_EQ(sum.load(), static_cast<long long>(ITEM_COUNT) * (ITEM_COUNT + 1) / 2);
+}
+
+TEST_F(DataReceiverTest, BatchReceiveWaitsOnlyForFirstPacket)
+{
+    // 环形缓冲区：一次取走已缓冲的元素，不超过maxCount
+    for (bool singleProducer : {true, false})
+    {
+        OverflowRing<int> ring(16, OverflowPolicy::DROP_OLDEST, singleProducer);
+        for (int i = 0; i < 10; ++i)
+        {
+            ring.push(i);
+        }
+        int items[16] = {};
+        ASSERT_EQ(ring.popBatch(items, 4), 4u);
+        EXPECT_EQ(items[0], 0);
+        EXPECT_EQ(items[3], 3);
+        ASSERT_EQ(ring.popBatchFor(items, 16, std::chrono::milliseconds(10)), 6u);
+        EXPECT_EQ(items[5], 9);
+        EXPECT_EQ(ring.popBatchFor(items, 16, std::chrono::milliseconds(10)), 0u);
+    }
+
+    auto receiver = DataReceiverFactory::createReceiver(
+        DataReceiverFactory::ReceiverType::SIMULATION_RECEIVER,
+        DataReceiverConfig{},
+        nullptr);
+    ASSERT_NE(receiver, nullptr);
+
+    RawDataPacketPtr packets[16];
+    size_t receivedCount = 0;
+    EXPECT_EQ(receiver->receivePackets(packets, 0, receivedCount, 10), radar::SystemErrors::INVALID_PARAMETER);
+
+    EXPECT_EQ(receiver->initialize(), radar::SystemErrors::SUCCESS);
+    EXPECT_EQ(receiver->start(), radar::SystemErrors::SUCCESS);
+
+    ASSERT_EQ(receiver->receivePackets(packets, 16, receivedCount, 2000), radar::SystemErrors::SUCCESS);
+    EXPECT_GE(receivedCount, 1u);
+    EXPECT_LE(receivedCount, 16u);
+    for (size_t i = 0; i < receivedCount; ++i)
+    {
+        EXPECT_NE(packets[i], nullptr);
+    }
+
+    EXPECT_EQ(receiver->stop(), radar::SystemErrors::SUCCESS);
+    EXPECT_NE(receiver->receivePackets(packets, 16, receivedCount, 10), radar::SystemErrors::SUCCESS);
+    EXPECT_EQ(receivedCount, 0u);
+}
+
+TEST_F(DataReceiverTest, ControlMessagesRunOnReceptionThread)
+{
+    auto receiver = DataReceiverFactory::createReceiver(
+        DataReceiverFactory::ReceiverType::SIMULATION_RECEIVER,
+        DataReceiverConfig{},
+        nullptr);
+    ASSERT_NE(receiver, nullptr);
+    EXPECT_EQ(receiver->postControl(nullptr), radar::SystemErrors::INVALID_PARAMETER);
+
+    // 启动前投递的消息保留到接收线程启动后执行，且不在调用线程上执行
+    std::atomic<int> applied{0};
+    std::atomic<bool> onCallerThread{false};
+    const std::thread::id caller = std::this_thread::get_id();
+    ASSERT_EQ(receiver->postControl([&]()
+                                    {
+        onCallerThread = std::this_thread::get_id() == caller;
+        applied++; }),
+              radar::SystemErrors::SUCCESS);
+    ASSERT_EQ(receiver->postControl([]()
+                                    { throw std::runtime_error("bad parameter"); }),
+              radar::SystemErrors::SUCCESS);
+    ASSERT_EQ(receiver->postControl([&]()
+                                    { applied++; }),
+              radar::SystemErrors::SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(applied.load(), 0);
+
+    EXPECT_EQ(receiver->initialize(), radar::SystemErrors::SUCCESS);
+    EXPECT_EQ(receiver->start(), radar::SystemErrors::SUCCESS);
+
+    // 失败的消息不影响后续消息
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (receiver->getControlStatistics().applied < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(applied.load(), 2);
+    EXPECT_FALSE(onCallerThread.load());
+
+    const ControlLaneStatistics stats = receiver->getControlStatistics();
+    EXPECT_EQ(stats.posted, 3u);
+    EXPECT_EQ(stats.applied, 3u);
+    EXPECT_EQ(stats.failed, 1u);
+
+    EXPECT_EQ(receiver->stop(), radar::SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief block策略的接收缓冲区已满、无人消费时，阻塞在入队上的接收线程仍执行控制消息
+ */
+TEST_F(DataReceiverTest, ControlMessagesRunWhileBlockedOnFullRing)
+{
+    DataReceiverConfig config;
+    config.maxQueueSize = 2;
+    config.overflowPolicy = "block";
+    auto receiver = DataReceiverFactory::createReceiver(
+        DataReceiverFactory::ReceiverType::SIMULATION_RECEIVER,
+        config,
+        nullptr);
+    ASSERT_NE(receiver, nullptr);
+    EXPECT_EQ(receiver->initialize(), radar::SystemErrors::SUCCESS);
+    EXPECT_EQ(receiver->start(), radar::SystemErrors::SUCCESS);
+
+    // 缓冲区填满后接收线程已取到下一个数据包并阻塞在入队上
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    BufferStatus status = receiver->getBufferStatus();
+    while ((status.currentSize < status.totalCapacity || status.totalReceived <= status.totalCapacity) &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        status = receiver->getBufferStatus();
+    }
+    ASSERT_EQ(status.currentSize, status.totalCapacity);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::atomic<int> applied{0};
+    ASSERT_EQ(receiver->postControl([&]()
+                                    { applied++; }),
+              radar::SystemErrors::SUCCESS);
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (applied.load() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(applied.load(), 1);
+
+    // 执行控制消息后继续等待空位，不丢弃数据包
+    status = receiver->getBufferStatus();
+    EXPECT_EQ(status.currentSize, status.totalCapacity);
+    EXPECT_EQ(status.totalDropped, 0u);
+
+    EXPECT_EQ(receiver->stop(), radar::SystemErrors::SUCCESS);
+}
+
 //==============================================================================
 // 配置管理测试
 //==============================================================================
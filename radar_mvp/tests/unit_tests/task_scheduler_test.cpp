@@ -0,0 +1,2178 @@
+/**
+ * @file task_scheduler_test.cpp
+ * @brief 任务调度模块单元测试
+ *
+ * 使用 GoogleTest 框架测试任务调度模块的各项功能：
+ * - Chase-Lev工作窃取双端队列
+ * - 工作窃取线程池（本地提交、注入队列、窃取、启停、弹性伸缩）
+ * - 分级无锁优先级队列（级内FIFO、老化、并发）
+ * - 事件计数器的先自旋再休眠、批量唤醒与超时
+ * - 最早截止时间优先队列（d叉堆排序、过期降级/丢弃）
+ * - 分层时间轮与延迟/周期任务
+ * - 运行槽位与基于时间轮的任务超时统计
+ * - 有界等待队列的分级准入、拒绝统计与背压信号（清理或重建队列丢弃的任务归还信用）
+ * - 分片长任务在检查点让出给高优先级任务（协作式抢占），检查点只取更高优先级任务、不触发老化
+ * - 按工作线程分片的统计与延迟直方图（p50/p90/p99/p99.9）
+ * - 多租户（传感器）按权重公平共享工作线程池
+ * - 多个处理器实例间按排队深度（含处理器自报积压）与服务时间派发，按亲和键粘性派发且固定的键数有上限
+ * - 内联存储的只移动可调用对象与免分配轻量任务
+ * - 调度器在工作窃取线程池上的任务执行（FIFO策略保持提交顺序）
+ * - 控制通道：控制消息在相邻两个任务之间执行，不排在积压任务之后，空闲时也能及时生效
+ * - 支持续体、组合与取消的Future
+ * - 按依赖关系释放节点的任务依赖图
+ * - 工作线程的CPU亲和性、NUMA与实时调度放置
+ *
+ * @author Kelin
+ * @version 1.0
+ * @date 2026-10-16
+ * @since 1.0
+ */
+
+#include <gtest/gtest.h>
+#include "modules/task_scheduler.h"
+#include "common/logger.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace radar;
+using namespace radar::common;
+
+/**
+ * @brief 任务调度测试夹具
+ */
+class TaskSchedulerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // 初始化日志系统
+        LoggerConfig logConfig;
+        logConfig.console.enabled = true;
+        logConfig.file.enabled = false;
+        logConfig.globalLevel = LogLevel::WARN;
+        LoggerManager::getInstance().initialize(logConfig);
+    }
+
+    void TearDown() override
+    {
+        LoggerManager::getInstance().shutdown();
+    }
+
+    /**
+     * @brief 等待条件成立
+     * @param condition 条件函数
+     * @param timeoutMs 超时时间（毫秒）
+     * @return 条件是否在超时前成立
+     */
+    template <typename Condition>
+    static bool waitUntil(Condition condition, int timeoutMs = 5000)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief 所有者与多个窃取者并发访问时每个元素恰好被取出一次
+ */
+TEST_F(TaskSchedulerTest, WorkStealingDequeHandsOutEachItemOnce)
+{
+    constexpr int ITEM_COUNT = 100000;
+    constexpr int THIEF_COUNT = 3;
+
+    std::vector<int> items(ITEM_COUNT);
+    std::vector<std::atomic<int>> taken(ITEM_COUNT);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        items[i] = i;
+        taken[i] = 0;
+    }
+
+    // 小初始容量，覆盖并发扩容
+    WorkStealingDeque<int *> deque(4);
+    std::atomic<bool> ownerDone{false};
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < THIEF_COUNT; ++t)
+    {
+        thieves.emplace_back([&]()
+                             {
+            while (!ownerDone.load() || !deque.empty())
+            {
+                if (int *item = deque.steal())
+                {
+                    taken[*item]++;
+                    consumed++;
+                }
+            } });
+    }
+
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        deque.push(&items[i]);
+        if (i % 3 == 0)
+        {
+            if (int *item = deque.pop())
+            {
+                taken[*item]++;
+                consumed++;
+            }
+        }
+    }
+    while (int *item = deque.pop())
+    {
+        taken[*item]++;
+        consumed++;
+    }
+    ownerDone = true;
+
+    for (auto &thief : thieves)
+    {
+        thief.join();
+    }
+
+    EXPECT_EQ(consumed.load(), ITEM_COUNT);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+    EXPECT_GT(deque.capacity(), 4u);
+}
+
+/**
+ * @brief 任务内部递归派生的子任务全部执行，空闲线程通过窃取分担
+ */
+TEST_F(TaskSchedulerTest, WorkStealingPoolRunsNestedSubmissions)
+{
+    constexpr int DEPTH = 10;
+
+    WorkStealingPool pool;
+    WorkStealingPoolConfig config;
+    config.threadCount = 4;
+    ASSERT_EQ(pool.start(config, [](ScheduledTaskPtr task)
+                         { task->execute(); }),
+              SystemErrors::SUCCESS);
+    EXPECT_EQ(pool.getThreadCount(), 4u);
+
+    std::atomic<int> leaves{0};
+    std::function<void(int)> spawn = [&](int depth)
+    {
+        if (depth == 0)
+        {
+            // 叶子任务稍作停留，让其他线程有机会窃取
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+            leaves++;
+            return;
+        }
+        EXPECT_GE(WorkStealingPool::getCurrentWorkerIndex(), 0);
+        for (int i = 0; i < 2; ++i)
+        {
+            pool.submit(std::make_shared<ScheduledTask>([&spawn, depth]()
+                                                        { spawn(depth - 1); }));
+        }
+    };
+
+    pool.submit(std::make_shared<ScheduledTask>([&spawn]()
+                                                { spawn(DEPTH); }));
+    ASSERT_TRUE(waitUntil([&]()
+                          { return leaves.load() == (1 << DEPTH); }));
+    pool.stop();
+
+    const auto stats = pool.getStatistics();
+    const uint64_t total = (2u << DEPTH) - 1;
+    EXPECT_EQ(stats.submitted, total);
+    EXPECT_EQ(stats.executed, total);
+    EXPECT_EQ(stats.injectedSubmits, 1u);
+    EXPECT_EQ(stats.localSubmits, total - 1);
+    EXPECT_GT(stats.successfulSteals, 0u);
+    EXPECT_EQ(stats.pendingTasks, 0u);
+    EXPECT_EQ(WorkStealingPool::getCurrentWorkerIndex(), -1);
+}
+
+/**
+ * @brief 积压持续超过阈值时线程数逐个增加到上限，空闲超过存活时间后回到核心线程数
+ */
+TEST_F(TaskSchedulerTest, WorkStealingPoolGrowsUnderBacklogAndShrinksWhenIdle)
+{
+    WorkStealingPool pool;
+    WorkStealingPoolConfig config;
+    config.threadCount = 1;
+    config.maxThreadCount = 3;
+    config.keepAliveMs = 200;
+    config.scaleUpWaitUs = 1000;
+    config.scaleUpChecks = 2;
+    config.scaleCheckIntervalMs = 5;
+    ASSERT_EQ(pool.start(config, [](ScheduledTaskPtr task)
+                         { task->execute(); }),
+              SystemErrors::SUCCESS);
+    EXPECT_EQ(pool.getThreadCount(), 1u);
+
+    // 每个任务5ms，单线程需要约300ms，排队等待远超1ms阈值
+    std::atomic<int> executed{0};
+    for (int i = 0; i < 60; ++i)
+    {
+        pool.submit(std::make_shared<ScheduledTask>([&executed]()
+                                                    {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            executed++; }));
+    }
+    ASSERT_TRUE(waitUntil([&]()
+                          { return pool.getThreadCount() == 3u; }));
+    ASSERT_TRUE(waitUntil([&]()
+                          { return executed.load() == 60; }));
+
+    // 额外线程空闲200ms后退出，核心线程保留
+    ASSERT_TRUE(waitUntil([&]()
+                          { return pool.getThreadCount() == 1u; }));
+
+    const auto stats = pool.getStatistics();
+    EXPECT_EQ(stats.coreThreadCount, 1u);
+    EXPECT_EQ(stats.maxThreadCount, 3u);
+    EXPECT_EQ(stats.peakThreadCount, 3u);
+    EXPECT_EQ(stats.threadsSpawned, 2u);
+    EXPECT_EQ(stats.threadsRetired, 2u);
+
+    // 线程数变化记录：启动1 -> 增长到2、3（带触发时的排队等待）-> 退出回到1
+    const auto history = pool.getSizeHistory();
+    ASSERT_EQ(history.size(), 5u);
+    EXPECT_EQ(history[0].threadCount, 1u);
+    EXPECT_EQ(history[1].threadCount, 2u);
+    EXPECT_GE(history[1].queueWaitUs, 1000u);
+    EXPECT_EQ(history[2].threadCount, 3u);
+    EXPECT_EQ(history[4].threadCount, 1u);
+    for (size_t i = 1; i < history.size(); ++i)
+    {
+        EXPECT_LE(history[i - 1].timestamp, history[i].timestamp);
+    }
+
+    // 再次积压时复用已退出线程的槽位
+    executed = 0;
+    for (int i = 0; i < 60; ++i)
+    {
+        pool.submit(std::make_shared<ScheduledTask>([&executed]()
+                                                    {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            executed++; }));
+    }
+    ASSERT_TRUE(waitUntil([&]()
+                          { return pool.getThreadCount() > 1u; }));
+    ASSERT_TRUE(waitUntil([&]()
+                          { return executed.load() == 60; }));
+    pool.stop();
+    EXPECT_EQ(pool.getThreadCount(), 0u);
+    EXPECT_EQ(pool.getStatistics().executed, 120u);
+}
+
+/**
+ * @brief 默认的线程池调度器同样按maxThreads增长、按keepAliveMs回到构造时的核心线程数
+ */
+TEST_F(TaskSchedulerTest, ThreadPoolSchedulerGrowsToMaxThreadsAndShrinksWhenIdle)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 3;
+    config.keepAliveMs = 200;
+    config.scaleUpWaitUs = 1000;
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler.getWorkerPoolStatistics().threadCount, 1u);
+    EXPECT_EQ(scheduler.getWorkerPoolStatistics().maxThreadCount, 3u);
+
+    // 每个任务5ms，单线程需要约300ms，排队等待远超1ms阈值
+    std::vector<Future<void>> futures;
+    for (int i = 0; i < 60; ++i)
+    {
+        futures.push_back(scheduler.submitTask([]()
+                                               { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }));
+    }
+    ASSERT_TRUE(waitUntil([&]()
+                          { return scheduler.getWorkerPoolStatistics().threadCount == 3u; }));
+    for (auto &future : futures)
+    {
+        future.get();
+    }
+
+    ASSERT_TRUE(waitUntil([&]()
+                          { return scheduler.getWorkerPoolStatistics().threadCount == 1u; }));
+    EXPECT_EQ(scheduler.getWorkerPoolStatistics().threadsRetired, 2u);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 启动前提交的任务在启动后执行，停止后线程池可重新启动
+ */
+TEST_F(TaskSchedulerTest, WorkStealingPoolKeepsPendingTasksAcrossRestart)
+{
+    WorkStealingPool pool;
+    std::atomic<int> executed{0};
+    auto handler = [&executed](ScheduledTaskPtr task)
+    {
+        if (task)
+        {
+            task->execute();
+        }
+        executed++;
+    };
+
+    for (int i = 0; i < 8; ++i)
+    {
+        pool.submit(std::make_shared<ScheduledTask>([]() {}));
+    }
+    EXPECT_EQ(pool.getPendingCount(), 8u);
+    EXPECT_FALSE(pool.isRunning());
+
+    WorkStealingPoolConfig config;
+    config.threadCount = 2;
+    ASSERT_EQ(pool.start(config, handler), SystemErrors::SUCCESS);
+    EXPECT_NE(pool.start(config, handler), SystemErrors::SUCCESS);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return executed.load() == 8; }));
+    pool.stop();
+    EXPECT_FALSE(pool.isRunning());
+    EXPECT_EQ(pool.getThreadCount(), 0u);
+
+    // 空任务指针原样交给处理函数
+    pool.submit(nullptr);
+    ASSERT_EQ(pool.start(config, handler), SystemErrors::SUCCESS);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return executed.load() == 9; }));
+    pool.stop();
+
+    const auto stats = pool.getStatistics();
+    EXPECT_EQ(stats.executed, 9u);
+    EXPECT_EQ(stats.pendingTasks, 0u);
+
+    // 停止时本地队列剩余的任务排在注入队列剩余任务之前，重启后仍按提交顺序执行
+    WorkStealingPool ordered;
+    std::mutex orderMutex;
+    std::vector<int> order;
+    std::promise<void> gate;
+    std::shared_future<void> gateOpen = gate.get_future().share();
+    auto makeOrderedTask = [&](int index)
+    {
+        return std::make_shared<ScheduledTask>([&, index]()
+                                               {
+            if (index == 0)
+            {
+                gateOpen.wait();
+            }
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(index); });
+    };
+
+    // 单线程启动时第一个任务执行，其余任务一次取回本地队列
+    for (int i = 0; i < 8; ++i)
+    {
+        ordered.submit(makeOrderedTask(i));
+    }
+    config.threadCount = 1;
+    ASSERT_EQ(ordered.start(config, handler), SystemErrors::SUCCESS);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return ordered.getPendingCount() == 7; }));
+    for (int i = 8; i < 12; ++i)
+    {
+        ordered.submit(makeOrderedTask(i));
+    }
+    std::thread stopper([&]()
+                        { ordered.stop(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    gate.set_value();
+    stopper.join();
+
+    ASSERT_EQ(ordered.start(config, handler), SystemErrors::SUCCESS);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return ordered.getPendingCount() == 0; }));
+    ordered.stop();
+
+    std::vector<int> expectedOrder(12);
+    std::iota(expectedOrder.begin(), expectedOrder.end(), 0);
+    std::lock_guard<std::mutex> lock(orderMutex);
+    EXPECT_EQ(order, expectedOrder);
+}
+
+/**
+ * @brief 优先级队列按级别出队、级内FIFO，老化让低优先级任务获得出队份额
+ */
+TEST_F(TaskSchedulerTest, PriorityTaskQueueOrdersByLevelAndAges)
+{
+    auto makeTask = [](PacketPriority priority)
+    {
+        return std::make_shared<ScheduledTask>([]() {}, priority);
+    };
+
+    PriorityTaskQueue strict(16, 0);
+    std::vector<ScheduledTask::TaskId> expected[TASK_PRIORITY_LEVELS];
+    for (int i = 0; i < 3; ++i)
+    {
+        for (auto priority : {PacketPriority::LOW, PacketPriority::CRITICAL, PacketPriority::NORMAL})
+        {
+            auto task = makeTask(priority);
+            expected[static_cast<size_t>(priority)].push_back(task->getId());
+            ASSERT_EQ(strict.enqueue(task), SystemErrors::SUCCESS);
+        }
+    }
+    EXPECT_EQ(strict.size(), 9u);
+
+    std::vector<ScheduledTask::TaskId> order;
+    ScheduledTaskPtr task;
+    while (strict.dequeue(task, 0) == SystemErrors::SUCCESS)
+    {
+        order.push_back(task->getId());
+    }
+    std::vector<ScheduledTask::TaskId> expectedOrder;
+    for (auto level : {PacketPriority::CRITICAL, PacketPriority::NORMAL, PacketPriority::LOW})
+    {
+        const auto &ids = expected[static_cast<size_t>(level)];
+        expectedOrder.insert(expectedOrder.end(), ids.begin(), ids.end());
+    }
+    EXPECT_EQ(order, expectedOrder);
+    EXPECT_TRUE(strict.empty());
+    EXPECT_EQ(strict.dequeue(task, 5), TaskSchedulerErrors::TASK_TIMEOUT);
+
+    // 每4次出队服务一次最低的非空级别
+    PriorityTaskQueue aging(16, 4);
+    for (int i = 0; i < 8; ++i)
+    {
+        aging.enqueue(makeTask(PacketPriority::HIGH));
+    }
+    aging.enqueue(makeTask(PacketPriority::LOW));
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(aging.dequeue(task, 0), SystemErrors::SUCCESS);
+        EXPECT_EQ(task->getPriority(), PacketPriority::HIGH);
+    }
+    ASSERT_EQ(aging.dequeue(task, 0), SystemErrors::SUCCESS);
+    EXPECT_EQ(task->getPriority(), PacketPriority::LOW);
+    EXPECT_EQ(aging.getAgedDequeueCount(), 1u);
+
+    // 单级容量耗尽时拒绝入队
+    PriorityTaskQueue tiny(2, 0);
+    EXPECT_EQ(tiny.enqueue(makeTask(PacketPriority::LOW)), SystemErrors::SUCCESS);
+    EXPECT_EQ(tiny.enqueue(makeTask(PacketPriority::LOW)), SystemErrors::SUCCESS);
+    EXPECT_EQ(tiny.enqueue(makeTask(PacketPriority::LOW)), TaskSchedulerErrors::TASK_QUEUE_FULL);
+    EXPECT_EQ(tiny.enqueue(makeTask(PacketPriority::HIGH)), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 多生产者多消费者并发访问优先级队列时任务不丢失不重复
+ */
+TEST_F(TaskSchedulerTest, PriorityTaskQueueConcurrentProducersAndConsumers)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 4;
+    constexpr int TASKS_PER_PRODUCER = 2000;
+
+    PriorityTaskQueue queue(PRODUCERS * TASKS_PER_PRODUCER);
+    std::atomic<int> consumed{0};
+    std::mutex idsMutex;
+    std::set<ScheduledTask::TaskId> ids;
+
+    std::vector<std::thread> threads;
+    for (int c = 0; c < CONSUMERS; ++c)
+    {
+        threads.emplace_back([&]()
+                             {
+            ScheduledTaskPtr task;
+            while (consumed.load() < PRODUCERS * TASKS_PER_PRODUCER)
+            {
+                if (queue.dequeue(task, 10) == SystemErrors::SUCCESS)
+                {
+                    std::lock_guard<std::mutex> lock(idsMutex);
+                    EXPECT_TRUE(ids.insert(task->getId()).second);
+                    consumed++;
+                }
+            } });
+    }
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        threads.emplace_back([&queue, p]()
+                             {
+            for (int i = 0; i < TASKS_PER_PRODUCER; ++i)
+            {
+                auto priority = static_cast<PacketPriority>((p + i) % TASK_PRIORITY_LEVELS);
+                EXPECT_EQ(queue.enqueue(std::make_shared<ScheduledTask>([]() {}, priority)),
+                          SystemErrors::SUCCESS);
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(consumed.load(), PRODUCERS * TASKS_PER_PRODUCER);
+    EXPECT_EQ(ids.size(), static_cast<size_t>(PRODUCERS * TASKS_PER_PRODUCER));
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @brief 事件计数器：无等待者时通知不登记，notifyMany()一次唤醒多个休眠者，条件不满足时按时超时
+ */
+TEST_F(TaskSchedulerTest, EventCountWakesParkedWaitersAndTimesOut)
+{
+    constexpr int WAITERS = 4;
+
+    EventCount events;
+    events.notifyOne();
+    EXPECT_EQ(events.getWaiterCount(), 0u);
+
+    // 每个等待者取走一个令牌，条件本身带副作用
+    std::atomic<int> tokens{0};
+    auto takeToken = [&tokens]()
+    {
+        int available = tokens.load();
+        while (available > 0)
+        {
+            if (tokens.compare_exchange_weak(available, available - 1))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::atomic<int> woken{0};
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < WAITERS; ++i)
+    {
+        waiters.emplace_back([&]()
+                             {
+            if (events.awaitFor(takeToken, std::chrono::seconds(5)))
+            {
+                woken++;
+            } });
+    }
+
+    // 等全部等待者自旋结束进入休眠，验证唤醒来自通知而不是自旋
+    const auto parkDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (events.getWaiterCount() < static_cast<uint32_t>(WAITERS) &&
+           std::chrono::steady_clock::now() < parkDeadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(events.getWaiterCount(), static_cast<uint32_t>(WAITERS));
+
+    tokens.store(WAITERS);
+    events.notifyMany(WAITERS);
+    for (auto &waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_EQ(woken.load(), WAITERS);
+    EXPECT_EQ(tokens.load(), 0);
+    EXPECT_EQ(events.getWaiterCount(), 0u);
+
+    // 条件一直不满足时按超时返回，并撤销登记
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(events.awaitFor([]()
+                                 { return false; },
+                                 std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    EXPECT_EQ(events.getWaiterCount(), 0u);
+}
+
+/**
+ * @brief EDF队列按截止时间出队，过期任务按策略降级或交给调度器丢弃
+ */
+TEST_F(TaskSchedulerTest, EDFTaskQueueOrdersByDeadlineAndHandlesMisses)
+{
+    const auto now = Timestamp::clock::now();
+    auto makeTask = [](Timestamp deadline)
+    {
+        auto task = std::make_shared<ScheduledTask>([]() {});
+        task->setDeadline(deadline);
+        return task;
+    };
+
+    for (auto policy : {DeadlineMissPolicy::DEMOTE, DeadlineMissPolicy::DROP})
+    {
+        SCOPED_TRACE(static_cast<int>(policy));
+
+        EDFTaskQueue queue(64, policy);
+        auto expired = makeTask(now - std::chrono::milliseconds(10));
+        auto late = makeTask(now + std::chrono::seconds(30));
+        auto early = makeTask(now + std::chrono::seconds(10));
+        auto middle = makeTask(now + std::chrono::seconds(20));
+        auto tie = makeTask(now + std::chrono::seconds(20));
+        auto unbounded = std::make_shared<ScheduledTask>([]() {});
+        for (const auto &task : {late, unbounded, expired, middle, early, tie})
+        {
+            ASSERT_EQ(queue.enqueue(task), SystemErrors::SUCCESS);
+        }
+        EXPECT_EQ(queue.size(), 6u);
+
+        std::vector<ScheduledTaskPtr> order;
+        ScheduledTaskPtr task;
+        while (queue.dequeue(task, 0) == SystemErrors::SUCCESS)
+        {
+            order.push_back(task);
+        }
+
+        // 降级的过期任务排在所有未过期任务（包括无截止时间的任务）之后；
+        // 丢弃策略下过期任务最先出队，由调度器负责丢弃
+        std::vector<ScheduledTaskPtr> expected{early, middle, tie, late, unbounded};
+        if (policy == DeadlineMissPolicy::DEMOTE)
+        {
+            expected.push_back(expired);
+        }
+        else
+        {
+            expected.insert(expected.begin(), expired);
+        }
+        EXPECT_EQ(order, expected);
+        EXPECT_EQ(queue.getDemotedCount(), policy == DeadlineMissPolicy::DEMOTE ? 1u : 0u);
+        EXPECT_EQ(queue.dequeue(task, 5), TaskSchedulerErrors::TASK_TIMEOUT);
+    }
+
+    // 容量耗尽时拒绝入队
+    EDFTaskQueue tiny(1);
+    EXPECT_EQ(tiny.enqueue(makeTask(now)), SystemErrors::SUCCESS);
+    EXPECT_EQ(tiny.enqueue(makeTask(now)), TaskSchedulerErrors::TASK_QUEUE_FULL);
+}
+
+/**
+ * @brief 检查点让出只取优先级严格更高的任务：不触发老化，EDF在更高优先级任务中取最早到期的
+ */
+TEST_F(TaskSchedulerTest, CheckpointDequeueTakesOnlyHigherPriorityTasks)
+{
+    auto makeTask = [](PacketPriority priority)
+    {
+        return std::make_shared<ScheduledTask>([]() {}, priority);
+    };
+
+    // 老化间隔为2时普通出队每2次就会服务一次最低级别
+    PriorityTaskQueue aging(16, 2);
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(aging.enqueue(makeTask(PacketPriority::LOW)), SystemErrors::SUCCESS);
+        ASSERT_EQ(aging.enqueue(makeTask(PacketPriority::NORMAL)), SystemErrors::SUCCESS);
+        ASSERT_EQ(aging.enqueue(makeTask(PacketPriority::HIGH)), SystemErrors::SUCCESS);
+    }
+
+    ScheduledTaskPtr task;
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(aging.tryDequeueAbove(PacketPriority::NORMAL, task));
+        EXPECT_EQ(task->getPriority(), PacketPriority::HIGH);
+    }
+    // 没有更高优先级的任务时不取同级或更低级别的任务
+    EXPECT_FALSE(aging.tryDequeueAbove(PacketPriority::NORMAL, task));
+    EXPECT_FALSE(aging.tryDequeueAbove(PacketPriority::CRITICAL, task));
+    EXPECT_EQ(aging.getAgedDequeueCount(), 0u);
+    EXPECT_EQ(aging.size(), 8u);
+
+    // 检查点出队不推进老化计数：普通出队仍是第2次才老化
+    ASSERT_EQ(aging.dequeue(task, 0), SystemErrors::SUCCESS);
+    EXPECT_EQ(task->getPriority(), PacketPriority::NORMAL);
+    ASSERT_EQ(aging.dequeue(task, 0), SystemErrors::SUCCESS);
+    EXPECT_EQ(task->getPriority(), PacketPriority::LOW);
+    EXPECT_EQ(aging.getAgedDequeueCount(), 1u);
+
+    // EDF：低优先级任务最早到期，普通出队先取它，检查点只在更高优先级任务中按截止时间选
+    const auto now = Timestamp::clock::now();
+    auto makeDeadlineTask = [&](PacketPriority priority, std::chrono::seconds offset)
+    {
+        auto deadlineTask = makeTask(priority);
+        deadlineTask->setDeadline(now + offset);
+        return deadlineTask;
+    };
+
+    EDFTaskQueue edf(64);
+    auto lowEarly = makeDeadlineTask(PacketPriority::LOW, std::chrono::seconds(1));
+    auto highLate = makeDeadlineTask(PacketPriority::HIGH, std::chrono::seconds(30));
+    auto criticalMiddle = makeDeadlineTask(PacketPriority::CRITICAL, std::chrono::seconds(20));
+    auto normalMiddle = makeDeadlineTask(PacketPriority::NORMAL, std::chrono::seconds(10));
+    auto highEarly = makeDeadlineTask(PacketPriority::HIGH, std::chrono::seconds(15));
+    for (const auto &entry : {lowEarly, highLate, criticalMiddle, normalMiddle, highEarly})
+    {
+        ASSERT_EQ(edf.enqueue(entry), SystemErrors::SUCCESS);
+    }
+
+    std::vector<ScheduledTaskPtr> preempting;
+    while (edf.tryDequeueAbove(PacketPriority::NORMAL, task))
+    {
+        preempting.push_back(task);
+    }
+    EXPECT_EQ(preempting, (std::vector<ScheduledTaskPtr>{highEarly, criticalMiddle, highLate}));
+    EXPECT_EQ(edf.size(), 2u);
+
+    // 从堆中间删除后其余任务仍按截止时间出队
+    ASSERT_EQ(edf.dequeue(task, 0), SystemErrors::SUCCESS);
+    EXPECT_EQ(task, lowEarly);
+    ASSERT_EQ(edf.dequeue(task, 0), SystemErrors::SUCCESS);
+    EXPECT_EQ(task, normalMiddle);
+    EXPECT_TRUE(edf.empty());
+}
+
+/**
+ * @brief EDF调度器丢弃已过期任务并统计截止时间错过率
+ */
+TEST_F(TaskSchedulerTest, EdfSchedulerDropsTasksPastDeadline)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+    config.schedulingPolicy = "edf";
+    config.deadlineMissPolicy = "drop";
+    config.latencyBudgetNormalMs = 0; // 普通任务一提交即过期
+    config.latencyBudgetHighMs = 60000;
+
+    ThreadPoolScheduler scheduler(2);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.getCurrentStrategy(), SchedulingStrategy::EARLIEST_DEADLINE_FIRST);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    std::atomic<int> executed{0};
+    std::vector<Future<void>> expiredFutures;
+    std::vector<Future<void>> onTimeFutures;
+    for (int i = 0; i < 20; ++i)
+    {
+        expiredFutures.push_back(scheduler.submitTask([&executed]()
+                                                      { executed++; },
+                                                      PacketPriority::NORMAL));
+        onTimeFutures.push_back(scheduler.submitTask([&executed]()
+                                                     { executed++; },
+                                                     PacketPriority::HIGH));
+    }
+
+    for (auto &future : onTimeFutures)
+    {
+        ASSERT_TRUE(future.waitFor(std::chrono::seconds(5)));
+        EXPECT_NO_THROW(future.get());
+    }
+    for (auto &future : expiredFutures)
+    {
+        ASSERT_TRUE(future.waitFor(std::chrono::seconds(5)));
+        EXPECT_THROW(future.get(), std::runtime_error);
+    }
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_EQ(executed.load(), 20);
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    EXPECT_EQ(status.deadlineMisses, 20u);
+    EXPECT_DOUBLE_EQ(status.deadlineMissRate, 0.5);
+
+    TaskStatistics stats;
+    scheduler.getStatistics(stats);
+    EXPECT_EQ(stats.deadlineDrops.load(), 20u);
+    EXPECT_EQ(stats.totalTasksCancelled.load(), 20u);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 时间轮在各级（含溢出链表）的定时器都恰好在到期tick触发，支持取消与周期重装
+ */
+TEST_F(TaskSchedulerTest, TimerWheelFiresAtExpiryAcrossLevels)
+{
+    TimerWheel wheel(100);
+    std::vector<int> fired;
+    std::vector<TimerWheel::Callback> expired;
+    auto advance = [&](uint64_t tick)
+    {
+        expired.clear();
+        wheel.advanceTo(tick, expired);
+        for (auto &callback : expired)
+        {
+            callback();
+        }
+    };
+
+    // 分别落在第0~3级和溢出链表
+    const std::vector<uint64_t> expiries{130, 100 + 1000, 100 + 70000, 100 + 5000000, 100 + (uint64_t{1} << 25)};
+    for (size_t i = 0; i < expiries.size(); ++i)
+    {
+        wheel.schedule(expiries[i], [&fired, i]()
+                       { fired.push_back(static_cast<int>(i)); });
+    }
+    const auto cancelled = wheel.schedule(150, [&fired]()
+                                          { fired.push_back(-1); });
+    EXPECT_EQ(wheel.size(), expiries.size() + 1);
+    EXPECT_TRUE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(cancelled));
+
+    for (size_t i = 0; i < expiries.size(); ++i)
+    {
+        advance(expiries[i] - 1);
+        EXPECT_EQ(fired.size(), i);
+        advance(expiries[i]);
+        ASSERT_EQ(fired.size(), i + 1);
+        EXPECT_EQ(fired.back(), static_cast<int>(i));
+    }
+    EXPECT_TRUE(wheel.empty());
+
+    // 周期定时器：按固定相位重装，推进跨越多个周期时只触发一次
+    int ticks = 0;
+    const uint64_t start = wheel.now();
+    const auto periodic = wheel.schedule(start + 10, [&ticks]()
+                                         { ticks++; },
+                                         5);
+    advance(start + 10);
+    EXPECT_EQ(ticks, 1);
+    advance(start + 14);
+    EXPECT_EQ(ticks, 1);
+    advance(start + 15);
+    EXPECT_EQ(ticks, 2);
+    advance(start + 100);
+    EXPECT_EQ(ticks, 3);
+    EXPECT_EQ(wheel.ticksUntilNextEvent(), 5u);
+    EXPECT_TRUE(wheel.cancel(periodic));
+    advance(start + 200);
+    EXPECT_EQ(ticks, 3);
+    EXPECT_TRUE(wheel.empty());
+}
+
+/**
+ * @brief 调度器的延迟任务与周期任务由定时器线程投递到线程池执行
+ */
+TEST_F(TaskSchedulerTest, SchedulerRunsDelayedAndPeriodicTasks)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+
+    ThreadPoolScheduler scheduler(2);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    using Clock = std::chrono::steady_clock;
+    const auto submitted = Clock::now();
+    std::atomic<int64_t> delayedAfterMs{-1};
+    scheduler.submitDelayed([&]()
+                            { delayedAfterMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                   Clock::now() - submitted)
+                                                   .count(); },
+                            std::chrono::milliseconds(30));
+
+    std::atomic<int> cancelledRuns{0};
+    const auto cancelled = scheduler.submitDelayed([&]()
+                                                   { cancelledRuns++; },
+                                                   std::chrono::milliseconds(20));
+    EXPECT_TRUE(scheduler.cancelTimer(cancelled));
+
+    std::atomic<int> periodicRuns{0};
+    const auto periodic = scheduler.submitPeriodic([&]()
+                                                   { periodicRuns++; },
+                                                   std::chrono::milliseconds(5));
+    EXPECT_EQ(scheduler.getTimerCount(), 2u);
+
+    EXPECT_TRUE(waitUntil([&]()
+                          { return delayedAfterMs.load() >= 0 && periodicRuns.load() >= 5; }));
+    EXPECT_GE(delayedAfterMs.load(), 30);
+    EXPECT_THROW(scheduler.submitPeriodic([]() {}, std::chrono::milliseconds(0)), std::invalid_argument);
+
+    EXPECT_TRUE(scheduler.cancelTimer(periodic));
+    EXPECT_EQ(scheduler.getTimerCount(), 0u);
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    const int runsAfterCancel = periodicRuns.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_EQ(periodicRuns.load(), runsAfterCancel);
+    EXPECT_EQ(cancelledRuns.load(), 0);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 执行中超时的任务在结束前就被按优先级计数，未设超时的任务不计
+ */
+TEST_F(TaskSchedulerTest, TaskTimeoutsAreCountedPerPriorityWhileRunning)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+
+    ThreadPoolScheduler scheduler(2);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto slow = scheduler.submitTask([released]()
+                                     { released.wait(); },
+                                     PacketPriority::HIGH, 20);
+    auto untimed = scheduler.submitTask([released]()
+                                        { released.wait(); },
+                                        PacketPriority::LOW);
+
+    // 两个任务都在执行；带超时的任务在结束前就被计为超时
+    EXPECT_TRUE(waitUntil([&]()
+                          { return scheduler.getActiveTaskCount() == 2; }));
+    EXPECT_TRUE(waitUntil([&]()
+                          { return scheduler.getTimeoutCount(PacketPriority::HIGH) == 1; }));
+    release.set_value();
+    slow.get();
+    untimed.get();
+
+    auto quick = scheduler.submitTask([]() {}, PacketPriority::NORMAL, 1000);
+    quick.get();
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    EXPECT_EQ(scheduler.getTimeoutCount(PacketPriority::HIGH), 1u);
+    EXPECT_EQ(scheduler.getTimeoutCount(PacketPriority::LOW), 0u);
+    EXPECT_EQ(scheduler.getTimeoutCount(PacketPriority::NORMAL), 0u);
+    EXPECT_EQ(scheduler.getActiveTaskCount(), 0u);
+    EXPECT_EQ(scheduler.getTimerCount(), 0u);
+
+    TaskStatistics stats;
+    scheduler.getStatistics(stats);
+    EXPECT_EQ(stats.totalTasksTimeout.load(), 1u);
+    EXPECT_EQ(stats.totalTasksCompleted.load(), 3u);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 等待队列按容量发放信用：按优先级分级准入，满时拒绝并通过背压信号告知上游
+ */
+TEST_F(TaskSchedulerTest, BoundedQueueRejectsByPriorityAndSignalsBackpressure)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+    config.queueCapacity = 4;
+    config.queueFullPolicy = "drop_by_priority";
+    config.schedulingPolicy = "priority";
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+    auto signal = scheduler.getBackpressureSignal();
+    ASSERT_NE(signal, nullptr);
+    EXPECT_EQ(signal->getCapacity(), 4u);
+
+    // 唯一的工作线程被占住，后续任务都留在等待队列中占用信用
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::vector<Future<void>> futures;
+    futures.push_back(scheduler.submitTask([released]()
+                                           { released.wait(); },
+                                           PacketPriority::CRITICAL));
+    ASSERT_TRUE(waitUntil([&]()
+                          { return scheduler.getActiveTaskCount() == 1; }));
+    EXPECT_EQ(signal->getCredits(), 4u);
+
+    auto expectQueueFull = [&](PacketPriority priority)
+    {
+        try
+        {
+            scheduler.submitTask([]() {}, priority);
+            ADD_FAILURE() << "Submission with priority " << static_cast<int>(priority) << " was admitted";
+        }
+        catch (const RadarException &e)
+        {
+            EXPECT_EQ(e.getErrorCode(), TaskSchedulerErrors::TASK_QUEUE_FULL);
+        }
+    };
+
+    // 容量4：低优先级最多占2个，普通/高优先级3个，关键优先级可以占满
+    futures.push_back(scheduler.submitTask([]() {}, PacketPriority::LOW));
+    futures.push_back(scheduler.submitTask([]() {}, PacketPriority::LOW));
+    expectQueueFull(PacketPriority::LOW);
+    futures.push_back(scheduler.submitTask([]() {}, PacketPriority::HIGH));
+    expectQueueFull(PacketPriority::NORMAL);
+    futures.push_back(scheduler.submitTask([]() {}, PacketPriority::CRITICAL));
+    expectQueueFull(PacketPriority::CRITICAL);
+
+    EXPECT_FALSE(signal->hasCredit());
+    EXPECT_FALSE(signal->waitForCredit(std::chrono::milliseconds(5)));
+    EXPECT_FALSE(signal->admitUpstream(BackpressurePolicy::DROP, std::chrono::milliseconds(0)));
+    EXPECT_TRUE(signal->admitUpstream(BackpressurePolicy::THROTTLE, std::chrono::milliseconds(1)));
+
+    SchedulerStatus status = scheduler.getSchedulerStatus();
+    EXPECT_EQ(status.queueCapacity, 4u);
+    EXPECT_DOUBLE_EQ(status.queueOccupancy, 1.0);
+    EXPECT_EQ(status.rejectedTasks, 3u);
+    EXPECT_EQ(scheduler.getRejectionCount(PacketPriority::LOW), 1u);
+    EXPECT_EQ(scheduler.getRejectionCount(PacketPriority::CRITICAL), 1u);
+
+    // 任务出队时归还信用，节流中的上游随之被唤醒
+    std::thread releaser([&release]()
+                         {
+                             std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                             release.set_value(); });
+    EXPECT_TRUE(signal->waitForCredit(std::chrono::milliseconds(5000)));
+    releaser.join();
+    for (auto &future : futures)
+    {
+        future.get();
+    }
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_EQ(signal->getCredits(), 4u);
+    EXPECT_DOUBLE_EQ(scheduler.getSchedulerStatus().queueOccupancy, 0.0);
+
+    // 占住工作线程并排队3个任务，之后按给定方式重启调度器
+    auto fillQueueAndRestart = [&](const std::function<void()> &restart)
+    {
+        std::promise<void> gateRelease;
+        std::shared_future<void> gateReleased = gateRelease.get_future().share();
+        std::vector<Future<void>> queued;
+        auto gate = scheduler.submitTask([gateReleased]()
+                                         { gateReleased.wait(); },
+                                         PacketPriority::CRITICAL);
+        ASSERT_TRUE(waitUntil([&]()
+                              { return scheduler.getActiveTaskCount() == 1; }));
+        for (int i = 0; i < 3; ++i)
+        {
+            queued.push_back(scheduler.submitTask([]() {}, PacketPriority::HIGH));
+        }
+        EXPECT_EQ(signal->getCredits(), 1u);
+
+        // stop()等待执行中的任务结束，排队的任务留在队列中
+        std::thread opener([&gateRelease]()
+                           {
+                               std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                               gateRelease.set_value(); });
+        EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+        opener.join();
+        restart();
+        for (auto &future : queued)
+        {
+            EXPECT_THROW(future.get(), std::exception);
+        }
+    };
+
+    // 清理丢弃的任务归还信用与分级计数：重启后信用完整，高优先级可再占3个
+    fillQueueAndRestart([&]()
+                        {
+                            EXPECT_EQ(scheduler.cleanup(), SystemErrors::SUCCESS);
+                            ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+                            ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS); });
+    EXPECT_EQ(scheduler.getBackpressureSignal(), signal);
+    EXPECT_EQ(signal->getCredits(), 4u);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 停止后直接重新配置：重建队列时取消旧队列中的任务并归还信用
+    fillQueueAndRestart([&]()
+                        { ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS); });
+    EXPECT_EQ(signal->getCredits(), 4u);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    std::promise<void> finalRelease;
+    std::shared_future<void> finalReleased = finalRelease.get_future().share();
+    futures.clear();
+    futures.push_back(scheduler.submitTask([finalReleased]()
+                                           { finalReleased.wait(); },
+                                           PacketPriority::CRITICAL));
+    ASSERT_TRUE(waitUntil([&]()
+                          { return scheduler.getActiveTaskCount() == 1; }));
+    for (int i = 0; i < 3; ++i)
+    {
+        futures.push_back(scheduler.submitTask([]() {}, PacketPriority::HIGH));
+    }
+    expectQueueFull(PacketPriority::HIGH);
+    finalRelease.set_value();
+    for (auto &future : futures)
+    {
+        future.get();
+    }
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_EQ(signal->getCredits(), 4u);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 分片执行的低优先级长任务在检查点让出：关键任务不必等长任务结束，之后长任务从原处继续
+ */
+TEST_F(TaskSchedulerTest, ResumableTaskYieldsToHigherPriorityAtCheckpoints)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+    config.schedulingPolicy = "priority";
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 200个分片、每片约0.5ms的长任务
+    constexpr int CHUNKS = 200;
+    std::atomic<int> chunksDone{0};
+    std::atomic<int> chunksAtUrgent{-1};
+    auto bulk = scheduler.submitResumableTask(
+        [&chunksDone]()
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+            return ++chunksDone == CHUNKS;
+        },
+        PacketPriority::LOW);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return chunksDone.load() > 0; }));
+
+    auto urgent = scheduler.submitTask([&]()
+                                       { chunksAtUrgent = chunksDone.load(); },
+                                       PacketPriority::CRITICAL);
+    urgent.get();
+    bulk.get();
+
+    // 关键任务在长任务中途执行，长任务随后完成全部分片
+    EXPECT_GT(chunksAtUrgent.load(), 0);
+    EXPECT_LT(chunksAtUrgent.load(), CHUNKS);
+    EXPECT_EQ(chunksDone.load(), CHUNKS);
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    EXPECT_EQ(status.preemptions, 1u);
+    EXPECT_GT(status.maxPreemptionLatencyUs, 0u);
+    EXPECT_LT(status.maxPreemptionLatencyUs, 50000u);
+
+    // 检查点不在工作线程上调用时不做任何事
+    EXPECT_FALSE(scheduler.yieldToHigherPriority());
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 延迟直方图的分桶相对误差有界，调度器按工作线程分片记录并在读取时聚合出分位数、
+ *        等待与执行中任务数和截止时间结果
+ */
+TEST_F(TaskSchedulerTest, LatencyHistogramReportsPercentiles)
+{
+    // 每个桶的上界与其中任意值的差不超过该值的1/32
+    for (uint64_t value : {0ull, 1ull, 31ull, 32ull, 33ull, 1000ull, 123456ull, 987654321ull, 1ull << 40})
+    {
+        const size_t index = LatencyHistogram::bucketIndex(value);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        const uint64_t upper = LatencyHistogram::bucketUpperBound(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / LatencyHistogram::SUB_BUCKET_COUNT);
+        EXPECT_EQ(LatencyHistogram::bucketIndex(upper), index);
+    }
+
+    // 1~1000微秒均匀分布，分位数落在真实值的1/32以内
+    LatencyHistogram first;
+    LatencyHistogram second;
+    for (uint64_t us = 1; us <= 1000; ++us)
+    {
+        (us % 2 == 0 ? first : second).record(us * 1000);
+    }
+    LatencyHistogram::Snapshot snapshot;
+    snapshot.add(first);
+    snapshot.add(second);
+    const LatencyPercentiles summary = snapshot.summarize();
+    EXPECT_EQ(summary.count, 1000u);
+    EXPECT_NEAR(summary.meanUs, 500.5, 0.01);
+    EXPECT_NEAR(summary.p50Us, 500.0, 500.0 / 32);
+    EXPECT_NEAR(summary.p90Us, 900.0, 900.0 / 32);
+    EXPECT_NEAR(summary.p99Us, 990.0, 990.0 / 32);
+    EXPECT_NEAR(summary.p999Us, 999.0, 999.0 / 32);
+    EXPECT_DOUBLE_EQ(summary.maxUs, 1000.0);
+
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+
+    ThreadPoolScheduler scheduler(2);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 两个工作线程都被占住时，等待与执行中任务数由提交数和各分片计数聚合得到
+    {
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::atomic<int> held{0};
+        std::vector<Future<void>> blocked;
+        for (int i = 0; i < 2; ++i)
+        {
+            blocked.push_back(scheduler.submitTask([&]()
+                                                   {
+                held++;
+                released.wait(); }));
+        }
+        ASSERT_TRUE(waitUntil([&]()
+                              { return held.load() == 2; }));
+        for (int i = 0; i < 5; ++i)
+        {
+            blocked.push_back(scheduler.submitTask([]() {}));
+        }
+
+        const SchedulerStatus busy = scheduler.getSchedulerStatus();
+        EXPECT_EQ(busy.pendingTasks, 5u);
+        EXPECT_EQ(busy.activeThreads, 2u);
+
+        release.set_value();
+        for (auto &future : blocked)
+        {
+            future.get();
+        }
+        EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+        scheduler.resetStatistics();
+    }
+
+    constexpr int TASKS = 100;
+    std::vector<Future<void>> futures;
+    for (int i = 0; i < TASKS; ++i)
+    {
+        futures.push_back(scheduler.submitTask([i]()
+                                               { std::this_thread::sleep_for(std::chrono::microseconds(i == 0 ? 5000 : 100)); }));
+    }
+    futures.push_back(scheduler.submitTask([]()
+                                           { throw std::runtime_error("failed on purpose"); }));
+    for (auto &future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (const std::exception &)
+        {
+        }
+    }
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    EXPECT_EQ(status.completedTasks, static_cast<uint32_t>(TASKS));
+    EXPECT_EQ(status.failedTasks, 1u);
+    EXPECT_EQ(status.pendingTasks, 0u);
+    EXPECT_EQ(status.activeThreads, 0u);
+    EXPECT_EQ(status.executionLatency.count, static_cast<uint64_t>(TASKS + 1));
+    EXPECT_EQ(status.queueWaitLatency.count, static_cast<uint64_t>(TASKS + 1));
+    EXPECT_GE(status.executionLatency.p50Us, 100.0);
+    EXPECT_LE(status.executionLatency.p50Us, status.executionLatency.p99Us);
+    EXPECT_LE(status.executionLatency.p99Us, status.executionLatency.p999Us);
+    EXPECT_LE(status.executionLatency.p999Us, status.executionLatency.maxUs);
+    EXPECT_GE(status.executionLatency.maxUs, 5000.0);
+
+    // 每个任务都有按优先级延迟预算计算的截止时间
+    TaskStatistics stats;
+    scheduler.getStatistics(stats);
+    EXPECT_EQ(stats.deadlineTasks.load(), static_cast<uint64_t>(TASKS + 1));
+
+    scheduler.resetStatistics();
+    scheduler.getStatistics(stats);
+    EXPECT_EQ(stats.totalTasksCompleted.load(), 0u);
+    EXPECT_EQ(stats.executionLatency.count, 0u);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 以不同线程数重启时旧分片的计数并入共享分片：等待数不虚增，截止时间统计不丢失
+ */
+TEST_F(TaskSchedulerTest, WorkerStatisticsSurviveRestartWithDifferentThreadCount)
+{
+    constexpr int TASKS = 10;
+
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+
+    RealTimeScheduler scheduler;
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+    for (int i = 0; i < TASKS; ++i)
+    {
+        scheduler.submitTask([]() {}).get();
+    }
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+
+    config.coreThreads = 3;
+    config.maxThreads = 3;
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler.getWorkerPoolStatistics().threadCount, 3u);
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    EXPECT_EQ(status.pendingTasks, 0u);
+    EXPECT_EQ(status.activeThreads, 0u);
+    EXPECT_EQ(status.completedTasks, static_cast<uint32_t>(TASKS));
+    EXPECT_EQ(scheduler.waitForAllTasks(300), SystemErrors::SUCCESS);
+
+    TaskStatistics stats;
+    scheduler.getStatistics(stats);
+    EXPECT_EQ(stats.deadlineTasks.load(), static_cast<uint64_t>(TASKS));
+
+    // 重启后的任务照常计数
+    scheduler.submitTask([]() {}).get();
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler.getSchedulerStatus().completedTasks, static_cast<uint32_t>(TASKS + 1));
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 两个租户都繁忙时按权重分配工作线程，一个租户空闲后另一个租户借用全部线程
+ */
+TEST_F(TaskSchedulerTest, FairShareSplitsWorkerPoolByTenantWeight)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+    config.tenants = {TenantConfig{1, "array-a", 3}, TenantConfig{2, "array-b", 1}};
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 先占住唯一的工作线程，两个租户的任务同时积压
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto gate = scheduler.submitTask([released]()
+                                     { released.wait(); });
+    ASSERT_TRUE(waitUntil([&]()
+                          { return scheduler.getActiveTaskCount() == 1; }));
+
+    constexpr int TASKS_PER_TENANT = 120;
+    std::mutex orderMutex;
+    std::vector<TenantId> order;
+    std::vector<Future<void>> futures;
+    for (int i = 0; i < TASKS_PER_TENANT; ++i)
+    {
+        for (TenantId tenant : {TenantId{1}, TenantId{2}})
+        {
+            futures.push_back(scheduler.submitTenantTask(tenant, [tenant, &orderMutex, &order]()
+                                                         {
+                const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(100);
+                while (std::chrono::steady_clock::now() < until)
+                {
+                }
+                std::lock_guard<std::mutex> lock(orderMutex);
+                order.push_back(tenant); }));
+        }
+    }
+    release.set_value();
+    gate.get();
+    for (auto &future : futures)
+    {
+        future.get();
+    }
+
+    // 两者都繁忙的前半段按3:1分配，array-a的任务完成后array-b独占线程
+    ASSERT_EQ(order.size(), static_cast<size_t>(2 * TASKS_PER_TENANT));
+    const auto firstA = std::count(order.begin(), order.begin() + TASKS_PER_TENANT, TenantId{1});
+    EXPECT_GE(firstA, 80);
+    EXPECT_LE(firstA, 100);
+    EXPECT_EQ(order.back(), TenantId{2});
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    ASSERT_EQ(status.tenants.size(), 3u);
+    EXPECT_EQ(status.tenants[0].id, DEFAULT_TENANT);
+    EXPECT_EQ(status.tenants[0].completedTasks, 1u);
+    EXPECT_EQ(status.tenants[1].name, "array-a");
+    EXPECT_DOUBLE_EQ(status.tenants[1].configuredShare, 0.6);
+    EXPECT_EQ(status.tenants[1].completedTasks, static_cast<uint64_t>(TASKS_PER_TENANT));
+    EXPECT_EQ(status.tenants[2].completedTasks, static_cast<uint64_t>(TASKS_PER_TENANT));
+    EXPECT_EQ(status.tenants[2].executionLatency.count, static_cast<uint64_t>(TASKS_PER_TENANT));
+    EXPECT_GT(status.tenants[2].throughputTasksPerSec, 0.0);
+    EXPECT_GT(status.tenants[1].queueWaitLatency.p99Us, 0.0);
+
+    // 运行中调整权重，未配置的租户在设置权重时加入
+    EXPECT_EQ(scheduler.setTenantWeight(2, 0), SystemErrors::INVALID_PARAMETER);
+    EXPECT_EQ(scheduler.setTenantWeight(3, 2), SystemErrors::SUCCESS);
+    scheduler.submitTenantTask(3, []() {}).get();
+    EXPECT_EQ(scheduler.getSchedulerStatus().tenants.size(), 4u);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+namespace
+{
+    /**
+     * @brief 固定服务时间的处理器桩，记录处理过的数据包
+     */
+    class StubProcessor : public IDataProcessor
+    {
+    public:
+        explicit StubProcessor(std::chrono::microseconds serviceTime) : serviceTime_(serviceTime) {}
+
+        ErrorCode configure(const DataProcessorConfig &) override { return SystemErrors::SUCCESS; }
+        ErrorCode processPacket(const RawDataPacketPtr &inputPacket, ProcessingResultPtr &result) override
+        {
+            std::this_thread::sleep_for(serviceTime_);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                sequences_.push_back(inputPacket->sequenceId);
+            }
+            result = std::make_shared<ProcessingResult>();
+            return SystemErrors::SUCCESS;
+        }
+        Future<ProcessingResultPtr> processPacketAsync(const RawDataPacketPtr &) override
+        {
+            return makeFailedFuture<ProcessingResultPtr>(
+                std::make_exception_ptr(std::logic_error("not supported")));
+        }
+        ErrorCode processBatch(const std::vector<RawDataPacketPtr> &, std::vector<ProcessingResultPtr> &) override
+        {
+            return SystemErrors::SUCCESS;
+        }
+        void setProcessingCompleteCallback(ProcessingCompleteCallback) override {}
+        ErrorCode switchStrategy(ProcessingStrategy) override { return SystemErrors::SUCCESS; }
+        ProcessingStrategy getCurrentStrategy() const override { return ProcessingStrategy::CPU_BASIC; }
+        ProcessorCapabilities getCapabilities() const override { return ProcessorCapabilities{}; }
+        size_t getQueueDepth() const override { return reportedDepth_.load(); }
+
+        ErrorCode initialize() override { return SystemErrors::SUCCESS; }
+        ErrorCode start() override { return SystemErrors::SUCCESS; }
+        ErrorCode stop() override { return SystemErrors::SUCCESS; }
+        ErrorCode pause() override { return SystemErrors::SUCCESS; }
+        ErrorCode resume() override { return SystemErrors::SUCCESS; }
+        ErrorCode cleanup() override { return SystemErrors::SUCCESS; }
+        ModuleState getState() const override { return ModuleState::RUNNING; }
+        const std::string &getModuleName() const override { return name_; }
+        void setStateChangeCallback(StateChangeCallback) override {}
+        void setErrorCallback(ErrorCallback) override {}
+        PerformanceMetricsPtr getPerformanceMetrics() const override { return nullptr; }
+
+        std::vector<uint64_t> getSequences() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return sequences_;
+        }
+
+        void setReportedDepth(size_t depth) { reportedDepth_.store(depth); }
+
+    private:
+        std::chrono::microseconds serviceTime_;
+        std::atomic<size_t> reportedDepth_{0};
+        std::string name_{"StubProcessor"};
+        mutable std::mutex mutex_;
+        std::vector<uint64_t> sequences_;
+    };
+
+    RawDataPacketPtr makePacket(uint64_t sequenceId)
+    {
+        auto packet = std::make_shared<RawDataPacket>();
+        packet->sequenceId = sequenceId;
+        packet->priority = PacketPriority::NORMAL;
+        return packet;
+    }
+} // namespace
+
+/**
+ * @brief 负载均衡调度器把数据包派发给预计最早完成的实例，同一亲和键的数据包固定到同一实例
+ */
+TEST_F(TaskSchedulerTest, LoadBalanceSchedulerPrefersFasterInstancesAndKeepsKeysSticky)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 4;
+    config.maxThreads = 4;
+    config.loadBalancePolicy = "jsq";
+
+    auto scheduler = TaskSchedulerFactory::createLoadBalanceScheduler(config);
+    ASSERT_NE(scheduler, nullptr);
+    ASSERT_EQ(scheduler->initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler->start(), SystemErrors::SUCCESS);
+
+    // 没有登记实例时只能使用调用者给出的处理器
+    EXPECT_THROW(scheduler->submitProcessingTask(nullptr, makePacket(0)), std::invalid_argument);
+
+    auto slow = std::make_shared<StubProcessor>(std::chrono::microseconds(4000));
+    auto fast = std::make_shared<StubProcessor>(std::chrono::microseconds(200));
+    ASSERT_EQ(scheduler->addProcessor(slow), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler->addProcessor(fast), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler->addProcessor(fast), SystemErrors::INVALID_PARAMETER);
+    EXPECT_EQ(scheduler->getProcessorCount(), 2u);
+
+    // 分批提交：首批让两个实例都有服务时间，之后的批次大部分派给快实例
+    uint64_t sequence = 0;
+    for (int wave = 0; wave < 10; ++wave)
+    {
+        std::vector<Future<ProcessingResultPtr>> futures;
+        for (int i = 0; i < 8; ++i)
+        {
+            futures.push_back(scheduler->submitProcessingTask(nullptr, makePacket(++sequence)));
+        }
+        for (auto &future : futures)
+        {
+            EXPECT_NE(future.get(), nullptr);
+        }
+    }
+    auto instances = scheduler->getInstanceStatus();
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].completed + instances[1].completed, sequence);
+    EXPECT_EQ(instances[0].inFlight + instances[1].inFlight, 0u);
+    EXPECT_GT(instances[1].completed, 3 * instances[0].completed);
+    EXPECT_GT(instances[0].averageServiceTimeUs, instances[1].averageServiceTimeUs);
+
+    // 按亲和键粘性派发：每个键的数据包只出现在一个实例上
+    scheduler->setLoadBalancePolicy(LoadBalancePolicy::POWER_OF_TWO_CHOICES);
+    scheduler->setAffinityKey([](const RawDataPacket &packet)
+                              { return packet.sequenceId % 4; });
+    const size_t slowBefore = slow->getSequences().size();
+    const size_t fastBefore = fast->getSequences().size();
+    std::vector<Future<ProcessingResultPtr>> futures;
+    for (int i = 0; i < 40; ++i)
+    {
+        futures.push_back(scheduler->submitProcessingTask(nullptr, makePacket(++sequence)));
+    }
+    for (auto &future : futures)
+    {
+        future.get();
+    }
+    std::array<std::set<const StubProcessor *>, 4> owners;
+    for (const StubProcessor *processor : {slow.get(), fast.get()})
+    {
+        const auto sequences = processor->getSequences();
+        const size_t before = processor == slow.get() ? slowBefore : fastBefore;
+        for (size_t i = before; i < sequences.size(); ++i)
+        {
+            owners[sequences[i] % 4].insert(processor);
+        }
+    }
+    for (const auto &owner : owners)
+    {
+        EXPECT_EQ(owner.size(), 1u);
+    }
+    instances = scheduler->getInstanceStatus();
+    EXPECT_EQ(instances[0].stickyKeys + instances[1].stickyKeys, 4u);
+
+    // 注销实例后，固定到它的键改派给剩下的实例
+    ASSERT_EQ(scheduler->removeProcessor(slow), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler->removeProcessor(slow), SystemErrors::INVALID_PARAMETER);
+    for (uint64_t key = 0; key < 4; ++key)
+    {
+        scheduler->submitProcessingTask(nullptr, makePacket(++sequence * 4 + key)).get();
+    }
+    EXPECT_EQ(scheduler->getInstanceStatus().front().stickyKeys, 4u);
+
+    EXPECT_EQ(scheduler->stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 负载均衡调度器避开自报积压深的实例，固定的亲和键数不超过上限
+ */
+TEST_F(TaskSchedulerTest, LoadBalanceSchedulerWeighsReportedDepthAndBoundsStickyKeys)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+    config.loadBalancePolicy = "jsq";
+    config.stickyRouteCapacity = 8;
+
+    auto scheduler = TaskSchedulerFactory::createLoadBalanceScheduler(config);
+    ASSERT_NE(scheduler, nullptr);
+    ASSERT_EQ(scheduler->initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler->start(), SystemErrors::SUCCESS);
+
+    auto busy = std::make_shared<StubProcessor>(std::chrono::microseconds(100));
+    auto idle = std::make_shared<StubProcessor>(std::chrono::microseconds(100));
+    ASSERT_EQ(scheduler->addProcessor(busy), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler->addProcessor(idle), SystemErrors::SUCCESS);
+
+    // 先让两个实例都有服务时间记录
+    uint64_t sequence = 0;
+    scheduler->submitProcessingTask(nullptr, makePacket(++sequence)).get();
+    scheduler->submitProcessingTask(nullptr, makePacket(++sequence)).get();
+    ASSERT_EQ(busy->getSequences().size(), 1u);
+    ASSERT_EQ(idle->getSequences().size(), 1u);
+
+    // 其他提交者在busy上造成的积压对本调度器的在途计数不可见，只能从处理器自报的深度得知
+    busy->setReportedDepth(1000);
+    for (int i = 0; i < 20; ++i)
+    {
+        scheduler->submitProcessingTask(nullptr, makePacket(++sequence)).get();
+    }
+    EXPECT_EQ(busy->getSequences().size(), 1u);
+    EXPECT_EQ(idle->getSequences().size(), 21u);
+    auto instances = scheduler->getInstanceStatus();
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].queueDepth, 1000u);
+    EXPECT_EQ(instances[1].queueDepth, 0u);
+    busy->setReportedDepth(0);
+
+    // 每个数据包一个新键：只保留最近出现的8个键
+    scheduler->setAffinityKey([](const RawDataPacket &packet)
+                              { return packet.sequenceId; });
+    for (int i = 0; i < 32; ++i)
+    {
+        scheduler->submitProcessingTask(nullptr, makePacket(++sequence)).get();
+    }
+    instances = scheduler->getInstanceStatus();
+    EXPECT_EQ(instances[0].stickyKeys + instances[1].stickyKeys, 8u);
+
+    // 调小上限立即淘汰；上限为0时不固定任何键
+    scheduler->setStickyRouteCapacity(2);
+    instances = scheduler->getInstanceStatus();
+    EXPECT_EQ(instances[0].stickyKeys + instances[1].stickyKeys, 2u);
+    scheduler->setStickyRouteCapacity(0);
+    scheduler->submitProcessingTask(nullptr, makePacket(++sequence)).get();
+    instances = scheduler->getInstanceStatus();
+    EXPECT_EQ(instances[0].stickyKeys + instances[1].stickyKeys, 0u);
+
+    EXPECT_EQ(scheduler->stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 小闭包内联保存、大闭包退化为堆分配，只移动的捕获可以保存并随移动转移
+ */
+TEST_F(TaskSchedulerTest, SmallFunctionStoresMoveOnlyCallablesInline)
+{
+    auto owned = std::make_unique<int>(7);
+    SmallFunction<int(), 64> small([value = std::move(owned)]()
+                                   { return *value; });
+    EXPECT_TRUE(small.isInline());
+    EXPECT_EQ(small(), 7);
+
+    SmallFunction<int(), 64> moved(std::move(small));
+    EXPECT_FALSE(static_cast<bool>(small));
+    EXPECT_EQ(moved(), 7);
+
+    std::array<char, 200> payload{};
+    payload[199] = 3;
+    SmallFunction<int(), 64> large([payload]()
+                                   { return static_cast<int>(payload[199]); });
+    EXPECT_FALSE(large.isInline());
+    moved = std::move(large);
+    EXPECT_EQ(moved(), 3);
+
+    moved.reset();
+    EXPECT_FALSE(static_cast<bool>(moved));
+}
+
+/**
+ * @brief 轻量任务通过结果槽报告完成与异常，调度器清理时未执行的任务被丢弃，节点内存被复用
+ */
+TEST_F(TaskSchedulerTest, LightTasksCompleteThroughEmbeddedResultSlot)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+
+    {
+        ThreadPoolScheduler scheduler(2);
+        ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+        ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+        ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+        constexpr int TASKS = 1000;
+        std::atomic<int> executed{0};
+        std::vector<LightTaskFuture> futures;
+        futures.reserve(TASKS);
+        for (int i = 0; i < TASKS; ++i)
+        {
+            futures.push_back(scheduler.submitLightTask([&executed]()
+                                                        { executed.fetch_add(1); }));
+        }
+        EXPECT_EQ(scheduler.postLightTask([&executed]()
+                                          { executed.fetch_add(1); }),
+                  SystemErrors::SUCCESS);
+        for (auto &future : futures)
+        {
+            future.get();
+            EXPECT_FALSE(future.valid());
+        }
+        EXPECT_TRUE(waitUntil([&]()
+                              { return executed.load() == TASKS + 1; }));
+
+        // 句柄释放后节点回到空闲链表，再次提交不再向系统申请内存
+        EXPECT_GT(LightTask::cachedBlockCount(), 0u);
+
+        auto failing = scheduler.submitLightTask([]()
+                                                 { throw std::runtime_error("light task failure"); });
+        EXPECT_TRUE(failing.waitFor(std::chrono::milliseconds(5000)));
+        EXPECT_THROW(failing.get(), std::runtime_error);
+
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        auto blocked = scheduler.submitLightTask([released]()
+                                                 { released.wait(); });
+        release.set_value();
+        blocked.get();
+
+        EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+    }
+
+    // 调度器未启动：任务留在线程池中，销毁时被丢弃，句柄收到异常
+    LightTaskFuture orphan;
+    bool ran = false;
+    {
+        ThreadPoolScheduler scheduler(1);
+        ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+        ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+        orphan = scheduler.submitLightTask([&ran]()
+                                           { ran = true; });
+        EXPECT_FALSE(orphan.isReady());
+    }
+    EXPECT_TRUE(orphan.isReady());
+    EXPECT_THROW(orphan.get(), std::runtime_error);
+    EXPECT_FALSE(ran);
+}
+
+/**
+ * @brief 线程池调度器在固定数量的工作线程上执行任务，FIFO、优先级与EDF策略的future都能完成
+ */
+TEST_F(TaskSchedulerTest, ThreadPoolSchedulerRunsTasksOnFixedWorkers)
+{
+    for (const char *policy : {"fifo", "priority", "edf"})
+    {
+        SCOPED_TRACE(policy);
+
+        TaskSchedulerConfig config;
+        config.coreThreads = 3;
+        config.maxThreads = 3;
+        config.schedulingPolicy = policy;
+
+        ThreadPoolScheduler scheduler(3);
+        ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+        ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+        ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+        std::mutex idsMutex;
+        std::set<std::thread::id> threadIds;
+        std::vector<Future<void>> futures;
+        for (int i = 0; i < 200; ++i)
+        {
+            futures.push_back(scheduler.submitTask([&]()
+                                                   {
+                std::lock_guard<std::mutex> lock(idsMutex);
+                threadIds.insert(std::this_thread::get_id()); },
+                                                   i % 2 ? PacketPriority::HIGH : PacketPriority::LOW));
+        }
+        for (auto &future : futures)
+        {
+            ASSERT_TRUE(future.waitFor(std::chrono::seconds(5)));
+            future.get();
+        }
+
+        EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+        EXPECT_LE(threadIds.size(), 3u);
+        EXPECT_EQ(scheduler.getQueueSize(), 0u);
+
+        TaskStatistics stats;
+        scheduler.getStatistics(stats);
+        EXPECT_EQ(stats.totalTasksCompleted.load(), 200u);
+
+        // 线程池在处理函数返回后才计数
+        EXPECT_TRUE(waitUntil([&]()
+                              { return scheduler.getWorkerPoolStatistics().executed == 200u; }));
+        EXPECT_EQ(scheduler.getWorkerPoolStatistics().threadCount, 3u);
+
+        EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+    }
+}
+
+/**
+ * @brief FIFO策略下任务按提交顺序执行：经注入队列成批取回本地队列后顺序不变
+ */
+TEST_F(TaskSchedulerTest, FifoSchedulerRunsTasksInSubmissionOrder)
+{
+    constexpr int TASK_COUNT = 100;
+
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+    config.schedulingPolicy = "fifo";
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 先占住唯一的工作线程，让后续任务全部在注入队列中排队（超过一次取回的批大小）
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> held{false};
+    auto gate = scheduler.submitTask([&]()
+                                     {
+        held = true;
+        released.wait(); });
+    ASSERT_TRUE(waitUntil([&]()
+                          { return held.load(); }));
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    std::vector<Future<void>> futures;
+    for (int i = 0; i < TASK_COUNT; ++i)
+    {
+        futures.push_back(scheduler.submitTask([&, i]()
+                                               {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(i); }));
+    }
+    release.set_value();
+
+    ASSERT_TRUE(gate.waitFor(std::chrono::seconds(5)));
+    for (auto &future : futures)
+    {
+        ASSERT_TRUE(future.waitFor(std::chrono::seconds(5)));
+    }
+
+    std::vector<int> expected(TASK_COUNT);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(order, expected);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 控制消息不经过等待队列：积压任务之前执行，工作线程空闲或调度器未启动时也会执行
+ */
+TEST_F(TaskSchedulerTest, ControlMessagesRunAheadOfQueuedTasks)
+{
+    constexpr int TASK_COUNT = 50;
+
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+    config.schedulingPolicy = "fifo";
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    EXPECT_EQ(scheduler.postControl(nullptr), SystemErrors::INVALID_PARAMETER);
+
+    // 启动前投递的消息在启动后执行
+    std::atomic<int> applied{0};
+    ASSERT_EQ(scheduler.postControl([&]()
+                                    { applied++; }),
+              SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return applied.load() == 1; }));
+
+    // 唯一的工作线程被占住时积压一批任务，再投递控制消息：它先于所有积压任务执行
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> held{false};
+    auto gate = scheduler.submitTask([&]()
+                                     {
+        held = true;
+        released.wait(); });
+    ASSERT_TRUE(waitUntil([&]()
+                          { return held.load(); }));
+
+    std::atomic<int> completed{0};
+    std::vector<Future<void>> futures;
+    for (int i = 0; i < TASK_COUNT; ++i)
+    {
+        futures.push_back(scheduler.submitTask([&]()
+                                               { completed++; }));
+    }
+    std::atomic<int> completedAtControl{-1};
+    ASSERT_EQ(scheduler.postControl([&]()
+                                    {
+        completedAtControl = completed.load();
+        applied++; }),
+              SystemErrors::SUCCESS);
+    release.set_value();
+
+    ASSERT_TRUE(gate.waitFor(std::chrono::seconds(5)));
+    for (auto &future : futures)
+    {
+        ASSERT_TRUE(future.waitFor(std::chrono::seconds(5)));
+    }
+    EXPECT_EQ(completedAtControl.load(), 0);
+
+    // 工作线程空闲时由轻量任务唤醒
+    ASSERT_EQ(scheduler.postControl([&]()
+                                    { applied++; }),
+              SystemErrors::SUCCESS);
+    ASSERT_TRUE(waitUntil([&]()
+                          { return scheduler.getControlStatistics().applied == 3; }));
+    EXPECT_EQ(applied.load(), 3);
+
+    const ControlLaneStatistics stats = scheduler.getControlStatistics();
+    EXPECT_EQ(stats.posted, 3u);
+    EXPECT_EQ(stats.applied, 3u);
+    EXPECT_EQ(stats.failed, 0u);
+    EXPECT_GE(stats.maxLatencyUs, stats.meanLatencyUs);
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief 任务依赖图按依赖关系释放节点，可逐包重复提交；异常跳过剩余节点，有环的图被拒绝
+ */
+TEST_F(TaskSchedulerTest, TaskGraphReleasesNodesAfterDependencies)
+{
+    constexpr int CHANNELS = 8;
+    constexpr int PACKETS = 100;
+
+    TaskSchedulerConfig config;
+    config.coreThreads = 4;
+    config.maxThreads = 4;
+
+    ThreadPoolScheduler scheduler(4);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 各通道FFT -> 波束形成 -> CFAR；packet是逐包更新的上下文
+    int packet = 0;
+    std::array<std::atomic<int>, CHANNELS> fftPacket{};
+    std::atomic<int> beamformPacket{-1};
+    std::atomic<int> cfarPacket{-1};
+    std::atomic<int> orderViolations{0};
+
+    TaskGraph graph("range-doppler");
+    std::vector<TaskGraph::NodeId> ffts;
+    for (int ch = 0; ch < CHANNELS; ++ch)
+    {
+        ffts.push_back(graph.addNode([&, ch]()
+                                     { fftPacket[ch] = packet; },
+                                     "fft"));
+    }
+    const auto beamform = graph.addNode([&]()
+                                        {
+        for (const auto &done : fftPacket)
+        {
+            if (done.load() != packet)
+            {
+                orderViolations++;
+            }
+        }
+        beamformPacket = packet; },
+                                        "beamform");
+    const auto cfar = graph.addNode([&]()
+                                    {
+        if (beamformPacket.load() != packet)
+        {
+            orderViolations++;
+        }
+        cfarPacket = packet; },
+                                    "cfar");
+    for (const auto id : ffts)
+    {
+        ASSERT_EQ(graph.precede(id, beamform), SystemErrors::SUCCESS);
+    }
+    ASSERT_EQ(graph.precede(beamform, cfar), SystemErrors::SUCCESS);
+    EXPECT_EQ(graph.precede(cfar, cfar), SystemErrors::INVALID_PARAMETER);
+    EXPECT_EQ(graph.validate(), SystemErrors::SUCCESS);
+    EXPECT_EQ(graph.getNodeName(beamform), "beamform");
+
+    for (packet = 1; packet <= PACKETS; ++packet)
+    {
+        auto done = scheduler.submitGraph(graph);
+        ASSERT_TRUE(done.waitFor(std::chrono::seconds(5)));
+        done.get();
+        EXPECT_EQ(cfarPacket.load(), packet);
+    }
+    EXPECT_EQ(orderViolations.load(), 0);
+    EXPECT_EQ(graph.getRunCount(), static_cast<uint64_t>(PACKETS));
+
+    // 执行期间不能修改图，也不能重复提交
+    std::promise<void> gate;
+    std::shared_future<void> gateOpen = gate.get_future().share();
+    TaskGraph blocking("blocking");
+    const auto first = blocking.addNode([gateOpen]()
+                                        { gateOpen.wait(); });
+    std::atomic<bool> skipped{true};
+    const auto second = blocking.addNode([]()
+                                         { throw std::runtime_error("stage failure"); });
+    const auto third = blocking.addNode([&skipped]()
+                                        { skipped = false; });
+    ASSERT_EQ(blocking.precede(first, second), SystemErrors::SUCCESS);
+    ASSERT_EQ(blocking.precede(second, third), SystemErrors::SUCCESS);
+
+    auto failing = scheduler.submitGraph(blocking);
+    EXPECT_TRUE(blocking.isRunning());
+    EXPECT_EQ(blocking.precede(first, third), TaskSchedulerErrors::GRAPH_BUSY);
+    EXPECT_EQ(blocking.addNode([]() {}), TaskGraph::INVALID_NODE);
+    EXPECT_THROW(scheduler.submitGraph(blocking), std::runtime_error);
+    gate.set_value();
+
+    // 第二个节点的异常交给图的Future，第三个节点被跳过
+    ASSERT_TRUE(failing.waitFor(std::chrono::seconds(5)));
+    EXPECT_THROW(failing.get(), std::runtime_error);
+    EXPECT_TRUE(skipped.load());
+    EXPECT_FALSE(blocking.isRunning());
+
+    // 有环的图
+    TaskGraph cyclic("cyclic");
+    const auto a = cyclic.addNode([]() {});
+    const auto b = cyclic.addNode([]() {});
+    ASSERT_EQ(cyclic.precede(a, b), SystemErrors::SUCCESS);
+    ASSERT_EQ(cyclic.precede(b, a), SystemErrors::SUCCESS);
+    EXPECT_EQ(cyclic.validate(), TaskSchedulerErrors::GRAPH_CYCLE);
+    EXPECT_THROW(scheduler.submitGraph(cyclic), std::invalid_argument);
+    EXPECT_FALSE(cyclic.isRunning());
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief Future续体在调度器上执行，回调返回的Future自动展开，whenAll/whenAny组合结果，取消会跳过排队中的任务
+ */
+TEST_F(TaskSchedulerTest, FutureContinuationsComposeOnScheduler)
+{
+    TaskSchedulerConfig config;
+    config.coreThreads = 1;
+    config.maxThreads = 1;
+
+    ThreadPoolScheduler scheduler(1);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    // 有返回值的任务把真实结果交给续体，续体再提交下一级任务
+    auto chained = scheduler.submitTaskWithResult([]()
+                                                  {
+        auto result = std::make_shared<ProcessingResult>();
+        result->sourcePacketId = 7;
+        return result; })
+                       .then(scheduler, [&scheduler](ProcessingResultPtr result)
+                             { return scheduler.submitTaskWithResult([result]()
+                                                                     {
+            result->sourcePacketId *= 6;
+            return result; }); })
+                       .then([](ProcessingResultPtr result)
+                             { return result->sourcePacketId; });
+    ASSERT_TRUE(chained.waitFor(std::chrono::seconds(5)));
+    EXPECT_EQ(chained.get(), 42u);
+
+    // 异常沿续体链传播，中间回调不执行
+    bool skippedCallback = true;
+    auto failing = scheduler.submitTask([]()
+                                        { throw std::runtime_error("task failure"); })
+                       .then([&skippedCallback]()
+                             { skippedCallback = false; });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+    EXPECT_TRUE(skippedCallback);
+
+    std::vector<Future<int>> inputs;
+    for (int i = 0; i < 4; ++i)
+    {
+        inputs.push_back(scheduler.submitTask([]() {}).then([i]()
+                                                           { return i * i; }));
+    }
+    EXPECT_EQ(whenAll(std::move(inputs)).get(), (std::vector<int>{0, 1, 4, 9}));
+
+    std::vector<Future<int>> racers;
+    racers.push_back(makeFailedFuture<int>(std::make_exception_ptr(std::runtime_error("lost"))));
+    racers.push_back(scheduler.submitTask([]() {}).then([]()
+                                                       { return 5; }));
+    EXPECT_EQ(whenAny(std::move(racers)).get(), std::make_pair(size_t(1), 5));
+
+    // 唯一的工作线程被占住时取消排队任务：任务不执行，Future以OPERATION_CANCELLED完成
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto blocker = scheduler.submitTask([released]()
+                                        { released.wait(); });
+    std::atomic<bool> ran{false};
+    auto queued = scheduler.submitTask([&ran]()
+                                       { ran = true; });
+    queued.cancel();
+    EXPECT_TRUE(queued.isCancelled());
+    release.set_value();
+    blocker.get();
+    EXPECT_EQ(scheduler.waitForAllTasks(5000), SystemErrors::SUCCESS);
+    EXPECT_FALSE(ran.load());
+    try
+    {
+        queued.get();
+        FAIL() << "cancelled future should throw";
+    }
+    catch (const ModuleException &e)
+    {
+        EXPECT_EQ(e.getErrorCode(), SystemErrors::OPERATION_CANCELLED);
+    }
+
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+}
+
+/**
+ * @brief CPU列表解析与格式化互逆；调度器工作线程按配置绑核，状态中报告从内核读回的实际放置；
+ *        实时调度策略只由配置开启
+ */
+TEST_F(TaskSchedulerTest, SchedulerReportsWorkerPlacement)
+{
+    std::vector<uint32_t> cpus;
+    ASSERT_TRUE(parseCpuList("0-3,8, 10-11", cpus));
+    EXPECT_EQ(cpus, (std::vector<uint32_t>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(formatCpuList(cpus), "0-3,8,10-11");
+    EXPECT_FALSE(parseCpuList("3-1", cpus));
+    EXPECT_FALSE(parseCpuList("cpu0", cpus));
+
+    const CpuTopology &topology = CpuTopology::instance();
+    const std::vector<uint32_t> &available = topology.getAvailableCpus();
+    ASSERT_FALSE(available.empty());
+    ASSERT_GE(topology.getNumaNodeCount(), 1u);
+
+    // 节点轮转后在节点内按下标选一个CPU
+    ThreadPlacementConfig nodePlacement;
+    nodePlacement.numaNodes = {topology.getNodeOfCpu(available.front())};
+    nodePlacement.pinPerCpu = true;
+    const std::vector<uint32_t> nodeCpus = resolvePlacementCpus(nodePlacement, 0);
+    ASSERT_EQ(nodeCpus.size(), 1u);
+    EXPECT_EQ(topology.getNodeOfCpu(nodeCpus.front()), nodePlacement.numaNodes.front());
+    EXPECT_TRUE(resolvePlacementCpus(ThreadPlacementConfig{}, 3).empty());
+
+    TaskSchedulerConfig config;
+    config.coreThreads = 2;
+    config.maxThreads = 2;
+    config.threadPlacement.cpus.assign(available.begin(), available.begin() + std::min<size_t>(2, available.size()));
+    config.threadPlacement.pinPerCpu = true;
+    config.threadPlacement.realtimePolicy = "fifo";
+    config.threadPlacement.realtimePriority = 1;
+
+    ThreadPoolScheduler scheduler(2);
+    ASSERT_EQ(scheduler.configure(config), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(scheduler.start(), SystemErrors::SUCCESS);
+
+    const SchedulerStatus status = scheduler.getSchedulerStatus();
+    ASSERT_EQ(status.workerPlacement.size(), 2u);
+    for (size_t i = 0; i < status.workerPlacement.size(); ++i)
+    {
+        const ThreadPlacementStatus &placement = status.workerPlacement[i];
+        SCOPED_TRACE(placement.threadName);
+        EXPECT_EQ(placement.cpus,
+                  (std::vector<uint32_t>{config.threadPlacement.cpus[i % config.threadPlacement.cpus.size()]}));
+        EXPECT_EQ(placement.numaNode, topology.getNodeOfCpu(placement.cpus.front()));
+
+        // 没有CAP_SYS_NICE时回退为普通调度，不影响启动
+        if (placement.realtimeFallback)
+        {
+            EXPECT_EQ(placement.schedulingPolicy, "other");
+        }
+        else
+        {
+            EXPECT_EQ(placement.schedulingPolicy, "fifo");
+            EXPECT_EQ(placement.priority, 1);
+        }
+    }
+
+    auto future = scheduler.submitTask([]() {});
+    ASSERT_TRUE(future.waitFor(std::chrono::seconds(5)));
+    future.get();
+    EXPECT_EQ(scheduler.stop(), SystemErrors::SUCCESS);
+
+    // 实时调度器不自行开启实时调度策略，未配置时与其他调度器一样保持普通调度
+    TaskSchedulerConfig realtimeConfig;
+    realtimeConfig.coreThreads = 1;
+    realtimeConfig.maxThreads = 1;
+
+    RealTimeScheduler realtimeScheduler;
+    ASSERT_EQ(realtimeScheduler.configure(realtimeConfig), SystemErrors::SUCCESS);
+    ASSERT_EQ(realtimeScheduler.initialize(), SystemErrors::SUCCESS);
+    ASSERT_EQ(realtimeScheduler.start(), SystemErrors::SUCCESS);
+
+    const SchedulerStatus realtimeStatus = realtimeScheduler.getSchedulerStatus();
+    ASSERT_EQ(realtimeStatus.workerPlacement.size(), 1u);
+    EXPECT_EQ(realtimeStatus.workerPlacement.front().schedulingPolicy, "other");
+    EXPECT_FALSE(realtimeStatus.workerPlacement.front().realtimeFallback);
+    EXPECT_EQ(realtimeScheduler.stop(), SystemErrors::SUCCESS);
+}